@@ -0,0 +1,111 @@
+#include "Benchmark.h"
+#include "Core/Memory/MemoryTracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Benchmarks report heap allocations per item. With CORE_ENABLE_MEMORY_TRACKING the tracker
+// already replaces operator new and its totals are read back; otherwise the bench replaces it
+// here with a counting one.
+#ifdef CORE_ENABLE_MEMORY_TRACKING
+
+namespace Core::Bench
+{
+
+    std::uint64_t GetAllocationCount()
+    {
+        // Reused so that reading the totals does not allocate once it has grown
+        thread_local FMemoryStats Stats;
+        FMemoryTracker::MarkFrame();
+        FMemoryTracker::GetStats(Stats);
+
+        std::uint64_t Count = 0;
+        for (const FMemoryTagStats& Tag : Stats.Tags)
+            Count += Tag.TotalAllocations;
+        return Count;
+    }
+
+}
+
+#else
+
+namespace
+{
+    std::atomic<std::uint64_t> s_AllocationCount{ 0 };
+
+    void* CountedAllocate(std::size_t Size, std::size_t Alignment) noexcept
+    {
+        s_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+        Size = Size > 0 ? Size : 1;
+        if (Alignment <= alignof(std::max_align_t))
+            return std::malloc(Size);
+
+        #if defined(_MSC_VER)
+            return _aligned_malloc(Size, Alignment);
+        #else
+            // aligned_alloc wants a multiple of the alignment
+            return std::aligned_alloc(Alignment, (Size + Alignment - 1) / Alignment * Alignment);
+        #endif
+    }
+
+    void* CountedAllocateOrThrow(std::size_t Size, std::size_t Alignment)
+    {
+        void* Memory = CountedAllocate(Size, Alignment);
+        if (!Memory)
+            throw std::bad_alloc();
+        return Memory;
+    }
+
+    void CountedFree(void* Ptr, std::size_t Alignment) noexcept
+    {
+        #if defined(_MSC_VER)
+            if (Alignment > alignof(std::max_align_t))
+            {
+                _aligned_free(Ptr);
+                return;
+            }
+        #else
+            (void)Alignment;
+        #endif
+        std::free(Ptr);
+    }
+}
+
+namespace Core::Bench
+{
+
+    std::uint64_t GetAllocationCount()
+    {
+        return s_AllocationCount.load(std::memory_order_relaxed);
+    }
+
+}
+
+// --- Global operator new/delete ---
+
+constexpr std::size_t DefaultAlignment = alignof(std::max_align_t);
+
+void* operator new(std::size_t Size) { return CountedAllocateOrThrow(Size, DefaultAlignment); }
+void* operator new[](std::size_t Size) { return CountedAllocateOrThrow(Size, DefaultAlignment); }
+void* operator new(std::size_t Size, std::align_val_t Alignment) { return CountedAllocateOrThrow(Size, static_cast<std::size_t>(Alignment)); }
+void* operator new[](std::size_t Size, std::align_val_t Alignment) { return CountedAllocateOrThrow(Size, static_cast<std::size_t>(Alignment)); }
+void* operator new(std::size_t Size, const std::nothrow_t&) noexcept { return CountedAllocate(Size, DefaultAlignment); }
+void* operator new[](std::size_t Size, const std::nothrow_t&) noexcept { return CountedAllocate(Size, DefaultAlignment); }
+void* operator new(std::size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept { return CountedAllocate(Size, static_cast<std::size_t>(Alignment)); }
+void* operator new[](std::size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept { return CountedAllocate(Size, static_cast<std::size_t>(Alignment)); }
+
+void operator delete(void* Ptr) noexcept { CountedFree(Ptr, DefaultAlignment); }
+void operator delete[](void* Ptr) noexcept { CountedFree(Ptr, DefaultAlignment); }
+void operator delete(void* Ptr, std::size_t) noexcept { CountedFree(Ptr, DefaultAlignment); }
+void operator delete[](void* Ptr, std::size_t) noexcept { CountedFree(Ptr, DefaultAlignment); }
+void operator delete(void* Ptr, std::align_val_t Alignment) noexcept { CountedFree(Ptr, static_cast<std::size_t>(Alignment)); }
+void operator delete[](void* Ptr, std::align_val_t Alignment) noexcept { CountedFree(Ptr, static_cast<std::size_t>(Alignment)); }
+void operator delete(void* Ptr, std::size_t, std::align_val_t Alignment) noexcept { CountedFree(Ptr, static_cast<std::size_t>(Alignment)); }
+void operator delete[](void* Ptr, std::size_t, std::align_val_t Alignment) noexcept { CountedFree(Ptr, static_cast<std::size_t>(Alignment)); }
+void operator delete(void* Ptr, const std::nothrow_t&) noexcept { CountedFree(Ptr, DefaultAlignment); }
+void operator delete[](void* Ptr, const std::nothrow_t&) noexcept { CountedFree(Ptr, DefaultAlignment); }
+void operator delete(void* Ptr, std::align_val_t Alignment, const std::nothrow_t&) noexcept { CountedFree(Ptr, static_cast<std::size_t>(Alignment)); }
+void operator delete[](void* Ptr, std::align_val_t Alignment, const std::nothrow_t&) noexcept { CountedFree(Ptr, static_cast<std::size_t>(Alignment)); }
+
+#endif
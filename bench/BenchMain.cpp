@@ -0,0 +1,183 @@
+#include "Benchmark.h"
+#include "MathParity.h"
+#include "Core/Application/Application.h"
+#include "Core/Application/EntryPoint.h"
+#include "Core/Jobs/JobSystem.h"
+#include "Core/Logging/Log.h"
+
+#include "GLFW/glfw3.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <print>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <sys/resource.h>
+#endif
+
+namespace
+{
+    // The sandbox scene from src/main.cpp, headless. Every other switch goes to the application:
+    // --frames, --duration, --warmup, --fixed-delta, --stats, --max-allocations and the sandbox's
+    // own --cubes, --bounds.
+    int RunScene(int argc, char** argv)
+    {
+        std::vector<char*> Args;
+        Args.push_back(argv[0]);
+        Args.push_back(const_cast<char*>("--headless"));
+        for (int i = 1; i < argc; i++)
+        {
+            if (std::string_view(argv[i]) != "--scene")
+                Args.push_back(argv[i]);
+        }
+        Args.push_back(nullptr);
+
+        Core::FApplication::SetCommandLine(static_cast<int>(Args.size()) - 1, Args.data());
+        auto App = CreateApplication();
+        App->Run();
+        const int ExitCode = App->GetExitCode();
+        App.reset();
+
+        Core::FLog::Shutdown();
+        return ExitCode;
+    }
+
+    // CPU time of every thread in the process so far
+    double GetProcessCpuSeconds()
+    {
+        #ifdef _WIN32
+            FILETIME Creation, Exit, Kernel, User;
+            GetProcessTimes(GetCurrentProcess(), &Creation, &Exit, &Kernel, &User);
+            const auto Seconds = [](const FILETIME& Time)
+            {
+                return static_cast<double>((static_cast<unsigned long long>(Time.dwHighDateTime) << 32) | Time.dwLowDateTime) * 1.0e-7;
+            };
+            return Seconds(Kernel) + Seconds(User);
+        #else
+            rusage Usage{};
+            getrusage(RUSAGE_SELF, &Usage);
+            return static_cast<double>(Usage.ru_utime.tv_sec + Usage.ru_stime.tv_sec) + static_cast<double>(Usage.ru_utime.tv_usec + Usage.ru_stime.tv_usec) * 1.0e-6;
+        #endif
+    }
+
+    // The sandbox scene in its normal window, left alone: after a settling period, the process CPU
+    // time over Seconds is printed and the window closed. Run it once per --power mode to compare
+    // what an idle window costs. Needs a display; don't touch the window while it measures.
+    int RunIdleCpu(int argc, char** argv, double Seconds)
+    {
+        constexpr std::chrono::seconds SettleTime{ 2 };
+
+        // The sandbox defaults to continuous
+        const char* PowerMode = "continuous";
+        std::vector<char*> Args;
+        Args.push_back(argv[0]);
+        for (int i = 1; i < argc; i++)
+        {
+            const std::string_view Arg = argv[i];
+            if (Arg.starts_with("--power="))
+                PowerMode = argv[i] + 8;
+            if (!Arg.starts_with("--idle-cpu="))
+                Args.push_back(argv[i]);
+        }
+        Args.push_back(nullptr);
+
+        Core::FApplication::SetCommandLine(static_cast<int>(Args.size()) - 1, Args.data());
+        auto App = CreateApplication();
+
+        std::mutex StopMutex;
+        std::condition_variable StopCondition;
+        bool bStopped = false;
+        std::thread Sampler([&]()
+        {
+            std::unique_lock Lock(StopMutex);
+            if (StopCondition.wait_for(Lock, SettleTime, [&]() { return bStopped; }))
+                return;
+
+            const double CpuStart = GetProcessCpuSeconds();
+            const auto WallStart = std::chrono::steady_clock::now();
+            if (StopCondition.wait_for(Lock, std::chrono::duration<double>(Seconds), [&]() { return bStopped; }))
+                return;
+
+            const double Cpu = GetProcessCpuSeconds() - CpuStart;
+            const double Wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - WallStart).count();
+            std::println("Idle CPU ({}): {:.3f} s over {:.1f} s, {:.1f}% of one core", PowerMode, Cpu, Wall, 100.0 * Cpu / Wall);
+            std::fflush(stdout);
+
+            Core::FApplication* Target = App.get();
+            App->GetJobSystem().Submit([Target]() { glfwSetWindowShouldClose(Target->GetWindow(), GLFW_TRUE); }, nullptr, Core::EJobAffinity::MainThread);
+        });
+
+        App->Run();
+        {
+            std::lock_guard Lock(StopMutex);
+            bStopped = true;
+        }
+        StopCondition.notify_one();
+        Sampler.join();
+        App.reset();
+
+        Core::FLog::Shutdown();
+        return 0;
+    }
+
+    void PrintUsage()
+    {
+        std::puts(
+            "Usage: raylib_imgui_hybrid_bench [options]\n"
+            "  --filter=TEXT        Only benchmarks whose name contains TEXT\n"
+            "  --json=PATH          Write the results as JSON\n"
+            "  --samples=N          Samples per benchmark (default 15)\n"
+            "  --min-sample-ms=MS   Minimum duration of one sample (default 50)\n"
+            "  --list               List the benchmarks and exit\n"
+            "  --check-math         Check the batch math kernels against raymath and exit\n"
+            "  --scene [...]        Run the sandbox scene headless instead, see --headless\n"
+            "  --idle-cpu=SECONDS [--power=MODE]\n"
+            "                       Measure the CPU time of the sandbox idling in its window");
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Core::Bench::FRunOptions Options;
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string_view Arg = argv[i];
+        if (Arg == "--scene")
+            return RunScene(argc, argv);
+        if (Arg == "--check-math")
+            return Core::Bench::RunMathParityCheck();
+        if (Arg.starts_with("--idle-cpu="))
+            return RunIdleCpu(argc, argv, std::max(std::atof(argv[i] + 11), 1.0));
+
+        if (Arg.starts_with("--filter="))
+            Options.Filter = Arg.substr(9);
+        else if (Arg.starts_with("--json="))
+            Options.JsonPath = Arg.substr(7);
+        else if (Arg.starts_with("--samples="))
+            Options.Settings.Samples = std::max(std::atoi(argv[i] + 10), 1);
+        else if (Arg.starts_with("--min-sample-ms="))
+            Options.Settings.MinSampleSeconds = std::max(std::atof(argv[i] + 16), 1.0) / 1000.0;
+        else if (Arg == "--list")
+            Options.bListOnly = true;
+        else
+        {
+            PrintUsage();
+            return Arg == "--help" ? 0 : 1;
+        }
+    }
+
+    const int Result = Core::Bench::RunBenchmarks(Options);
+    Core::FLog::Shutdown();
+    return Result;
+}
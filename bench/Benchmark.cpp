@@ -0,0 +1,273 @@
+#include "Benchmark.h"
+#include "Core/Math/BatchMath.h"
+
+#include <glad/glad.h>
+#include "GLFW/glfw3.h"
+
+#include <cmath>
+#include <cstdio>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <thread>
+
+#include "raymath.h"
+
+extern "C"
+{
+    #include "rlgl.h"
+}
+
+namespace Core::Bench
+{
+
+    namespace
+    {
+        struct FBenchmarkEntry
+        {
+            std::string Name;
+            FBenchmarkFunction Function = nullptr;
+            std::int64_t Arg = 0;
+        };
+
+        std::vector<FBenchmarkEntry>& GetRegistry()
+        {
+            static std::vector<FBenchmarkEntry> Registry;
+            return Registry;
+        }
+
+        constexpr int GLWidth = 1280;
+        constexpr int GLHeight = 720;
+
+        struct FGLContext
+        {
+            GLFWwindow* Window = nullptr;
+            bool bAttempted = false;
+            std::string Renderer = "none";
+        };
+
+        FGLContext s_GL;
+
+        bool CreateGLContext()
+        {
+            bool bInitialized = glfwInit();
+            if (!bInitialized)
+            {
+                // No display server, as on build machines: OSMesa on GLFW's null platform
+                glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+                bInitialized = glfwInit();
+            }
+            if (!bInitialized)
+                return false;
+
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+            glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+            #if __APPLE__
+                glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+            #endif
+            glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+            if (glfwGetPlatform() == GLFW_PLATFORM_NULL)
+            {
+                glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+            }
+
+            s_GL.Window = glfwCreateWindow(GLWidth, GLHeight, "Benchmarks", nullptr, nullptr);
+            if (!s_GL.Window)
+            {
+                glfwTerminate();
+                return false;
+            }
+
+            glfwMakeContextCurrent(s_GL.Window);
+            glfwSwapInterval(0);
+            rlLoadExtensions((void*)glfwGetProcAddress);
+            rlglInit(GLWidth, GLHeight);
+
+            const char* Renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+            s_GL.Renderer = Renderer ? Renderer : "unknown";
+            return true;
+        }
+
+        void DestroyGLContext()
+        {
+            if (!s_GL.Window)
+                return;
+
+            rlglClose();
+            glfwDestroyWindow(s_GL.Window);
+            glfwTerminate();
+            s_GL.Window = nullptr;
+        }
+
+        void AppendJsonString(std::string& Out, std::string_view Text)
+        {
+            Out += '"';
+            for (const char Char : Text)
+            {
+                if (Char == '"' || Char == '\\')
+                    Out += '\\';
+                Out += Char;
+            }
+            Out += '"';
+        }
+    }
+
+    void FState::SetCounter(std::string Name, double Value)
+    {
+        for (auto& [Key, Existing] : Counters)
+        {
+            if (Key == Name)
+            {
+                Existing = Value;
+                return;
+            }
+        }
+        Counters.emplace_back(std::move(Name), Value);
+    }
+
+    bool FState::RequireGL()
+    {
+        if (!s_GL.bAttempted)
+        {
+            s_GL.bAttempted = true;
+            CreateGLContext();
+        }
+        if (!s_GL.Window)
+        {
+            Skip("no OpenGL 3.3 context");
+            return false;
+        }
+
+        // Every benchmark starts from the same state
+        rlDrawRenderBatchActive();
+        rlViewport(0, 0, GLWidth, GLHeight);
+        rlSetMatrixProjection(MatrixPerspective(45.0 * DEG2RAD, static_cast<double>(GLWidth) / GLHeight, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR));
+        rlSetMatrixModelview(MatrixLookAt({ 30.0f, 30.0f, 30.0f }, { 0.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }));
+        rlEnableDepthTest();
+        rlClearColor(0, 0, 0, 255);
+        rlClearScreenBuffers();
+        return true;
+    }
+
+    GLFWwindow* FState::GetWindow() const
+    {
+        return s_GL.Window;
+    }
+
+    FBenchmarkRegistration::FBenchmarkRegistration(const char* Name, FBenchmarkFunction Function, std::vector<std::int64_t> Args)
+    {
+        std::vector<FBenchmarkEntry>& Registry = GetRegistry();
+        if (Args.empty())
+        {
+            Registry.push_back({ Name, Function, 0 });
+            return;
+        }
+
+        for (const std::int64_t Arg : Args)
+        {
+            Registry.push_back({ std::format("{}/{}", Name, Arg), Function, Arg });
+        }
+    }
+
+    int RunBenchmarks(const FRunOptions& Options)
+    {
+        std::vector<FBenchmarkEntry> Entries;
+        for (const FBenchmarkEntry& Entry : GetRegistry())
+        {
+            if (Options.Filter.empty() || Entry.Name.find(Options.Filter) != std::string::npos)
+                Entries.push_back(Entry);
+        }
+        // Registration order depends on link order; name order keeps groups together
+        std::stable_sort(Entries.begin(), Entries.end(), [](const FBenchmarkEntry& A, const FBenchmarkEntry& B) { return A.Name < B.Name; });
+
+        if (Options.bListOnly)
+        {
+            for (const FBenchmarkEntry& Entry : Entries)
+                std::puts(Entry.Name.c_str());
+            return 0;
+        }
+
+        std::fputs(std::format("{:<52} {:>14} {:>8} {:>12}\n", "Benchmark", "ns/item", "+-%", "iterations").c_str(), stdout);
+
+        std::string Results;
+        for (const FBenchmarkEntry& Entry : Entries)
+        {
+            std::fflush(stdout);
+
+            FState State(Entry.Arg, Options.Settings);
+            Entry.Function(State);
+
+            if (!State.GetSkipReason().empty() || State.GetSamples().empty())
+            {
+                const std::string Reason = State.GetSkipReason().empty() ? "nothing measured" : State.GetSkipReason();
+                std::fputs(std::format("{:<52} skipped: {}\n", Entry.Name, Reason).c_str(), stdout);
+                continue;
+            }
+
+            std::vector<double> Sorted = State.GetSamples();
+            std::sort(Sorted.begin(), Sorted.end());
+            const double Count = static_cast<double>(Sorted.size());
+            const double Mean = std::accumulate(Sorted.begin(), Sorted.end(), 0.0) / Count;
+            const std::size_t Middle = Sorted.size() / 2;
+            const double Median = Sorted.size() % 2 ? Sorted[Middle] : 0.5 * (Sorted[Middle - 1] + Sorted[Middle]);
+            double SquaredDeviations = 0.0;
+            for (const double Sample : Sorted)
+                SquaredDeviations += (Sample - Mean) * (Sample - Mean);
+            const double StdDev = Sorted.size() > 1 ? std::sqrt(SquaredDeviations / (Count - 1.0)) : 0.0;
+
+            std::string Line = std::format("{:<52} {:>14.3f} {:>7.1f}% {:>12}", Entry.Name, Median, Mean > 0.0 ? 100.0 * StdDev / Mean : 0.0, State.GetIterations());
+            for (const auto& [Name, Value] : State.GetCounters())
+                std::format_to(std::back_inserter(Line), "  {}={}", Name, Value);
+            Line += '\n';
+            std::fputs(Line.c_str(), stdout);
+
+            Results += Results.empty() ? "\n    {" : ",\n    {";
+            Results += "\"name\": ";
+            AppendJsonString(Results, Entry.Name);
+            std::format_to(std::back_inserter(Results),
+                ", \"unit\": \"ns\", \"items_per_op\": {}, \"iterations\": {}, \"median\": {:.4f}, \"mean\": {:.4f}, \"stddev\": {:.4f}, \"min\": {:.4f}, \"counters\": {{",
+                State.GetItemsPerOp(), State.GetIterations(), Median, Mean, StdDev, Sorted.front());
+            for (std::size_t Index = 0; Index < State.GetCounters().size(); Index++)
+            {
+                const auto& [Name, Value] = State.GetCounters()[Index];
+                if (Index > 0)
+                    Results += ", ";
+                AppendJsonString(Results, Name);
+                std::format_to(std::back_inserter(Results), ": {}", Value);
+            }
+            Results += "}, \"samples\": [";
+            for (std::size_t Index = 0; Index < State.GetSamples().size(); Index++)
+            {
+                std::format_to(std::back_inserter(Results), "{}{:.4f}", Index > 0 ? ", " : "", State.GetSamples()[Index]);
+            }
+            Results += "]}";
+        }
+
+        const std::string Renderer = s_GL.Renderer;
+        DestroyGLContext();
+
+        if (Options.JsonPath.empty())
+            return 0;
+
+        std::string Json = "{\n  \"context\": {";
+        Json += "\"renderer\": ";
+        AppendJsonString(Json, Renderer);
+        std::format_to(std::back_inserter(Json), ", \"simd\": \"{}\", \"hardware_threads\": {}, \"samples\": {}, \"min_sample_seconds\": {}}},\n",
+            Math::GetSimdBackendName(), std::thread::hardware_concurrency(), Options.Settings.Samples, Options.Settings.MinSampleSeconds);
+        Json += "  \"benchmarks\": [";
+        Json += Results;
+        Json += "\n  ]\n}\n";
+
+        std::ofstream File(Options.JsonPath, std::ios::binary);
+        File.write(Json.data(), static_cast<std::streamsize>(Json.size()));
+        if (!File)
+        {
+            std::fputs(std::format("Failed to write {}\n", Options.JsonPath).c_str(), stderr);
+            return 1;
+        }
+        return 0;
+    }
+
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+struct GLFWwindow;
+
+namespace Core::Bench
+{
+
+    // Keeps the compiler from discarding Value and the work that produced it
+    template<typename T>
+    inline void DoNotOptimize(const T& Value)
+    {
+        #if defined(_MSC_VER) && !defined(__clang__)
+            const volatile char Sink = *reinterpret_cast<const volatile char*>(&Value);
+            (void)Sink;
+            _ReadWriteBarrier();
+        #else
+            asm volatile("" : : "r,m"(Value) : "memory");
+        #endif
+    }
+
+    // Heap allocations made so far by any thread (bench/AllocationCounter.cpp)
+    [[nodiscard]] std::uint64_t GetAllocationCount();
+
+    struct FSettings
+    {
+        // Samples recorded per benchmark, after calibration
+        int Samples = 15;
+        // Each sample repeats the operation until it takes at least this long
+        double MinSampleSeconds = 0.05;
+    };
+
+    // Handed to every benchmark function. The function sets up its data, calls Run once with the
+    // operation to time, then tears down; setup and teardown are not timed.
+    class FState
+    {
+    public:
+        FState(std::int64_t InArg, const FSettings& InSettings)
+            : Arg(InArg), Settings(InSettings)
+        {
+        }
+
+        // The registered argument, e.g. an item count; 0 without one
+        [[nodiscard]] std::int64_t GetArg() const { return Arg; }
+
+        // Items one call of the operation processes; results are reported per item
+        void SetItemsPerOp(std::uint64_t Items) { ItemsPerOp = std::max<std::uint64_t>(Items, 1); }
+        // Caps the sample count for operations too slow for the default
+        void SetMaxSamples(int Samples) { Settings.Samples = std::clamp(Samples, 1, Settings.Samples); }
+        // Reported with the result, e.g. draw calls of the last operation
+        void SetCounter(std::string Name, double Value);
+
+        // Makes a GL 3.3 context with rlgl current on this thread: a hidden window created once
+        // and shared by every benchmark. Without one the benchmark is skipped and this returns
+        // false. Viewport and matrices are reset to a 3D view of the origin.
+        [[nodiscard]] bool RequireGL();
+        // The hidden window behind that context, after RequireGL returned true
+        [[nodiscard]] GLFWwindow* GetWindow() const;
+        void Skip(std::string Reason) { SkipReason = std::move(Reason); }
+
+        // Times Op, called over and over: calibrates how many calls make a sample of at least
+        // FSettings::MinSampleSeconds, then records the samples. EndSample runs at the end of every
+        // sample inside the timing, e.g. glFinish so that queued GPU work is counted. Heap
+        // allocations during the samples are reported as the "allocs_per_item" counter.
+        template<typename FOp>
+        void Run(FOp&& Op)
+        {
+            Run(Op, []() {});
+        }
+
+        template<typename FOp, typename FEndSample>
+        void Run(FOp&& Op, FEndSample&& EndSample);
+
+        // Results, nanoseconds per item
+        [[nodiscard]] const std::vector<double>& GetSamples() const { return SampleNs; }
+        [[nodiscard]] std::uint64_t GetIterations() const { return Iterations; }
+        [[nodiscard]] std::uint64_t GetItemsPerOp() const { return ItemsPerOp; }
+        [[nodiscard]] const std::vector<std::pair<std::string, double>>& GetCounters() const { return Counters; }
+        [[nodiscard]] const std::string& GetSkipReason() const { return SkipReason; }
+
+    private:
+        std::int64_t Arg = 0;
+        FSettings Settings;
+
+        std::uint64_t ItemsPerOp = 1;
+        std::uint64_t Iterations = 0;
+        std::vector<double> SampleNs;
+        std::vector<std::pair<std::string, double>> Counters;
+        std::string SkipReason;
+    };
+
+    template<typename FOp, typename FEndSample>
+    void FState::Run(FOp&& Op, FEndSample&& EndSample)
+    {
+        using FClock = std::chrono::steady_clock;
+        const auto Measure = [&](std::uint64_t Count)
+        {
+            const FClock::time_point Start = FClock::now();
+            for (std::uint64_t Index = 0; Index < Count; Index++)
+            {
+                Op();
+            }
+            EndSample();
+            return std::chrono::duration<double>(FClock::now() - Start).count();
+        };
+
+        // Calibration doubles as warmup: caches, allocations and lazily created GL objects
+        std::uint64_t Count = 1;
+        double Seconds = Measure(Count);
+        while (Seconds < Settings.MinSampleSeconds)
+        {
+            const double Scale = Seconds > 0.0 ? 1.2 * Settings.MinSampleSeconds / Seconds : 10.0;
+            Count = std::max(Count + 1, static_cast<std::uint64_t>(static_cast<double>(Count) * std::min(Scale, 10.0)));
+            Seconds = Measure(Count);
+        }
+
+        Iterations = Count;
+        SampleNs.clear();
+        SampleNs.reserve(static_cast<std::size_t>(Settings.Samples));
+        const std::uint64_t AllocationsBefore = GetAllocationCount();
+        for (int Sample = 0; Sample < Settings.Samples; Sample++)
+        {
+            SampleNs.push_back(Measure(Count) * 1.0e9 / static_cast<double>(Count * ItemsPerOp));
+        }
+        const std::uint64_t Allocations = GetAllocationCount() - AllocationsBefore;
+        SetCounter("allocs_per_item", static_cast<double>(Allocations) / static_cast<double>(Count * ItemsPerOp * static_cast<std::uint64_t>(Settings.Samples)));
+    }
+
+    using FBenchmarkFunction = void(*)(FState&);
+
+    // Registers Function under Name, once per argument ("Name/Arg"), or once without
+    struct FBenchmarkRegistration
+    {
+        FBenchmarkRegistration(const char* Name, FBenchmarkFunction Function, std::vector<std::int64_t> Args = {});
+    };
+
+    struct FRunOptions
+    {
+        FSettings Settings;
+        // Only benchmarks whose name contains it
+        std::string Filter;
+        // Results are written here as JSON; empty writes nothing
+        std::string JsonPath;
+        bool bListOnly = false;
+    };
+
+    // Runs the registered benchmarks in name order and prints a line for each. Returns the
+    // process exit code.
+    int RunBenchmarks(const FRunOptions& Options);
+
+}
+
+#define CORE_BENCH_CONCAT_INNER(a, b) a##b
+#define CORE_BENCH_CONCAT(a, b) CORE_BENCH_CONCAT_INNER(a, b)
+
+// CORE_BENCHMARK(Function, "Group/Name") or CORE_BENCHMARK(Function, "Group/Name", 100, 10000)
+#define CORE_BENCHMARK(Function, Name, ...) \
+    static const ::Core::Bench::FBenchmarkRegistration CORE_BENCH_CONCAT(BenchmarkRegistration_, __LINE__)(Name, Function, { __VA_ARGS__ })
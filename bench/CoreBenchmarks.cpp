@@ -0,0 +1,128 @@
+#include "Benchmark.h"
+#include "Core/Input/Input.h"
+#include "Core/Logging/Log.h"
+#include "Core/Logging/LogSink.h"
+#include "Core/Profiling/Profiler.h"
+
+#include "GLFW/glfw3.h"
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+namespace Core::Bench
+{
+
+    namespace
+    {
+        // Counts what reaches it, so the logger's own cost is measured without console output
+        class FNullLogSink : public FLogSink
+        {
+        public:
+            void Write(const FLog::FRecord& Record) override { Bytes += Record.Length; }
+
+            std::uint64_t Bytes = 0;
+        };
+    }
+
+    // Sustained throughput: the producer formats into its ring and blocks whenever the flusher
+    // falls behind, and every sample waits until its messages reached the sink
+    static void LogThroughput(FState& State)
+    {
+        const Ref<FNullLogSink> Sink = CreateRef<FNullLogSink>();
+        FLog::Flush();
+        FLog::RemoveAllSinks();
+        FLog::AddSink(Sink);
+        FLog::SetOverflowPolicy(FLog::EOverflowPolicy::Block);
+
+        std::uint64_t Index = 0;
+        State.Run([&]()
+        {
+            FLog::Warn("Entity {} moved to ({:.2f}, {:.2f}) in cell {}", Index, Index * 0.5f, Index * 0.25f, Index % 64);
+            Index++;
+        },
+        []()
+        {
+            FLog::Flush();
+        });
+
+        FLog::RemoveAllSinks();
+        FLog::AddSink(CreateRef<FStdoutLogSink>());
+        FLog::SetOverflowPolicy(FLog::EOverflowPolicy::Drop);
+        DoNotOptimize(Sink->Bytes);
+    }
+    CORE_BENCHMARK(LogThroughput, "Log/Throughput");
+
+    namespace
+    {
+        // What a sandbox frame typically asks: WASD, space, shift, control, escape, a button and the cursor
+        constexpr std::array<int, 8> QueriedKeys = { 87, 65, 83, 68, 32, 340, 341, 256 };
+    }
+
+    // FInput before the per-frame snapshot: every query asked GLFW for the window's current state
+    static void InputQueriesGLFW(FState& State)
+    {
+        if (!State.RequireGL())
+            return;
+
+        GLFWwindow* Window = State.GetWindow();
+        State.SetItemsPerOp(QueriedKeys.size() + 2);
+
+        State.Run([&]()
+        {
+            int Pressed = 0;
+            for (const int Key : QueriedKeys)
+            {
+                const int KeyState = glfwGetKey(Window, Key);
+                Pressed += KeyState == GLFW_PRESS || KeyState == GLFW_REPEAT ? 1 : 0;
+            }
+            Pressed += glfwGetMouseButton(Window, 0) == GLFW_PRESS ? 1 : 0;
+            double X, Y;
+            glfwGetCursorPos(Window, &X, &Y);
+            const std::pair<float, float> Mouse = { static_cast<float>(X), static_cast<float>(Y) };
+            DoNotOptimize(Pressed);
+            DoNotOptimize(Mouse);
+        });
+    }
+    CORE_BENCHMARK(InputQueriesGLFW, "Input/Queries GLFW");
+
+    static void InputQueriesSnapshot(FState& State)
+    {
+        State.SetItemsPerOp(QueriedKeys.size() + 2);
+
+        State.Run([&]()
+        {
+            int Pressed = 0;
+            for (const int Key : QueriedKeys)
+                Pressed += FInput::IsKeyPressed(Key) ? 1 : 0;
+            Pressed += FInput::IsMouseButtonPressed(0) ? 1 : 0;
+            const std::pair<float, float> Mouse = FInput::GetMousePosition();
+            DoNotOptimize(Pressed);
+            DoNotOptimize(Mouse);
+        });
+    }
+    CORE_BENCHMARK(InputQueriesSnapshot, "Input/Queries snapshot");
+
+    #ifdef CORE_ENABLE_PROFILING
+    // A frame's worth of nested zones, then the collection MarkFrame does once per frame
+    static void ProfilerZones(FState& State)
+    {
+        constexpr int ZoneCount = 1000;
+        State.SetItemsPerOp(ZoneCount);
+
+        State.Run([&]()
+        {
+            for (int Index = 0; Index < ZoneCount / 2; Index++)
+            {
+                CORE_PROFILE_SCOPE("Outer");
+                {
+                    CORE_PROFILE_SCOPE("Inner");
+                }
+            }
+            CORE_PROFILE_FRAME();
+        });
+    }
+    CORE_BENCHMARK(ProfilerZones, "Profiler/Zones");
+    #endif
+
+}
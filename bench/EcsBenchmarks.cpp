@@ -0,0 +1,142 @@
+#include "Benchmark.h"
+#include "Core/ECS/World.h"
+#include "Core/Jobs/JobSystem.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace Core::Bench
+{
+
+    namespace
+    {
+        struct FBenchPosition
+        {
+            float X = 0.0f;
+            float Y = 0.0f;
+            float Z = 0.0f;
+        };
+
+        struct FBenchVelocity
+        {
+            float X = 1.0f;
+            float Y = 0.5f;
+            float Z = 0.25f;
+        };
+
+        struct FBenchHealth
+        {
+            int Value = 100;
+        };
+
+        struct FBenchSleeping {};
+
+        constexpr std::size_t IterationEntities = 1'000'000;
+        constexpr float StepSeconds = 1.0f / 60.0f;
+
+        void CreateMovingEntities(FWorld& World, std::size_t Count)
+        {
+            for (std::size_t Index = 0; Index < Count; Index++)
+            {
+                World.CreateEntity(FBenchPosition{ static_cast<float>(Index), 0.0f, 0.0f }, FBenchVelocity{});
+            }
+        }
+    }
+
+    static void EcsEach(FState& State)
+    {
+        FWorld World;
+        CreateMovingEntities(World, IterationEntities);
+        TQuery<FBenchPosition, const FBenchVelocity> Query;
+        State.SetItemsPerOp(IterationEntities);
+        State.SetMaxSamples(10);
+
+        State.Run([&]()
+        {
+            Query.Each(World, [](FBenchPosition& Position, const FBenchVelocity& Velocity)
+            {
+                Position.X += Velocity.X * StepSeconds;
+                Position.Y += Velocity.Y * StepSeconds;
+                Position.Z += Velocity.Z * StepSeconds;
+            });
+        });
+    }
+    CORE_BENCHMARK(EcsEach, "ECS/Each 1M");
+
+    static void EcsEachChunk(FState& State)
+    {
+        FWorld World;
+        CreateMovingEntities(World, IterationEntities);
+        TQuery<FBenchPosition, const FBenchVelocity> Query;
+        State.SetItemsPerOp(IterationEntities);
+        State.SetMaxSamples(10);
+
+        State.Run([&]()
+        {
+            Query.EachChunk(World, [](std::size_t Count, const FEntity*, FBenchPosition* Positions, const FBenchVelocity* Velocities)
+            {
+                for (std::size_t Index = 0; Index < Count; Index++)
+                {
+                    Positions[Index].X += Velocities[Index].X * StepSeconds;
+                    Positions[Index].Y += Velocities[Index].Y * StepSeconds;
+                    Positions[Index].Z += Velocities[Index].Z * StepSeconds;
+                }
+            });
+        });
+    }
+    CORE_BENCHMARK(EcsEachChunk, "ECS/EachChunk 1M");
+
+    static void EcsParallelEach(FState& State)
+    {
+        FJobSystem JobSystem;
+        FWorld World;
+        CreateMovingEntities(World, IterationEntities);
+        TQuery<FBenchPosition, const FBenchVelocity> Query;
+        State.SetItemsPerOp(IterationEntities);
+        State.SetMaxSamples(10);
+
+        State.Run([&]()
+        {
+            Query.ParallelEach(World, JobSystem, [](FBenchPosition& Position, const FBenchVelocity& Velocity)
+            {
+                Position.X += Velocity.X * StepSeconds;
+                Position.Y += Velocity.Y * StepSeconds;
+                Position.Z += Velocity.Z * StepSeconds;
+            });
+        });
+    }
+    CORE_BENCHMARK(EcsParallelEach, "ECS/ParallelEach 1M");
+
+    // Structural changes: every entity is created, moved to another archetype twice, and destroyed
+    static void EcsChurn(FState& State)
+    {
+        constexpr std::size_t BatchSize = 1024;
+        FWorld World;
+        // A populated world, so the churned entities share archetypes with resident ones
+        CreateMovingEntities(World, 100'000);
+
+        std::vector<FEntity> Entities;
+        Entities.reserve(BatchSize);
+        State.SetItemsPerOp(BatchSize);
+
+        State.Run([&]()
+        {
+            for (std::size_t Index = 0; Index < BatchSize; Index++)
+            {
+                Entities.push_back(World.CreateEntity(FBenchPosition{}, FBenchVelocity{}));
+            }
+            for (const FEntity Entity : Entities)
+            {
+                World.AddComponent<FBenchHealth>(Entity);
+                World.AddComponent<FBenchSleeping>(Entity);
+            }
+            for (const FEntity Entity : Entities)
+            {
+                World.DestroyEntity(Entity);
+            }
+            Entities.clear();
+        });
+    }
+    CORE_BENCHMARK(EcsChurn, "ECS/Churn");
+
+}
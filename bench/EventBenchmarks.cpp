@@ -0,0 +1,261 @@
+#include "Benchmark.h"
+#include "Core/Events/Event.h"
+#include "Core/Layers/LayerStack.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Core::Bench
+{
+
+    namespace
+    {
+        // A mix of catch-all layers and input- or application-only ones, like the built-in overlays
+        constexpr std::array<int, 3> LayerMasks = { EventCategoryAll, EventCategoryInput | EventCategoryKeyboard | EventCategoryMouse, EventCategoryApplication };
+
+        class FCountingLayer : public FLayer
+        {
+        public:
+            explicit FCountingLayer(int Mask)
+                : FLayer("Counting")
+            {
+                SetEventCategoryMask(Mask);
+            }
+
+            void OnEvent(FEvent& InEvent) override
+            {
+                FEventDispatcher Dispatcher(InEvent);
+                Dispatcher.Dispatch<FKeyPressedEvent>([this](FKeyPressedEvent&) { Handled++; return false; });
+                Dispatcher.Dispatch<FMouseMovedEvent>([this](FMouseMovedEvent&) { Handled++; return false; });
+                Dispatcher.Dispatch<FWindowResizeEvent>([this](FWindowResizeEvent&) { Handled++; return false; });
+            }
+
+            std::uint64_t Handled = 0;
+        };
+
+        // Formats every event it sees, like an event log or console layer
+        class FEventLogLayer : public FLayer
+        {
+        public:
+            FEventLogLayer()
+                : FLayer("Event Log")
+            {
+            }
+
+            void OnEvent(FEvent& InEvent) override
+            {
+                const char* End = InEvent.FormatTo(Line.data());
+                Length = static_cast<std::size_t>(End - Line.data());
+            }
+
+            std::array<char, 128> Line{};
+            std::size_t Length = 0;
+        };
+
+        // FApplication::OnEvent's walk down the stack: overlays first, skipping layers whose category
+        // mask does not match, until a layer handles the event
+        void DispatchThroughStack(FLayerStack& Stack, FEvent& Event)
+        {
+            const int Categories = Event.GetCategoryFlags();
+            for (auto It = Stack.rbegin(); It != Stack.rend(); ++It)
+            {
+                if (Event.bHandled)
+                    break;
+                if (((*It)->GetEventCategoryMask() & Categories) == 0)
+                    continue;
+                (*It)->OnEvent(Event);
+            }
+        }
+    }
+
+    namespace Legacy
+    {
+        // The event system before value-type events: a virtual hierarchy, a virtual GetEventType call
+        // per Dispatch, ToString through std::stringstream and no category masks on layers
+
+        class FEvent
+        {
+        public:
+            virtual ~FEvent() = default;
+
+            bool bHandled = false;
+
+            [[nodiscard]] virtual EEventType GetEventType() const = 0;
+            [[nodiscard]] virtual const char* GetName() const = 0;
+            [[nodiscard]] virtual int GetCategoryFlags() const = 0;
+            [[nodiscard]] virtual std::string ToString() const { return GetName(); }
+        };
+
+        class FMouseMovedEvent : public FEvent
+        {
+        public:
+            FMouseMovedEvent(float InX, float InY)
+                : MouseX(InX), MouseY(InY) {}
+
+            [[nodiscard]] std::string ToString() const override
+            {
+                std::stringstream ss;
+                ss << "MouseMovedEvent: " << MouseX << ", " << MouseY;
+                return ss.str();
+            }
+
+            static EEventType GetStaticType() { return EEventType::MouseMoved; }
+            EEventType GetEventType() const override { return GetStaticType(); }
+            const char* GetName() const override { return "MouseMoved"; }
+            int GetCategoryFlags() const override { return EventCategoryMouse | EventCategoryInput; }
+
+        private:
+            float MouseX, MouseY;
+        };
+
+        // Never sent here; the layers' handlers still pay for checking them
+        template<EEventType Type>
+        struct TOtherEvent : public FEvent
+        {
+            static EEventType GetStaticType() { return Type; }
+            EEventType GetEventType() const override { return Type; }
+            const char* GetName() const override { return "Other"; }
+            int GetCategoryFlags() const override { return EventCategoryApplication; }
+        };
+
+        class FEventDispatcher
+        {
+        public:
+            FEventDispatcher(FEvent& InEvent)
+                : Event(InEvent)
+            {
+            }
+
+            template<typename T, typename F>
+            bool Dispatch(const F& Func)
+            {
+                if (Event.GetEventType() == T::GetStaticType())
+                {
+                    Event.bHandled |= Func(static_cast<T&>(Event));
+                    return true;
+                }
+                return false;
+            }
+
+        private:
+            FEvent& Event;
+        };
+
+        class FLayer
+        {
+        public:
+            virtual ~FLayer() = default;
+            virtual void OnEvent(FEvent&) {}
+        };
+
+        class FCountingLayer : public FLayer
+        {
+        public:
+            void OnEvent(FEvent& InEvent) override
+            {
+                FEventDispatcher Dispatcher(InEvent);
+                Dispatcher.Dispatch<TOtherEvent<EEventType::KeyPressed>>([this](FEvent&) { Handled++; return false; });
+                Dispatcher.Dispatch<FMouseMovedEvent>([this](FMouseMovedEvent&) { Handled++; return false; });
+                Dispatcher.Dispatch<TOtherEvent<EEventType::WindowResize>>([this](FEvent&) { Handled++; return false; });
+            }
+
+            std::uint64_t Handled = 0;
+        };
+
+        class FEventLogLayer : public FLayer
+        {
+        public:
+            void OnEvent(FEvent& InEvent) override { Line = InEvent.ToString(); }
+
+            std::string Line;
+        };
+    }
+
+    static void LayerStackDispatch(FState& State)
+    {
+        FLayerStack Stack;
+        for (std::int64_t Index = 0; Index < State.GetArg(); Index++)
+        {
+            Stack.PushLayer(new FCountingLayer(LayerMasks[static_cast<std::size_t>(Index) % LayerMasks.size()]));
+        }
+
+        const std::array<FEvent, 4> Events =
+        {
+            FMouseMovedEvent(120.0f, 80.0f),
+            FKeyPressedEvent(65),
+            FMouseScrolledEvent(0.0f, 1.0f),
+            FWindowResizeEvent(1280, 720)
+        };
+        State.SetItemsPerOp(Events.size());
+
+        State.Run([&]()
+        {
+            for (FEvent Event : Events)
+            {
+                DispatchThroughStack(Stack, Event);
+                DoNotOptimize(Event);
+            }
+        });
+    }
+    CORE_BENCHMARK(LayerStackDispatch, "Events/LayerStack dispatch", 4, 16, 32);
+
+    namespace
+    {
+        // Synthetic cursor moves per operation, each through 32 layers of which one logs it
+        constexpr int MouseMoveBurst = 1024;
+        constexpr int MouseMoveLayers = 32;
+
+        float BurstX(int Index) { return static_cast<float>(Index % 1920) + 0.5f; }
+        float BurstY(int Index) { return static_cast<float>(Index % 1080) + 0.25f; }
+    }
+
+    static void MouseMovesLegacy(FState& State)
+    {
+        std::vector<std::unique_ptr<Legacy::FLayer>> Stack;
+        Stack.push_back(std::make_unique<Legacy::FEventLogLayer>());
+        for (int Index = 1; Index < MouseMoveLayers; Index++)
+            Stack.push_back(std::make_unique<Legacy::FCountingLayer>());
+        State.SetItemsPerOp(MouseMoveBurst);
+
+        State.Run([&]()
+        {
+            for (int Index = 0; Index < MouseMoveBurst; Index++)
+            {
+                Legacy::FMouseMovedEvent Event(BurstX(Index), BurstY(Index));
+                for (auto It = Stack.rbegin(); It != Stack.rend(); ++It)
+                {
+                    if (Event.bHandled)
+                        break;
+                    (*It)->OnEvent(Event);
+                }
+                DoNotOptimize(Event);
+            }
+        });
+    }
+    CORE_BENCHMARK(MouseMovesLegacy, "Events/32 layers mouse moves legacy");
+
+    static void MouseMoves(FState& State)
+    {
+        FLayerStack Stack;
+        Stack.PushLayer(new FEventLogLayer());
+        for (int Index = 1; Index < MouseMoveLayers; Index++)
+            Stack.PushLayer(new FCountingLayer(LayerMasks[static_cast<std::size_t>(Index) % LayerMasks.size()]));
+        State.SetItemsPerOp(MouseMoveBurst);
+
+        State.Run([&]()
+        {
+            for (int Index = 0; Index < MouseMoveBurst; Index++)
+            {
+                FEvent Event = FMouseMovedEvent(BurstX(Index), BurstY(Index));
+                DispatchThroughStack(Stack, Event);
+                DoNotOptimize(Event);
+            }
+        });
+    }
+    CORE_BENCHMARK(MouseMoves, "Events/32 layers mouse moves");
+
+}
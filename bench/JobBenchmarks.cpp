@@ -0,0 +1,150 @@
+#include "Benchmark.h"
+#include "Core/Jobs/JobSystem.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace Core::Bench
+{
+
+    namespace
+    {
+        // Worker counts for the scaling runs: the calling thread plus 0, 1, 3, 7... workers, up to
+        // one thread per hardware thread
+        std::vector<std::int64_t> ScalingWorkerCounts()
+        {
+            const std::int64_t MaxWorkers = std::max<std::int64_t>(static_cast<std::int64_t>(std::thread::hardware_concurrency()) - 1, 1);
+
+            std::vector<std::int64_t> Counts;
+            for (std::int64_t Threads = 1; Threads - 1 < MaxWorkers; Threads *= 2)
+                Counts.push_back(Threads - 1);
+            Counts.push_back(MaxWorkers);
+            return Counts;
+        }
+
+        // Cheap per-element work, so scheduling overhead shows next to the memory traffic
+        float Step(float Value)
+        {
+            return std::sqrt(Value * 1.0001f + 1.0f);
+        }
+
+        constexpr std::size_t ScalingCount = 1 << 20;
+    }
+
+    static void JobParallelFor(FState& State)
+    {
+        FJobSystem JobSystem(static_cast<int>(State.GetArg()));
+        std::vector<float> Values(ScalingCount, 2.0f);
+        State.SetItemsPerOp(ScalingCount);
+
+        State.Run([&]()
+        {
+            JobSystem.ParallelFor(ScalingCount, 4096, [&Values](std::size_t Index)
+            {
+                Values[Index] = Step(Values[Index]);
+            });
+            DoNotOptimize(Values[0]);
+        });
+    }
+    static const FBenchmarkRegistration JobParallelForRegistration("Jobs/ParallelFor 1M workers", JobParallelFor, ScalingWorkerCounts());
+
+    namespace
+    {
+        constexpr std::size_t ForkJoinLeaf = 4096;
+
+        // Each level submits one half and runs the other itself, the shape of a parallel sort or
+        // tree build. Every waiting thread runs other jobs, so nesting never deadlocks.
+        void ForkJoin(FJobSystem& JobSystem, float* Values, std::size_t Count)
+        {
+            if (Count <= ForkJoinLeaf)
+            {
+                for (std::size_t Index = 0; Index < Count; Index++)
+                    Values[Index] = Step(Values[Index]);
+                return;
+            }
+
+            const std::size_t Half = Count / 2;
+            FJobCounter Counter;
+            JobSystem.Submit([&JobSystem, Values, Half]() { ForkJoin(JobSystem, Values, Half); }, &Counter);
+            ForkJoin(JobSystem, Values + Half, Count - Half);
+            JobSystem.Wait(Counter);
+        }
+    }
+
+    static void JobForkJoin(FState& State)
+    {
+        FJobSystem JobSystem(static_cast<int>(State.GetArg()));
+        std::vector<float> Values(ScalingCount, 2.0f);
+        State.SetItemsPerOp(ScalingCount);
+
+        State.Run([&]()
+        {
+            ForkJoin(JobSystem, Values.data(), Values.size());
+            DoNotOptimize(Values[0]);
+        });
+    }
+    static const FBenchmarkRegistration JobForkJoinRegistration("Jobs/Fork-join 1M workers", JobForkJoin, ScalingWorkerCounts());
+
+    // A frame-shaped graph: stages of jobs over slices of the same data, each stage released by
+    // SubmitAfter once the one before it has finished. Measures continuation hand-off as well as
+    // the work.
+    static void JobDependentStages(FState& State)
+    {
+        static constexpr int StageCount = 4;
+        static constexpr int JobsPerStage = 32;
+        static constexpr std::size_t SliceSize = ScalingCount / JobsPerStage;
+
+        FJobSystem JobSystem(static_cast<int>(State.GetArg()));
+        std::vector<float> Values(ScalingCount, 2.0f);
+        State.SetItemsPerOp(StageCount * JobsPerStage);
+
+        State.Run([&]()
+        {
+            std::array<FJobCounter, StageCount> Stages;
+            for (int Stage = 0; Stage < StageCount; Stage++)
+            {
+                for (int Job = 0; Job < JobsPerStage; Job++)
+                {
+                    float* Slice = Values.data() + static_cast<std::size_t>(Job) * SliceSize;
+                    const auto Work = [Slice]()
+                    {
+                        for (std::size_t Index = 0; Index < SliceSize; Index++)
+                            Slice[Index] = Step(Slice[Index]);
+                    };
+
+                    if (Stage == 0)
+                        JobSystem.Submit(Work, &Stages[0]);
+                    else
+                        JobSystem.SubmitAfter(Stages[Stage - 1], Work, &Stages[Stage]);
+                }
+            }
+            JobSystem.Wait(Stages.back());
+            DoNotOptimize(Values[0]);
+        });
+    }
+    static const FBenchmarkRegistration JobDependentStagesRegistration("Jobs/Dependent stages workers", JobDependentStages, ScalingWorkerCounts());
+
+    static void JobSubmitWait(FState& State)
+    {
+        constexpr int JobCount = 64;
+        FJobSystem JobSystem(static_cast<int>(State.GetArg()));
+        std::atomic<int> Executed{ 0 };
+        State.SetItemsPerOp(JobCount);
+
+        State.Run([&]()
+        {
+            FJobCounter Counter;
+            for (int Index = 0; Index < JobCount; Index++)
+                JobSystem.Submit([&Executed]() { Executed.fetch_add(1, std::memory_order_relaxed); }, &Counter);
+            JobSystem.Wait(Counter);
+        });
+        DoNotOptimize(Executed);
+    }
+    CORE_BENCHMARK(JobSubmitWait, "Jobs/Submit and wait workers", 1, 3);
+
+}
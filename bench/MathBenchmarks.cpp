@@ -0,0 +1,414 @@
+#include "Benchmark.h"
+#include "Core/Math/BatchMath.h"
+#include "Core/Math/MathStreams.h"
+#include "Core/Spatial/Frustum.h"
+#include "Core/Spatial/SpatialIndex.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "raymath.h"
+
+namespace Core::Bench
+{
+
+    namespace
+    {
+        Vector3 MakePoint(std::size_t Index)
+        {
+            const float Value = static_cast<float>(Index);
+            return { std::sin(Value) * 50.0f, std::cos(Value * 0.7f) * 50.0f, Value * 0.001f };
+        }
+
+        Matrix MakeMatrix(std::size_t Index)
+        {
+            const float Value = static_cast<float>(Index);
+            return MatrixMultiply(MatrixRotateXYZ({ Value * 0.01f, Value * 0.02f, Value * 0.03f }), MatrixTranslate(Value, -Value, 2.0f));
+        }
+
+        // Unit rotations; each one at a multiple of three barely differs from the next, so a third
+        // of the slerps take the normalized-lerp branch as they would between close animation keys
+        Quaternion MakeRotation(std::size_t Index)
+        {
+            constexpr float Offsets[3] = { 0.0f, 0.001f, 2.0f };
+            const float Value = static_cast<float>(Index - Index % 3) + Offsets[Index % 3];
+            return QuaternionFromEuler(Value * 0.3f, Value * 0.7f, Value * 1.1f);
+        }
+
+        BoundingBox MakeBox(std::size_t Index)
+        {
+            const Vector3 Center = MakePoint(Index);
+            const float Half = 0.5f + static_cast<float>(Index % 5) * 0.25f;
+            return { Vector3SubtractValue(Center, Half), Vector3AddValue(Center, Half) };
+        }
+
+        const Matrix TransformMatrix = MatrixMultiply(MatrixRotateY(0.7f), MatrixTranslate(1.0f, 2.0f, 3.0f));
+
+        // Element count of a sweep benchmark; the largest sizes take long enough per operation
+        // that a few samples suffice
+        std::size_t BeginSweep(FState& State)
+        {
+            const std::size_t Count = static_cast<std::size_t>(State.GetArg());
+            State.SetItemsPerOp(Count);
+            if (Count >= 1'000'000)
+                State.SetMaxSamples(5);
+            return Count;
+        }
+    }
+
+    // Batch kernels against raymath over the same data, to track the SIMD speedup from data that
+    // sits in L1 up to streams several times larger than the last level cache. Matrices stop at
+    // 1M: three streams of 10M would take almost 2 GB.
+
+    static void TransformPointsBatch(FState& State)
+    {
+        const std::size_t Count = BeginSweep(State);
+        Math::FVector3Stream In;
+        Math::FVector3Stream Out;
+        In.Resize(Count);
+        for (std::size_t Index = 0; Index < Count; Index++)
+            In.Set(Index, MakePoint(Index));
+
+        State.Run([&]()
+        {
+            Math::TransformPoints(TransformMatrix, In, Out);
+            DoNotOptimize(Out.X[0]);
+        });
+    }
+    CORE_BENCHMARK(TransformPointsBatch, "Math/TransformPoints batch", 1'000, 10'000, 100'000, 1'000'000, 10'000'000);
+
+    static void TransformPointsRaymath(FState& State)
+    {
+        const std::size_t Count = BeginSweep(State);
+        std::vector<Vector3> In(Count);
+        std::vector<Vector3> Out(Count);
+        for (std::size_t Index = 0; Index < Count; Index++)
+            In[Index] = MakePoint(Index);
+
+        State.Run([&]()
+        {
+            for (std::size_t Index = 0; Index < Count; Index++)
+                Out[Index] = Vector3Transform(In[Index], TransformMatrix);
+            DoNotOptimize(Out[0]);
+        });
+    }
+    CORE_BENCHMARK(TransformPointsRaymath, "Math/TransformPoints raymath", 1'000, 10'000, 100'000, 1'000'000, 10'000'000);
+
+    static void MultiplyMatricesBatch(FState& State)
+    {
+        const std::size_t Count = BeginSweep(State);
+        Math::FMatrixStream Left;
+        Math::FMatrixStream Right;
+        Math::FMatrixStream Out;
+        Left.Resize(Count);
+        Right.Resize(Count);
+        for (std::size_t Index = 0; Index < Count; Index++)
+        {
+            Left.Set(Index, MakeMatrix(Index));
+            Right.Set(Index, MakeMatrix(Index + 1));
+        }
+
+        State.Run([&]()
+        {
+            Math::MultiplyMatrices(Left, Right, Out);
+            DoNotOptimize(Out.M[0][0]);
+        });
+    }
+    CORE_BENCHMARK(MultiplyMatricesBatch, "Math/MultiplyMatrices batch", 1'000, 10'000, 100'000, 1'000'000);
+
+    static void MultiplyMatricesRaymath(FState& State)
+    {
+        const std::size_t Count = BeginSweep(State);
+        std::vector<Matrix> Left(Count);
+        std::vector<Matrix> Right(Count);
+        std::vector<Matrix> Out(Count);
+        for (std::size_t Index = 0; Index < Count; Index++)
+        {
+            Left[Index] = MakeMatrix(Index);
+            Right[Index] = MakeMatrix(Index + 1);
+        }
+
+        State.Run([&]()
+        {
+            for (std::size_t Index = 0; Index < Count; Index++)
+                Out[Index] = MatrixMultiply(Left[Index], Right[Index]);
+            DoNotOptimize(Out[0]);
+        });
+    }
+    CORE_BENCHMARK(MultiplyMatricesRaymath, "Math/MultiplyMatrices raymath", 1'000, 10'000, 100'000, 1'000'000);
+
+    static void NormalizeBatch(FState& State)
+    {
+        const std::size_t Count = BeginSweep(State);
+        Math::FVector3Stream In;
+        Math::FVector3Stream Out;
+        In.Resize(Count);
+        for (std::size_t Index = 0; Index < Count; Index++)
+            In.Set(Index, MakePoint(Index));
+
+        State.Run([&]()
+        {
+            Math::Normalize(In, Out);
+            DoNotOptimize(Out.X[0]);
+        });
+    }
+    CORE_BENCHMARK(NormalizeBatch, "Math/Normalize batch", 1'000, 10'000, 100'000, 1'000'000, 10'000'000);
+
+    static void NormalizeRaymath(FState& State)
+    {
+        const std::size_t Count = BeginSweep(State);
+        std::vector<Vector3> In(Count);
+        std::vector<Vector3> Out(Count);
+        for (std::size_t Index = 0; Index < Count; Index++)
+            In[Index] = MakePoint(Index);
+
+        State.Run([&]()
+        {
+            for (std::size_t Index = 0; Index < Count; Index++)
+                Out[Index] = Vector3Normalize(In[Index]);
+            DoNotOptimize(Out[0]);
+        });
+    }
+    CORE_BENCHMARK(NormalizeRaymath, "Math/Normalize raymath", 1'000, 10'000, 100'000, 1'000'000, 10'000'000);
+
+    static void LerpBatch(FState& State)
+    {
+        const std::size_t Count = BeginSweep(State);
+        Math::FVector3Stream A;
+        Math::FVector3Stream B;
+        Math::FVector3Stream Out;
+        A.Resize(Count);
+        B.Resize(Count);
+        for (std::size_t Index = 0; Index < Count; Index++)
+        {
+            A.Set(Index, MakePoint(Index));
+            B.Set(Index, MakePoint(Index + 1));
+        }
+
+        State.Run([&]()
+        {
+            Math::Lerp(A, B, 0.3f, Out);
+            DoNotOptimize(Out.X[0]);
+        });
+    }
+    CORE_BENCHMARK(LerpBatch, "Math/Lerp batch", 1'000, 10'000, 100'000, 1'000'000, 10'000'000);
+
+    static void LerpRaymath(FState& State)
+    {
+        const std::size_t Count = BeginSweep(State);
+        std::vector<Vector3> A(Count);
+        std::vector<Vector3> B(Count);
+        std::vector<Vector3> Out(Count);
+        for (std::size_t Index = 0; Index < Count; Index++)
+        {
+            A[Index] = MakePoint(Index);
+            B[Index] = MakePoint(Index + 1);
+        }
+
+        State.Run([&]()
+        {
+            for (std::size_t Index = 0; Index < Count; Index++)
+                Out[Index] = Vector3Lerp(A[Index], B[Index], 0.3f);
+            DoNotOptimize(Out[0]);
+        });
+    }
+    CORE_BENCHMARK(LerpRaymath, "Math/Lerp raymath", 1'000, 10'000, 100'000, 1'000'000, 10'000'000);
+
+    static void SlerpBatch(FState& State)
+    {
+        const std::size_t Count = BeginSweep(State);
+        Math::FQuaternionStream A;
+        Math::FQuaternionStream B;
+        Math::FQuaternionStream Out;
+        A.Resize(Count);
+        B.Resize(Count);
+        for (std::size_t Index = 0; Index < Count; Index++)
+        {
+            A.Set(Index, MakeRotation(Index));
+            B.Set(Index, MakeRotation(Index + 1));
+        }
+
+        State.Run([&]()
+        {
+            Math::Slerp(A, B, 0.3f, Out);
+            DoNotOptimize(Out.X[0]);
+        });
+    }
+    CORE_BENCHMARK(SlerpBatch, "Math/Slerp batch", 1'000, 10'000, 100'000, 1'000'000, 10'000'000);
+
+    static void SlerpRaymath(FState& State)
+    {
+        const std::size_t Count = BeginSweep(State);
+        std::vector<Quaternion> A(Count);
+        std::vector<Quaternion> B(Count);
+        std::vector<Quaternion> Out(Count);
+        for (std::size_t Index = 0; Index < Count; Index++)
+        {
+            A[Index] = MakeRotation(Index);
+            B[Index] = MakeRotation(Index + 1);
+        }
+
+        State.Run([&]()
+        {
+            for (std::size_t Index = 0; Index < Count; Index++)
+                Out[Index] = QuaternionSlerp(A[Index], B[Index], 0.3f);
+            DoNotOptimize(Out[0]);
+        });
+    }
+    CORE_BENCHMARK(SlerpRaymath, "Math/Slerp raymath", 1'000, 10'000, 100'000, 1'000'000, 10'000'000);
+
+    static void TransformBoxesBatch(FState& State)
+    {
+        const std::size_t Count = BeginSweep(State);
+        Math::FBoxStream In;
+        Math::FBoxStream Out;
+        In.Resize(Count);
+        for (std::size_t Index = 0; Index < Count; Index++)
+            In.Set(Index, MakeBox(Index));
+
+        State.Run([&]()
+        {
+            Math::TransformBoxes(TransformMatrix, In, Out);
+            DoNotOptimize(Out.Min.X[0]);
+        });
+    }
+    CORE_BENCHMARK(TransformBoxesBatch, "Math/TransformBoxes batch", 1'000, 10'000, 100'000, 1'000'000, 10'000'000);
+
+    // raymath has no box transform; this is what callers write without one: the eight corners
+    // through Vector3Transform and their bounds
+    static void TransformBoxesRaymath(FState& State)
+    {
+        const std::size_t Count = BeginSweep(State);
+        std::vector<BoundingBox> In(Count);
+        std::vector<BoundingBox> Out(Count);
+        for (std::size_t Index = 0; Index < Count; Index++)
+            In[Index] = MakeBox(Index);
+
+        State.Run([&]()
+        {
+            for (std::size_t Index = 0; Index < Count; Index++)
+            {
+                const BoundingBox& Box = In[Index];
+                Vector3 Min = Vector3Transform(Box.min, TransformMatrix);
+                Vector3 Max = Min;
+                for (int Corner = 1; Corner < 8; Corner++)
+                {
+                    const Vector3 Point = Vector3Transform({ Corner & 1 ? Box.max.x : Box.min.x, Corner & 2 ? Box.max.y : Box.min.y, Corner & 4 ? Box.max.z : Box.min.z }, TransformMatrix);
+                    Min = Vector3Min(Min, Point);
+                    Max = Vector3Max(Max, Point);
+                }
+                Out[Index] = { Min, Max };
+            }
+            DoNotOptimize(Out[0]);
+        });
+    }
+    CORE_BENCHMARK(TransformBoxesRaymath, "Math/TransformBoxes raymath", 1'000, 10'000, 100'000, 1'000'000, 10'000'000);
+
+    namespace
+    {
+        constexpr int StaticSide = 1000;
+        constexpr std::size_t MovingCount = 50'000;
+
+        // One million static boxes on a 1000 x 1000 grid and 50k moving ones above it
+        struct FSpatialScene
+        {
+            FSpatialIndex Index;
+            std::vector<FProxyId> Moving;
+            std::vector<Vector3> MovingPositions;
+
+            FSpatialScene()
+            {
+                for (int Z = 0; Z < StaticSide; Z++)
+                {
+                    for (int X = 0; X < StaticSide; X++)
+                    {
+                        const Vector3 Position = { static_cast<float>(X - StaticSide / 2), 0.0f, static_cast<float>(Z - StaticSide / 2) };
+                        Index.CreateProxy({ Vector3SubtractValue(Position, 0.4f), Vector3AddValue(Position, 0.4f) }, static_cast<std::uint64_t>(Z * StaticSide + X), ESpatialMobility::Static);
+                    }
+                }
+
+                Moving.reserve(MovingCount);
+                MovingPositions.reserve(MovingCount);
+                for (std::size_t Proxy = 0; Proxy < MovingCount; Proxy++)
+                {
+                    const Vector3 Position = Vector3Add(MakePoint(Proxy), { 0.0f, 5.0f, 0.0f });
+                    Moving.push_back(Index.CreateProxy({ Vector3SubtractValue(Position, 0.5f), Vector3AddValue(Position, 0.5f) }, Proxy, ESpatialMobility::Movable));
+                    MovingPositions.push_back(Position);
+                }
+                Index.Rebuild();
+            }
+
+            // Small steps, as from one frame to the next
+            void Move(float Time)
+            {
+                for (std::size_t Proxy = 0; Proxy < Moving.size(); Proxy++)
+                {
+                    const Vector3 Displacement = { 0.02f * std::sin(Time + static_cast<float>(Proxy)), 0.0f, 0.02f * std::cos(Time) };
+                    MovingPositions[Proxy] = Vector3Add(MovingPositions[Proxy], Displacement);
+                    const Vector3& Position = MovingPositions[Proxy];
+                    Index.MoveProxy(Moving[Proxy], { Vector3SubtractValue(Position, 0.5f), Vector3AddValue(Position, 0.5f) }, Displacement);
+                }
+            }
+        };
+
+        FFrustum MakeSceneFrustum()
+        {
+            Camera3D Camera{};
+            Camera.position = { 0.0f, 60.0f, 120.0f };
+            Camera.target = { 0.0f, 0.0f, 0.0f };
+            Camera.up = { 0.0f, 1.0f, 0.0f };
+            Camera.fovy = 45.0f;
+            Camera.projection = CAMERA_PERSPECTIVE;
+            return FFrustum::FromCamera(Camera, 16.0f / 9.0f);
+        }
+    }
+
+    static void SpatialFrustumCull(FState& State)
+    {
+        FSpatialScene Scene;
+        const FFrustum Frustum = MakeSceneFrustum();
+        std::vector<std::uint64_t> Visible;
+        FSpatialQueryStats Stats;
+        State.SetItemsPerOp(Scene.Index.GetProxyCount());
+
+        State.Run([&]()
+        {
+            Visible.clear();
+            Stats = {};
+            Scene.Index.QueryFrustum(Frustum, Visible, &Stats);
+        });
+
+        State.SetCounter("visible", static_cast<double>(Visible.size()));
+        State.SetCounter("visited", Stats.Visited);
+    }
+    CORE_BENCHMARK(SpatialFrustumCull, "Spatial/Frustum cull 1M static + 50k moving");
+
+    static void SpatialMove(FState& State)
+    {
+        FSpatialScene Scene;
+        float Time = 0.0f;
+        State.SetItemsPerOp(MovingCount);
+
+        State.Run([&]()
+        {
+            Scene.Move(Time);
+            Time += 1.0f / 60.0f;
+        });
+    }
+    CORE_BENCHMARK(SpatialMove, "Spatial/Move 50k proxies");
+
+    static void SpatialRebuild(FState& State)
+    {
+        FSpatialScene Scene;
+        State.SetItemsPerOp(Scene.Index.GetProxyCount());
+        State.SetMaxSamples(5);
+
+        State.Run([&]()
+        {
+            Scene.Index.Rebuild();
+        });
+    }
+    CORE_BENCHMARK(SpatialRebuild, "Spatial/Rebuild 1M static + 50k moving");
+
+}
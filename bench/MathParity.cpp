@@ -0,0 +1,352 @@
+#include "MathParity.h"
+#include "Core/Math/BatchMath.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <limits>
+#include <print>
+#include <string>
+#include <vector>
+
+#include "raymath.h"
+
+namespace Core::Bench
+{
+
+    namespace
+    {
+        // Every remainder of an 8-wide lane twice over, and a long run with a partial register at the end
+        constexpr std::size_t ParityCounts[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 1021 };
+
+        // Deterministic inputs, so a failure reproduces
+        class FRandom
+        {
+        public:
+            float Next(float Min, float Max)
+            {
+                State ^= State << 13;
+                State ^= State >> 17;
+                State ^= State << 5;
+                return Min + (Max - Min) * static_cast<float>(State >> 8) / static_cast<float>(1u << 24);
+            }
+
+            Vector3 NextVector(float Range) { return { Next(-Range, Range), Next(-Range, Range), Next(-Range, Range) }; }
+
+            Quaternion NextRotation()
+            {
+                return QuaternionFromEuler(Next(-PI, PI), Next(-PI, PI), Next(-PI, PI));
+            }
+
+            Matrix NextMatrix()
+            {
+                return MatrixMultiply(MatrixMultiply(MatrixScale(Next(0.1f, 4.0f), Next(0.1f, 4.0f), Next(0.1f, 4.0f)), QuaternionToMatrix(NextRotation())),
+                    MatrixTranslate(Next(-100.0f, 100.0f), Next(-100.0f, 100.0f), Next(-100.0f, 100.0f)));
+            }
+
+        private:
+            std::uint32_t State = 0x9E3779B9u;
+        };
+
+        // Bit for bit, except that any NaN matches any NaN
+        bool SameBits(float A, float B)
+        {
+            return std::bit_cast<std::uint32_t>(A) == std::bit_cast<std::uint32_t>(B) || (std::isnan(A) && std::isnan(B));
+        }
+
+        // Mismatches of one kernel; only the first is described
+        class FKernelReport
+        {
+        public:
+            explicit FKernelReport(const char* InKernel) : Kernel(InKernel) {}
+
+            void Check(std::size_t Count, std::size_t Index, const char* Component, float Expected, float Actual, float Tolerance = 0.0f)
+            {
+                Checked++;
+                const bool bMatch = Tolerance > 0.0f ? std::fabs(Expected - Actual) <= Tolerance : SameBits(Expected, Actual);
+                if (bMatch)
+                    return;
+
+                if (Mismatches++ == 0)
+                {
+                    FirstMismatch = std::format("first at count {}, index {}, {}: expected {:.9g}, got {:.9g}", Count, Index, Component, Expected, Actual);
+                }
+            }
+
+            bool Print() const
+            {
+                if (Mismatches == 0)
+                {
+                    std::println("  {:<16} {:>9} values  ok", Kernel, Checked);
+                    return true;
+                }
+                std::println("  {:<16} {:>9} values  {} MISMATCHED, {}", Kernel, Checked, Mismatches, FirstMismatch);
+                return false;
+            }
+
+        private:
+            const char* Kernel;
+            std::size_t Checked = 0;
+            std::size_t Mismatches = 0;
+            std::string FirstMismatch;
+        };
+
+        // Runs Kernel into a separate output, then again in place over a copy of the first input
+        template<typename FStream, typename FKernel, typename FCheck>
+        void CheckBothWays(const FStream& In, FKernel&& Kernel, FCheck&& Check)
+        {
+            FStream Out;
+            Kernel(In, Out);
+            Check(Out);
+
+            FStream InPlace = In;
+            Kernel(InPlace, InPlace);
+            Check(InPlace);
+        }
+
+        void CheckVector3(FKernelReport& Report, std::size_t Count, std::size_t Index, Vector3 Expected, Vector3 Actual)
+        {
+            Report.Check(Count, Index, "x", Expected.x, Actual.x);
+            Report.Check(Count, Index, "y", Expected.y, Actual.y);
+            Report.Check(Count, Index, "z", Expected.z, Actual.z);
+        }
+
+        // Ordinary vectors, with zero-length, negative zero, underflowing and overflowing ones mixed in
+        Vector3 MakeVector(FRandom& Random, std::size_t Index)
+        {
+            switch (Index % 7)
+            {
+                case 1: return { 0.0f, 0.0f, 0.0f };
+                case 3: return { -0.0f, 0.0f, -0.0f };
+                case 4: return { 1.0e-30f, -2.0e-30f, 0.0f };
+                case 5: return { 3.0e19f, -2.0e19f, 1.0e20f };
+                default: return Random.NextVector(50.0f);
+            }
+        }
+
+        bool CheckTransformPoints(FRandom& Random)
+        {
+            FKernelReport Report("TransformPoints");
+            for (const std::size_t Count : ParityCounts)
+            {
+                const Matrix Transform = Random.NextMatrix();
+                Math::FVector3Stream In;
+                In.Resize(Count);
+                for (std::size_t Index = 0; Index < Count; Index++)
+                    In.Set(Index, MakeVector(Random, Index));
+
+                CheckBothWays(In, [&](const Math::FVector3Stream& Source, Math::FVector3Stream& Out) { Math::TransformPoints(Transform, Source, Out); },
+                    [&](const Math::FVector3Stream& Out)
+                    {
+                        for (std::size_t Index = 0; Index < Count; Index++)
+                            CheckVector3(Report, Count, Index, Vector3Transform(In.Get(Index), Transform), Out.Get(Index));
+                    });
+            }
+            return Report.Print();
+        }
+
+        bool CheckMultiplyMatrices(FRandom& Random)
+        {
+            static const char* const Elements[16] = { "m0", "m1", "m2", "m3", "m4", "m5", "m6", "m7", "m8", "m9", "m10", "m11", "m12", "m13", "m14", "m15" };
+
+            FKernelReport Report("MultiplyMatrices");
+            for (const std::size_t Count : ParityCounts)
+            {
+                Math::FMatrixStream Left;
+                Math::FMatrixStream Right;
+                Left.Resize(Count);
+                Right.Resize(Count);
+                for (std::size_t Index = 0; Index < Count; Index++)
+                {
+                    Left.Set(Index, Random.NextMatrix());
+                    Right.Set(Index, Random.NextMatrix());
+                }
+
+                CheckBothWays(Left, [&](const Math::FMatrixStream& Source, Math::FMatrixStream& Out) { Math::MultiplyMatrices(Source, Right, Out); },
+                    [&](const Math::FMatrixStream& Out)
+                    {
+                        for (std::size_t Index = 0; Index < Count; Index++)
+                        {
+                            const Matrix Expected = MatrixMultiply(Left.Get(Index), Right.Get(Index));
+                            for (int Element = 0; Element < 16; Element++)
+                                Report.Check(Count, Index, Elements[Element], MatrixToFloatV(Expected).v[Element], Out.M[Element][Index]);
+                        }
+                    });
+            }
+            return Report.Print();
+        }
+
+        bool CheckNormalize(FRandom& Random)
+        {
+            FKernelReport Report("Normalize");
+            for (const std::size_t Count : ParityCounts)
+            {
+                Math::FVector3Stream In;
+                In.Resize(Count);
+                for (std::size_t Index = 0; Index < Count; Index++)
+                    In.Set(Index, MakeVector(Random, Index));
+
+                CheckBothWays(In, [](const Math::FVector3Stream& Source, Math::FVector3Stream& Out) { Math::Normalize(Source, Out); },
+                    [&](const Math::FVector3Stream& Out)
+                    {
+                        for (std::size_t Index = 0; Index < Count; Index++)
+                            CheckVector3(Report, Count, Index, Vector3Normalize(In.Get(Index)), Out.Get(Index));
+                    });
+            }
+            return Report.Print();
+        }
+
+        bool CheckLerp(FRandom& Random)
+        {
+            FKernelReport Report("Lerp");
+            for (const std::size_t Count : ParityCounts)
+            {
+                Math::FVector3Stream A;
+                Math::FVector3Stream B;
+                A.Resize(Count);
+                B.Resize(Count);
+                for (std::size_t Index = 0; Index < Count; Index++)
+                {
+                    A.Set(Index, MakeVector(Random, Index));
+                    B.Set(Index, MakeVector(Random, Index + 3));
+                }
+
+                for (const float Amount : { 0.0f, 0.3f, 1.0f, 1.7f })
+                {
+                    CheckBothWays(A, [&](const Math::FVector3Stream& Source, Math::FVector3Stream& Out) { Math::Lerp(Source, B, Amount, Out); },
+                        [&](const Math::FVector3Stream& Out)
+                        {
+                            for (std::size_t Index = 0; Index < Count; Index++)
+                                CheckVector3(Report, Count, Index, Vector3Lerp(A.Get(Index), B.Get(Index), Amount), Out.Get(Index));
+                        });
+                }
+            }
+            return Report.Print();
+        }
+
+        // Pairs that steer QuaternionSlerp down each of its branches: identical and opposite
+        // rotations (|cos| >= 1 once flipped), close ones (the normalized lerp), ordinary ones, and
+        // unnormalized input. The half-and-half branch for a vanishing sine needs cos <= 0.95 and
+        // |sin| < 1e-6 at once, which no input reaches, so raymath and the kernel can only agree
+        // on it by never taking it.
+        Quaternion MakeSlerpPartner(FRandom& Random, Quaternion A, std::size_t Index)
+        {
+            const Quaternion Nudge = QuaternionFromAxisAngle(Vector3Normalize(Random.NextVector(1.0f)), Random.Next(0.001f, 0.5f));
+            switch (Index % 6)
+            {
+                case 0: return A;
+                case 1: return QuaternionScale(A, -1.0f);
+                case 2: return QuaternionMultiply(A, Nudge);
+                case 3: return QuaternionScale(QuaternionMultiply(A, Nudge), -1.0f);
+                case 4: return QuaternionScale(Random.NextRotation(), Random.Next(0.5f, 2.0f));
+                default: return Random.NextRotation();
+            }
+        }
+
+        bool CheckSlerp(FRandom& Random)
+        {
+            FKernelReport Report("Slerp");
+            for (const std::size_t Count : ParityCounts)
+            {
+                Math::FQuaternionStream A;
+                Math::FQuaternionStream B;
+                A.Resize(Count);
+                B.Resize(Count);
+                for (std::size_t Index = 0; Index < Count; Index++)
+                {
+                    const Quaternion Rotation = Random.NextRotation();
+                    A.Set(Index, Rotation);
+                    B.Set(Index, MakeSlerpPartner(Random, Rotation, Index));
+                }
+
+                for (const float Amount : { 0.0f, 0.25f, 0.5f, 1.0f })
+                {
+                    CheckBothWays(A, [&](const Math::FQuaternionStream& Source, Math::FQuaternionStream& Out) { Math::Slerp(Source, B, Amount, Out); },
+                        [&](const Math::FQuaternionStream& Out)
+                        {
+                            for (std::size_t Index = 0; Index < Count; Index++)
+                            {
+                                const Quaternion Expected = QuaternionSlerp(A.Get(Index), B.Get(Index), Amount);
+                                const Quaternion Actual = Out.Get(Index);
+                                Report.Check(Count, Index, "x", Expected.x, Actual.x);
+                                Report.Check(Count, Index, "y", Expected.y, Actual.y);
+                                Report.Check(Count, Index, "z", Expected.z, Actual.z);
+                                Report.Check(Count, Index, "w", Expected.w, Actual.w);
+                            }
+                        });
+                }
+            }
+            return Report.Print();
+        }
+
+        // No raymath counterpart: compared with the bounds of the eight transformed corners, which
+        // sum the same terms in another order
+        bool CheckTransformBoxes(FRandom& Random)
+        {
+            FKernelReport Report("TransformBoxes");
+            for (const std::size_t Count : ParityCounts)
+            {
+                const Matrix Transform = Random.NextMatrix();
+                Math::FBoxStream In;
+                In.Resize(Count);
+                for (std::size_t Index = 0; Index < Count; Index++)
+                {
+                    const Vector3 Center = Random.NextVector(50.0f);
+                    // Every third box is flat or a point
+                    const Vector3 Extent = Index % 3 == 1 ? Vector3{ 0.0f, Random.Next(0.0f, 5.0f), 0.0f } : Random.NextVector(5.0f);
+                    const Vector3 Half = { std::fabs(Extent.x), std::fabs(Extent.y), std::fabs(Extent.z) };
+                    In.Set(Index, { Vector3Subtract(Center, Half), Vector3Add(Center, Half) });
+                }
+
+                CheckBothWays(In, [&](const Math::FBoxStream& Source, Math::FBoxStream& Out) { Math::TransformBoxes(Transform, Source, Out); },
+                    [&](const Math::FBoxStream& Out)
+                    {
+                        for (std::size_t Index = 0; Index < Count; Index++)
+                        {
+                            const BoundingBox Box = In.Get(Index);
+                            Vector3 Min = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+                            Vector3 Max = Vector3Negate(Min);
+                            float Scale = 1.0f;
+                            for (int Corner = 0; Corner < 8; Corner++)
+                            {
+                                const Vector3 Point = Vector3Transform({ Corner & 1 ? Box.max.x : Box.min.x, Corner & 2 ? Box.max.y : Box.min.y, Corner & 4 ? Box.max.z : Box.min.z }, Transform);
+                                Min = Vector3Min(Min, Point);
+                                Max = Vector3Max(Max, Point);
+                                Scale = std::max({ Scale, std::fabs(Point.x), std::fabs(Point.y), std::fabs(Point.z) });
+                            }
+
+                            // A few ulps of the largest coordinate involved
+                            const float Tolerance = Scale * 8.0f * std::numeric_limits<float>::epsilon();
+                            const BoundingBox Actual = Out.Get(Index);
+                            Report.Check(Count, Index, "min.x", Min.x, Actual.min.x, Tolerance);
+                            Report.Check(Count, Index, "min.y", Min.y, Actual.min.y, Tolerance);
+                            Report.Check(Count, Index, "min.z", Min.z, Actual.min.z, Tolerance);
+                            Report.Check(Count, Index, "max.x", Max.x, Actual.max.x, Tolerance);
+                            Report.Check(Count, Index, "max.y", Max.y, Actual.max.y, Tolerance);
+                            Report.Check(Count, Index, "max.z", Max.z, Actual.max.z, Tolerance);
+                        }
+                    });
+            }
+            return Report.Print();
+        }
+    }
+
+    int RunMathParityCheck()
+    {
+        std::println("Batch math against raymath, {} backend", Math::GetSimdBackendName());
+
+        FRandom Random;
+        bool bPassed = true;
+        for (bool (*Check)(FRandom&) : { CheckTransformPoints, CheckMultiplyMatrices, CheckNormalize, CheckLerp, CheckSlerp, CheckTransformBoxes })
+        {
+            bPassed &= Check(Random);
+        }
+
+        std::println("{}", bPassed ? "All kernels match" : "Mismatches found");
+        return bPassed ? 0 : 1;
+    }
+
+}
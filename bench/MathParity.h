@@ -0,0 +1,12 @@
+#pragma once
+
+namespace Core::Bench
+{
+
+    // Runs every batch math kernel against its raymath counterpart on the SIMD backend this binary
+    // was built with, and prints a line per kernel. Covers every remainder length of the widest
+    // lane, in-place calls, zero-length and overflowing vectors, and each branch of the slerp.
+    // Returns the process exit code: 0 when everything matched.
+    [[nodiscard]] int RunMathParityCheck();
+
+}
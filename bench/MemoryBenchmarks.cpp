@@ -0,0 +1,111 @@
+#include "Benchmark.h"
+#include "Core/Memory/FrameAllocator.h"
+
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+namespace Core::Bench
+{
+
+    namespace
+    {
+        // One entry of a frame's scratch data, e.g. a queued draw with a few parameters of its own
+        struct FScratchItem
+        {
+            std::uint32_t Key;
+            float* Params;
+        };
+
+        constexpr std::size_t ParamCount = 4;
+
+        // Sums what was built, so no variant can skip the writes
+        float Consume(std::span<const FScratchItem> Items)
+        {
+            float Sum = 0.0f;
+            for (const FScratchItem& Item : Items)
+                Sum += Item.Params[ParamCount - 1] + static_cast<float>(Item.Key);
+            return Sum;
+        }
+
+        void Fill(float* Params, std::size_t Index)
+        {
+            for (std::size_t Param = 0; Param < ParamCount; Param++)
+                Params[Param] = static_cast<float>(Index + Param);
+        }
+    }
+
+    // Each operation is one frame: a vector grown one push at a time without reserving, and a small
+    // array per entry, all thrown away at the end of the frame. Reported per entry.
+    static void FrameScratchNew(FState& State)
+    {
+        const std::size_t Count = static_cast<std::size_t>(State.GetArg());
+        State.SetItemsPerOp(Count);
+
+        State.Run([&]()
+        {
+            std::vector<FScratchItem> Items;
+            for (std::size_t Index = 0; Index < Count; Index++)
+            {
+                float* Params = new float[ParamCount];
+                Fill(Params, Index);
+                Items.push_back({ static_cast<std::uint32_t>(Index), Params });
+            }
+            DoNotOptimize(Consume(Items));
+
+            for (const FScratchItem& Item : Items)
+                delete[] Item.Params;
+        });
+    }
+    CORE_BENCHMARK(FrameScratchNew, "Memory/Frame scratch new", 64, 1024, 16384);
+
+    // The same through pmr containers on the default resource, i.e. new and delete behind a virtual call
+    static void FrameScratchPmrDefault(FState& State)
+    {
+        const std::size_t Count = static_cast<std::size_t>(State.GetArg());
+        std::pmr::memory_resource* Resource = std::pmr::get_default_resource();
+        State.SetItemsPerOp(Count);
+
+        State.Run([&]()
+        {
+            std::pmr::vector<FScratchItem> Items(Resource);
+            for (std::size_t Index = 0; Index < Count; Index++)
+            {
+                float* Params = static_cast<float*>(Resource->allocate(sizeof(float) * ParamCount, alignof(float)));
+                Fill(Params, Index);
+                Items.push_back({ static_cast<std::uint32_t>(Index), Params });
+            }
+            DoNotOptimize(Consume(Items));
+
+            for (const FScratchItem& Item : Items)
+                Resource->deallocate(Item.Params, sizeof(float) * ParamCount, alignof(float));
+        });
+    }
+    CORE_BENCHMARK(FrameScratchPmrDefault, "Memory/Frame scratch pmr default", 64, 1024, 16384);
+
+    // The same from FFrameAllocator: nothing is freed, BeginFrame recycles the whole frame. Sized
+    // like the application's default so nothing falls back to the heap; allocs_per_item stays 0.
+    static void FrameScratchFrameAllocator(FState& State)
+    {
+        const std::size_t Count = static_cast<std::size_t>(State.GetArg());
+        FFrameAllocator Allocator(4 * 1024 * 1024);
+        State.SetItemsPerOp(Count);
+
+        State.Run([&]()
+        {
+            Allocator.BeginFrame();
+            std::pmr::vector<FScratchItem> Items(Allocator.GetResource());
+            for (std::size_t Index = 0; Index < Count; Index++)
+            {
+                float* Params = Allocator.NewArray<float>(ParamCount).data();
+                Fill(Params, Index);
+                Items.push_back({ static_cast<std::uint32_t>(Index), Params });
+            }
+            DoNotOptimize(Consume(Items));
+        });
+        State.SetCounter("overflows", static_cast<double>(Allocator.GetLastOverflowCount()));
+    }
+    CORE_BENCHMARK(FrameScratchFrameAllocator, "Memory/Frame scratch frame allocator", 64, 1024, 16384);
+
+}
@@ -0,0 +1,237 @@
+#include "Benchmark.h"
+#include "Core/Jobs/JobSystem.h"
+#include "Core/Renderer/DebugDraw.h"
+#include "Core/Renderer/InstancedRenderer.h"
+#include "Core/Renderer/RenderQueue.h"
+#include "Core/Renderer/RenderTargetPool.h"
+
+#include <glad/glad.h>
+
+#include "imgui.h"
+
+#include <cmath>
+#include <cstdint>
+
+#include "raylib.h"
+#include "raymath.h"
+
+extern "C"
+{
+    #include "rlgl.h"
+}
+
+namespace Core::Bench
+{
+
+    namespace
+    {
+        // Objects on a square grid around the origin, spacing 1
+        Vector3 GridPosition(std::int64_t Index, std::int64_t Count)
+        {
+            const std::int64_t Side = static_cast<std::int64_t>(std::ceil(std::sqrt(static_cast<double>(Count))));
+            return { static_cast<float>(Index % Side - Side / 2), 0.0f, static_cast<float>(Index / Side - Side / 2) };
+        }
+
+        Color GridColor(std::int64_t Index)
+        {
+            return { static_cast<unsigned char>(Index * 37), static_cast<unsigned char>(Index * 91), static_cast<unsigned char>(Index * 13), 255 };
+        }
+
+        // Samples include the GPU finishing what they submitted
+        void FinishGPU()
+        {
+            glFinish();
+        }
+    }
+
+    // Immediate-mode cubes through rlgl's default batch, flushed once per frame
+    static void RlglBatchCubes(FState& State)
+    {
+        if (!State.RequireGL())
+            return;
+
+        const std::int64_t Count = State.GetArg();
+        State.SetItemsPerOp(static_cast<std::uint64_t>(Count));
+
+        State.Run([&]()
+        {
+            for (std::int64_t Index = 0; Index < Count; Index++)
+                DrawCube(GridPosition(Index, Count), 0.5f, 0.5f, 0.5f, GridColor(Index));
+            rlDrawRenderBatchActive();
+        }, FinishGPU);
+    }
+    CORE_BENCHMARK(RlglBatchCubes, "Render/rlgl batch cubes", 1000, 10000);
+
+    // Cubes and their wireframes recorded interleaved, executed in recording order (0) or sorted (1)
+    static void RenderQueueCubes(FState& State)
+    {
+        if (!State.RequireGL())
+            return;
+
+        constexpr std::int64_t Count = 5000;
+        FRenderQueue Queue;
+        Queue.SetSortEnabled(State.GetArg() != 0);
+
+        Camera3D Camera{};
+        Camera.position = { 30.0f, 30.0f, 30.0f };
+        Camera.up = { 0.0f, 1.0f, 0.0f };
+        Camera.fovy = 45.0f;
+        State.SetItemsPerOp(2 * Count);
+
+        State.Run([&]()
+        {
+            Queue.SetView(Camera);
+            for (std::int64_t Index = 0; Index < Count; Index++)
+            {
+                const Vector3 Position = GridPosition(Index, Count);
+                Queue.DrawCube(Position, { 0.5f, 0.5f, 0.5f }, static_cast<float>(Index), GridColor(Index));
+                Queue.DrawCubeWires(Position, { 0.5f, 0.5f, 0.5f }, static_cast<float>(Index), BLACK);
+            }
+            Queue.Execute();
+        }, FinishGPU);
+
+        const FRenderQueueStats& Stats = Queue.GetStats();
+        State.SetCounter("draw_calls", Stats.DrawCalls);
+        State.SetCounter("batch_flushes", Stats.BatchFlushes);
+        State.SetCounter("state_changes", Stats.StateChanges);
+        Queue.Release();
+    }
+    CORE_BENCHMARK(RenderQueueCubes, "Render/RenderQueue 5k cubes + wires sorted", 0, 1);
+
+    static void InstancedCubes(FState& State)
+    {
+        if (!State.RequireGL())
+            return;
+
+        constexpr std::int64_t Count = 100'000;
+        const Mesh CubeMesh = GenMeshCube(0.5f, 0.5f, 0.5f);
+        const Material CubeMaterial = LoadMaterialDefault();
+        {
+            FInstancedRenderer Renderer;
+            FInstanceBatch& Batch = Renderer.GetBatch(CubeMesh, CubeMaterial);
+            Batch.Reserve(Count);
+            State.SetItemsPerOp(Count);
+
+            float Time = 0.0f;
+            State.Run([&]()
+            {
+                for (std::int64_t Index = 0; Index < Count; Index++)
+                    Batch.Add(GridPosition(Index, Count), Time + static_cast<float>(Index), { 1.0f, 1.0f, 1.0f }, GridColor(Index));
+                Renderer.Flush();
+                Time += 1.0f;
+            }, FinishGPU);
+
+            State.SetCounter("draw_calls", static_cast<double>(Renderer.GetDrawCallCount()));
+        }
+        UnloadMaterial(CubeMaterial);
+        UnloadMesh(CubeMesh);
+    }
+    CORE_BENCHMARK(InstancedCubes, "Render/Instanced cubes 100k");
+
+    // Recorded from the calling thread (0), or spread over that many job workers
+    static void DebugDrawLines(FState& State)
+    {
+        if (!State.RequireGL())
+            return;
+
+        constexpr std::size_t Count = 500'000;
+        FJobSystem JobSystem(static_cast<int>(State.GetArg()));
+        FDebugDraw::SetEnabled(true);
+        State.SetItemsPerOp(Count);
+
+        const auto RecordLine = [](std::size_t Index)
+        {
+            const float X = static_cast<float>(Index % 1000) * 0.1f - 50.0f;
+            const float Z = static_cast<float>(Index / 1000) * 0.2f - 50.0f;
+            FDebugDraw::Line({ X, 0.0f, Z }, { X, 1.0f, Z }, GridColor(static_cast<std::int64_t>(Index)));
+        };
+
+        State.Run([&]()
+        {
+            FDebugDraw::BeginFrame(1.0f / 60.0f);
+            if (State.GetArg() == 0)
+            {
+                for (std::size_t Index = 0; Index < Count; Index++)
+                    RecordLine(Index);
+            }
+            else
+            {
+                JobSystem.ParallelFor(Count, 16384, RecordLine);
+            }
+            FDebugDraw::Flush();
+        }, FinishGPU);
+
+        State.SetCounter("draw_calls", FDebugDraw::GetStats().DrawCalls);
+        FDebugDraw::Shutdown();
+    }
+    CORE_BENCHMARK(DebugDrawLines, "Render/DebugDraw 500k lines workers", 0, 3);
+
+    // A viewport dragged larger and smaller every frame: most sizes fit the pooled allocation,
+    // growing past it reallocates
+    static void RenderTargetResize(FState& State)
+    {
+        if (!State.RequireGL())
+            return;
+
+        FRenderTargetPool Pool;
+        FRenderTarget Target;
+        int Frame = 0;
+
+        State.Run([&]()
+        {
+            Pool.BeginFrame();
+            const int Step = Frame++ % 400;
+            const int Offset = Step < 200 ? Step : 400 - Step;
+            Pool.Request(Target, { .Width = 1000 + 2 * Offset, .Height = 600 + Offset });
+        }, FinishGPU);
+
+        State.SetCounter("targets_created", static_cast<double>(Pool.GetCreatedCount()));
+        Pool.ReleaseAll();
+    }
+    CORE_BENCHMARK(RenderTargetResize, "Render/RenderTargetPool resize");
+
+    // NewFrame to Render with the argument's count of widgets in one window; the CPU side only,
+    // nothing is drawn
+    static void ImGuiFrameBuild(FState& State)
+    {
+        ImGuiContext* Context = ImGui::CreateContext();
+        ImGuiIO& IO = ImGui::GetIO();
+        IO.IniFilename = nullptr;
+        IO.DisplaySize = ImVec2(1920.0f, 1080.0f);
+        IO.DeltaTime = 1.0f / 60.0f;
+        // Font textures are created on demand and left pending, there is no renderer to upload them
+        IO.BackendFlags |= ImGuiBackendFlags_RendererHasTextures;
+
+        const int Count = static_cast<int>(State.GetArg());
+        float Values[4] = { 0.25f, 0.5f, 0.75f, 1.0f };
+        bool bChecked = false;
+        State.SetItemsPerOp(static_cast<std::uint64_t>(Count));
+
+        State.Run([&]()
+        {
+            ImGui::NewFrame();
+            ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+            ImGui::SetNextWindowSize(IO.DisplaySize);
+            ImGui::Begin("Widgets");
+            for (int Index = 0; Index < Count; Index++)
+            {
+                ImGui::PushID(Index);
+                switch (Index % 4)
+                {
+                    case 0: ImGui::Text("Item %d: %.3f", Index, Values[0]); break;
+                    case 1: ImGui::Button("Button"); break;
+                    case 2: ImGui::SliderFloat("Value", &Values[Index % 3], 0.0f, 1.0f); break;
+                    default: ImGui::Checkbox("Enabled", &bChecked); break;
+                }
+                ImGui::PopID();
+            }
+            ImGui::End();
+            ImGui::Render();
+            DoNotOptimize(ImGui::GetDrawData()->TotalVtxCount);
+        });
+
+        ImGui::DestroyContext(Context);
+    }
+    CORE_BENCHMARK(ImGuiFrameBuild, "ImGui/Frame build widgets", 100, 1000, 10000);
+
+}
@@ -1,6 +1,6 @@
-add_custom_command(TARGET ${PROJECT_NAME} POST_BUILD
+add_custom_command(TARGET ${CORE_TARGET} POST_BUILD
     COMMAND ${CMAKE_COMMAND} -E copy_if_different
     "${CMAKE_SOURCE_DIR}/src/Core/Font/Roboto-Regular.ttf"
-    "$<TARGET_FILE_DIR:${PROJECT_NAME}>/Roboto-Regular.ttf"
+    "$<TARGET_FILE_DIR:${CORE_TARGET}>/Roboto-Regular.ttf"
 )
   
\ No newline at end of file
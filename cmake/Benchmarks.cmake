@@ -0,0 +1,33 @@
+# Benchmark runner: the engine and sandbox sources with bench/BenchMain.cpp's main instead of the
+# entry point, so `--scene` can run the sandbox headless next to the micro benchmarks
+set(BENCH_SOURCES ${SOURCES})
+list(REMOVE_ITEM BENCH_SOURCES src/Core/Application/EntryPoint.cpp)
+list(APPEND BENCH_SOURCES
+    bench/AllocationCounter.cpp
+    bench/Benchmark.cpp
+    bench/Benchmark.h
+    bench/BenchMain.cpp
+    bench/CoreBenchmarks.cpp
+    bench/EcsBenchmarks.cpp
+    bench/EventBenchmarks.cpp
+    bench/JobBenchmarks.cpp
+    bench/MathBenchmarks.cpp
+    bench/MathParity.cpp
+    bench/MathParity.h
+    bench/MemoryBenchmarks.cpp
+    bench/RenderBenchmarks.cpp
+)
+
+add_executable(${PROJECT_NAME}_bench ${BENCH_SOURCES})
+
+target_include_directories(${PROJECT_NAME}_bench PRIVATE
+    src
+    bench
+    external/raylib-cpp/include
+    external/glad/include
+)
+
+target_link_libraries(${PROJECT_NAME}_bench PRIVATE raylib imgui)
+set(CORE_TARGET ${PROJECT_NAME}_bench)
+include(Platform)
+include(Assets)
@@ -1,6 +1,17 @@
 # raylib
 add_subdirectory(${CMAKE_SOURCE_DIR}/external/raylib)
 
+if(CORE_ENABLE_MEMORY_TRACKING)
+    # raylib only defines RL_MALLOC and friends when they are missing; force-including the hooks
+    # routes all of its allocations to the memory tracker
+    set(CORE_RAYLIB_ALLOCATOR_HOOKS ${CMAKE_SOURCE_DIR}/src/Core/Memory/RaylibAllocatorHooks.h)
+    if(MSVC)
+        target_compile_options(raylib PRIVATE "/FI${CORE_RAYLIB_ALLOCATOR_HOOKS}")
+    else()
+        target_compile_options(raylib PRIVATE "SHELL:-include ${CORE_RAYLIB_ALLOCATOR_HOOKS}")
+    endif()
+endif()
+
 # sources for your app (kept centralized)
 set(SOURCES
     src/main.cpp
@@ -13,17 +24,86 @@ set(SOURCES
     src/Core/Application/ApplicationTheme.h
     src/Core/Application/EntryPoint.h
     src/Core/Application/EntryPoint.cpp
+    src/Core/Application/FontCache.cpp
+    src/Core/Application/FontCache.h
+    src/Core/Application/PlatformWindowProxy.cpp
+    src/Core/Application/PlatformWindowProxy.h
+    src/Core/Assets/AssetManager.cpp
+    src/Core/Assets/AssetManager.h
+    src/Core/Assets/ObjParser.cpp
+    src/Core/Assets/ObjParser.h
     src/Core/Base/Core.h
+    src/Core/Base/SPSCQueue.h
+    src/Core/Base/TripleBuffer.h
+    src/Core/ECS/Archetype.cpp
+    src/Core/ECS/Archetype.h
+    src/Core/ECS/CommandBuffer.cpp
+    src/Core/ECS/CommandBuffer.h
+    src/Core/ECS/ComponentType.cpp
+    src/Core/ECS/ComponentType.h
+    src/Core/ECS/ECSLayer.cpp
+    src/Core/ECS/ECSLayer.h
+    src/Core/ECS/Entity.h
+    src/Core/ECS/System.cpp
+    src/Core/ECS/System.h
+    src/Core/ECS/World.cpp
+    src/Core/ECS/World.h
     src/Core/Events/ApplicationEvent.h
     src/Core/Events/Event.h
+    src/Core/Events/EventBase.h
+    src/Core/Events/EventQueue.h
     src/Core/Events/KeyEvent.h
     src/Core/Events/MouseEvent.h
     src/Core/Input/Input.cpp
     src/Core/Input/Input.h
+    src/Core/Input/InputState.h
+    src/Core/Jobs/JobSystem.cpp
+    src/Core/Jobs/JobSystem.h
     src/Core/Layers/Layer.cpp
     src/Core/Layers/Layer.h
     src/Core/Layers/LayerStack.cpp
     src/Core/Layers/LayerStack.h
     src/Core/Logging/Log.cpp
     src/Core/Logging/Log.h
+    src/Core/Logging/LogConsoleLayer.cpp
+    src/Core/Logging/LogConsoleLayer.h
+    src/Core/Logging/LogSink.cpp
+    src/Core/Logging/LogSink.h
+    src/Core/Math/BatchMath.cpp
+    src/Core/Math/BatchMath.h
+    src/Core/Math/MathStreams.h
+    src/Core/Math/SimdLane.h
+    src/Core/Memory/AlignedAllocator.h
+    src/Core/Memory/FrameAllocator.cpp
+    src/Core/Memory/FrameAllocator.h
+    src/Core/Memory/MemoryLayer.cpp
+    src/Core/Memory/MemoryLayer.h
+    src/Core/Memory/MemoryTracker.cpp
+    src/Core/Memory/MemoryTracker.h
+    src/Core/Memory/RaylibAllocatorHooks.h
+    src/Core/Profiling/FrameStats.cpp
+    src/Core/Profiling/FrameStats.h
+    src/Core/Profiling/GpuProfiler.cpp
+    src/Core/Profiling/GpuProfiler.h
+    src/Core/Profiling/Profiler.cpp
+    src/Core/Profiling/Profiler.h
+    src/Core/Profiling/ProfilerLayer.cpp
+    src/Core/Profiling/ProfilerLayer.h
+    src/Core/Profiling/StartupTrace.cpp
+    src/Core/Profiling/StartupTrace.h
+    src/Core/Renderer/DebugDraw.cpp
+    src/Core/Renderer/DebugDraw.h
+    src/Core/Renderer/FramePipeline.cpp
+    src/Core/Renderer/FramePipeline.h
+    src/Core/Renderer/InstancedRenderer.cpp
+    src/Core/Renderer/InstancedRenderer.h
+    src/Core/Renderer/RenderQueue.cpp
+    src/Core/Renderer/RenderQueue.h
+    src/Core/Renderer/RenderTargetPool.cpp
+    src/Core/Renderer/RenderTargetPool.h
+    src/Core/Simulation/SnapshotBuffer.h
+    src/Core/Spatial/Frustum.cpp
+    src/Core/Spatial/Frustum.h
+    src/Core/Spatial/SpatialIndex.cpp
+    src/Core/Spatial/SpatialIndex.h
 )
\ No newline at end of file
@@ -9,4 +9,42 @@ set(BUILD_GAMES OFF CACHE BOOL "" FORCE)
 
 set(BUILD_SHARED_LIBS OFF CACHE BOOL "" FORCE)
 
-add_compile_definitions(NOMINMAX)
\ No newline at end of file
+add_compile_definitions(NOMINMAX)
+
+# Engine options
+option(CORE_ENABLE_PROFILING "Compile the built-in profiler (zones, Profiler panel, trace export)" OFF)
+if(CORE_ENABLE_PROFILING)
+    add_compile_definitions(CORE_ENABLE_PROFILING)
+endif()
+
+option(CORE_ENABLE_MEMORY_TRACKING "Track heap (operator new, raylib, ImGui) and GPU memory per tag for the Memory panel" OFF)
+if(CORE_ENABLE_MEMORY_TRACKING)
+    add_compile_definitions(CORE_ENABLE_MEMORY_TRACKING)
+endif()
+
+option(CORE_LOG_STRIP_DEBUG "Compile out FLog::Debug and FLog::CoreDebug messages" OFF)
+if(CORE_LOG_STRIP_DEBUG)
+    add_compile_definitions(CORE_LOG_STRIP_DEBUG)
+endif()
+
+# Batch math (src/Core/Math) picks its SIMD backend from the instruction sets the compiler targets
+option(CORE_SIMD_AVX2 "Target AVX2 (x86-64 CPUs from 2013 on) so the batch math kernels run 8 floats wide instead of SSE's 4" OFF)
+if(CORE_SIMD_AVX2)
+    if(MSVC)
+        add_compile_options(/arch:AVX2)
+    else()
+        add_compile_options(-mavx2)
+    endif()
+endif()
+
+option(CORE_WEB_SIMD "Build the web target with WebAssembly SIMD for the batch math kernels (browsers from 2023 on)" OFF)
+if(CORE_WEB_SIMD AND EMSCRIPTEN)
+    add_compile_options(-msimd128)
+endif()
+
+option(CORE_MATH_FORCE_SCALAR "Use the plain C++ batch math kernels regardless of the target's SIMD support" OFF)
+if(CORE_MATH_FORCE_SCALAR)
+    add_compile_definitions(CORE_MATH_FORCE_SCALAR)
+endif()
+
+option(CORE_BUILD_BENCHMARKS "Build the _bench runner target: micro benchmarks plus the sandbox scene run headless (desktop only)" OFF)
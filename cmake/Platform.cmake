@@ -1,11 +1,11 @@
 if (WIN32)
-    target_link_libraries(${PROJECT_NAME} PRIVATE opengl32)
+    target_link_libraries(${CORE_TARGET} PRIVATE opengl32)
 
 elseif (UNIX AND NOT APPLE)
-    target_link_libraries(${PROJECT_NAME} PRIVATE GL X11 pthread dl)
+    target_link_libraries(${CORE_TARGET} PRIVATE GL X11 pthread dl)
 
 elseif (APPLE)
-    target_link_libraries(${PROJECT_NAME} PRIVATE
+    target_link_libraries(${CORE_TARGET} PRIVATE
         "-framework OpenGL"
         "-framework Cocoa"
         "-framework IOKit"
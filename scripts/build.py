@@ -1,5 +1,9 @@
 #!/usr/bin/env python3
+import argparse
+import json
+import math
 import os
+import platform
 import sys
 import subprocess
 import webbrowser
@@ -24,13 +28,16 @@ def print_success(msg):
 def print_info(msg):
     print(f"{Colors.CYAN}[INFO]{Colors.RESET} {msg}")
 
+def print_warning(msg):
+    print(f"{Colors.YELLOW}{Colors.BOLD}[WARNING]{Colors.RESET} {msg}")
+
 def run_command(command, folder):
     process = subprocess.Popen(command, shell=True, cwd=folder)
     process.communicate()
     if process.returncode != 0:
         sys.exit(1)
 
-def main():
+def build_web():
     print_info("Starting WebAssembly Build...")
     
     # Get project root (parent of scripts folder)
@@ -76,5 +83,221 @@ def main():
     server_cmd = f'{sys.executable} -m http.server 8000 --directory "{build_folder}"'
     run_command(server_cmd, build_folder)
 
+# Sandbox scene variants run headless by the bench command: (name, extra switches)
+BENCH_SCENES = [
+    ("Scene/Sandbox default", []),
+    ("Scene/Sandbox 10k cubes", ["--cubes=10000"]),
+    ("Scene/Sandbox 10k cubes + bounds", ["--cubes=10000", "--bounds"]),
+]
+
+def find_bench_executable(build_folder):
+    name = "raylib_imgui_hybrid_bench" + (".exe" if os.name == "nt" else "")
+    # Multi-config generators (Visual Studio, Xcode) put it in a per-config folder
+    for candidate in [build_folder / name, build_folder / "Release" / name]:
+        if candidate.exists():
+            return candidate
+    print_error(f"{name} was not found in {build_folder}")
+    sys.exit(1)
+
+def scene_entry(name, stats):
+    # Frame-time statistics from a headless run, in the micro benchmarks' result format
+    return {
+        "name": name,
+        "unit": "ms",
+        "items_per_op": 1,
+        "iterations": stats["frames"],
+        "median": stats["p50_ms"],
+        "mean": stats["mean_ms"],
+        "stddev": stats["stddev_ms"],
+        "min": stats["min_ms"],
+        "counters": {"p90": stats["p90_ms"], "p99": stats["p99_ms"], "max": stats["max_ms"]},
+        "samples": stats["frame_ms"],
+    }
+
+def mann_whitney_p(a, b):
+    # Two-sided p-value of the Mann-Whitney U test, normal approximation with tie correction.
+    # Makes no assumption about the shape of the timing distributions, which are rarely normal.
+    n1, n2 = len(a), len(b)
+    if n1 == 0 or n2 == 0:
+        return 1.0
+
+    values = sorted([(v, 0) for v in a] + [(v, 1) for v in b])
+    ranks = [0.0] * len(values)
+    tie_term = 0.0
+    i = 0
+    while i < len(values):
+        j = i
+        while j + 1 < len(values) and values[j + 1][0] == values[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1.0
+        ties = j - i + 1
+        tie_term += ties ** 3 - ties
+        i = j + 1
+
+    rank_sum_a = sum(rank for rank, (_, group) in zip(ranks, values) if group == 0)
+    u = rank_sum_a - n1 * (n1 + 1) / 2.0
+    n = n1 + n2
+    variance = n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1)))
+    if variance <= 0.0:
+        return 1.0
+    z = (abs(u - n1 * n2 / 2.0) - 0.5) / math.sqrt(variance)
+    return math.erfc(max(z, 0.0) / math.sqrt(2.0))
+
+def compare_results(baseline, current, threshold, alpha):
+    # A benchmark regressed when its median got slower by more than threshold percent and the
+    # samples differ significantly; both are needed, so noise and negligible shifts pass
+    baseline_entries = {entry["name"]: entry for entry in baseline["benchmarks"]}
+    regressions = []
+
+    print(f"\n{'Benchmark':<52} {'Baseline':>12} {'Current':>12} {'Change':>9} {'p':>8}")
+    for entry in current["benchmarks"]:
+        base = baseline_entries.get(entry["name"])
+        if base is None or base["median"] <= 0.0:
+            print(f"{entry['name']:<52} {'-':>12} {entry['median']:>10.3f}{entry['unit']:<2} {'new':>9}")
+            continue
+
+        change = (entry["median"] - base["median"]) / base["median"] * 100.0
+        p = mann_whitney_p(base["samples"], entry["samples"])
+        line = f"{entry['name']:<52} {base['median']:>10.3f}{base['unit']:<2} {entry['median']:>10.3f}{entry['unit']:<2} {change:>+8.1f}% {p:>8.4f}"
+        if change > threshold and p < alpha:
+            regressions.append(entry["name"])
+            print(f"{Colors.RED}{line}{Colors.RESET}")
+        elif change < -threshold and p < alpha:
+            print(f"{Colors.GREEN}{line}{Colors.RESET}")
+        else:
+            print(line)
+
+    missing = sorted(set(baseline_entries) - {entry["name"] for entry in current["benchmarks"]})
+    for name in missing:
+        print_warning(f"{name} is in the baseline but was not run")
+    return regressions
+
+def build_bench(argv):
+    parser = argparse.ArgumentParser(prog="build.py bench", description="Build and run the benchmarks, optionally comparing against a baseline")
+    parser.add_argument("--compare", metavar="BASELINE", help="Results JSON from an earlier run to compare against")
+    parser.add_argument("--output", default="bench_results.json", help="Where to write this run's results (default bench_results.json)")
+    parser.add_argument("--filter", default="", help="Only micro benchmarks whose name contains this text")
+    parser.add_argument("--frames", type=int, default=600, help="Measured frames per scene run (default 600)")
+    parser.add_argument("--threshold", type=float, default=5.0, help="Median slowdown in percent that counts as a regression (default 5)")
+    parser.add_argument("--alpha", type=float, default=0.01, help="Significance level of the Mann-Whitney U test (default 0.01)")
+    parser.add_argument("--skip-scenes", action="store_true", help="Only run the micro benchmarks")
+    parser.add_argument("--idle-cpu", type=float, default=0.0, metavar="SECONDS", help="Also measure the CPU time of the idle sandbox window in each power mode (needs a display)")
+    args = parser.parse_args(argv)
+
+    project_root = Path(__file__).parent.resolve().parent.resolve()
+    build_folder = project_root / "build-bench"
+    build_folder.mkdir(parents=True, exist_ok=True)
+
+    print_info("Configuring benchmark build...")
+    run_command(f'cmake "{project_root}" -DCMAKE_BUILD_TYPE=Release -DCORE_BUILD_BENCHMARKS=ON', build_folder)
+    print_info("Compiling benchmarks...")
+    run_command("cmake --build . --config Release --target raylib_imgui_hybrid_bench", build_folder)
+    executable = find_bench_executable(build_folder)
+
+    print_info("Checking batch math against raymath...")
+    run_command(f'"{executable}" --check-math', build_folder)
+
+    print_info("Running micro benchmarks...")
+    micro_path = build_folder / "micro_results.json"
+    filter_arg = f' "--filter={args.filter}"' if args.filter else ""
+    run_command(f'"{executable}" "--json={micro_path}"{filter_arg}', build_folder)
+    with open(micro_path) as file:
+        results = json.load(file)
+
+    if not args.skip_scenes:
+        for name, switches in BENCH_SCENES:
+            print_info(f"Running {name} headless...")
+            stats_path = build_folder / "scene_stats.json"
+            scene_args = " ".join(switches + [f"--frames={args.frames}", f'"--stats={stats_path}"'])
+            run_command(f'"{executable}" --scene {scene_args}', executable.parent)
+            with open(stats_path) as file:
+                results["benchmarks"].append(scene_entry(name, json.load(file)))
+
+    if args.idle_cpu > 0.0:
+        for mode in ("continuous", "on-demand"):
+            print_info(f"Measuring idle CPU, {mode}...")
+            run_command(f'"{executable}" --idle-cpu={args.idle_cpu} --power={mode}', executable.parent)
+
+    output_path = Path(args.output).resolve()
+    with open(output_path, "w") as file:
+        json.dump(results, file, indent=1)
+    print_success(f"Results written to {output_path}")
+
+    if not args.compare:
+        return 0
+
+    with open(args.compare) as file:
+        baseline = json.load(file)
+    if baseline.get("context", {}).get("renderer") != results["context"].get("renderer"):
+        print_warning("The baseline was recorded on a different renderer, GPU timings are not comparable")
+
+    regressions = compare_results(baseline, results, args.threshold, args.alpha)
+    if regressions:
+        print_error(f"{len(regressions)} regression(s): " + ", ".join(regressions))
+        return 1
+    print_success("No regressions")
+    return 0
+
+# SIMD backends of the batch math, each built in its own folder by the check-math command:
+# (name, extra CMake switches). NEON is the default on ARM hosts; WebAssembly has no bench target.
+def math_backends():
+    backends = [("default", [])]
+    if platform.machine().lower() in ("x86_64", "amd64"):
+        backends.append(("avx2", ["-DCORE_SIMD_AVX2=ON"]))
+    backends.append(("scalar", ["-DCORE_MATH_FORCE_SCALAR=ON"]))
+    return backends
+
+def check_math():
+    project_root = Path(__file__).parent.resolve().parent.resolve()
+    for name, switches in math_backends():
+        build_folder = project_root / f"build-bench-{name}"
+        build_folder.mkdir(parents=True, exist_ok=True)
+
+        print_info(f"Building the {name} math backend...")
+        run_command(f'cmake "{project_root}" -DCMAKE_BUILD_TYPE=Release -DCORE_BUILD_BENCHMARKS=ON ' + " ".join(switches), build_folder)
+        run_command("cmake --build . --config Release --target raylib_imgui_hybrid_bench", build_folder)
+        run_command(f'"{find_bench_executable(build_folder)}" --check-math', build_folder)
+
+    print_success("Every math backend matches raymath")
+    return 0
+
+def check_allocations():
+    # Every bench scene, headless with the memory tracker compiled in: a measured frame that
+    # allocates on the heap fails the run, which then lists where the allocations came from
+    project_root = Path(__file__).parent.resolve().parent.resolve()
+    build_folder = project_root / "build-bench-memory"
+    build_folder.mkdir(parents=True, exist_ok=True)
+
+    print_info("Building with memory tracking...")
+    run_command(f'cmake "{project_root}" -DCMAKE_BUILD_TYPE=Release -DCORE_BUILD_BENCHMARKS=ON -DCORE_ENABLE_MEMORY_TRACKING=ON', build_folder)
+    run_command("cmake --build . --config Release --target raylib_imgui_hybrid_bench", build_folder)
+    executable = find_bench_executable(build_folder)
+
+    for name, switches in BENCH_SCENES:
+        print_info(f"Running {name} headless...")
+        scene_args = " ".join(switches + ["--frames=120", "--max-allocations=0", '"--stats="'])
+        run_command(f'"{executable}" --scene {scene_args}', executable.parent)
+
+    print_success("No measured frame allocated on the heap")
+    return 0
+
+def main():
+    # build.py [web] builds and serves the web target, build.py bench [...] runs the benchmarks,
+    # build.py check-math checks the batch math against raymath on every SIMD backend,
+    # build.py check-allocations checks that the bench scenes run without heap allocations
+    command = sys.argv[1] if len(sys.argv) > 1 else "web"
+    if command == "web":
+        build_web()
+    elif command == "bench":
+        sys.exit(build_bench(sys.argv[2:]))
+    elif command == "check-math":
+        sys.exit(check_math())
+    elif command == "check-allocations":
+        sys.exit(check_allocations())
+    else:
+        print_error(f"Unknown command '{command}', expected 'web', 'bench', 'check-math' or 'check-allocations'")
+        sys.exit(1)
+
 if __name__ == "__main__":
     main()
\ No newline at end of file
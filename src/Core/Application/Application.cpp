@@ -1,6 +1,15 @@
 #include "Application.h"
 #include "Core/Logging/Log.h"
 #include "Core/Input/Input.h" // IWYU pragma: keep
+#include "Core/Profiling/GpuProfiler.h"
+#include "Core/Profiling/Profiler.h"
+#include "Core/Logging/LogConsoleLayer.h"
+#include "Core/Logging/LogSink.h"
+#include "Core/Memory/MemoryLayer.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Profiling/ProfilerLayer.h"
+#include "Core/Profiling/StartupTrace.h"
+#include "Core/Renderer/DebugDraw.h"
 
 // --- Swap GLAD for standard WebGL headers on the Web ---
 #ifdef CORE_PLATFORM_WEB
@@ -13,11 +22,21 @@
 #include "GLFW/glfw3.h"
 
 #include "imgui.h"
+#include "imgui_internal.h"
 #include "backends/imgui_impl_glfw.h"
 #include "backends/imgui_impl_opengl3.h"
 
 #include "ApplicationLayout.h"
 #include "ApplicationTheme.h"
+#include "FontCache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <format>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 extern "C" 
 {
@@ -27,6 +46,8 @@ extern "C"
 namespace Core 
 {
     FApplication* FApplication::s_Instance = nullptr;
+    int FApplication::s_ArgCount = 0;
+    char** FApplication::s_Args = nullptr;
 
     // --- Web Asynchronous Loop Anchor ---
     #ifdef CORE_PLATFORM_WEB
@@ -48,23 +69,166 @@ namespace Core
     {
         CORE_ASSERT(!s_Instance, "Application already exists!");
         s_Instance = this;
+
+        ApplyCommandLine();
+        if (Config.Headless.bEnabled)
+        {
+            #ifdef CORE_PLATFORM_WEB
+                FLog::CoreWarn("Headless runs are not supported on the web");
+                Config.Headless.bEnabled = false;
+            #else
+                // Measured frames must not wait for vsync, input or other windows
+                Config.bVSync = false;
+                Config.PowerMode = EPowerMode::Continuous;
+                Config.bMultiViewports = false;
+                HeadlessStats.Reserve(static_cast<std::size_t>(std::max(Config.Headless.FrameCount, 0)));
+                #ifdef CORE_ENABLE_MEMORY_TRACKING
+                    // Reading the tracker must not count against the frames it checks
+                    HeadlessMemoryStats.Threads.reserve(HeadlessThreadAllocations.size());
+                #endif
+            #endif
+        }
+
+        JobSystem = CreateScope<FJobSystem>(Config.JobWorkerCount);
+        AssetManager = CreateScope<FAssetManager>(*JobSystem);
+        AssetManager->SetUploadBudget(Config.AssetUploadBudgetBytes, Config.AssetUploadBudgetMs);
+
+        // Work handed to the render thread only runs inside frames
+        if (Config.PowerMode == EPowerMode::OnDemand)
+        {
+            JobSystem->SetAffinityWakeCallback(EJobAffinity::RenderThread, [this]() { RequestRedraw(); });
+            #ifdef CORE_PLATFORM_WEB
+                // WebTick runs the main thread's jobs too
+                JobSystem->SetAffinityWakeCallback(EJobAffinity::MainThread, [this]() { RequestRedraw(); });
+            #endif
+            AssetManager->SetUploadWakeCallback([this]() { RequestRedraw(); });
+        }
+
+        // The UI thread may run FramePipelineDepth frames ahead of the one being reset
+        FrameAllocator = CreateScope<FFrameAllocator>(Config.FrameAllocatorBytes, 2 + static_cast<std::size_t>(std::max(Config.FramePipelineDepth, 0)));
+        // Replaced render targets may still be shown by UI frames built ahead
+        RenderTargetPool = CreateScope<FRenderTargetPool>(1 + std::max(Config.FramePipelineDepth, 0));
+        RenderQueue = CreateScope<FRenderQueue>();
+
+        #ifndef CORE_PLATFORM_WEB
+            if (!Config.LogFilePath.empty())
+            {
+                LogFileSink = CreateRef<FRotatingFileLogSink>(Config.LogFilePath);
+                FLog::AddSink(LogFileSink);
+            }
+        #endif
+
+        if (Config.bConsolePanel)
+        {
+            PushOverlay(new FLogConsoleLayer());
+        }
+        if (Config.bMemoryPanel)
+        {
+            PushOverlay(new FMemoryLayer(*FrameAllocator));
+        }
+        #ifdef CORE_ENABLE_PROFILING
+            PushOverlay(new FProfilerLayer());
+        #endif
     }
 
     FApplication::~FApplication()
     {
+        if (SimulationThread.joinable())
+        {
+            SimulationThread.join();
+        }
+
         if (RenderThread.joinable())
         {
             RenderThread.join();
         }
+
+        if (LogFileSink)
+        {
+            FLog::Flush();
+            FLog::RemoveSink(LogFileSink);
+        }
+    }
+
+    void FApplication::SetCommandLine(int ArgCount, char** Args)
+    {
+        s_ArgCount = ArgCount;
+        s_Args = Args;
+    }
+
+    void FApplication::ApplyCommandLine()
+    {
+        FHeadlessConfig& Headless = Config.Headless;
+        for (int Index = 1; Index < s_ArgCount; Index++)
+        {
+            const std::string_view Arg = s_Args[Index];
+            const std::size_t Equals = Arg.find('=');
+            const std::string_view Switch = Arg.substr(0, Equals);
+            const char* Value = Equals == std::string_view::npos ? "" : s_Args[Index] + Equals + 1;
+
+            const auto ParseNumber = [Arg, Value](auto& Out)
+            {
+                char* End = nullptr;
+                const double Number = std::strtod(Value, &End);
+                if (End == Value || *End != '\0' || Number < 0.0)
+                {
+                    FLog::CoreWarn("Ignoring {}, expected a non-negative number", Arg);
+                    return false;
+                }
+                Out = static_cast<std::remove_reference_t<decltype(Out)>>(Number);
+                return true;
+            };
+
+            if (Switch == "--headless")
+            {
+                Headless.bEnabled = true;
+            }
+            else if (Switch == "--frames")
+            {
+                ParseNumber(Headless.FrameCount);
+            }
+            else if (Switch == "--duration")
+            {
+                if (ParseNumber(Headless.DurationSeconds))
+                    Headless.FrameCount = 0;
+            }
+            else if (Switch == "--warmup")
+            {
+                ParseNumber(Headless.WarmupFrames);
+            }
+            else if (Switch == "--fixed-delta")
+            {
+                ParseNumber(Headless.FixedDeltaSeconds);
+            }
+            else if (Switch == "--stats")
+            {
+                Headless.StatsPath = Value;
+            }
+            else if (Switch == "--max-allocations")
+            {
+                ParseNumber(Headless.MaxFrameAllocations);
+            }
+            else if (Switch == "--power")
+            {
+                if (std::string_view(Value) == "continuous")
+                    Config.PowerMode = EPowerMode::Continuous;
+                else if (std::string_view(Value) == "on-demand")
+                    Config.PowerMode = EPowerMode::OnDemand;
+                else
+                    FLog::CoreWarn("Ignoring {}, expected continuous or on-demand", Arg);
+            }
+        }
     }
 
     void FApplication::PushLayer(FLayer* InLayer)
     {
+        CORE_ASSERT(!bUIPipelined, "The UI logic thread walks the layer stack; push layers in OnStart");
         LayerStack.PushLayer(InLayer);
     }
 
     void FApplication::PushOverlay(FLayer* InOverlay)
     {
+        CORE_ASSERT(!bUIPipelined, "The UI logic thread walks the layer stack; push overlays in OnStart");
         LayerStack.PushOverlay(InOverlay);
     }
 
@@ -74,10 +238,13 @@ namespace Core
         Dispatcher.Dispatch<FWindowCloseEvent>(CORE_BIND_EVENT_FN(FApplication::OnWindowClose));
         Dispatcher.Dispatch<FWindowResizeEvent>(CORE_BIND_EVENT_FN(FApplication::OnWindowResize));
 
+        const int Categories = InEvent.GetCategoryFlags();
         for (auto It = LayerStack.rbegin(); It != LayerStack.rend(); ++It)
         {
             if (InEvent.bHandled) 
                 break;  
+            if (((*It)->GetEventCategoryMask() & Categories) == 0)
+                continue;
             (*It)->OnEvent(InEvent);
         }
     }
@@ -85,6 +252,10 @@ namespace Core
     bool FApplication::OnWindowClose(FWindowCloseEvent&)
     {
         bIsRunning = false;
+
+        // The main thread may be parked in glfwWaitEvents, the UI thread waiting for a redraw
+        WakeMainThread();
+        RequestRedraw();
         return true;
     }
 
@@ -99,13 +270,517 @@ namespace Core
         return false;
     }
 
+    void FApplication::QueueEvent(const FEvent& InEvent)
+    {
+        EventQueue.Push(InEvent);
+        RequestInputRedraw();
+    }
+
+    void FApplication::ProcessEvents()
+    {
+        EventQueue.Drain([this](FEvent& Event) { OnEvent(Event); });
+
+        if (const std::uint64_t Dropped = EventQueue.TakeDroppedCount())
+        {
+            FLog::CoreWarn("Event queue full, dropped {} events", Dropped);
+        }
+    }
+
+    void FApplication::PublishInput()
+    {
+        InputBuffer.Publish(PendingInput);
+    }
+
+    void FApplication::UpdateInput()
+    {
+        InputBuffer.Latch();
+        FInput::BeginFrame(InputBuffer.GetReadBuffer());
+    }
+
+    void FApplication::UpdateLayers(float DeltaSeconds)
+    {
+        CORE_PROFILE_SCOPE("Update");
+        CORE_MEMORY_TAG(Layers);
+
+        for (FLayer* Layer : LayerStack)
+        {
+            CORE_PROFILE_SCOPE(Layer->GetName().c_str());
+            Layer->OnUpdate(DeltaSeconds);
+        }
+
+        CORE_PROFILE_SCOPE("Application OnUpdate");
+        OnUpdate(DeltaSeconds);
+    }
+
+    void FApplication::BuildUI()
+    {
+        CORE_PROFILE_SCOPE("UI Build");
+        CORE_MEMORY_TAG(UI);
+
+        for (FLayer* Layer : LayerStack)
+        {
+            CORE_PROFILE_SCOPE(Layer->GetName().c_str());
+            Layer->OnUIRender();
+        }
+
+        CORE_PROFILE_SCOPE("Application OnUIRender");
+        OnUIRender();
+    }
+
+    void FApplication::FixedUpdate(float FixedDeltaTime)
+    {
+        CORE_PROFILE_SCOPE("Fixed Update");
+
+        for (FLayer* Layer : LayerStack)
+        {
+            CORE_PROFILE_SCOPE(Layer->GetName().c_str());
+            Layer->OnFixedUpdate(FixedDeltaTime);
+        }
+
+        CORE_PROFILE_SCOPE("Application OnFixedUpdate");
+        OnFixedUpdate(FixedDeltaTime);
+    }
+
+    void FApplication::RequestRedraw(float DelaySeconds)
+    {
+        if (Config.PowerMode != EPowerMode::OnDemand)
+            return;
+
+        using FClock = std::chrono::steady_clock;
+        const FClock::time_point Deadline = FClock::now() + std::chrono::duration_cast<FClock::duration>(std::chrono::duration<float>(std::max(DelaySeconds, 0.0f)));
+        {
+            std::lock_guard<std::mutex> Lock(RedrawMutex);
+            if (Deadline >= RedrawDeadline)
+                return;
+            RedrawDeadline = Deadline;
+        }
+        RedrawCondition.notify_one();
+    }
+
+    void FApplication::RequestInputRedraw()
+    {
+        if (Config.PowerMode != EPowerMode::OnDemand)
+            return;
+
+        // ImGui takes a few frames to catch up with input (hover state, auto-fit windows), plus
+        // one per pipelined frame since the UI sees input that much later
+        SettleFrames.store(3 + std::max(Config.FramePipelineDepth, 0), std::memory_order_relaxed);
+        RequestRedraw();
+    }
+
+    bool FApplication::WaitForRedraw()
+    {
+        using FClock = std::chrono::steady_clock;
+
+        #ifdef CORE_PLATFORM_WEB
+            // The browser owns the loop and must not be blocked; ticks with nothing due are skipped.
+            // Fixed updates run inside ticks here, so a simulation keeps every tick.
+            if (Config.PowerMode != EPowerMode::OnDemand || HasFixedUpdate())
+                return true;
+
+            std::lock_guard<std::mutex> Lock(RedrawMutex);
+            if (SettleFrames.load(std::memory_order_relaxed) > 0)
+            {
+                SettleFrames.fetch_sub(1, std::memory_order_relaxed);
+            }
+            else if (RedrawDeadline > FClock::now())
+            {
+                return false;
+            }
+
+            RedrawDeadline = FClock::time_point::max();
+            return true;
+        #else
+            if (Config.PowerMode != EPowerMode::OnDemand)
+                return bIsRunning;
+
+            std::unique_lock<std::mutex> Lock(RedrawMutex);
+            if (SettleFrames.load(std::memory_order_relaxed) > 0)
+            {
+                SettleFrames.fetch_sub(1, std::memory_order_relaxed);
+            }
+            else if (bIsRunning && RedrawDeadline > FClock::now())
+            {
+                CORE_PROFILE_SCOPE("Idle");
+                const FClock::time_point IdleStart = FClock::now();
+                while (bIsRunning && RedrawDeadline > FClock::now())
+                {
+                    if (RedrawDeadline == FClock::time_point::max())
+                        RedrawCondition.wait(Lock);
+                    else
+                        RedrawCondition.wait_until(Lock, RedrawDeadline);
+                }
+                IdleSeconds.fetch_add(std::chrono::duration<double>(FClock::now() - IdleStart).count(), std::memory_order_relaxed);
+            }
+
+            // The frame about to start answers every request made so far
+            RedrawDeadline = FClock::time_point::max();
+            return bIsRunning;
+        #endif
+    }
+
+    void FApplication::RequestImGuiRedraws()
+    {
+        if (Config.PowerMode != EPowerMode::OnDemand)
+            return;
+
+        const ImGuiContext& Context = *ImGui::GetCurrentContext();
+
+        // The text cursor is solid for a moment after each edit, then shown for 0.8 s of every 1.2 s
+        const ImGuiInputTextState& TextState = Context.InputTextState;
+        if (Context.IO.ConfigInputTextCursorBlink && TextState.ID != 0 && TextState.ID == Context.ActiveId)
+        {
+            const float Phase = TextState.CursorAnim > 0.0f ? ImFmod(TextState.CursorAnim, 1.2f) : TextState.CursorAnim;
+            RequestRedraw(Phase < 0.8f ? 0.8f - Phase : 1.2f - Phase);
+        }
+
+        // Delayed tooltips wait on hover timers, which only advance while frames are rendered
+        if (Context.HoverItemDelayId != 0)
+        {
+            float Delay = FLT_MAX;
+            for (const float Threshold : { Context.Style.HoverDelayShort, Context.Style.HoverDelayNormal })
+            {
+                if (Context.HoverItemDelayTimer < Threshold)
+                    Delay = std::min(Delay, Threshold - Context.HoverItemDelayTimer);
+            }
+            if (Context.MouseStationaryTimer < Context.Style.HoverStationaryDelay)
+                Delay = std::min(Delay, Context.Style.HoverStationaryDelay - Context.MouseStationaryTimer);
+
+            if (Delay < FLT_MAX)
+                RequestRedraw(Delay);
+        }
+
+        // The Ctrl+Tab window switcher fades in on its own
+        if (Context.NavWindowingTarget)
+            RequestRedraw();
+    }
+
+    float FApplication::AdvanceFrameTime()
+    {
+        const double CurrentTime = glfwGetTime();
+        const double Elapsed = CurrentTime - PreviousTime - IdleSeconds.exchange(0.0, std::memory_order_relaxed);
+        PreviousTime = CurrentTime;
+
+        // Headless runs step by a scripted delta so every run simulates the same frames
+        if (Config.Headless.bEnabled && Config.Headless.FixedDeltaSeconds > 0.0f)
+            return Config.Headless.FixedDeltaSeconds;
+
+        return static_cast<float>(std::max(Elapsed, 0.0));
+    }
+
+    void FApplication::EndHeadlessFrame()
+    {
+        if (!Config.Headless.bEnabled || !bIsRunning)
+            return;
+
+        const FHeadlessConfig& Headless = Config.Headless;
+        const double Now = glfwGetTime();
+        const double FrameSeconds = Now - HeadlessFrameEnd;
+        HeadlessFrameEnd = Now;
+
+        if (HeadlessFrameIndex++ < Headless.WarmupFrames)
+        {
+            HeadlessMeasureStart = Now;
+            return;
+        }
+        HeadlessStats.Add(FrameSeconds);
+        CountHeadlessAllocations();
+
+        const bool bComplete = Headless.FrameCount > 0
+            ? HeadlessStats.GetCount() >= static_cast<std::size_t>(Headless.FrameCount)
+            : Now - HeadlessMeasureStart >= Headless.DurationSeconds;
+        if (bComplete)
+        {
+            // Ends the run the way closing the window does, so layers see the same shutdown
+            FEvent CloseEvent = FWindowCloseEvent();
+            OnEvent(CloseEvent);
+        }
+    }
+
+    void FApplication::CountHeadlessAllocations()
+    {
+        #ifdef CORE_ENABLE_MEMORY_TRACKING
+            // The tracker closes a frame's counters when the next one begins, so what it reports now
+            // is the previous frame; the first measured frame is read during the second, and the
+            // last one is never read
+            if (Config.Headless.MaxFrameAllocations < 0 || HeadlessStats.GetCount() < 2)
+                return;
+
+            FMemoryTracker::GetStats(HeadlessMemoryStats);
+            std::uint64_t FrameAllocations = 0;
+            for (std::size_t Tag = 0; Tag < HeadlessTagAllocations.size(); Tag++)
+            {
+                HeadlessTagAllocations[Tag] += HeadlessMemoryStats.Tags[Tag].AllocationsLastFrame;
+                FrameAllocations += HeadlessMemoryStats.Tags[Tag].AllocationsLastFrame;
+            }
+            for (const FMemoryThreadStats& Thread : HeadlessMemoryStats.Threads)
+            {
+                if (Thread.ThreadIndex < HeadlessThreadAllocations.size())
+                    HeadlessThreadAllocations[Thread.ThreadIndex] += Thread.AllocationsLastFrame;
+            }
+
+            if (FrameAllocations > static_cast<std::uint64_t>(Config.Headless.MaxFrameAllocations))
+                HeadlessFramesOverBudget++;
+        #endif
+    }
+
+    void FApplication::ReportHeadlessAllocations()
+    {
+        const int MaxFrameAllocations = Config.Headless.MaxFrameAllocations;
+        if (MaxFrameAllocations < 0)
+            return;
+
+        #ifdef CORE_ENABLE_MEMORY_TRACKING
+            if (HeadlessFramesOverBudget == 0)
+            {
+                FLog::CoreDebug("Headless run: no measured frame made more than {} heap allocations", MaxFrameAllocations);
+                return;
+            }
+
+            // Everything counted in the measured frames, not just in the frames over the limit
+            FLog::CoreError("Headless run: {} measured frames made more than {} heap allocations", HeadlessFramesOverBudget, MaxFrameAllocations);
+            for (std::size_t Tag = 0; Tag < HeadlessTagAllocations.size(); Tag++)
+            {
+                if (HeadlessTagAllocations[Tag] > 0)
+                    FLog::CoreError("  tag {}: {} allocations", FMemoryTracker::GetTagName(static_cast<EMemoryTag>(Tag)), HeadlessTagAllocations[Tag]);
+            }
+            for (std::size_t Thread = 0; Thread < HeadlessThreadAllocations.size(); Thread++)
+            {
+                if (HeadlessThreadAllocations[Thread] > 0)
+                    FLog::CoreError("  thread {}: {} allocations", Thread, HeadlessThreadAllocations[Thread]);
+            }
+        #else
+            FLog::CoreError("--max-allocations needs a build with CORE_ENABLE_MEMORY_TRACKING");
+        #endif
+        ExitCode = 1;
+    }
+
+    void FApplication::WriteHeadlessStats()
+    {
+        const FHeadlessConfig& Headless = Config.Headless;
+        if (!Headless.bEnabled)
+            return;
+
+        const FFrameStatsSummary Summary = HeadlessStats.Summarize();
+        FLog::CoreDebug("Headless run: {} frames, mean {:.3f} ms, stddev {:.3f} ms, p99 {:.3f} ms",
+            Summary.Frames, Summary.MeanMs, Summary.StdDevMs, Summary.P99Ms);
+        ReportHeadlessAllocations();
+        if (Headless.StatsPath.empty())
+            return;
+
+        const char* Renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+        const FFrameStats::FInfo Info =
+        {
+            { "application", Name },
+            { "renderer", Renderer ? Renderer : "unknown" },
+            { "resolution", std::format("{}x{}", Width.load(), Height.load()) },
+            { "fixed_delta", std::format("{}", Headless.FixedDeltaSeconds) },
+            { "warmup_frames", std::to_string(Headless.WarmupFrames) },
+            { "frame_pipeline_depth", std::to_string(Config.FramePipelineDepth) }
+        };
+        if (HeadlessStats.WriteJson(Headless.StatsPath, Info))
+        {
+            FLog::CoreDebug("Frame stats written to {}", Headless.StatsPath);
+        }
+    }
+
+    void FApplication::WaitMainThreadEvents(double TimeoutSeconds)
+    {
+        #ifndef CORE_PLATFORM_WEB
+            if (glfwGetPlatform() == GLFW_PLATFORM_NULL)
+            {
+                std::unique_lock<std::mutex> Lock(MainWakeMutex);
+                if (TimeoutSeconds < 0.0)
+                    MainWakeCondition.wait(Lock, [this]() { return bMainWakePending; });
+                else
+                    MainWakeCondition.wait_for(Lock, std::chrono::duration<double>(TimeoutSeconds), [this]() { return bMainWakePending; });
+                bMainWakePending = false;
+                return;
+            }
+        #endif
+
+        if (TimeoutSeconds < 0.0)
+            glfwWaitEvents();
+        else
+            glfwWaitEventsTimeout(TimeoutSeconds);
+    }
+
+    void FApplication::WakeMainThread()
+    {
+        {
+            std::lock_guard<std::mutex> Lock(MainWakeMutex);
+            bMainWakePending = true;
+        }
+        MainWakeCondition.notify_one();
+        glfwPostEmptyEvent();
+    }
+
+    // This runs on the RENDER THREAD when FramePipelineDepth > 0 (Desktop Only).
+    // It owns GL: scene updates, draw submission and swaps. UI frames come from LogicLoop.
+    void FApplication::PipelinedRenderLoop()
+    {
+        FramePipeline = CreateScope<FFramePipeline>(Config.FramePipelineDepth);
+
+        // Create the ImGui device objects here, the logic thread has no GL context
+        ImGui_ImplOpenGL3_NewFrame();
+        LogicThread = std::thread(&FApplication::LogicLoop, this);
+
+        while (bIsRunning)
+        {
+            FFramePacket* Packet = nullptr;
+            {
+                CORE_PROFILE_SCOPE("Wait For UI");
+                Packet = FramePipeline->AcquireRead(std::chrono::milliseconds(100));
+            }
+            if (!Packet)
+                continue;
+
+            CORE_PROFILE_FRAME();
+            CORE_PROFILE_GPU_FRAME();
+            CORE_PROFILE_SCOPE("Frame");
+            FrameAllocator->BeginFrame();
+            CORE_MEMORY_FRAME();
+
+            {
+                CORE_PROFILE_SCOPE("Events");
+                UpdateInput();
+                ProcessEvents();
+            }
+
+            JobSystem->ExecuteAffinityJobs(EJobAffinity::RenderThread);
+            AssetManager->Update();
+            RenderTargetPool->BeginFrame();
+            RenderQueue->BeginFrame();
+
+            const float DeltaSeconds = AdvanceFrameTime();
+
+            FDebugDraw::BeginFrame(DeltaSeconds);
+
+            int CurrentW = Width;
+            int CurrentH = Height;
+
+            UpdateLayers(DeltaSeconds);
+
+            glViewport(0, 0, CurrentW, CurrentH);
+            glClearColor(0.12f, 0.12f, 0.12f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+            {
+                CORE_PROFILE_SCOPE("Render DrawData");
+                CORE_PROFILE_GPU_SCOPE("UI");
+                ImGui_ImplOpenGL3_RenderDrawData(Packet->DrawData.Get());
+            }
+
+            {
+                CORE_PROFILE_SCOPE("Swap");
+                glfwSwapBuffers(WindowHandle);
+            }
+            FStartupTrace::MarkFrame();
+            EndHeadlessFrame();
+
+            // Hand the slot back along with the input this frame saw
+            Packet->Input = FInput::GetState();
+            FramePipeline->ReleaseRead(*Packet);
+        }
+
+        FramePipeline->Abort();
+        RequestRedraw();
+        if (LogicThread.joinable())
+        {
+            LogicThread.join();
+        }
+        FramePipeline.reset();
+    }
+
+    // This runs on the LOGIC THREAD when FramePipelineDepth > 0 (Desktop Only).
+    // Builds the ImGui frame and snapshots its draw data while the GL thread submits the previous one.
+    void FApplication::LogicLoop()
+    {
+        CORE_PROFILE_THREAD("UI Logic");
+
+        while (bIsRunning)
+        {
+            FFramePacket* Packet = FramePipeline->AcquireWrite(std::chrono::milliseconds(100));
+            if (!Packet)
+                continue;
+
+            // Holding the slot while idle is fine, the GL thread has nothing to draw until it is submitted
+            if (!WaitForRedraw())
+                break;
+
+            CORE_PROFILE_SCOPE("UI Frame");
+            FInput::BeginFrame(Packet->Input);
+
+            {
+                CORE_PROFILE_SCOPE("ImGui NewFrame");
+                ImGui_ImplGlfw_NewFrame();
+                ImGui::NewFrame();
+            }
+
+            BuildUI();
+
+            {
+                CORE_PROFILE_SCOPE("ImGui Render");
+                ImGui::Render();
+            }
+            RequestImGuiRedraws();
+
+            // Atlas uploads read ImGui-owned pixels, so they must finish before the next NewFrame
+            bool bHasTextureUpdates = false;
+            for (const ImTextureData* Texture : ImGui::GetPlatformIO().Textures)
+            {
+                bHasTextureUpdates |= Texture->Status != ImTextureStatus_OK;
+            }
+
+            {
+                CORE_PROFILE_SCOPE("Snapshot DrawData");
+                Packet->DrawData.Capture(ImGui::GetDrawData(), bHasTextureUpdates);
+            }
+            Packet->bHasTextureUpdates = bHasTextureUpdates;
+            const std::uint64_t FrameIndex = Packet->FrameIndex;
+            FramePipeline->SubmitWrite(*Packet);
+
+            if (bHasTextureUpdates)
+            {
+                FramePipeline->WaitForCompletion(FrameIndex);
+            }
+        }
+    }
+
+    // This runs on the SIMULATION THREAD (Desktop Only, when FixedUpdateRate > 0)
+    void FApplication::SimulationLoop()
+    {
+        CORE_PROFILE_THREAD("Simulation");
+
+        using FClock = std::chrono::steady_clock;
+
+        const float FixedDeltaTime = GetFixedDeltaTime();
+        const auto Step = std::chrono::duration_cast<FClock::duration>(std::chrono::duration<double>(FixedDeltaTime));
+        const auto MaxLag = Step * std::max(Config.MaxFixedStepsPerFrame, 1);
+
+        auto NextTick = FClock::now();
+        while (bIsRunning)
+        {
+            FixedUpdate(FixedDeltaTime);
+            NextTick += Step;
+
+            // Fell too far behind (debugger, heavy step): drop the backlog rather than spiral
+            const auto Now = FClock::now();
+            if (Now - NextTick > MaxLag)
+            {
+                NextTick = Now;
+            }
+
+            std::this_thread::sleep_until(NextTick);
+        }
+    }
+
     void FApplication::FramebufferSizeCallback(GLFWwindow* Window, int Width, int Height)
     {
         FApplication* App = (FApplication*)glfwGetWindowUserPointer(Window);
         if (App)
         {
-            FWindowResizeEvent Event(Width, Height);
-            App->OnEvent(Event);
+            App->QueueEvent(FWindowResizeEvent(Width, Height));
         }
     }
 
@@ -114,17 +789,147 @@ namespace Core
         FApplication* App = (FApplication*)glfwGetWindowUserPointer(Window);
         if (App)
         {
-            FWindowCloseEvent Event;
-            App->OnEvent(Event);
+            App->QueueEvent(FWindowCloseEvent());
         }
     }
 
-    void FApplication::Run()
+    void FApplication::KeyCallback(GLFWwindow* Window, int Key, int, int Action, int)
     {
-        if (!glfwInit())
+        FApplication* App = (FApplication*)glfwGetWindowUserPointer(Window);
+        if (!App || Key < 0 || Key >= FInputState::MaxKeys)
+            return;
+
+        switch (Action)
         {
-            FLog::CoreError("Failed to init GLFW");
+            case GLFW_PRESS:
+                App->PendingInput.Keys.set(Key);
+                App->QueueEvent(FKeyPressedEvent(Key));
+                break;
+            case GLFW_REPEAT:
+                App->QueueEvent(FKeyPressedEvent(Key, true));
+                break;
+            case GLFW_RELEASE:
+                App->PendingInput.Keys.reset(Key);
+                App->QueueEvent(FKeyReleasedEvent(Key));
+                break;
+        }
+    }
+
+    void FApplication::CharCallback(GLFWwindow* Window, unsigned int CodePoint)
+    {
+        FApplication* App = (FApplication*)glfwGetWindowUserPointer(Window);
+        if (App)
+        {
+            App->QueueEvent(FKeyTypedEvent(static_cast<int>(CodePoint)));
+        }
+    }
+
+    void FApplication::MouseButtonCallback(GLFWwindow* Window, int Button, int Action, int)
+    {
+        FApplication* App = (FApplication*)glfwGetWindowUserPointer(Window);
+        if (!App || Button < 0 || Button >= FInputState::MaxMouseButtons)
             return;
+
+        if (Action == GLFW_PRESS)
+        {
+            App->PendingInput.MouseButtons.set(Button);
+            App->QueueEvent(FMouseButtonPressedEvent(Button));
+        }
+        else if (Action == GLFW_RELEASE)
+        {
+            App->PendingInput.MouseButtons.reset(Button);
+            App->QueueEvent(FMouseButtonReleasedEvent(Button));
+        }
+    }
+
+    void FApplication::CursorPosCallback(GLFWwindow* Window, double XPos, double YPos)
+    {
+        FApplication* App = (FApplication*)glfwGetWindowUserPointer(Window);
+        if (App)
+        {
+            App->PendingInput.MouseX = static_cast<float>(XPos);
+            App->PendingInput.MouseY = static_cast<float>(YPos);
+            App->QueueEvent(FMouseMovedEvent(App->PendingInput.MouseX, App->PendingInput.MouseY));
+        }
+    }
+
+    void FApplication::ScrollCallback(GLFWwindow* Window, double XOffset, double YOffset)
+    {
+        FApplication* App = (FApplication*)glfwGetWindowUserPointer(Window);
+        if (App)
+        {
+            App->PendingInput.ScrollX += static_cast<float>(XOffset);
+            App->PendingInput.ScrollY += static_cast<float>(YOffset);
+            App->QueueEvent(FMouseScrolledEvent(static_cast<float>(XOffset), static_cast<float>(YOffset)));
+        }
+    }
+
+    void FApplication::WindowRefreshCallback(GLFWwindow* Window)
+    {
+        FApplication* App = (FApplication*)glfwGetWindowUserPointer(Window);
+        if (App)
+        {
+            App->bWindowEventsPending = true;
+        }
+    }
+
+    void FApplication::WindowStateCallback(GLFWwindow* Window, int)
+    {
+        WindowRefreshCallback(Window);
+    }
+
+    void FApplication::Run()
+    {
+        CORE_PROFILE_THREAD("Main");
+        CORE_MEMORY_TAG(Application);
+
+        // CPU-only startup work overlaps GLFW and window creation below
+        FJobCounter FontJobs;
+        void* FontData = nullptr;
+        std::size_t FontDataSize = 0;
+        #ifndef CORE_PLATFORM_WEB
+            JobSystem->Submit([&FontData, &FontDataSize]()
+            {
+                CORE_STARTUP_PHASE("Read Font");
+                FontData = ImFileLoadToMemory(ApplicationFontPath.data(), "rb", &FontDataSize);
+            }, &FontJobs);
+
+            if (!Config.FontCachePath.empty())
+            {
+                JobSystem->Submit([this]()
+                {
+                    CORE_STARTUP_PHASE("Map Font Cache");
+                    PreloadFontCache(Config.FontCachePath);
+                }, &FontJobs);
+            }
+        #endif
+
+        JobSystem->Submit([this]()
+        {
+            CORE_STARTUP_PHASE("OnPreload");
+            OnPreload();
+        }, &PreloadJobs);
+
+        {
+            CORE_STARTUP_PHASE("glfwInit");
+            bool bInitialized = glfwInit();
+            #ifndef CORE_PLATFORM_WEB
+                // No display server: render offscreen through OSMesa on GLFW's null platform
+                if (!bInitialized && Config.Headless.bEnabled)
+                {
+                    FLog::CoreWarn("No display available, rendering through OSMesa on GLFW's null platform");
+                    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+                    bInitialized = glfwInit();
+                }
+            #endif
+            if (!bInitialized)
+            {
+                FLog::CoreError("Failed to init GLFW");
+                JobSystem->Wait(FontJobs);
+                IM_FREE(FontData);
+                JobSystem->Wait(PreloadJobs);
+                return;
+            }
         }
 
         // --- FIX: Downgrade Context Version Profile for WebGL ---
@@ -141,11 +946,28 @@ namespace Core
         glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
     #endif
 
-        WindowHandle = glfwCreateWindow(Width, Height, Name.c_str(), nullptr, nullptr);
+        #ifndef CORE_PLATFORM_WEB
+            if (Config.Headless.bEnabled)
+            {
+                glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+                if (glfwGetPlatform() == GLFW_PLATFORM_NULL)
+                {
+                    glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+                }
+            }
+        #endif
+
+        {
+            CORE_STARTUP_PHASE("Create Window");
+            WindowHandle = glfwCreateWindow(Width, Height, Name.c_str(), nullptr, nullptr);
+        }
         if (!WindowHandle)
         {
             FLog::CoreError("Failed to create GLFW window");
             glfwTerminate();
+            JobSystem->Wait(FontJobs);
+            IM_FREE(FontData);
+            JobSystem->Wait(PreloadJobs);
             return;
         }
 
@@ -153,21 +975,86 @@ namespace Core
         glfwSetFramebufferSizeCallback(WindowHandle, FramebufferSizeCallback);
         glfwSetWindowCloseCallback(WindowHandle, WindowCloseCallback);
 
-        IMGUI_CHECKVERSION();
-        ImGui::CreateContext();
-        
-        SetApplicationTheme();
-        LoadApplicationDefaultIni();
+        // Installed before the ImGui backend, which chains to them
+        glfwSetKeyCallback(WindowHandle, KeyCallback);
+        glfwSetCharCallback(WindowHandle, CharCallback);
+        glfwSetMouseButtonCallback(WindowHandle, MouseButtonCallback);
+        glfwSetCursorPosCallback(WindowHandle, CursorPosCallback);
+        glfwSetScrollCallback(WindowHandle, ScrollCallback);
+        #ifndef CORE_PLATFORM_WEB
+            glfwSetWindowFocusCallback(WindowHandle, WindowStateCallback);
+            glfwSetCursorEnterCallback(WindowHandle, WindowStateCallback);
+            glfwSetWindowIconifyCallback(WindowHandle, WindowStateCallback);
+            glfwSetWindowRefreshCallback(WindowHandle, WindowRefreshCallback);
+        #endif
+
+        double CursorX, CursorY;
+        glfwGetCursorPos(WindowHandle, &CursorX, &CursorY);
+        PendingInput.MouseX = static_cast<float>(CursorX);
+        PendingInput.MouseY = static_cast<float>(CursorY);
+        PublishInput();
+
+        {
+            CORE_STARTUP_PHASE("ImGui Setup");
+            IMGUI_CHECKVERSION();
+            CORE_MEMORY_INSTALL_IMGUI_ALLOCATOR();
+            ImGui::CreateContext();
+
+            {
+                CORE_STARTUP_PHASE("Wait For Font");
+                JobSystem->Wait(FontJobs);
+            }
+
+            #ifndef CORE_PLATFORM_WEB
+                if (!Config.FontCachePath.empty())
+                {
+                    InstallFontCache(Config.FontCachePath);
+                }
+            #endif
+
+            SetApplicationTheme(ApplicationFontPath, FontData, static_cast<int>(FontDataSize));
+            LoadApplicationDefaultIni();
+
+            #ifndef CORE_PLATFORM_WEB
+                // Every headless run starts from the default layout and leaves the user's alone
+                if (Config.Headless.bEnabled)
+                {
+                    ImGui::GetIO().IniFilename = nullptr;
+                }
+
+                if (Config.bMultiViewports)
+                {
+                    ImGui::GetIO().ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;
+                }
+            #endif
+
+            ImGui_ImplGlfw_InitForOpenGL(WindowHandle, true);
 
-        ImGui_ImplGlfw_InitForOpenGL(WindowHandle, true);
+            #ifndef CORE_PLATFORM_WEB
+                // GLFW windows belong to the main thread; ImGui's hooks for them are re-routed there
+                const ImGuiIO& IO = ImGui::GetIO();
+                if ((IO.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) && (IO.BackendFlags & ImGuiBackendFlags_PlatformHasViewports))
+                {
+                    PlatformWindowProxy = CreateScope<FPlatformWindowProxy>(*JobSystem, *RenderTargetPool, WindowHandle);
+                }
+            #endif
+        }
 
         // --- Separate Paths for Web vs Desktop ---
         #ifdef CORE_PLATFORM_WEB
             // Web lacks secondary graphics threads. Execute everything inline.
-            ImGui_ImplOpenGL3_Init("#version 100");
-            rlLoadExtensions((void*)glfwGetProcAddress);
-            rlglInit(Width, Height);
-            OnStart();
+            {
+                CORE_STARTUP_PHASE("GL Setup");
+                ImGui_ImplOpenGL3_Init("#version 100");
+                rlLoadExtensions((void*)glfwGetProcAddress);
+                rlglInit(Width, Height);
+                CORE_PROFILE_GPU_INIT();
+            }
+            JobSystem->Wait(PreloadJobs);
+            {
+                CORE_STARTUP_PHASE("OnStart");
+                OnStart();
+            }
             PreviousTime = glfwGetTime();
             bIsRunning = true;
 
@@ -179,26 +1066,46 @@ namespace Core
             bIsRunning = true;
             RenderThread = std::thread(&FApplication::RenderLoop, this);
 
+            // Main-thread jobs are picked up after glfwWaitEvents, which needs waking for them
+            JobSystem->SetAffinityWakeCallback(EJobAffinity::MainThread, [this]() { WakeMainThread(); });
+
             while (bIsRunning)
             {
-                glfwWaitEvents();
+                WaitMainThreadEvents();
+                PublishInput();
+                JobSystem->ExecuteAffinityJobs(EJobAffinity::MainThread);
+
+                // Queued events already asked for frames. Wake-ups that only ran main thread
+                // jobs, such as presenting undocked windows, must not, or OnDemand never idles.
+                bool bWindowEvents = std::exchange(bWindowEventsPending, false);
+                if (PlatformWindowProxy && PlatformWindowProxy->TakeWindowEvents())
+                    bWindowEvents = true;
+                if (bWindowEvents)
+                    RequestInputRedraw();
+
                 if (glfwWindowShouldClose(WindowHandle)) 
                 {
                     bIsRunning = false;
                 }
             }
+            RequestRedraw();
 
+            // The render thread may still wait on platform windows being presented or destroyed
             while (!bRenderLoopFinished)
             {
-                glfwWaitEventsTimeout(0.005);
+                WaitMainThreadEvents(0.005);
+                JobSystem->ExecuteAffinityJobs(EJobAffinity::MainThread);
             }
 
             if (RenderThread.joinable())
             {
                 RenderThread.join();
             }
+            JobSystem->ExecuteAffinityJobs(EJobAffinity::MainThread);
 
+            SaveFontCache();
             ImGui_ImplGlfw_Shutdown();
+            PlatformWindowProxy.reset();
             ImGui::DestroyContext();
             glfwDestroyWindow(WindowHandle);
             glfwTerminate();
@@ -209,47 +1116,105 @@ namespace Core
     #ifdef CORE_PLATFORM_WEB
     void FApplication::WebTick()
     {
+        // Polled ahead of the frame so that input can end an idle stretch
         glfwPollEvents();
+        if (!WaitForRedraw())
+        {
+            // Skipped ticks are not frame time
+            PreviousTime = glfwGetTime();
+            return;
+        }
 
-        double CurrentTime = glfwGetTime();
-        float DeltaSeconds = static_cast<float>(CurrentTime - PreviousTime);
-        PreviousTime = CurrentTime;
+        CORE_PROFILE_FRAME();
+        CORE_PROFILE_GPU_FRAME();
+        CORE_PROFILE_SCOPE("Frame");
+        FrameAllocator->BeginFrame();
+        CORE_MEMORY_FRAME();
 
-        for (FLayer* Layer : LayerStack)
-            Layer->OnUpdate(DeltaSeconds);
+        {
+            CORE_PROFILE_SCOPE("Events");
+            PublishInput();
+            UpdateInput();
+            ProcessEvents();
+        }
 
-        OnUpdate(DeltaSeconds);
+        // One thread plays both roles on the web
+        JobSystem->ExecuteAffinityJobs(EJobAffinity::MainThread);
+        JobSystem->ExecuteAffinityJobs(EJobAffinity::RenderThread);
+        AssetManager->Update();
+        RenderTargetPool->BeginFrame();
+        RenderQueue->BeginFrame();
 
-        ImGui_ImplOpenGL3_NewFrame();
-        ImGui_ImplGlfw_NewFrame();
-        ImGui::NewFrame();
+        const float DeltaSeconds = AdvanceFrameTime();
 
-        for (FLayer* Layer : LayerStack)
-            Layer->OnUIRender();
+        FDebugDraw::BeginFrame(DeltaSeconds);
 
-        OnUIRender();
-        ImGui::Render();
+        // No threads on the web: run the fixed steps inline from an accumulator
+        if (HasFixedUpdate())
+        {
+            const float FixedDeltaTime = GetFixedDeltaTime();
+            FixedTimeAccumulator = std::min(FixedTimeAccumulator + DeltaSeconds, static_cast<double>(FixedDeltaTime) * std::max(Config.MaxFixedStepsPerFrame, 1));
+            while (FixedTimeAccumulator >= FixedDeltaTime)
+            {
+                FixedUpdate(FixedDeltaTime);
+                FixedTimeAccumulator -= FixedDeltaTime;
+            }
+        }
+
+        UpdateLayers(DeltaSeconds);
+
+        {
+            CORE_PROFILE_SCOPE("ImGui NewFrame");
+            ImGui_ImplOpenGL3_NewFrame();
+            ImGui_ImplGlfw_NewFrame();
+            ImGui::NewFrame();
+        }
+
+        BuildUI();
+
+        {
+            CORE_PROFILE_SCOPE("ImGui Render");
+            ImGui::Render();
+        }
 
         glViewport(0, 0, Width, Height);
         glClearColor(0.12f, 0.12f, 0.12f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        ImGui_ImplOpenGL3_NewFrame();
-        ImGui_ImplGlfw_NewFrame();
-        ImGui::NewFrame();
+        {
+            CORE_PROFILE_SCOPE("ImGui NewFrame");
+            ImGui_ImplOpenGL3_NewFrame();
+            ImGui_ImplGlfw_NewFrame();
+            ImGui::NewFrame();
+        }
 
-        for (FLayer* Layer : LayerStack)
-            Layer->OnUIRender();
-            
-        OnUIRender();
+        BuildUI();
 
-        ImGui::Render();
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
-        glfwSwapBuffers(WindowHandle);
+        {
+            CORE_PROFILE_SCOPE("ImGui Render");
+            ImGui::Render();
+        }
+        RequestImGuiRedraws();
+
+        {
+            CORE_PROFILE_SCOPE("Render DrawData");
+            CORE_PROFILE_GPU_SCOPE("UI");
+            ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+        }
+
+        {
+            CORE_PROFILE_SCOPE("Swap");
+            glfwSwapBuffers(WindowHandle);
+        }
+        FStartupTrace::MarkFrame();
 
         if (!bIsRunning || glfwWindowShouldClose(WindowHandle))
         {
             OnShutdown();
+            AssetManager->UnloadAll();
+            RenderTargetPool->ReleaseAll();
+            RenderQueue->Release();
+            FDebugDraw::Shutdown();
             rlglClose();
             ImGui_ImplOpenGL3_Shutdown();
             ImGui_ImplGlfw_Shutdown();
@@ -264,59 +1229,173 @@ namespace Core
     // This runs on the SECONDARY THREAD (Desktop Only)
     void FApplication::RenderLoop()
     {
-        glfwMakeContextCurrent(WindowHandle);
-        glfwSwapInterval(1); 
+        CORE_PROFILE_THREAD("Render");
+        CORE_MEMORY_TAG(Application);
 
-        rlLoadExtensions((void*)glfwGetProcAddress);
         ImGuiIO& IO = ImGui::GetIO();
-        ImGui_ImplOpenGL3_Init("#version 330");
-        rlglInit(Width, Height);
+        {
+            CORE_STARTUP_PHASE("GL Setup");
+            glfwMakeContextCurrent(WindowHandle);
+            glfwSwapInterval(Config.bVSync ? 1 : 0);
+
+            rlLoadExtensions((void*)glfwGetProcAddress);
+            ImGui_ImplOpenGL3_Init("#version 330");
+            rlglInit(Width, Height);
+            CORE_PROFILE_GPU_INIT();
+        }
+
+        {
+            CORE_STARTUP_PHASE("Wait For OnPreload");
+            JobSystem->Wait(PreloadJobs);
+        }
 
-        OnStart();
+        {
+            CORE_STARTUP_PHASE("OnStart");
+            OnStart();
+        }
         PreviousTime = glfwGetTime();
+        HeadlessFrameEnd = PreviousTime;
+        HeadlessMeasureStart = PreviousTime;
 
-        while (bIsRunning)
+        // Layers are attached by now; the simulation only ever sees a fully started app
+        if (HasFixedUpdate())
+        {
+            SimulationThread = std::thread(&FApplication::SimulationLoop, this);
+        }
+
+        bool bPipelined = Config.FramePipelineDepth > 0;
+        if (bPipelined && (IO.ConfigFlags & ImGuiConfigFlags_ViewportsEnable))
         {
-            double CurrentTime = glfwGetTime();
-            float DeltaSeconds = static_cast<float>(CurrentTime - PreviousTime);
-            PreviousTime = CurrentTime;
+            FLog::CoreWarn("Pipelined frames are not supported with multi-viewports, rendering serially");
+            bPipelined = false;
+        }
+
+        // OnUIRender would run beside OnUpdate, which only the layers can tell is safe
+        if (bPipelined)
+        {
+            const auto Unsupported = std::find_if(LayerStack.begin(), LayerStack.end(), [](const FLayer* Layer) { return !Layer->SupportsPipelinedUI(); });
+            if (Unsupported != LayerStack.end())
+            {
+                FLog::CoreWarn("Layer '{}' does not support pipelined UI, rendering serially", (*Unsupported)->GetName());
+                bPipelined = false;
+            }
+            else if (!SupportsPipelinedUI())
+            {
+                FLog::CoreWarn("The application does not support pipelined UI, rendering serially");
+                bPipelined = false;
+            }
+        }
+        bUIPipelined = bPipelined;
+
+        // Returns once the application stops running, which also skips the serial loop below
+        if (bPipelined)
+        {
+            PipelinedRenderLoop();
+        }
+
+        while (WaitForRedraw())
+        {
+            CORE_PROFILE_FRAME();
+            CORE_PROFILE_GPU_FRAME();
+            CORE_PROFILE_SCOPE("Frame");
+            FrameAllocator->BeginFrame();
+            CORE_MEMORY_FRAME();
+
+            {
+                CORE_PROFILE_SCOPE("Events");
+                UpdateInput();
+                ProcessEvents();
+            }
+
+            JobSystem->ExecuteAffinityJobs(EJobAffinity::RenderThread);
+            AssetManager->Update();
+            RenderTargetPool->BeginFrame();
+            RenderQueue->BeginFrame();
+
+            const float DeltaSeconds = AdvanceFrameTime();
+
+            FDebugDraw::BeginFrame(DeltaSeconds);
 
             int CurrentW = Width;
             int CurrentH = Height;
 
-            for (FLayer* Layer : LayerStack)
-                Layer->OnUpdate(DeltaSeconds);
+            UpdateLayers(DeltaSeconds);
 
-            OnUpdate(DeltaSeconds);
-
-            ImGui_ImplOpenGL3_NewFrame();
-            ImGui_ImplGlfw_NewFrame();
-            ImGui::NewFrame();
+            {
+                CORE_PROFILE_SCOPE("ImGui NewFrame");
+                ImGui_ImplOpenGL3_NewFrame();
+                #ifndef CORE_PLATFORM_WEB
+                    // The backend would query and change every platform window from this thread
+                    if (PlatformWindowProxy)
+                    {
+                        PlatformWindowProxy->NewFrame();
+                    }
+                    else
+                    {
+                        ImGui_ImplGlfw_NewFrame();
+                    }
+                #else
+                    ImGui_ImplGlfw_NewFrame();
+                #endif
+                ImGui::NewFrame();
+            }
 
-            for (FLayer* Layer : LayerStack)
-                Layer->OnUIRender();
+            BuildUI();
 
-            OnUIRender();
-            ImGui::Render();
+            {
+                CORE_PROFILE_SCOPE("ImGui Render");
+                ImGui::Render();
+            }
+            RequestImGuiRedraws();
 
             glViewport(0, 0, CurrentW, CurrentH);
             glClearColor(0.12f, 0.12f, 0.12f, 1.0f);
             glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-            ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+            {
+                CORE_PROFILE_SCOPE("Render DrawData");
+                CORE_PROFILE_GPU_SCOPE("UI");
+                ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+            }
+
+            #ifndef CORE_PLATFORM_WEB
+                // Window changes go to the main thread; the windows are drawn here without leaving
+                // this context
+                if ((IO.ConfigFlags & ImGuiConfigFlags_ViewportsEnable) && PlatformWindowProxy)
+                {
+                    CORE_PROFILE_SCOPE("Platform Windows");
+                    ImGui::UpdatePlatformWindows();
+                    PlatformWindowProxy->RenderWindows();
+                }
+            #endif
 
-            if (IO.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
             {
-                GLFWwindow* BackupCurrentContext = glfwGetCurrentContext();
-                ImGui::UpdatePlatformWindows();
-                ImGui::RenderPlatformWindowsDefault();
-                glfwMakeContextCurrent(BackupCurrentContext);
+                CORE_PROFILE_SCOPE("Swap");
+                glfwSwapBuffers(WindowHandle);
             }
+            FStartupTrace::MarkFrame();
+            EndHeadlessFrame();
+        }
 
-            glfwSwapBuffers(WindowHandle);
+        if (SimulationThread.joinable())
+        {
+            SimulationThread.join();
         }
 
+        WriteHeadlessStats();
+
         OnShutdown();
+        AssetManager->UnloadAll();
+        #ifndef CORE_PLATFORM_WEB
+            if (PlatformWindowProxy)
+            {
+                PlatformWindowProxy->ReleaseRenderTargets();
+            }
+        #endif
+        RenderTargetPool->ReleaseAll();
+        RenderQueue->Release();
+        FDebugDraw::Shutdown();
+        CORE_PROFILE_GPU_SHUTDOWN();
         rlglClose();
         ImGui_ImplOpenGL3_Shutdown();
         bRenderLoopFinished = true;
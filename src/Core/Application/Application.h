@@ -3,13 +3,28 @@
 #include <string>
 #include <thread>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <mutex> // IWYU pragma: keep
 #include "imgui.h" // IWYU pragma: keep
 
 #include "Core/Events/Event.h"
 #include "Core/Events/ApplicationEvent.h"
+#include "Core/Events/EventQueue.h"
+#include "Core/Assets/AssetManager.h"
+#include "Core/Input/InputState.h"
+#include "Core/Jobs/JobSystem.h"
+#include "Core/Logging/Log.h"
+#include "Core/Memory/FrameAllocator.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Profiling/FrameStats.h"
+#include "Core/Base/TripleBuffer.h"
 #include "Core/Layers/LayerStack.h"
+#include "Core/Renderer/FramePipeline.h"
+#include "Core/Renderer/RenderQueue.h"
+#include "Core/Renderer/RenderTargetPool.h"
 #include "Core/Application/ApplicationConfig.h"
+#include "Core/Application/PlatformWindowProxy.h"
 
 // Forward declaration to avoid including internal headers in the public API if possible, 
 #include <raylib-cpp.hpp>
@@ -26,6 +41,14 @@ namespace Core
         virtual ~FApplication();
         static FApplication& Get() { return *s_Instance; }
 
+        // Called by main before the application is created. The constructor applies the switches it
+        // knows on top of the config: --headless, --frames=N, --duration=SECONDS (instead of a frame
+        // count), --warmup=N, --fixed-delta=SECONDS, --stats=PATH and --power=continuous|on-demand.
+        // Others are left to the application.
+        static void SetCommandLine(int ArgCount, char** Args);
+        [[nodiscard]] static int GetArgCount() { return s_ArgCount; }
+        [[nodiscard]] static char** GetArgs() { return s_Args; }
+
         void Run();
         void OnEvent(FEvent& InEvent);
 
@@ -33,13 +56,22 @@ namespace Core
         void PushOverlay(FLayer* InLayer);
 
         // Legacy Virtuals
+        // Runs on a job worker while the window and GL context are created; finishes before OnStart.
+        // CPU-only work such as reading or parsing files: no GL, ImGui or window calls.
+        virtual void OnPreload() {}
         virtual void OnStart() {}
         virtual void OnUpdate([[maybe_unused]] float DeltaTime) {}
+        virtual void OnFixedUpdate([[maybe_unused]] float FixedDeltaTime) {}
         virtual void OnUIRender() {}
         virtual void OnShutdown() {}
+        // Same contract as FLayer::SupportsPipelinedUI, for the application's own OnUIRender
+        [[nodiscard]] virtual bool SupportsPipelinedUI() const { return false; }
         
         // Internal usage for thread
         void RenderLoop();
+        void SimulationLoop();
+        void PipelinedRenderLoop();
+        void LogicLoop();
         
         // --- Add Web Loop Target Signature ---
         #ifdef CORE_PLATFORM_WEB
@@ -52,14 +84,87 @@ namespace Core
         [[nodiscard]] int GetWidth() const { return Width; }
         [[nodiscard]] int GetHeight() const { return Height; }
         void SetSize(int NewWidth, int NewHeight) { Width = NewWidth; Height = NewHeight; }
+        [[nodiscard]] bool IsHeadless() const { return Config.Headless.bEnabled; }
+        // For main to return once Run is done: 1 when a headless run broke
+        // FHeadlessConfig::MaxFrameAllocations, 0 otherwise
+        [[nodiscard]] int GetExitCode() const { return ExitCode; }
+
+        [[nodiscard]] FJobSystem& GetJobSystem() { return *JobSystem; }
+        // Transient memory, recycled two frames later (more while frames are pipelined)
+        [[nodiscard]] FFrameAllocator& GetFrameAllocator() { return *FrameAllocator; }
+        [[nodiscard]] FAssetManager& GetAssetManager() { return *AssetManager; }
+        // Render thread only
+        [[nodiscard]] FRenderTargetPool& GetRenderTargetPool() { return *RenderTargetPool; }
+        // Render thread only. Layers record draws into it; whoever owns the scene pass executes
+        // it there. Commands nobody executed are dropped when the next frame starts.
+        [[nodiscard]] FRenderQueue& GetRenderQueue() { return *RenderQueue; }
+
+        // Simulation
+        [[nodiscard]] bool HasFixedUpdate() const { return Config.FixedUpdateRate > 0.0f; }
+        [[nodiscard]] float GetFixedDeltaTime() const { return HasFixedUpdate() ? 1.0f / Config.FixedUpdateRate : 0.0f; }
+
+        // Any thread. With EPowerMode::OnDemand, makes sure a frame is rendered DelaySeconds from
+        // now at the latest. Continuous mode renders every frame anyway and ignores it.
+        void RequestRedraw(float DelaySeconds = 0.0f);
 
     private:
         static void FramebufferSizeCallback(GLFWwindow* Window, int Width, int Height);
         static void WindowCloseCallback(GLFWwindow* Window);
+        static void KeyCallback(GLFWwindow* Window, int Key, int ScanCode, int Action, int Mods);
+        static void CharCallback(GLFWwindow* Window, unsigned int CodePoint);
+        static void MouseButtonCallback(GLFWwindow* Window, int Button, int Action, int Mods);
+        static void CursorPosCallback(GLFWwindow* Window, double XPos, double YPos);
+        static void ScrollCallback(GLFWwindow* Window, double XOffset, double YOffset);
+        // Events with nothing to queue that still change what is drawn: exposure, and focus,
+        // cursor enter and iconify, which share a signature
+        static void WindowRefreshCallback(GLFWwindow* Window);
+        static void WindowStateCallback(GLFWwindow* Window, int Value);
 
         bool OnWindowClose(FWindowCloseEvent& e);
         bool OnWindowResize(FWindowResizeEvent& e);
 
+        // Main thread: hand an event over to the render thread
+        void QueueEvent(const FEvent& InEvent);
+        // Render thread: dispatch everything queued since the last frame
+        void ProcessEvents();
+
+        // Main thread: make the input captured so far visible to the render thread
+        void PublishInput();
+        // Render thread: latch the newest published input for this frame
+        void UpdateInput();
+
+        // Run every layer, then the application, for the named phase
+        void UpdateLayers(float DeltaSeconds);
+        void BuildUI();
+        void FixedUpdate(float FixedDeltaTime);
+
+        // Thread that starts frames (render, or UI logic when pipelined): with EPowerMode::OnDemand,
+        // sleeps until a redraw is due. Returns false once the application stops running, and on the
+        // web, where the browser drives the loop, when the tick should be skipped.
+        bool WaitForRedraw();
+        // Any thread, for input and window events: redraws now and for the few frames after
+        void RequestInputRedraw();
+        // UI thread, after ImGui::Render: requests the frames ImGui's own timers need
+        void RequestImGuiRedraws();
+        // Frame time since the last frame, minus what was spent waiting for a redraw
+        float AdvanceFrameTime();
+
+        // Headless runs
+        void ApplyCommandLine();
+        // Render thread, after every swap: measures the frame and closes the application once the
+        // run is complete
+        void EndHeadlessFrame();
+        // Render thread, for every measured frame: adds the tracker's counts to the totals below
+        void CountHeadlessAllocations();
+        // Logs where the measured frames allocated when one broke the limit, and fails the run
+        void ReportHeadlessAllocations();
+        void WriteHeadlessStats();
+        // Main thread: glfwWaitEvents, which returns at once on GLFW's null platform; the thread
+        // sleeps until WakeMainThread there instead. A negative timeout waits indefinitely.
+        void WaitMainThreadEvents(double TimeoutSeconds = -1.0);
+        // Any thread
+        void WakeMainThread();
+
     private:
         std::string Name;
         FApplicationConfig Config;
@@ -69,16 +174,70 @@ namespace Core
         GLFWwindow* WindowHandle;
         
         FLayerStack LayerStack;
+        FEventQueue EventQueue;
+
+        // Input: written by the GLFW callbacks, handed over through the triple buffer
+        FInputState PendingInput;
+        TTripleBuffer<FInputState> InputBuffer;
 
         // Threading
         std::thread RenderThread;
+        std::thread SimulationThread;
+        std::thread LogicThread;
+        Scope<FFramePipeline> FramePipeline;
+        // Set before the logic thread starts; the layer stack is frozen from then on
+        bool bUIPipelined = false;
+        Scope<FJobSystem> JobSystem;
+        Scope<FAssetManager> AssetManager;
+        Scope<FFrameAllocator> FrameAllocator;
+        Scope<FRenderTargetPool> RenderTargetPool;
+        Scope<FRenderQueue> RenderQueue;
+        #ifndef CORE_PLATFORM_WEB
+        // Created after the ImGui GLFW backend when multi-viewports are enabled and supported
+        Scope<FPlatformWindowProxy> PlatformWindowProxy;
+        #endif
+        FJobCounter PreloadJobs;
+
+        Ref<FLogSink> LogFileSink;
         std::atomic<bool> bIsRunning;
         std::atomic<bool> bRenderLoopFinished;
         
+        // On-demand rendering. The deadline starts in the past so the first frame always renders.
+        std::mutex RedrawMutex;
+        std::condition_variable RedrawCondition;
+        std::chrono::steady_clock::time_point RedrawDeadline;
+        // Frames still rendered after input so ImGui can settle (hover state, auto-fit windows)
+        std::atomic<int> SettleFrames{ 0 };
+        std::atomic<double> IdleSeconds{ 0.0 };
+
         // Timing
         double PreviousTime = 0.0;
+        double FixedTimeAccumulator = 0.0;
+
+        // Headless runs, render thread
+        FFrameStats HeadlessStats;
+        double HeadlessFrameEnd = 0.0;
+        double HeadlessMeasureStart = 0.0;
+        int HeadlessFrameIndex = 0;
+        #ifdef CORE_ENABLE_MEMORY_TRACKING
+        FMemoryStats HeadlessMemoryStats;
+        std::array<std::uint64_t, static_cast<std::size_t>(EMemoryTag::Count)> HeadlessTagAllocations{};
+        // By tracker thread index; later threads are only in the tag totals
+        std::array<std::uint64_t, 64> HeadlessThreadAllocations{};
+        int HeadlessFramesOverBudget = 0;
+        #endif
+        int ExitCode = 0;
+
+        // Main thread sleep on platforms without an event loop
+        std::mutex MainWakeMutex;
+        std::condition_variable MainWakeCondition;
+        bool bMainWakePending = false;
+        // Main thread: a window callback that queues no event ran since the last loop iteration
+        bool bWindowEventsPending = false;
     
     private:
         static FApplication* s_Instance;
+        static int s_ArgCount;
+        static char** s_Args;
     };
 }
@@ -1,8 +1,42 @@
 #pragma once
+#include <cstddef>
+#include <cstdint>
 #include <string>
 
 namespace Core 
 {
+    enum class EPowerMode : std::uint8_t
+    {
+        // A new frame every display refresh
+        Continuous,
+        // Frames only when something may have changed: input and window events, queued render
+        // thread work, FApplication::RequestRedraw, or ImGui timers such as the text cursor blink
+        OnDemand
+    };
+
+    // Automated performance runs without a visible window, also selected with --headless
+    // (see FApplication::SetCommandLine). Desktop only.
+    struct FHeadlessConfig
+    {
+        bool bEnabled = false;
+        // Frames measured before the run ends; 0 runs for DurationSeconds instead
+        int FrameCount = 600;
+        float DurationSeconds = 10.0f;
+        // Frames rendered before measuring starts, so shader compiles and first uploads stay out of
+        // the statistics
+        int WarmupFrames = 10;
+        // Delta time handed to OnUpdate every frame, so every run simulates the same frames.
+        // 0 passes the measured frame time as usual.
+        float FixedDeltaSeconds = 1.0f / 60.0f;
+        // Frame time statistics are written here as JSON when a headless run ends; normal runs
+        // never write it. Empty writes nothing.
+        std::string StatsPath = "frame_stats.json";
+        // Heap allocations a measured frame may make before the run fails (see
+        // FApplication::GetExitCode), also set with --max-allocations. Counted by the memory
+        // tracker, so it needs CORE_ENABLE_MEMORY_TRACKING. -1 checks nothing.
+        int MaxFrameAllocations = -1;
+    };
+
     struct FApplicationConfig
     {
         std::string Name = "Raylib Hybrid App";
@@ -10,9 +44,64 @@ namespace Core
         int Height = 720;
         bool bVSync = true;
         bool bMaximized = false;
+
+        // Simulation
+        // Rate in Hz of FLayer::OnFixedUpdate, run on its own thread. 0 disables fixed updates.
+        float FixedUpdateRate = 0.0f;
+        // Fixed steps allowed to catch up after a stall before the backlog is dropped
+        int MaxFixedStepsPerFrame = 8;
+
+        // Rendering
+        // 0 builds and submits each frame serially on the render thread. N > 0 builds the UI
+        // (OnUIRender) on a separate logic thread up to N frames ahead of the GL thread, which
+        // keeps running OnUpdate and submission. Adds N frames of UI latency; textures shown in
+        // the UI must stay alive for N frames after they are replaced. Desktop only, and ignored
+        // while ImGui multi-viewports are enabled or unless the application and every layer
+        // return true from SupportsPipelinedUI.
+        int FramePipelineDepth = 0;
+        // OnDemand sleeps while nothing changes, so an idle window costs no CPU. Layers that
+        // animate on their own must call FApplication::RequestRedraw every frame.
+        EPowerMode PowerMode = EPowerMode::Continuous;
+        // Lets ImGui windows be dragged out of the main window into windows of their own, which
+        // are drawn on the render thread and presented by the main thread. Desktop only.
+        bool bMultiViewports = false;
+
+        // Logging
+        // Messages are also written here, rotated at 5 MB with three older files kept.
+        // Empty (the default) disables the file; unused on the web.
+        std::string LogFilePath = {};
+        // Adds the Console window: every message since startup, filtered by level and text
+        bool bConsolePanel = false;
+
+        // Memory
+        // Size of each frame allocator buffer. Larger frames still work but fall back to the heap.
+        std::size_t FrameAllocatorBytes = 4 * 1024 * 1024;
+        // Adds the Memory window: frame allocator usage, and heap statistics per tag when built
+        // with CORE_ENABLE_MEMORY_TRACKING
+        bool bMemoryPanel = false;
+
+        // Jobs
+        // Worker threads of the job system. -1 uses one per hardware thread minus one for rendering.
+        // Always 0 on the web, where Any jobs run inline.
+        int JobWorkerCount = -1;
+
+        // Assets
+        // Per-frame limits for uploading asynchronously loaded assets on the render thread.
+        // Whichever runs out first ends the frame's uploads; one step always runs.
+        std::size_t AssetUploadBudgetBytes = 16 * 1024 * 1024;
+        float AssetUploadBudgetMs = 2.0f;
         
         // Resource paths
         std::string FontPath = "/src/Core/Font/Roboto-Regular.ttf";
         float FontSize = 20.0f;
+        // Rasterized glyphs are kept here between runs. Empty (the default) disables the cache;
+        // unused on the web.
+        std::string FontCachePath = {};
+
+        // Headless
+        // Renders into a hidden window without vsync, forces EPowerMode::Continuous and turns off
+        // multi-viewports, runs a fixed number of frames and quits. Layers run unchanged. Without
+        // a display server, GLFW's null platform renders through OSMesa (llvmpipe on Mesa).
+        FHeadlessConfig Headless = {};
     };
 }
\ No newline at end of file
@@ -3,7 +3,7 @@
 
 namespace Core 
 {
-    void SetApplicationTheme(std::string_view Path)
+    void SetApplicationTheme(std::string_view Path, [[maybe_unused]] void* PreloadedFont, [[maybe_unused]] int PreloadedFontSize)
     {
         ImGuiIO& IO = ImGui::GetIO();
         IO.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
@@ -19,7 +19,10 @@ namespace Core
             // This is guaranteed to fire on web builds
             IO.Fonts->AddFontFromFileTTF("Core/Font/Roboto-Regular.ttf", 18.0f, &FontConfig);
         #else
-            IO.Fonts->AddFontFromFileTTF(Path.data(), 18.0f, &FontConfig);
+            if (PreloadedFont)
+                IO.Fonts->AddFontFromMemoryTTF(PreloadedFont, PreloadedFontSize, 18.0f, &FontConfig);
+            else
+                IO.Fonts->AddFontFromFileTTF(Path.data(), 18.0f, &FontConfig);
         #endif
 
         ImGuiStyle& Style = ImGui::GetStyle();
@@ -3,5 +3,10 @@
 
 namespace Core
 {
-    void SetApplicationTheme(std::string_view path = "Roboto-Regular.ttf");
+    // Font file the theme loads on this platform
+    inline constexpr std::string_view ApplicationFontPath = "Roboto-Regular.ttf";
+
+    // PreloadedFont is the font file already read into IM_ALLOC'd memory; the atlas takes ownership.
+    // Without it the font is read from path.
+    void SetApplicationTheme(std::string_view path = ApplicationFontPath, void* PreloadedFont = nullptr, int PreloadedFontSize = 0);
 }
\ No newline at end of file
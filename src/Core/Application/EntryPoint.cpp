@@ -1,9 +1,25 @@
 #include "EntryPoint.h"
 #include "Application.h"
+#include "Core/Logging/Log.h"
+#include "Core/Profiling/StartupTrace.h"
 
-int main(int, char**)
+#include <string_view>
+
+int main(int argc, char** argv)
 {
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::string_view(argv[i]) == "--startup-trace")
+            Core::FStartupTrace::Enable();
+    }
+
+    Core::FApplication::SetCommandLine(argc, argv);
     auto App = CreateApplication();
     App->Run();
-    return 0;
+    const int ExitCode = App->GetExitCode();
+    App.reset();
+
+    // Everything logged during shutdown reaches the sinks before the process exits
+    Core::FLog::Shutdown();
+    return ExitCode;
 }
\ No newline at end of file
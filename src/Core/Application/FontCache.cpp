@@ -0,0 +1,464 @@
+#include "FontCache.h"
+#include "Core/Base/Core.h"
+#include "Core/Logging/Log.h"
+
+#include <imgui.h>
+#include <imgui_internal.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#if defined(CORE_PLATFORM_WINDOWS)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#elif !defined(CORE_PLATFORM_WEB)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace Core
+{
+    namespace
+    {
+        constexpr std::uint32_t CacheMagic = 0x31434746; // "FGC1"
+        constexpr std::uint32_t CacheVersion = 1;
+
+        struct FCacheHeader
+        {
+            std::uint32_t Magic = CacheMagic;
+            std::uint32_t Version = CacheVersion;
+            std::uint32_t ImGuiVersion = IMGUI_VERSION_NUM;
+            std::uint32_t EntryCount = 0;
+            std::uint64_t PixelBytes = 0;
+        };
+
+        enum EGlyphFlags : std::uint32_t
+        {
+            GlyphFound = 1 << 0,
+            GlyphVisible = 1 << 1
+        };
+
+        // One glyph of one font source at one baked size. Pixels are Alpha8, Width * Height bytes.
+        struct FCacheEntry
+        {
+            std::uint64_t SourceHash = 0;
+            float Size = 0.0f;
+            float Density = 0.0f;
+            std::uint32_t Codepoint = 0;
+            std::uint32_t Flags = 0;
+            float AdvanceX = 0.0f;
+            float X0 = 0.0f, Y0 = 0.0f, X1 = 0.0f, Y1 = 0.0f;
+            std::uint16_t Width = 0;
+            std::uint16_t Height = 0;
+            std::uint32_t PixelOffset = 0;
+        };
+
+        struct FGlyphKey
+        {
+            std::uint64_t SourceHash;
+            float Size;
+            float Density;
+            std::uint32_t Codepoint;
+
+            bool operator==(const FGlyphKey&) const = default;
+        };
+
+        struct FGlyphKeyHash
+        {
+            std::size_t operator()(const FGlyphKey& Key) const
+            {
+                std::uint32_t SizeBits, DensityBits;
+                std::memcpy(&SizeBits, &Key.Size, sizeof(SizeBits));
+                std::memcpy(&DensityBits, &Key.Density, sizeof(DensityBits));
+                std::uint64_t Hash = Key.SourceHash ^ (static_cast<std::uint64_t>(SizeBits) << 32 | DensityBits);
+                Hash ^= static_cast<std::uint64_t>(Key.Codepoint) * 0x9E3779B97F4A7C15ull;
+                return static_cast<std::size_t>(Hash ^ (Hash >> 29));
+            }
+        };
+
+        // Read-only view of the cache file, mapped so only the glyphs actually used are paged in
+        class FMappedFile
+        {
+        public:
+            ~FMappedFile() { Close(); }
+
+            bool Open(const std::string& Path)
+            {
+                #if defined(CORE_PLATFORM_WINDOWS)
+                    FileHandle = CreateFileA(Path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+                    if (FileHandle == INVALID_HANDLE_VALUE)
+                        return false;
+
+                    LARGE_INTEGER FileSize;
+                    GetFileSizeEx(FileHandle, &FileSize);
+                    Size = static_cast<std::size_t>(FileSize.QuadPart);
+                    MappingHandle = CreateFileMappingA(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                    if (MappingHandle)
+                        Data = static_cast<const std::uint8_t*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+                #elif !defined(CORE_PLATFORM_WEB)
+                    const int Descriptor = open(Path.c_str(), O_RDONLY);
+                    if (Descriptor < 0)
+                        return false;
+
+                    struct stat Info;
+                    if (fstat(Descriptor, &Info) == 0 && Info.st_size > 0)
+                    {
+                        Size = static_cast<std::size_t>(Info.st_size);
+                        void* Mapped = mmap(nullptr, Size, PROT_READ, MAP_PRIVATE, Descriptor, 0);
+                        Data = Mapped == MAP_FAILED ? nullptr : static_cast<const std::uint8_t*>(Mapped);
+                    }
+                    close(Descriptor);
+                #endif
+
+                if (!Data)
+                    Close();
+                return Data != nullptr;
+            }
+
+            void Close()
+            {
+                #if defined(CORE_PLATFORM_WINDOWS)
+                    if (Data)
+                        UnmapViewOfFile(Data);
+                    if (MappingHandle)
+                        CloseHandle(MappingHandle);
+                    if (FileHandle != INVALID_HANDLE_VALUE)
+                        CloseHandle(FileHandle);
+                    MappingHandle = nullptr;
+                    FileHandle = INVALID_HANDLE_VALUE;
+                #elif !defined(CORE_PLATFORM_WEB)
+                    if (Data)
+                        munmap(const_cast<std::uint8_t*>(Data), Size);
+                #endif
+                Data = nullptr;
+                Size = 0;
+            }
+
+            [[nodiscard]] const std::uint8_t* GetData() const { return Data; }
+            [[nodiscard]] std::size_t GetSize() const { return Size; }
+
+        private:
+            const std::uint8_t* Data = nullptr;
+            std::size_t Size = 0;
+            #if defined(CORE_PLATFORM_WINDOWS)
+                HANDLE FileHandle = INVALID_HANDLE_VALUE;
+                HANDLE MappingHandle = nullptr;
+            #endif
+        };
+
+        struct FGlyphRecord
+        {
+            FCacheEntry Entry;
+            // Rasterized this run: Entry.PixelOffset indexes NewPixels instead of the mapped file
+            bool bNew = false;
+        };
+
+        struct FFontCacheState
+        {
+            std::string Path;
+            ImFontLoader Loader;
+            const ImFontLoader* Base = nullptr;
+
+            FMappedFile File;
+            const std::uint8_t* FilePixels = nullptr;
+
+            std::unordered_map<FGlyphKey, FGlyphRecord, FGlyphKeyHash> Glyphs;
+            std::unordered_map<const ImFontConfig*, std::uint64_t> SourceHashes;
+            std::vector<std::uint8_t> NewPixels;
+            bool bDirty = false;
+        };
+
+        FFontCacheState& GetFontCacheState()
+        {
+            static FFontCacheState State;
+            return State;
+        }
+
+        std::uint64_t HashBytes(std::uint64_t Hash, const void* Data, std::size_t Size)
+        {
+            const std::uint8_t* Bytes = static_cast<const std::uint8_t*>(Data);
+            for (std::size_t i = 0; i < Size; i++)
+            {
+                Hash = (Hash ^ Bytes[i]) * 0x100000001B3ull;
+            }
+            return Hash;
+        }
+
+        template<typename T>
+        std::uint64_t HashValue(std::uint64_t Hash, const T& Value)
+        {
+            return HashBytes(Hash, &Value, sizeof(Value));
+        }
+
+        // Everything about a source that changes the rasterized output
+        std::uint64_t HashSource(const ImFontConfig* Src)
+        {
+            std::uint64_t Hash = 0xCBF29CE484222325ull;
+            Hash = HashBytes(Hash, Src->FontData, static_cast<std::size_t>(Src->FontDataSize));
+            Hash = HashValue(Hash, Src->FontNo);
+            Hash = HashValue(Hash, Src->SizePixels);
+            Hash = HashValue(Hash, Src->OversampleH);
+            Hash = HashValue(Hash, Src->OversampleV);
+            Hash = HashValue(Hash, Src->PixelSnapH);
+            Hash = HashValue(Hash, Src->PixelSnapV);
+            Hash = HashValue(Hash, Src->GlyphOffset.x);
+            Hash = HashValue(Hash, Src->GlyphOffset.y);
+            Hash = HashValue(Hash, Src->RasterizerDensity);
+            for (const ImWchar* Range = Src->GlyphRanges; Range && *Range; Range++)
+            {
+                Hash = HashValue(Hash, *Range);
+            }
+            return Hash;
+        }
+
+        bool LoadCacheFile(FFontCacheState& State)
+        {
+            if (!State.File.Open(State.Path))
+                return false;
+
+            const std::uint8_t* Data = State.File.GetData();
+            const std::size_t Size = State.File.GetSize();
+
+            FCacheHeader Header;
+            if (Size < sizeof(Header))
+                return false;
+            std::memcpy(&Header, Data, sizeof(Header));
+
+            const std::size_t EntryBytes = static_cast<std::size_t>(Header.EntryCount) * sizeof(FCacheEntry);
+            if (Header.Magic != CacheMagic || Header.Version != CacheVersion || Header.ImGuiVersion != IMGUI_VERSION_NUM ||
+                Size != sizeof(Header) + EntryBytes + Header.PixelBytes)
+            {
+                return false;
+            }
+
+            State.Glyphs.reserve(Header.EntryCount);
+            for (std::uint32_t i = 0; i < Header.EntryCount; i++)
+            {
+                FCacheEntry Entry;
+                std::memcpy(&Entry, Data + sizeof(Header) + i * sizeof(FCacheEntry), sizeof(Entry));
+                if (static_cast<std::uint64_t>(Entry.PixelOffset) + Entry.Width * Entry.Height > Header.PixelBytes)
+                    return false;
+
+                State.Glyphs.emplace(FGlyphKey{ Entry.SourceHash, Entry.Size, Entry.Density, Entry.Codepoint }, FGlyphRecord{ Entry });
+            }
+
+            State.FilePixels = Data + sizeof(Header) + EntryBytes;
+            return true;
+        }
+
+        // --- Loader hooks; everything not overridden goes straight to the stb_truetype loader ---
+
+        bool FontSrcInit(ImFontAtlas* Atlas, ImFontConfig* Src)
+        {
+            FFontCacheState& State = GetFontCacheState();
+            if (!State.Base->FontSrcInit(Atlas, Src))
+                return false;
+
+            // Post-processed pixels can't be read back unprocessed, so such sources bypass the cache
+            if (Src->RasterizerMultiply == 1.0f)
+                State.SourceHashes[Src] = HashSource(Src);
+            return true;
+        }
+
+        void FontSrcDestroy(ImFontAtlas* Atlas, ImFontConfig* Src)
+        {
+            GetFontCacheState().SourceHashes.erase(Src);
+            if (GetFontCacheState().Base->FontSrcDestroy)
+                GetFontCacheState().Base->FontSrcDestroy(Atlas, Src);
+        }
+
+        bool FontBakedLoadGlyph(ImFontAtlas* Atlas, ImFontConfig* Src, ImFontBaked* Baked, void* LoaderData, ImWchar Codepoint, ImFontGlyph* OutGlyph, float* OutAdvanceX)
+        {
+            FFontCacheState& State = GetFontCacheState();
+
+            const auto SourceIt = State.SourceHashes.find(Src);
+            if (SourceIt == State.SourceHashes.end())
+                return State.Base->FontBakedLoadGlyph(Atlas, Src, Baked, LoaderData, Codepoint, OutGlyph, OutAdvanceX);
+
+            const FGlyphKey Key{ SourceIt->second, Baked->Size, Baked->RasterizerDensity, static_cast<std::uint32_t>(Codepoint) };
+            if (const auto It = State.Glyphs.find(Key); It != State.Glyphs.end())
+            {
+                const FCacheEntry& Entry = It->second.Entry;
+                if (!(Entry.Flags & GlyphFound))
+                    return false;
+
+                if (OutAdvanceX)
+                {
+                    *OutAdvanceX = Entry.AdvanceX;
+                    return true;
+                }
+
+                OutGlyph->Codepoint = Codepoint;
+                OutGlyph->AdvanceX = Entry.AdvanceX;
+                if (Entry.Flags & GlyphVisible)
+                {
+                    const ImFontAtlasRectId PackId = ImFontAtlasPackAddRect(Atlas, Entry.Width, Entry.Height);
+                    if (PackId == ImFontAtlasRectId_Invalid)
+                        return false;
+
+                    const std::uint8_t* Pixels = It->second.bNew ? State.NewPixels.data() + Entry.PixelOffset : State.FilePixels + Entry.PixelOffset;
+                    OutGlyph->X0 = Entry.X0;
+                    OutGlyph->Y0 = Entry.Y0;
+                    OutGlyph->X1 = Entry.X1;
+                    OutGlyph->Y1 = Entry.Y1;
+                    OutGlyph->Visible = true;
+                    OutGlyph->PackId = PackId;
+                    ImFontAtlasBakedSetFontGlyphBitmap(Atlas, Baked, Src, OutGlyph, ImFontAtlasPackGetRect(Atlas, PackId), Pixels, ImTextureFormat_Alpha8, Entry.Width);
+                }
+                return true;
+            }
+
+            const bool bFound = State.Base->FontBakedLoadGlyph(Atlas, Src, Baked, LoaderData, Codepoint, OutGlyph, OutAdvanceX);
+
+            // Metrics-only requests have no bitmap to record
+            if (OutAdvanceX)
+                return bFound;
+
+            FCacheEntry Entry;
+            Entry.SourceHash = Key.SourceHash;
+            Entry.Size = Key.Size;
+            Entry.Density = Key.Density;
+            Entry.Codepoint = Key.Codepoint;
+
+            if (bFound)
+            {
+                Entry.Flags = GlyphFound;
+                Entry.AdvanceX = OutGlyph->AdvanceX;
+
+                if (OutGlyph->Visible)
+                {
+                    const ImTextureRect* Rect = ImFontAtlasPackGetRect(Atlas, OutGlyph->PackId);
+                    const ImTextureData* Texture = Atlas->TexData;
+                    const int AlphaOffset = Texture->Format == ImTextureFormat_RGBA32 ? 3 : 0;
+
+                    Entry.Flags |= GlyphVisible;
+                    Entry.X0 = OutGlyph->X0;
+                    Entry.Y0 = OutGlyph->Y0;
+                    Entry.X1 = OutGlyph->X1;
+                    Entry.Y1 = OutGlyph->Y1;
+                    Entry.Width = Rect->w;
+                    Entry.Height = Rect->h;
+                    Entry.PixelOffset = static_cast<std::uint32_t>(State.NewPixels.size());
+
+                    for (int y = 0; y < Rect->h; y++)
+                    {
+                        const std::uint8_t* Row = static_cast<const std::uint8_t*>(const_cast<ImTextureData*>(Texture)->GetPixelsAt(Rect->x, Rect->y + y));
+                        for (int x = 0; x < Rect->w; x++)
+                            State.NewPixels.push_back(Row[x * Texture->BytesPerPixel + AlphaOffset]);
+                    }
+                }
+            }
+
+            State.Glyphs.emplace(Key, FGlyphRecord{ Entry, true });
+            State.bDirty = true;
+            return bFound;
+        }
+    }
+
+    void PreloadFontCache(std::string_view CachePath)
+    {
+        FFontCacheState& State = GetFontCacheState();
+        if (State.Path == CachePath)
+            return;
+
+        State.File.Close();
+        State.FilePixels = nullptr;
+        State.Glyphs.clear();
+        State.Path = CachePath;
+
+        if (LoadCacheFile(State))
+        {
+            FLog::CoreDebug("Font cache '{}': {} glyphs", State.Path, State.Glyphs.size());
+        }
+        else
+        {
+            State.File.Close();
+            State.FilePixels = nullptr;
+            State.Glyphs.clear();
+        }
+    }
+
+    void InstallFontCache(std::string_view CachePath)
+    {
+        PreloadFontCache(CachePath);
+
+        FFontCacheState& State = GetFontCacheState();
+        State.Base = ImFontAtlasGetFontLoaderForStbTruetype();
+
+        State.Loader = *State.Base;
+        State.Loader.Name = "stb_truetype (cached)";
+        State.Loader.FontSrcInit = FontSrcInit;
+        State.Loader.FontSrcDestroy = FontSrcDestroy;
+        State.Loader.FontBakedLoadGlyph = FontBakedLoadGlyph;
+
+        ImGui::GetIO().Fonts->SetFontLoader(&State.Loader);
+    }
+
+    void SaveFontCache()
+    {
+        FFontCacheState& State = GetFontCacheState();
+        if (!State.bDirty || State.Path.empty())
+            return;
+
+        // Keep only glyphs of sources still in use; anything else is stale
+        std::vector<FCacheEntry> Entries;
+        std::vector<std::uint8_t> Pixels;
+        Entries.reserve(State.Glyphs.size());
+        for (const auto& [Key, Record] : State.Glyphs)
+        {
+            bool bLive = false;
+            for (const auto& [Src, Hash] : State.SourceHashes)
+                bLive |= Hash == Key.SourceHash;
+            if (!bLive)
+                continue;
+
+            FCacheEntry Entry = Record.Entry;
+            const std::uint8_t* Source = Record.bNew ? State.NewPixels.data() : State.FilePixels;
+            Entry.PixelOffset = static_cast<std::uint32_t>(Pixels.size());
+            Pixels.insert(Pixels.end(), Source + Record.Entry.PixelOffset, Source + Record.Entry.PixelOffset + Entry.Width * Entry.Height);
+            Entries.push_back(Entry);
+        }
+
+        // The mapping must be gone before the file can be replaced
+        State.File.Close();
+        State.FilePixels = nullptr;
+        State.Glyphs.clear();
+
+        FCacheHeader Header;
+        Header.EntryCount = static_cast<std::uint32_t>(Entries.size());
+        Header.PixelBytes = Pixels.size();
+
+        const std::string TempPath = State.Path + ".tmp";
+        std::FILE* File = std::fopen(TempPath.c_str(), "wb");
+        if (!File)
+        {
+            FLog::CoreWarn("Could not write font cache '{}'", State.Path);
+            return;
+        }
+
+        bool bWritten = std::fwrite(&Header, sizeof(Header), 1, File) == 1;
+        bWritten &= Entries.empty() || std::fwrite(Entries.data(), sizeof(FCacheEntry), Entries.size(), File) == Entries.size();
+        bWritten &= Pixels.empty() || std::fwrite(Pixels.data(), 1, Pixels.size(), File) == Pixels.size();
+        bWritten &= std::fclose(File) == 0;
+
+        #if defined(CORE_PLATFORM_WINDOWS)
+            std::remove(State.Path.c_str());
+        #endif
+        if (!bWritten || std::rename(TempPath.c_str(), State.Path.c_str()) != 0)
+        {
+            std::remove(TempPath.c_str());
+            FLog::CoreWarn("Could not write font cache '{}'", State.Path);
+            return;
+        }
+
+        State.NewPixels.clear();
+        State.bDirty = false;
+    }
+}
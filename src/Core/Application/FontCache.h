@@ -0,0 +1,17 @@
+#pragma once
+#include <string_view>
+
+namespace Core
+{
+    // Serves ImGui glyphs from a cache file of pre-rasterized bitmaps and records the ones that
+    // had to be rasterized. Call before any font is added; the cache is keyed per font source by
+    // the font data and every setting that changes its output, so stale entries are ignored.
+    void InstallFontCache(std::string_view CachePath);
+
+    // Maps and validates the cache file ahead of InstallFontCache. Needs no ImGui context, so it can
+    // run on a worker while the window is being created.
+    void PreloadFontCache(std::string_view CachePath);
+
+    // Writes the cache back if new glyphs were rasterized. Call before ImGui::DestroyContext.
+    void SaveFontCache();
+}
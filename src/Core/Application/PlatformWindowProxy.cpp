@@ -0,0 +1,1014 @@
+#include "PlatformWindowProxy.h"
+#include "Core/Logging/Log.h"
+#include "Core/Profiling/Profiler.h"
+
+// Multi-viewports only exist on the desktop; the web build has a single canvas
+#ifndef CORE_PLATFORM_WEB
+
+#include <glad/glad.h>
+
+#include "GLFW/glfw3.h"
+
+#include "imgui.h"
+#include "backends/imgui_impl_glfw.h"
+#include "backends/imgui_impl_opengl3.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <future>
+#include <iterator>
+#include <string>
+
+// Exported by the backend without a declaration
+ImGuiKey ImGui_ImplGlfw_KeyToImGuiKey(int KeyCode, int ScanCode);
+
+namespace Core
+{
+
+    namespace
+    {
+        // GLFW reports keys by their place on a US layout. Printable keys are given the key their
+        // character has there instead, as the backend does, so that shortcuts such as Ctrl+Z
+        // follow the user's layout. Main thread only.
+        int TranslateUntranslatedKey(int Key, int ScanCode)
+        {
+            if (Key >= GLFW_KEY_KP_0 && Key <= GLFW_KEY_KP_EQUAL)
+                return Key;
+
+            // Keys without a name raise errors
+            GLFWerrorfun PrevErrorCallback = glfwSetErrorCallback(nullptr);
+            const char* KeyName = glfwGetKeyName(Key, ScanCode);
+            glfwSetErrorCallback(PrevErrorCallback);
+            (void)glfwGetError(nullptr);
+            if (!KeyName || KeyName[0] == 0 || KeyName[1] != 0)
+                return Key;
+
+            constexpr char CharNames[] = "`-=[]\\,;\'./";
+            constexpr int CharKeys[] = { GLFW_KEY_GRAVE_ACCENT, GLFW_KEY_MINUS, GLFW_KEY_EQUAL, GLFW_KEY_LEFT_BRACKET, GLFW_KEY_RIGHT_BRACKET, GLFW_KEY_BACKSLASH, GLFW_KEY_COMMA, GLFW_KEY_SEMICOLON, GLFW_KEY_APOSTROPHE, GLFW_KEY_PERIOD, GLFW_KEY_SLASH, 0 };
+            static_assert(std::size(CharNames) == std::size(CharKeys));
+
+            const char Char = KeyName[0];
+            if (Char >= '0' && Char <= '9')
+                return GLFW_KEY_0 + (Char - '0');
+            if (Char >= 'A' && Char <= 'Z')
+                return GLFW_KEY_A + (Char - 'A');
+            if (Char >= 'a' && Char <= 'z')
+                return GLFW_KEY_A + (Char - 'a');
+            if (const char* Found = std::strchr(CharNames, Char))
+                return CharKeys[Found - CharNames];
+            return Key;
+        }
+    }
+
+    FPlatformWindowProxy* FPlatformWindowProxy::s_Instance = nullptr;
+
+    FPlatformWindowProxy::FPlatformWindowProxy(FJobSystem& InJobSystem, FRenderTargetPool& InRenderTargetPool, GLFWwindow* InMainWindow)
+        : JobSystem(InJobSystem),
+          RenderTargetPool(InRenderTargetPool),
+          MainWindow(InMainWindow),
+          MainThreadId(std::this_thread::get_id())
+    {
+        s_Instance = this;
+
+        ImGuiPlatformIO& PlatformIO = ImGui::GetPlatformIO();
+        BackendCreateWindow = PlatformIO.Platform_CreateWindow;
+        BackendDestroyWindow = PlatformIO.Platform_DestroyWindow;
+        BackendShowWindow = PlatformIO.Platform_ShowWindow;
+        BackendSetWindowPos = PlatformIO.Platform_SetWindowPos;
+        BackendSetWindowSize = PlatformIO.Platform_SetWindowSize;
+        BackendSetWindowFocus = PlatformIO.Platform_SetWindowFocus;
+        BackendSetWindowTitle = PlatformIO.Platform_SetWindowTitle;
+        BackendSetWindowAlpha = PlatformIO.Platform_SetWindowAlpha;
+
+        PlatformIO.Platform_CreateWindow = CreatePlatformWindow;
+        PlatformIO.Platform_DestroyWindow = DestroyPlatformWindow;
+        PlatformIO.Platform_ShowWindow = ShowPlatformWindow;
+        PlatformIO.Platform_SetWindowPos = SetWindowPos;
+        PlatformIO.Platform_GetWindowPos = GetWindowPos;
+        PlatformIO.Platform_SetWindowSize = SetWindowSize;
+        PlatformIO.Platform_GetWindowSize = GetWindowSize;
+        PlatformIO.Platform_GetWindowFramebufferScale = GetWindowFramebufferScale;
+        PlatformIO.Platform_SetWindowFocus = SetWindowFocus;
+        PlatformIO.Platform_GetWindowFocus = GetWindowFocus;
+        PlatformIO.Platform_GetWindowMinimized = GetWindowMinimized;
+        PlatformIO.Platform_SetWindowTitle = SetWindowTitle;
+        PlatformIO.Platform_SetWindowAlpha = BackendSetWindowAlpha ? SetWindowAlpha : nullptr;
+        // Presentation happens in RenderWindows and on the main thread, never through
+        // RenderPlatformWindowsDefault
+        PlatformIO.Platform_RenderWindow = nullptr;
+        PlatformIO.Platform_SwapBuffers = nullptr;
+
+        // The backend would ask every window whether the mouse is over it each frame; without
+        // the flag ImGui finds the viewport under the mouse itself
+        ImGui::GetIO().BackendFlags &= ~ImGuiBackendFlags_HasMouseHoveredViewport;
+
+        // The backend's input callbacks add to ImGui on this thread. Taking them off the main
+        // window leaves FApplication's, which the proxy's call in turn.
+        ImGui_ImplGlfw_RestoreCallbacks(MainWindow);
+        PrevMonitorCallback = glfwSetMonitorCallback(MonitorCallback);
+        RefreshMonitors();
+
+        // The backend's cursors are its own; these are set from the main thread instead
+        constexpr int CursorShapes[ImGuiMouseCursor_COUNT] =
+        {
+            GLFW_ARROW_CURSOR, GLFW_IBEAM_CURSOR, GLFW_RESIZE_ALL_CURSOR, GLFW_VRESIZE_CURSOR, GLFW_HRESIZE_CURSOR,
+            GLFW_RESIZE_NESW_CURSOR, GLFW_RESIZE_NWSE_CURSOR, GLFW_HAND_CURSOR, GLFW_ARROW_CURSOR, GLFW_ARROW_CURSOR,
+            GLFW_NOT_ALLOWED_CURSOR
+        };
+        // Shapes the platform lacks raise errors and fall back to the arrow
+        GLFWerrorfun PrevErrorCallback = glfwSetErrorCallback(nullptr);
+        for (const int Shape : CursorShapes)
+        {
+            Cursors.push_back(glfwCreateStandardCursor(Shape));
+        }
+        glfwSetErrorCallback(PrevErrorCallback);
+        (void)glfwGetError(nullptr);
+
+        // The main viewport answers from the cache as well
+        FViewportWindow* MainViewportWindow = new FViewportWindow();
+        MainViewportWindow->Window = MainWindow;
+        ImGui::GetMainViewport()->RendererUserData = MainViewportWindow;
+        Windows.push_back(MainViewportWindow);
+        RefreshState(*MainViewportWindow);
+        InstallWindowCallbacks(*MainViewportWindow);
+    }
+
+    FPlatformWindowProxy::~FPlatformWindowProxy()
+    {
+        glfwSetWindowPosCallback(MainWindow, PrevWindowPosCallback);
+        glfwSetWindowSizeCallback(MainWindow, PrevWindowSizeCallback);
+        glfwSetWindowFocusCallback(MainWindow, PrevWindowFocusCallback);
+        glfwSetWindowIconifyCallback(MainWindow, PrevWindowIconifyCallback);
+        glfwSetWindowContentScaleCallback(MainWindow, PrevWindowContentScaleCallback);
+        glfwSetCursorEnterCallback(MainWindow, PrevCursorEnterCallback);
+        glfwSetCursorPosCallback(MainWindow, PrevCursorPosCallback);
+        glfwSetMouseButtonCallback(MainWindow, PrevMouseButtonCallback);
+        glfwSetScrollCallback(MainWindow, PrevScrollCallback);
+        glfwSetKeyCallback(MainWindow, PrevKeyCallback);
+        glfwSetCharCallback(MainWindow, PrevCharCallback);
+        glfwSetMonitorCallback(PrevMonitorCallback);
+
+        for (GLFWcursor* Cursor : Cursors)
+        {
+            if (Cursor)
+                glfwDestroyCursor(Cursor);
+        }
+
+        for (FViewportWindow* ViewportWindow : Windows)
+        {
+            delete ViewportWindow;
+        }
+        s_Instance = nullptr;
+    }
+
+    void FPlatformWindowProxy::NewFrame()
+    {
+        ImGuiIO& IO = ImGui::GetIO();
+        ImGuiPlatformIO& PlatformIO = ImGui::GetPlatformIO();
+
+        {
+            const FViewportWindow* MainViewportWindow = static_cast<const FViewportWindow*>(ImGui::GetMainViewport()->RendererUserData);
+            std::lock_guard<std::mutex> Lock(StateMutex);
+            IO.DisplaySize = ImVec2(static_cast<float>(MainViewportWindow->State.Width), static_cast<float>(MainViewportWindow->State.Height));
+            IO.DisplayFramebufferScale = ImVec2(MainViewportWindow->State.FramebufferScaleX, MainViewportWindow->State.FramebufferScaleY);
+
+            if (std::exchange(bMonitorsChanged, false))
+            {
+                PlatformIO.Monitors.resize(0);
+                for (const ImGuiPlatformMonitor& Monitor : Monitors)
+                {
+                    PlatformIO.Monitors.push_back(Monitor);
+                }
+            }
+        }
+
+        // glfwGetTime may be called from any thread
+        const double Time = glfwGetTime();
+        IO.DeltaTime = PreviousTime > 0.0 ? static_cast<float>(std::max(Time - PreviousTime, 0.00001)) : 1.0f / 60.0f;
+        PreviousTime = Time;
+
+        // Work areas change without a monitor event, e.g. when a taskbar moves
+        if (Time - MonitorRefreshTime > 1.0)
+        {
+            MonitorRefreshTime = Time;
+            PostToMainThread([this]() { RefreshMonitors(); });
+        }
+
+        InputEvents.Drain([this](FEvent& Event) { AddInputEvent(Event); });
+        if (const std::uint64_t Dropped = InputEvents.TakeDroppedCount())
+        {
+            FLog::CoreWarn("Platform window input queue full, dropped {} events", Dropped);
+        }
+
+        if (IO.WantSetMousePos)
+        {
+            const ImVec2 MousePos = IO.MousePos;
+            PostToMainThread([this, MousePos]() { SetMousePos(MousePos.x, MousePos.y); });
+        }
+
+        // Set on the main thread, and only when the shape changes
+        if (!(IO.ConfigFlags & ImGuiConfigFlags_NoMouseCursorChange))
+        {
+            const int Cursor = IO.MouseDrawCursor ? ImGuiMouseCursor_None : ImGui::GetMouseCursor();
+            if (Cursor != RequestedCursor)
+            {
+                RequestedCursor = Cursor;
+                PostToMainThread([this, Cursor]() { SetMouseCursor(Cursor); });
+            }
+        }
+
+        ApplyWindowRequests();
+    }
+
+    void FPlatformWindowProxy::ApplyWindowRequests()
+    {
+        // Requests on the main viewport are FApplication's to handle
+        const ImGuiPlatformIO& PlatformIO = ImGui::GetPlatformIO();
+        for (int ViewportIndex = 1; ViewportIndex < PlatformIO.Viewports.Size; ++ViewportIndex)
+        {
+            ImGuiViewport* Viewport = PlatformIO.Viewports[ViewportIndex];
+            FViewportWindow* ViewportWindow = static_cast<FViewportWindow*>(Viewport->RendererUserData);
+            if (!ViewportWindow)
+                continue;
+
+            if (ViewportWindow->bRequestClose.exchange(false, std::memory_order_relaxed))
+                Viewport->PlatformRequestClose = true;
+            if (ViewportWindow->bRequestMove.exchange(false, std::memory_order_relaxed))
+                Viewport->PlatformRequestMove = true;
+            if (ViewportWindow->bRequestResize.exchange(false, std::memory_order_relaxed))
+                Viewport->PlatformRequestResize = true;
+        }
+    }
+
+    void FPlatformWindowProxy::AddInputEvent(const FEvent& Event)
+    {
+        ImGuiIO& IO = ImGui::GetIO();
+        if (const FMouseMovedEvent* Moved = Event.As<FMouseMovedEvent>())
+        {
+            IO.AddMousePosEvent(Moved->GetX(), Moved->GetY());
+            return;
+        }
+        if (const FMouseScrolledEvent* Scrolled = Event.As<FMouseScrolledEvent>())
+        {
+            IO.AddMouseWheelEvent(Scrolled->GetXOffset(), Scrolled->GetYOffset());
+            return;
+        }
+        if (const FKeyTypedEvent* Typed = Event.As<FKeyTypedEvent>())
+        {
+            IO.AddInputCharacter(static_cast<unsigned int>(Typed->GetKeyCode()));
+            return;
+        }
+        if (Event.Is<FWindowFocusEvent>() || Event.Is<FWindowLostFocusEvent>())
+        {
+            // GLFW releases every key of a window losing focus; ImGui does the same on its side
+            ModifierKeys = 0;
+            IO.AddFocusEvent(Event.Is<FWindowFocusEvent>());
+            return;
+        }
+
+        // X11 leaves a modifier out of the event's own mods while it changes, so the modifier
+        // keys are tracked instead and handed to ImGui ahead of every key and button
+        const FKeyPressedEvent* KeyPressed = Event.As<FKeyPressedEvent>();
+        const FKeyReleasedEvent* KeyReleased = Event.As<FKeyReleasedEvent>();
+        const int Key = KeyPressed ? KeyPressed->GetKeyCode() : KeyReleased ? KeyReleased->GetKeyCode() : GLFW_KEY_UNKNOWN;
+        if (Key >= GLFW_KEY_LEFT_SHIFT && Key <= GLFW_KEY_RIGHT_SUPER)
+        {
+            const unsigned int Bit = 1u << (Key - GLFW_KEY_LEFT_SHIFT);
+            ModifierKeys = KeyPressed ? ModifierKeys | Bit : ModifierKeys & ~Bit;
+        }
+
+        const auto IsDown = [this](int LeftKey, int RightKey)
+        {
+            return (ModifierKeys & (1u << (LeftKey - GLFW_KEY_LEFT_SHIFT) | 1u << (RightKey - GLFW_KEY_LEFT_SHIFT))) != 0;
+        };
+        IO.AddKeyEvent(ImGuiMod_Ctrl, IsDown(GLFW_KEY_LEFT_CONTROL, GLFW_KEY_RIGHT_CONTROL));
+        IO.AddKeyEvent(ImGuiMod_Shift, IsDown(GLFW_KEY_LEFT_SHIFT, GLFW_KEY_RIGHT_SHIFT));
+        IO.AddKeyEvent(ImGuiMod_Alt, IsDown(GLFW_KEY_LEFT_ALT, GLFW_KEY_RIGHT_ALT));
+        IO.AddKeyEvent(ImGuiMod_Super, IsDown(GLFW_KEY_LEFT_SUPER, GLFW_KEY_RIGHT_SUPER));
+
+        if (KeyPressed || KeyReleased)
+        {
+            IO.AddKeyEvent(ImGui_ImplGlfw_KeyToImGuiKey(Key, 0), KeyPressed != nullptr);
+        }
+        else if (const FMouseButtonPressedEvent* ButtonPressed = Event.As<FMouseButtonPressedEvent>())
+        {
+            if (ButtonPressed->GetMouseButton() < ImGuiMouseButton_COUNT)
+                IO.AddMouseButtonEvent(ButtonPressed->GetMouseButton(), true);
+        }
+        else if (const FMouseButtonReleasedEvent* ButtonReleased = Event.As<FMouseButtonReleasedEvent>())
+        {
+            if (ButtonReleased->GetMouseButton() < ImGuiMouseButton_COUNT)
+                IO.AddMouseButtonEvent(ButtonReleased->GetMouseButton(), false);
+        }
+    }
+
+    void FPlatformWindowProxy::QueueInput(const FEvent& Event)
+    {
+        InputEvents.Push(Event);
+        bWindowEventsPending = true;
+    }
+
+    void FPlatformWindowProxy::RefreshMonitors()
+    {
+        int MonitorCount = 0;
+        GLFWmonitor** GLFWMonitors = glfwGetMonitors(&MonitorCount);
+        // None are reported while macOS sleeps; the last known ones stay
+        if (MonitorCount == 0)
+            return;
+
+        std::lock_guard<std::mutex> Lock(StateMutex);
+        Monitors.clear();
+        for (int MonitorIndex = 0; MonitorIndex < MonitorCount; ++MonitorIndex)
+        {
+            GLFWmonitor* GLFWMonitor = GLFWMonitors[MonitorIndex];
+            const GLFWvidmode* VideoMode = glfwGetVideoMode(GLFWMonitor);
+            // Virtual monitors may report no mode or a zero scale
+            const float DpiScale = ImGui_ImplGlfw_GetContentScaleForMonitor(GLFWMonitor);
+            if (!VideoMode || DpiScale == 0.0f)
+                continue;
+
+            ImGuiPlatformMonitor Monitor;
+            int X = 0;
+            int Y = 0;
+            glfwGetMonitorPos(GLFWMonitor, &X, &Y);
+            Monitor.MainPos = Monitor.WorkPos = ImVec2(static_cast<float>(X), static_cast<float>(Y));
+            Monitor.MainSize = Monitor.WorkSize = ImVec2(static_cast<float>(VideoMode->width), static_cast<float>(VideoMode->height));
+
+            int Width = 0;
+            int Height = 0;
+            glfwGetMonitorWorkarea(GLFWMonitor, &X, &Y, &Width, &Height);
+            // Reported as zero for a moment after the monitors change
+            if (Width > 0 && Height > 0)
+            {
+                Monitor.WorkPos = ImVec2(static_cast<float>(X), static_cast<float>(Y));
+                Monitor.WorkSize = ImVec2(static_cast<float>(Width), static_cast<float>(Height));
+            }
+            Monitor.DpiScale = DpiScale;
+            Monitor.PlatformHandle = GLFWMonitor;
+            Monitors.push_back(Monitor);
+        }
+        bMonitorsChanged = true;
+    }
+
+    void FPlatformWindowProxy::SetMouseCursor(int Cursor)
+    {
+        AppliedCursor = Cursor;
+        for (FViewportWindow* ViewportWindow : Windows)
+        {
+            ApplyMouseCursor(ViewportWindow->Window);
+        }
+    }
+
+    void FPlatformWindowProxy::ApplyMouseCursor(GLFWwindow* Window) const
+    {
+        // A captured cursor is the application's
+        if (glfwGetInputMode(MainWindow, GLFW_CURSOR) == GLFW_CURSOR_DISABLED)
+            return;
+
+        if (AppliedCursor == ImGuiMouseCursor_None)
+        {
+            glfwSetInputMode(Window, GLFW_CURSOR, GLFW_CURSOR_HIDDEN);
+            return;
+        }
+        glfwSetCursor(Window, Cursors[AppliedCursor] ? Cursors[AppliedCursor] : Cursors[ImGuiMouseCursor_Arrow]);
+        glfwSetInputMode(Window, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
+    }
+
+    void FPlatformWindowProxy::SetMousePos(float X, float Y)
+    {
+        // The focused window places the cursor, relative to itself
+        for (FViewportWindow* ViewportWindow : Windows)
+        {
+            FWindowState State;
+            {
+                std::lock_guard<std::mutex> Lock(StateMutex);
+                State = ViewportWindow->State;
+            }
+            if (State.bFocused)
+            {
+                glfwSetCursorPos(ViewportWindow->Window, static_cast<double>(X - static_cast<float>(State.X)), static_cast<double>(Y - static_cast<float>(State.Y)));
+                return;
+            }
+        }
+    }
+
+    void FPlatformWindowProxy::RenderWindows()
+    {
+        // Skips the main viewport, which FApplication draws into the default framebuffer
+        const ImGuiPlatformIO& PlatformIO = ImGui::GetPlatformIO();
+        for (int ViewportIndex = 1; ViewportIndex < PlatformIO.Viewports.Size; ++ViewportIndex)
+        {
+            ImGuiViewport* Viewport = PlatformIO.Viewports[ViewportIndex];
+            FViewportWindow* ViewportWindow = static_cast<FViewportWindow*>(Viewport->RendererUserData);
+            if (!ViewportWindow || !Viewport->DrawData || (Viewport->Flags & ImGuiViewportFlags_IsMinimized))
+                continue;
+
+            // The main thread hasn't shown the last frame yet; drawing another would only replace it
+            if (ViewportWindow->bPresentPending.load(std::memory_order_acquire))
+                continue;
+
+            const ImDrawData* DrawData = Viewport->DrawData;
+            const int FramebufferWidth = static_cast<int>(DrawData->DisplaySize.x * DrawData->FramebufferScale.x);
+            const int FramebufferHeight = static_cast<int>(DrawData->DisplaySize.y * DrawData->FramebufferScale.y);
+            if (FramebufferWidth <= 0 || FramebufferHeight <= 0)
+                continue;
+
+            const int Slot = ViewportWindow->NextSlot;
+            ViewportWindow->NextSlot = (Slot + 1) % FViewportWindow::SlotCount;
+
+            // The slot's texture may still be read by the blit that presented it
+            if (ViewportWindow->PresentedFences[Slot])
+            {
+                GLsync PresentedFence = static_cast<GLsync>(ViewportWindow->PresentedFences[Slot]);
+                glWaitSync(PresentedFence, 0, GL_TIMEOUT_IGNORED);
+                glDeleteSync(PresentedFence);
+                ViewportWindow->PresentedFences[Slot] = nullptr;
+            }
+
+            FRenderTarget& Target = ViewportWindow->Targets[Slot];
+            RenderTargetPool.Request(Target, { .Width = FramebufferWidth, .Height = FramebufferHeight, .bDepth = false });
+
+            glBindFramebuffer(GL_FRAMEBUFFER, Target.GetRenderTexture().id);
+            if (!(Viewport->Flags & ImGuiViewportFlags_NoRendererClear))
+            {
+                glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+                glClear(GL_COLOR_BUFFER_BIT);
+            }
+            ImGui_ImplOpenGL3_RenderDrawData(Viewport->DrawData);
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+            // Flushed so the main thread's context can wait on the fence
+            GLsync RenderedFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            glFlush();
+
+            ViewportWindow->bPresentPending.store(true, std::memory_order_relaxed);
+            const unsigned int Texture = Target.GetTexture().id;
+            PostToMainThread([this, ViewportWindow, Slot, Texture, FramebufferWidth, FramebufferHeight, RenderedFence]()
+            {
+                Present(*ViewportWindow, Slot, Texture, FramebufferWidth, FramebufferHeight, RenderedFence);
+            });
+        }
+    }
+
+    void FPlatformWindowProxy::ReleaseRenderTargets()
+    {
+        // Queued presents still read the targets; the main thread keeps running them until the
+        // render loop has finished
+        for (ImGuiViewport* Viewport : ImGui::GetPlatformIO().Viewports)
+        {
+            if (const FViewportWindow* ViewportWindow = static_cast<const FViewportWindow*>(Viewport->RendererUserData))
+            {
+                while (ViewportWindow->bPresentPending.load(std::memory_order_acquire))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+
+        for (ImGuiViewport* Viewport : ImGui::GetPlatformIO().Viewports)
+        {
+            if (FViewportWindow* ViewportWindow = static_cast<FViewportWindow*>(Viewport->RendererUserData))
+            {
+                for (FRenderTarget& Target : ViewportWindow->Targets)
+                {
+                    RenderTargetPool.Release(Target);
+                }
+            }
+        }
+    }
+
+    void FPlatformWindowProxy::RunOnMainThread(const std::function<void()>& Func)
+    {
+        if (std::this_thread::get_id() == MainThreadId)
+        {
+            Func();
+            return;
+        }
+
+        // Not FJobSystem::Wait, which would run render thread jobs in the middle of ImGui's
+        // platform window update
+        std::promise<void> Done;
+        PostToMainThread([&Func, &Done]()
+        {
+            Func();
+            Done.set_value();
+        });
+        Done.get_future().wait();
+    }
+
+    void FPlatformWindowProxy::PostToMainThread(std::function<void()> Func)
+    {
+        JobSystem.Submit(std::move(Func), nullptr, EJobAffinity::MainThread);
+    }
+
+    FPlatformWindowProxy::FViewportWindow* FPlatformWindowProxy::FindViewportWindow(GLFWwindow* Window) const
+    {
+        for (FViewportWindow* ViewportWindow : Windows)
+        {
+            if (ViewportWindow->Window == Window)
+                return ViewportWindow;
+        }
+        return nullptr;
+    }
+
+    void FPlatformWindowProxy::InstallWindowCallbacks(FViewportWindow& ViewportWindow)
+    {
+        GLFWwindow* Window = ViewportWindow.Window;
+        if (Window == MainWindow)
+        {
+            // FApplication's are called from these; it owns close, framebuffer size and refresh
+            PrevWindowPosCallback = glfwSetWindowPosCallback(Window, WindowPosCallback);
+            PrevWindowSizeCallback = glfwSetWindowSizeCallback(Window, WindowSizeCallback);
+            PrevWindowFocusCallback = glfwSetWindowFocusCallback(Window, WindowFocusCallback);
+            PrevWindowIconifyCallback = glfwSetWindowIconifyCallback(Window, WindowIconifyCallback);
+            PrevWindowContentScaleCallback = glfwSetWindowContentScaleCallback(Window, WindowContentScaleCallback);
+            PrevCursorEnterCallback = glfwSetCursorEnterCallback(Window, CursorEnterCallback);
+            PrevCursorPosCallback = glfwSetCursorPosCallback(Window, CursorPosCallback);
+            PrevMouseButtonCallback = glfwSetMouseButtonCallback(Window, MouseButtonCallback);
+            PrevScrollCallback = glfwSetScrollCallback(Window, ScrollCallback);
+            PrevKeyCallback = glfwSetKeyCallback(Window, KeyCallback);
+            PrevCharCallback = glfwSetCharCallback(Window, CharCallback);
+            return;
+        }
+
+        // Replaces the backend's callbacks, which look viewports up in ImGui state the render
+        // thread may be changing, and add input to ImGui from this thread
+        glfwSetWindowPosCallback(Window, WindowPosCallback);
+        glfwSetWindowSizeCallback(Window, WindowSizeCallback);
+        glfwSetWindowFocusCallback(Window, WindowFocusCallback);
+        glfwSetWindowIconifyCallback(Window, WindowIconifyCallback);
+        glfwSetWindowContentScaleCallback(Window, WindowContentScaleCallback);
+        glfwSetWindowCloseCallback(Window, WindowCloseCallback);
+        glfwSetFramebufferSizeCallback(Window, FramebufferSizeCallback);
+        glfwSetWindowRefreshCallback(Window, WindowRefreshCallback);
+        glfwSetCursorEnterCallback(Window, CursorEnterCallback);
+        glfwSetCursorPosCallback(Window, CursorPosCallback);
+        glfwSetMouseButtonCallback(Window, MouseButtonCallback);
+        glfwSetScrollCallback(Window, ScrollCallback);
+        glfwSetKeyCallback(Window, KeyCallback);
+        glfwSetCharCallback(Window, CharCallback);
+    }
+
+    void FPlatformWindowProxy::RefreshState(FViewportWindow& ViewportWindow)
+    {
+        GLFWwindow* Window = ViewportWindow.Window;
+
+        FWindowState State;
+        glfwGetWindowPos(Window, &State.X, &State.Y);
+        glfwGetWindowSize(Window, &State.Width, &State.Height);
+        int FramebufferWidth = 0;
+        int FramebufferHeight = 0;
+        glfwGetFramebufferSize(Window, &FramebufferWidth, &FramebufferHeight);
+        if (State.Width > 0 && State.Height > 0)
+        {
+            State.FramebufferScaleX = static_cast<float>(FramebufferWidth) / static_cast<float>(State.Width);
+            State.FramebufferScaleY = static_cast<float>(FramebufferHeight) / static_cast<float>(State.Height);
+        }
+        State.bFocused = glfwGetWindowAttrib(Window, GLFW_FOCUSED) != 0;
+        State.bMinimized = glfwGetWindowAttrib(Window, GLFW_ICONIFIED) != 0;
+
+        std::lock_guard<std::mutex> Lock(StateMutex);
+        ViewportWindow.State = State;
+    }
+
+    void FPlatformWindowProxy::Present(FViewportWindow& ViewportWindow, int Slot, unsigned int Texture, int Width, int Height, void* RenderedFence)
+    {
+        CORE_PROFILE_SCOPE("Present Platform Window");
+
+        if (glfwGetCurrentContext() != ViewportWindow.Window)
+        {
+            glfwMakeContextCurrent(ViewportWindow.Window);
+        }
+
+        GLsync Rendered = static_cast<GLsync>(RenderedFence);
+        glWaitSync(Rendered, 0, GL_TIMEOUT_IGNORED);
+        glDeleteSync(Rendered);
+
+        // Framebuffers aren't shared between contexts, so each window reads the shared texture
+        // through its own, re-attached only when the pool hands the slot a new allocation
+        unsigned int& ReadFramebuffer = ViewportWindow.ReadFramebuffers[Slot];
+        if (ReadFramebuffer == 0)
+        {
+            glGenFramebuffers(1, &ReadFramebuffer);
+        }
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, ReadFramebuffer);
+        if (ViewportWindow.AttachedTextures[Slot] != Texture)
+        {
+            glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, Texture, 0);
+            ViewportWindow.AttachedTextures[Slot] = Texture;
+        }
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+        glBlitFramebuffer(0, 0, Width, Height, 0, 0, Width, Height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+        // The render thread holds off drawing into the slot again until the blit is done
+        ViewportWindow.PresentedFences[Slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glfwSwapBuffers(ViewportWindow.Window);
+        ViewportWindow.bPresentPending.store(false, std::memory_order_release);
+    }
+
+    void FPlatformWindowProxy::CreatePlatformWindow(ImGuiViewport* Viewport)
+    {
+        FPlatformWindowProxy& Proxy = *s_Instance;
+        FViewportWindow* ViewportWindow = new FViewportWindow();
+        Viewport->RendererUserData = ViewportWindow;
+
+        // The render thread waits, so the backend may read and write the viewport freely
+        Proxy.RunOnMainThread([&Proxy, Viewport, ViewportWindow]()
+        {
+            // Shares objects with the main window's context, and leaves the new context current
+            // on the main thread, where it is only ever used for presenting
+            Proxy.BackendCreateWindow(Viewport);
+            ViewportWindow->Window = static_cast<GLFWwindow*>(Viewport->PlatformHandle);
+            ViewportWindow->RequestedX = static_cast<int>(Viewport->Pos.x);
+            ViewportWindow->RequestedY = static_cast<int>(Viewport->Pos.y);
+            ViewportWindow->RequestedWidth = static_cast<int>(Viewport->Size.x);
+            ViewportWindow->RequestedHeight = static_cast<int>(Viewport->Size.y);
+
+            Proxy.Windows.push_back(ViewportWindow);
+            Proxy.RefreshState(*ViewportWindow);
+            Proxy.InstallWindowCallbacks(*ViewportWindow);
+            Proxy.ApplyMouseCursor(ViewportWindow->Window);
+        });
+    }
+
+    void FPlatformWindowProxy::DestroyPlatformWindow(ImGuiViewport* Viewport)
+    {
+        FPlatformWindowProxy& Proxy = *s_Instance;
+        FViewportWindow* ViewportWindow = static_cast<FViewportWindow*>(Viewport->RendererUserData);
+        if (!ViewportWindow)
+        {
+            Proxy.RunOnMainThread([&Proxy, Viewport]() { Proxy.BackendDestroyWindow(Viewport); });
+            return;
+        }
+
+        // Queued presents for the window run before this on the main thread, so nothing refers
+        // to it once the wait returns. Pooled targets go back on the render thread; at shutdown
+        // ReleaseRenderTargets has already returned them.
+        if (std::this_thread::get_id() != Proxy.MainThreadId)
+        {
+            for (FRenderTarget& Target : ViewportWindow->Targets)
+            {
+                Proxy.RenderTargetPool.Release(Target);
+            }
+        }
+
+        Proxy.RunOnMainThread([&Proxy, Viewport, ViewportWindow]()
+        {
+            if (ViewportWindow->Window && ViewportWindow->Window != Proxy.MainWindow)
+            {
+                glfwMakeContextCurrent(ViewportWindow->Window);
+                glDeleteFramebuffers(FViewportWindow::SlotCount, ViewportWindow->ReadFramebuffers);
+                for (void*& PresentedFence : ViewportWindow->PresentedFences)
+                {
+                    if (PresentedFence)
+                    {
+                        glDeleteSync(static_cast<GLsync>(PresentedFence));
+                        PresentedFence = nullptr;
+                    }
+                }
+                glfwMakeContextCurrent(nullptr);
+            }
+
+            if (Proxy.MouseWindow == ViewportWindow->Window)
+            {
+                Proxy.MouseWindow = nullptr;
+            }
+            Proxy.BackendDestroyWindow(Viewport);
+            std::erase(Proxy.Windows, ViewportWindow);
+            delete ViewportWindow;
+        });
+        Viewport->RendererUserData = nullptr;
+    }
+
+    void FPlatformWindowProxy::ShowPlatformWindow(ImGuiViewport* Viewport)
+    {
+        FPlatformWindowProxy& Proxy = *s_Instance;
+        Proxy.PostToMainThread([&Proxy, Viewport]() { Proxy.BackendShowWindow(Viewport); });
+    }
+
+    void FPlatformWindowProxy::SetWindowPos(ImGuiViewport* Viewport, ImVec2 Pos)
+    {
+        FPlatformWindowProxy& Proxy = *s_Instance;
+        FViewportWindow* ViewportWindow = static_cast<FViewportWindow*>(Viewport->RendererUserData);
+        {
+            // Answer with the new position until the window reports it
+            std::lock_guard<std::mutex> Lock(Proxy.StateMutex);
+            ViewportWindow->State.X = static_cast<int>(Pos.x);
+            ViewportWindow->State.Y = static_cast<int>(Pos.y);
+        }
+
+        Proxy.PostToMainThread([&Proxy, Viewport, ViewportWindow, Pos]()
+        {
+            ViewportWindow->RequestedX = static_cast<int>(Pos.x);
+            ViewportWindow->RequestedY = static_cast<int>(Pos.y);
+            Proxy.BackendSetWindowPos(Viewport, Pos);
+        });
+    }
+
+    ImVec2 FPlatformWindowProxy::GetWindowPos(ImGuiViewport* Viewport)
+    {
+        const FViewportWindow* ViewportWindow = static_cast<const FViewportWindow*>(Viewport->RendererUserData);
+        std::lock_guard<std::mutex> Lock(s_Instance->StateMutex);
+        return ImVec2(static_cast<float>(ViewportWindow->State.X), static_cast<float>(ViewportWindow->State.Y));
+    }
+
+    void FPlatformWindowProxy::SetWindowSize(ImGuiViewport* Viewport, ImVec2 Size)
+    {
+        FPlatformWindowProxy& Proxy = *s_Instance;
+        FViewportWindow* ViewportWindow = static_cast<FViewportWindow*>(Viewport->RendererUserData);
+        {
+            std::lock_guard<std::mutex> Lock(Proxy.StateMutex);
+            ViewportWindow->State.Width = static_cast<int>(Size.x);
+            ViewportWindow->State.Height = static_cast<int>(Size.y);
+        }
+
+        Proxy.PostToMainThread([&Proxy, Viewport, ViewportWindow, Size]()
+        {
+            ViewportWindow->RequestedWidth = static_cast<int>(Size.x);
+            ViewportWindow->RequestedHeight = static_cast<int>(Size.y);
+            Proxy.BackendSetWindowSize(Viewport, Size);
+        });
+    }
+
+    ImVec2 FPlatformWindowProxy::GetWindowSize(ImGuiViewport* Viewport)
+    {
+        const FViewportWindow* ViewportWindow = static_cast<const FViewportWindow*>(Viewport->RendererUserData);
+        std::lock_guard<std::mutex> Lock(s_Instance->StateMutex);
+        return ImVec2(static_cast<float>(ViewportWindow->State.Width), static_cast<float>(ViewportWindow->State.Height));
+    }
+
+    ImVec2 FPlatformWindowProxy::GetWindowFramebufferScale(ImGuiViewport* Viewport)
+    {
+        const FViewportWindow* ViewportWindow = static_cast<const FViewportWindow*>(Viewport->RendererUserData);
+        std::lock_guard<std::mutex> Lock(s_Instance->StateMutex);
+        return ImVec2(ViewportWindow->State.FramebufferScaleX, ViewportWindow->State.FramebufferScaleY);
+    }
+
+    void FPlatformWindowProxy::SetWindowFocus(ImGuiViewport* Viewport)
+    {
+        FPlatformWindowProxy& Proxy = *s_Instance;
+        Proxy.PostToMainThread([&Proxy, Viewport]() { Proxy.BackendSetWindowFocus(Viewport); });
+    }
+
+    bool FPlatformWindowProxy::GetWindowFocus(ImGuiViewport* Viewport)
+    {
+        const FViewportWindow* ViewportWindow = static_cast<const FViewportWindow*>(Viewport->RendererUserData);
+        std::lock_guard<std::mutex> Lock(s_Instance->StateMutex);
+        return ViewportWindow->State.bFocused;
+    }
+
+    bool FPlatformWindowProxy::GetWindowMinimized(ImGuiViewport* Viewport)
+    {
+        const FViewportWindow* ViewportWindow = static_cast<const FViewportWindow*>(Viewport->RendererUserData);
+        std::lock_guard<std::mutex> Lock(s_Instance->StateMutex);
+        return ViewportWindow->State.bMinimized;
+    }
+
+    void FPlatformWindowProxy::SetWindowTitle(ImGuiViewport* Viewport, const char* Title)
+    {
+        FPlatformWindowProxy& Proxy = *s_Instance;
+        Proxy.PostToMainThread([&Proxy, Viewport, Title = std::string(Title)]()
+        {
+            Proxy.BackendSetWindowTitle(Viewport, Title.c_str());
+        });
+    }
+
+    void FPlatformWindowProxy::SetWindowAlpha(ImGuiViewport* Viewport, float Alpha)
+    {
+        FPlatformWindowProxy& Proxy = *s_Instance;
+        Proxy.PostToMainThread([&Proxy, Viewport, Alpha]() { Proxy.BackendSetWindowAlpha(Viewport, Alpha); });
+    }
+
+    void FPlatformWindowProxy::WindowCloseCallback(GLFWwindow* Window)
+    {
+        if (FViewportWindow* ViewportWindow = s_Instance->FindViewportWindow(Window))
+        {
+            ViewportWindow->bRequestClose.store(true, std::memory_order_relaxed);
+            s_Instance->bWindowEventsPending = true;
+        }
+    }
+
+    void FPlatformWindowProxy::WindowPosCallback(GLFWwindow* Window, int X, int Y)
+    {
+        if (Window == s_Instance->MainWindow && s_Instance->PrevWindowPosCallback)
+        {
+            s_Instance->PrevWindowPosCallback(Window, X, Y);
+        }
+
+        FViewportWindow* ViewportWindow = s_Instance->FindViewportWindow(Window);
+        if (!ViewportWindow)
+            return;
+
+        {
+            std::lock_guard<std::mutex> Lock(s_Instance->StateMutex);
+            ViewportWindow->State.X = X;
+            ViewportWindow->State.Y = Y;
+        }
+
+        // Moves ImGui made itself come back as events too, on some platforms only later
+        if (X == ViewportWindow->RequestedX && Y == ViewportWindow->RequestedY)
+            return;
+        ViewportWindow->bRequestMove.store(true, std::memory_order_relaxed);
+        s_Instance->bWindowEventsPending = true;
+    }
+
+    void FPlatformWindowProxy::WindowSizeCallback(GLFWwindow* Window, int Width, int Height)
+    {
+        if (Window == s_Instance->MainWindow && s_Instance->PrevWindowSizeCallback)
+        {
+            s_Instance->PrevWindowSizeCallback(Window, Width, Height);
+        }
+
+        FViewportWindow* ViewportWindow = s_Instance->FindViewportWindow(Window);
+        if (!ViewportWindow)
+            return;
+
+        s_Instance->RefreshState(*ViewportWindow);
+
+        if (Width == ViewportWindow->RequestedWidth && Height == ViewportWindow->RequestedHeight)
+            return;
+        ViewportWindow->bRequestResize.store(true, std::memory_order_relaxed);
+        s_Instance->bWindowEventsPending = true;
+    }
+
+    void FPlatformWindowProxy::FramebufferSizeCallback(GLFWwindow* Window, int, int)
+    {
+        if (FViewportWindow* ViewportWindow = s_Instance->FindViewportWindow(Window))
+        {
+            s_Instance->RefreshState(*ViewportWindow);
+            s_Instance->bWindowEventsPending = true;
+        }
+    }
+
+    void FPlatformWindowProxy::WindowFocusCallback(GLFWwindow* Window, int bFocused)
+    {
+        if (Window == s_Instance->MainWindow && s_Instance->PrevWindowFocusCallback)
+        {
+            s_Instance->PrevWindowFocusCallback(Window, bFocused);
+        }
+
+        if (FViewportWindow* ViewportWindow = s_Instance->FindViewportWindow(Window))
+        {
+            std::lock_guard<std::mutex> Lock(s_Instance->StateMutex);
+            ViewportWindow->State.bFocused = bFocused != 0;
+        }
+        if (bFocused)
+        {
+            s_Instance->QueueInput(FWindowFocusEvent());
+        }
+        else
+        {
+            s_Instance->QueueInput(FWindowLostFocusEvent());
+        }
+    }
+
+    void FPlatformWindowProxy::WindowIconifyCallback(GLFWwindow* Window, int bIconified)
+    {
+        if (Window == s_Instance->MainWindow && s_Instance->PrevWindowIconifyCallback)
+        {
+            s_Instance->PrevWindowIconifyCallback(Window, bIconified);
+        }
+
+        if (FViewportWindow* ViewportWindow = s_Instance->FindViewportWindow(Window))
+        {
+            std::lock_guard<std::mutex> Lock(s_Instance->StateMutex);
+            ViewportWindow->State.bMinimized = bIconified != 0;
+        }
+        s_Instance->bWindowEventsPending = true;
+    }
+
+    void FPlatformWindowProxy::WindowRefreshCallback(GLFWwindow*)
+    {
+        s_Instance->bWindowEventsPending = true;
+    }
+
+    void FPlatformWindowProxy::WindowContentScaleCallback(GLFWwindow* Window, float XScale, float YScale)
+    {
+        if (Window == s_Instance->MainWindow && s_Instance->PrevWindowContentScaleCallback)
+        {
+            s_Instance->PrevWindowContentScaleCallback(Window, XScale, YScale);
+        }
+
+        // The framebuffer scale of the main window changes without a size event of its own
+        if (FViewportWindow* ViewportWindow = s_Instance->FindViewportWindow(Window))
+        {
+            s_Instance->RefreshState(*ViewportWindow);
+            s_Instance->bWindowEventsPending = true;
+        }
+    }
+
+    void FPlatformWindowProxy::MonitorCallback(GLFWmonitor* Monitor, int Event)
+    {
+        if (s_Instance->PrevMonitorCallback)
+        {
+            s_Instance->PrevMonitorCallback(Monitor, Event);
+        }
+        s_Instance->RefreshMonitors();
+        s_Instance->bWindowEventsPending = true;
+    }
+
+    void FPlatformWindowProxy::CursorEnterCallback(GLFWwindow* Window, int bEntered)
+    {
+        FPlatformWindowProxy& Proxy = *s_Instance;
+        if (Window == Proxy.MainWindow && Proxy.PrevCursorEnterCallback)
+        {
+            Proxy.PrevCursorEnterCallback(Window, bEntered);
+        }
+
+        // X11 sends spurious leave/enter pairs, so entering restores the last position
+        if (bEntered)
+        {
+            Proxy.MouseWindow = Window;
+            Proxy.QueueInput(FMouseMovedEvent(Proxy.LastMouseX, Proxy.LastMouseY));
+        }
+        else if (Proxy.MouseWindow == Window)
+        {
+            Proxy.MouseWindow = nullptr;
+            Proxy.QueueInput(FMouseMovedEvent(-FLT_MAX, -FLT_MAX));
+        }
+    }
+
+    void FPlatformWindowProxy::CursorPosCallback(GLFWwindow* Window, double X, double Y)
+    {
+        FPlatformWindowProxy& Proxy = *s_Instance;
+        if (Window == Proxy.MainWindow && Proxy.PrevCursorPosCallback)
+        {
+            Proxy.PrevCursorPosCallback(Window, X, Y);
+        }
+
+        if (const FViewportWindow* ViewportWindow = Proxy.FindViewportWindow(Window))
+        {
+            std::lock_guard<std::mutex> Lock(Proxy.StateMutex);
+            X += ViewportWindow->State.X;
+            Y += ViewportWindow->State.Y;
+        }
+        Proxy.MouseWindow = Window;
+        Proxy.LastMouseX = static_cast<float>(X);
+        Proxy.LastMouseY = static_cast<float>(Y);
+        Proxy.QueueInput(FMouseMovedEvent(Proxy.LastMouseX, Proxy.LastMouseY));
+    }
+
+    void FPlatformWindowProxy::MouseButtonCallback(GLFWwindow* Window, int Button, int Action, int Mods)
+    {
+        if (Window == s_Instance->MainWindow && s_Instance->PrevMouseButtonCallback)
+        {
+            s_Instance->PrevMouseButtonCallback(Window, Button, Action, Mods);
+        }
+
+        if (Button < 0)
+            return;
+        if (Action == GLFW_PRESS)
+        {
+            s_Instance->QueueInput(FMouseButtonPressedEvent(Button));
+        }
+        else
+        {
+            s_Instance->QueueInput(FMouseButtonReleasedEvent(Button));
+        }
+    }
+
+    void FPlatformWindowProxy::ScrollCallback(GLFWwindow* Window, double XOffset, double YOffset)
+    {
+        if (Window == s_Instance->MainWindow && s_Instance->PrevScrollCallback)
+        {
+            s_Instance->PrevScrollCallback(Window, XOffset, YOffset);
+        }
+        s_Instance->QueueInput(FMouseScrolledEvent(static_cast<float>(XOffset), static_cast<float>(YOffset)));
+    }
+
+    void FPlatformWindowProxy::KeyCallback(GLFWwindow* Window, int Key, int ScanCode, int Action, int Mods)
+    {
+        if (Window == s_Instance->MainWindow && s_Instance->PrevKeyCallback)
+        {
+            s_Instance->PrevKeyCallback(Window, Key, ScanCode, Action, Mods);
+        }
+
+        // ImGui repeats held keys itself
+        if (Action == GLFW_REPEAT)
+            return;
+
+        Key = TranslateUntranslatedKey(Key, ScanCode);
+        if (Action == GLFW_PRESS)
+        {
+            s_Instance->QueueInput(FKeyPressedEvent(Key));
+        }
+        else
+        {
+            s_Instance->QueueInput(FKeyReleasedEvent(Key));
+        }
+    }
+
+    void FPlatformWindowProxy::CharCallback(GLFWwindow* Window, unsigned int CodePoint)
+    {
+        if (Window == s_Instance->MainWindow && s_Instance->PrevCharCallback)
+        {
+            s_Instance->PrevCharCallback(Window, CodePoint);
+        }
+        s_Instance->QueueInput(FKeyTypedEvent(static_cast<int>(CodePoint)));
+    }
+
+}
+
+#endif
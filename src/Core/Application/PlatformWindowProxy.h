@@ -0,0 +1,231 @@
+#pragma once
+
+#include "Core/Events/EventQueue.h"
+#include "Core/Jobs/JobSystem.h"
+#include "Core/Renderer/RenderTargetPool.h"
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+struct GLFWcursor;
+struct GLFWmonitor;
+struct GLFWwindow;
+struct ImGuiPlatformMonitor;
+struct ImGuiViewport;
+struct ImVec2;
+
+namespace Core
+{
+
+    // Makes ImGui multi-viewports safe with GLFW's threading rules. ImGui drives its platform
+    // windows from the render thread, but GLFW windows may only be created, changed or queried on
+    // the main thread. The proxy replaces the GLFW backend's window hooks:
+    //  - create and destroy run on the main thread while the render thread waits for them
+    //  - moves, resizes, titles, focus and alpha are posted to the main thread without waiting
+    //  - position, size, focus and minimized state are answered from a cache the main thread's
+    //    window callbacks keep current, and close/move/resize requests are forwarded to ImGui
+    //    by NewFrame
+    //  - NewFrame stands in for ImGui_ImplGlfw_NewFrame, which queries every window and the
+    //    monitors and sets cursors: the display size and monitors come from the cache, cursor
+    //    changes are posted to the main thread, and input from every window, which the
+    //    backend's callbacks would add to ImGui on the main thread, arrives through an event
+    //    queue
+    // Secondary viewports are drawn in the render thread's own context into pooled framebuffers.
+    // The main thread then blits each one into its window through a shared context and swaps,
+    // so an undocked window costs one extra draw pass instead of a context switch per frame.
+    // Desktop only.
+    class FPlatformWindowProxy
+    {
+    public:
+        // Main thread, after ImGui_ImplGlfw_InitForOpenGL
+        FPlatformWindowProxy(FJobSystem& InJobSystem, FRenderTargetPool& InRenderTargetPool, GLFWwindow* InMainWindow);
+        // Main thread, after ImGui_ImplGlfw_Shutdown has destroyed the windows through the hooks
+        ~FPlatformWindowProxy();
+
+        FPlatformWindowProxy(const FPlatformWindowProxy&) = delete;
+        FPlatformWindowProxy& operator=(const FPlatformWindowProxy&) = delete;
+
+        // Render thread, in place of ImGui_ImplGlfw_NewFrame
+        void NewFrame();
+        // Render thread, after ImGui::UpdatePlatformWindows: draws every visible secondary
+        // viewport into a pooled framebuffer and queues it for presentation on the main thread.
+        // A window whose previous frame is still queued skips this one.
+        void RenderWindows();
+        // Render thread, before FRenderTargetPool::ReleaseAll
+        void ReleaseRenderTargets();
+
+        // Main thread: whether a window callback ran since the last call, i.e. something other than
+        // the proxy's own presents woke the main thread and a frame is due
+        [[nodiscard]] bool TakeWindowEvents() { return std::exchange(bWindowEventsPending, false); }
+
+    private:
+        struct FWindowState
+        {
+            int X = 0;
+            int Y = 0;
+            int Width = 0;
+            int Height = 0;
+            float FramebufferScaleX = 1.0f;
+            float FramebufferScaleY = 1.0f;
+            bool bFocused = false;
+            bool bMinimized = false;
+        };
+
+        // Hung off ImGuiViewport::RendererUserData, which the OpenGL3 renderer leaves unused
+        struct FViewportWindow
+        {
+            static constexpr int SlotCount = 2;
+
+            GLFWwindow* Window = nullptr;
+
+            // Guarded by StateMutex; written by the main thread's window callbacks
+            FWindowState State;
+
+            // Set by window callbacks, moved onto the viewport by ApplyWindowRequests
+            std::atomic<bool> bRequestClose{ false };
+            std::atomic<bool> bRequestMove{ false };
+            std::atomic<bool> bRequestResize{ false };
+
+            // Main thread: the last position and size ImGui asked for, whose events are echoes
+            int RequestedX = 0;
+            int RequestedY = 0;
+            int RequestedWidth = -1;
+            int RequestedHeight = -1;
+
+            // Render thread: framebuffers drawn in turn, so one can be drawn while the other is shown
+            FRenderTarget Targets[SlotCount];
+            int NextSlot = 0;
+            // Fences the main thread sets after blitting a slot; the render thread waits on them
+            // on the GPU before drawing into the slot again. GLsync.
+            void* PresentedFences[SlotCount] = {};
+            // Set while a frame is queued for the main thread
+            std::atomic<bool> bPresentPending{ false };
+
+            // Main thread, in the window's own context: reads the shared slot textures
+            unsigned int ReadFramebuffers[SlotCount] = {};
+            unsigned int AttachedTextures[SlotCount] = {};
+        };
+
+        // Render thread: hands window close/move/resize events to ImGui
+        void ApplyWindowRequests();
+        // Render thread: adds a queued input event to ImGui's
+        void AddInputEvent(const FEvent& Event);
+
+        // Main thread
+        void QueueInput(const FEvent& Event);
+        void RefreshMonitors();
+        void SetMouseCursor(int Cursor);
+        void ApplyMouseCursor(GLFWwindow* Window) const;
+        void SetMousePos(float X, float Y);
+
+        // Runs Func on the main thread and waits for it; inline when already there
+        void RunOnMainThread(const std::function<void()>& Func);
+        void PostToMainThread(std::function<void()> Func);
+
+        [[nodiscard]] FViewportWindow* FindViewportWindow(GLFWwindow* Window) const;
+        void InstallWindowCallbacks(FViewportWindow& ViewportWindow);
+        // Main thread: queries the window state the callbacks otherwise keep current
+        void RefreshState(FViewportWindow& ViewportWindow);
+        void Present(FViewportWindow& ViewportWindow, int Slot, unsigned int Texture, int Width, int Height, void* RenderedFence);
+
+        // ImGuiPlatformIO hooks
+        static void CreatePlatformWindow(ImGuiViewport* Viewport);
+        static void DestroyPlatformWindow(ImGuiViewport* Viewport);
+        static void ShowPlatformWindow(ImGuiViewport* Viewport);
+        static void SetWindowPos(ImGuiViewport* Viewport, ImVec2 Pos);
+        static ImVec2 GetWindowPos(ImGuiViewport* Viewport);
+        static void SetWindowSize(ImGuiViewport* Viewport, ImVec2 Size);
+        static ImVec2 GetWindowSize(ImGuiViewport* Viewport);
+        static ImVec2 GetWindowFramebufferScale(ImGuiViewport* Viewport);
+        static void SetWindowFocus(ImGuiViewport* Viewport);
+        static bool GetWindowFocus(ImGuiViewport* Viewport);
+        static bool GetWindowMinimized(ImGuiViewport* Viewport);
+        static void SetWindowTitle(ImGuiViewport* Viewport, const char* Title);
+        static void SetWindowAlpha(ImGuiViewport* Viewport, float Alpha);
+
+        // GLFW window callbacks, main thread
+        static void WindowCloseCallback(GLFWwindow* Window);
+        static void WindowPosCallback(GLFWwindow* Window, int X, int Y);
+        static void WindowSizeCallback(GLFWwindow* Window, int Width, int Height);
+        static void FramebufferSizeCallback(GLFWwindow* Window, int Width, int Height);
+        static void WindowFocusCallback(GLFWwindow* Window, int bFocused);
+        static void WindowIconifyCallback(GLFWwindow* Window, int bIconified);
+        static void WindowRefreshCallback(GLFWwindow* Window);
+        static void WindowContentScaleCallback(GLFWwindow* Window, float XScale, float YScale);
+        static void MonitorCallback(GLFWmonitor* Monitor, int Event);
+        // Every window's input, queued for NewFrame. The main window's is passed on to
+        // FApplication's callbacks first.
+        static void CursorEnterCallback(GLFWwindow* Window, int bEntered);
+        static void CursorPosCallback(GLFWwindow* Window, double X, double Y);
+        static void MouseButtonCallback(GLFWwindow* Window, int Button, int Action, int Mods);
+        static void ScrollCallback(GLFWwindow* Window, double XOffset, double YOffset);
+        static void KeyCallback(GLFWwindow* Window, int Key, int ScanCode, int Action, int Mods);
+        static void CharCallback(GLFWwindow* Window, unsigned int CodePoint);
+
+    private:
+        static FPlatformWindowProxy* s_Instance;
+
+        FJobSystem& JobSystem;
+        // Render thread only
+        FRenderTargetPool& RenderTargetPool;
+        GLFWwindow* MainWindow;
+        std::thread::id MainThreadId;
+
+        // The backend's hooks, which do the actual GLFW work on the main thread
+        void (*BackendCreateWindow)(ImGuiViewport*) = nullptr;
+        void (*BackendDestroyWindow)(ImGuiViewport*) = nullptr;
+        void (*BackendShowWindow)(ImGuiViewport*) = nullptr;
+        void (*BackendSetWindowPos)(ImGuiViewport*, ImVec2) = nullptr;
+        void (*BackendSetWindowSize)(ImGuiViewport*, ImVec2) = nullptr;
+        void (*BackendSetWindowFocus)(ImGuiViewport*) = nullptr;
+        void (*BackendSetWindowTitle)(ImGuiViewport*, const char*) = nullptr;
+        void (*BackendSetWindowAlpha)(ImGuiViewport*, float) = nullptr;
+
+        // The main window's callbacks from before the proxy, restored by the destructor
+        void (*PrevWindowPosCallback)(GLFWwindow*, int, int) = nullptr;
+        void (*PrevWindowSizeCallback)(GLFWwindow*, int, int) = nullptr;
+        void (*PrevWindowFocusCallback)(GLFWwindow*, int) = nullptr;
+        void (*PrevWindowIconifyCallback)(GLFWwindow*, int) = nullptr;
+        void (*PrevWindowContentScaleCallback)(GLFWwindow*, float, float) = nullptr;
+        void (*PrevCursorEnterCallback)(GLFWwindow*, int) = nullptr;
+        void (*PrevCursorPosCallback)(GLFWwindow*, double, double) = nullptr;
+        void (*PrevMouseButtonCallback)(GLFWwindow*, int, int, int) = nullptr;
+        void (*PrevScrollCallback)(GLFWwindow*, double, double) = nullptr;
+        void (*PrevKeyCallback)(GLFWwindow*, int, int, int, int) = nullptr;
+        void (*PrevCharCallback)(GLFWwindow*, unsigned int) = nullptr;
+        void (*PrevMonitorCallback)(GLFWmonitor*, int) = nullptr;
+
+        mutable std::mutex StateMutex;
+        // Guarded by StateMutex; copied into ImGui's list by NewFrame when changed
+        std::vector<ImGuiPlatformMonitor> Monitors;
+        bool bMonitorsChanged = false;
+
+        // Filled by the main thread's callbacks. Mouse positions are desktop coordinates, which
+        // ImGui expects with multi-viewports; leaving a window moves the mouse to -FLT_MAX.
+        FEventQueue InputEvents;
+
+        // Render thread only
+        double PreviousTime = 0.0;
+        double MonitorRefreshTime = 0.0;
+        // ImGuiMouseCursor last posted to the main thread; none of its values until the first
+        int RequestedCursor = -2;
+        // Bit per modifier key, GLFW_KEY_LEFT_SHIFT through GLFW_KEY_RIGHT_SUPER
+        unsigned int ModifierKeys = 0;
+
+        // Main thread only: every window with a proxy entry, the main window first
+        std::vector<FViewportWindow*> Windows;
+        bool bWindowEventsPending = false;
+        // Indexed by ImGuiMouseCursor
+        std::vector<GLFWcursor*> Cursors;
+        int AppliedCursor = 0;
+        // The window under the mouse, and the position it was last seen at
+        GLFWwindow* MouseWindow = nullptr;
+        float LastMouseX = 0.0f;
+        float LastMouseY = 0.0f;
+    };
+
+}
@@ -0,0 +1,671 @@
+#include "AssetManager.h"
+#include "Core/Logging/Log.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Profiling/Profiler.h"
+
+#include "raymath.h"
+#include "rlgl.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+namespace Core
+{
+
+    namespace
+    {
+        // Unreferenced assets are looked for this often rather than every frame
+        constexpr int CollectInterval = 60;
+
+        // Reads a whole file into a MemAlloc'd, NUL-terminated buffer raylib can take ownership of
+        unsigned char* ReadFileData(const char* Path, int* OutSize)
+        {
+            std::ifstream File(Path, std::ios::binary | std::ios::ate);
+            if (!File)
+                return nullptr;
+
+            const std::streamsize Size = File.tellg();
+            File.seekg(0, std::ios::beg);
+
+            unsigned char* Data = static_cast<unsigned char*>(MemAlloc(static_cast<unsigned int>(Size) + 1));
+            if (!Data || !File.read(reinterpret_cast<char*>(Data), Size))
+            {
+                MemFree(Data);
+                return nullptr;
+            }
+
+            *OutSize = static_cast<int>(Size);
+            return Data;
+        }
+
+        void ReleaseTexture(const Texture2D& Texture)
+        {
+            CORE_MEMORY_GPU_FREE(Texture, Texture.id);
+            UnloadTexture(Texture);
+        }
+
+        // Case-insensitive, without raylib's IsFileExtension, which is not safe to call from workers
+        bool HasExtension(std::string_view Path, std::string_view Extension)
+        {
+            return Path.size() >= Extension.size() && std::equal(Extension.begin(), Extension.end(), Path.end() - Extension.size(), [](char A, char B)
+            {
+                return std::tolower(static_cast<unsigned char>(A)) == std::tolower(static_cast<unsigned char>(B));
+            });
+        }
+
+        // Calls Func(Texture) once for every texture the model's materials own. raylib's UnloadModel
+        // leaves them alone since materials may share them.
+        template<typename F>
+        void ForEachModelTexture(const Model& InModel, F&& Func)
+        {
+            std::vector<unsigned int> Seen;
+            for (int MaterialIndex = 0; MaterialIndex < InModel.materialCount; MaterialIndex++)
+            {
+                const Material& Source = InModel.materials[MaterialIndex];
+                for (int Map = 0; Source.maps && Map <= MATERIAL_MAP_BRDF; Map++)
+                {
+                    const Texture2D& Texture = Source.maps[Map].texture;
+                    if (Texture.id == 0 || Texture.id == rlGetTextureIdDefault() || std::find(Seen.begin(), Seen.end(), Texture.id) != Seen.end())
+                        continue;
+
+                    Seen.push_back(Texture.id);
+                    Func(Texture);
+                }
+            }
+        }
+
+        [[nodiscard]] std::size_t GetMeshBytes(const Mesh& Source)
+        {
+            const std::size_t Vertices = static_cast<std::size_t>(Source.vertexCount);
+            return Vertices * 3 * sizeof(float)
+                + (Source.texcoords ? Vertices * 2 * sizeof(float) : 0)
+                + (Source.normals ? Vertices * 3 * sizeof(float) : 0)
+                + (Source.colors ? Vertices * 4 : 0)
+                + (Source.tangents ? Vertices * 4 * sizeof(float) : 0)
+                + (Source.indices ? static_cast<std::size_t>(Source.triangleCount) * 3 * sizeof(unsigned short) : 0);
+        }
+
+        // Reports a finished model's vertex buffers and textures to the memory tracker
+        void TrackModel([[maybe_unused]] const Model& InModel)
+        {
+            #ifdef CORE_ENABLE_MEMORY_TRACKING
+                for (int MeshIndex = 0; MeshIndex < InModel.meshCount; MeshIndex++)
+                {
+                    const Mesh& Source = InModel.meshes[MeshIndex];
+                    if (Source.vboId && Source.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION] != 0)
+                        CORE_MEMORY_GPU_ALLOC(Buffer, Source.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION], GetMeshBytes(Source));
+                }
+                ForEachModelTexture(InModel, [](const Texture2D& Texture)
+                {
+                    CORE_MEMORY_GPU_ALLOC(Texture, Texture.id, static_cast<std::size_t>(GetPixelDataSize(Texture.width, Texture.height, Texture.format)));
+                });
+            #endif
+        }
+
+        void ReleaseModel(const Model& InModel)
+        {
+            #ifdef CORE_ENABLE_MEMORY_TRACKING
+                for (int MeshIndex = 0; MeshIndex < InModel.meshCount; MeshIndex++)
+                {
+                    const Mesh& Source = InModel.meshes[MeshIndex];
+                    if (Source.vboId)
+                        CORE_MEMORY_GPU_FREE(Buffer, Source.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION]);
+                }
+            #endif
+            ForEachModelTexture(InModel, ReleaseTexture);
+            UnloadModel(InModel);
+        }
+
+        // raylib's UnloadMesh frees MAX_MESH_VERTEX_BUFFERS slots, 9 in the larger of its two
+        // configurations
+        constexpr int MeshVertexBufferSlots = 9;
+        // A step always moves at least this much, whatever is left of the frame's budget
+        constexpr std::size_t MinModelUploadBytes = 64 * 1024;
+
+        struct FMeshAttribute
+        {
+            int Location;
+            int Components;
+            const void* Data;
+            std::size_t Bytes;
+        };
+
+        // The arrays ParseObj fills, in upload order; missing ones have no bytes
+        std::array<FMeshAttribute, 3> GetMeshAttributes(const Mesh& Source)
+        {
+            const std::size_t Vertices = static_cast<std::size_t>(Source.vertexCount);
+            return
+            {{
+                { RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, Source.vertices, Vertices * 3 * sizeof(float) },
+                { RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, Source.texcoords, Source.texcoords ? Vertices * 2 * sizeof(float) : 0 },
+                { RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, 3, Source.normals, Source.normals ? Vertices * 3 * sizeof(float) : 0 }
+            }};
+        }
+
+        // UploadMesh's vertex array layout with empty buffers, filled afterwards by rlUpdateVertexBuffer
+        bool CreateMeshBuffers(Mesh& Target)
+        {
+            Target.vboId = static_cast<unsigned int*>(MemAlloc(MeshVertexBufferSlots * sizeof(unsigned int)));
+            Target.vaoId = rlLoadVertexArray();
+            if (Target.vaoId == 0)
+                return false;
+
+            rlEnableVertexArray(Target.vaoId);
+            for (const FMeshAttribute& Attribute : GetMeshAttributes(Target))
+            {
+                if (Attribute.Bytes > 0)
+                {
+                    Target.vboId[Attribute.Location] = rlLoadVertexBuffer(nullptr, static_cast<int>(Attribute.Bytes), false);
+                    rlSetVertexAttribute(Attribute.Location, Attribute.Components, RL_FLOAT, false, 0, 0);
+                    rlEnableVertexAttribute(Attribute.Location);
+                }
+                else
+                {
+                    // The same defaults UploadMesh sets for absent arrays
+                    const float Texcoord[2] = { 0.0f, 0.0f };
+                    const float Normal[3] = { 0.0f, 0.0f, 1.0f };
+                    const bool bNormal = Attribute.Location == RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL;
+                    rlSetVertexAttributeDefault(Attribute.Location, bNormal ? Normal : Texcoord, bNormal ? SHADER_ATTRIB_VEC3 : SHADER_ATTRIB_VEC2, Attribute.Components);
+                    rlDisableVertexAttribute(Attribute.Location);
+                }
+            }
+
+            const float White[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+            rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, White, SHADER_ATTRIB_VEC4, 4);
+            rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+            const float Tangent[4] = { 1.0f, 0.0f, 0.0f, 1.0f };
+            rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, Tangent, SHADER_ATTRIB_VEC4, 4);
+            rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
+
+            rlDisableVertexArray();
+            return true;
+        }
+
+        template<typename T>
+        T* CopyToRaylib(const std::vector<T>& Values)
+        {
+            T* Copy = static_cast<T*>(MemAlloc(static_cast<unsigned int>(Values.size() * sizeof(T))));
+            std::copy(Values.begin(), Values.end(), Copy);
+            return Copy;
+        }
+
+        // File read ahead by a worker for the model raylib is loading right now. raylib's loaders
+        // only take paths, so the prefetched bytes are served through its file callbacks.
+        struct FServedFile
+        {
+            const char* Path = nullptr;
+            unsigned char* Data = nullptr;
+            int Size = 0;
+        };
+        FServedFile s_ServedFile;
+
+        unsigned char* ServeFileData(const char* FileName, int* OutSize)
+        {
+            if (s_ServedFile.Data && std::strcmp(FileName, s_ServedFile.Path) == 0)
+            {
+                *OutSize = s_ServedFile.Size;
+                return std::exchange(s_ServedFile.Data, nullptr);
+            }
+
+            // Companion files (.mtl, .bin, textures) come straight from disk
+            *OutSize = 0;
+            return ReadFileData(FileName, OutSize);
+        }
+
+        char* ServeFileText(const char* FileName)
+        {
+            int Size = 0;
+            return reinterpret_cast<char*>(ServeFileData(FileName, &Size));
+        }
+    }
+
+    FAssetManager::FAssetManager(FJobSystem& InJobSystem)
+        : JobSystem(InJobSystem)
+    {
+    }
+
+    FAssetManager::~FAssetManager()
+    {
+        JobSystem.Wait(InFlight);
+
+        // Without a GL context only the CPU side can be released here
+        for (FStagedAsset& Asset : Staging)
+        {
+            Discard(Asset, false);
+        }
+    }
+
+    FTextureHandle FAssetManager::LoadTextureAsync(const std::string& Path)
+    {
+        std::lock_guard<std::mutex> Lock(AssetsMutex);
+
+        Ref<Detail::TAssetSlot<Texture2D>>& Slot = Textures[Path];
+        if (Slot)
+            return FTextureHandle(Slot);
+
+        Slot = CreateRef<Detail::TAssetSlot<Texture2D>>();
+        Slot->Path = Path;
+        PendingCount.fetch_add(1, std::memory_order_relaxed);
+
+        JobSystem.Submit([this, Slot]()
+        {
+            CORE_PROFILE_SCOPE("Decode Texture");
+            CORE_MEMORY_TAG(Assets);
+
+            int Size = 0;
+            unsigned char* Data = ReadFileData(Slot->Path.c_str(), &Size);
+            Image Pixels{};
+            if (Data)
+            {
+                Pixels = LoadImageFromMemory(GetFileExtension(Slot->Path.c_str()), Data, Size);
+                MemFree(Data);
+            }
+
+            if (!Pixels.data)
+            {
+                FLog::CoreError("Failed to load texture '{}'", Slot->Path);
+                Slot->State.store(EAssetState::Failed, std::memory_order_release);
+                PendingCount.fetch_sub(1, std::memory_order_relaxed);
+                return;
+            }
+
+            Stage(FStagedTexture{ Slot, Pixels });
+        }, &InFlight);
+
+        return FTextureHandle(Slot);
+    }
+
+    FModelHandle FAssetManager::LoadModelAsync(const std::string& Path)
+    {
+        std::lock_guard<std::mutex> Lock(AssetsMutex);
+
+        Ref<Detail::TAssetSlot<Model>>& Slot = Models[Path];
+        if (Slot)
+            return FModelHandle(Slot);
+
+        Slot = CreateRef<Detail::TAssetSlot<Model>>();
+        Slot->Path = Path;
+        PendingCount.fetch_add(1, std::memory_order_relaxed);
+
+        JobSystem.Submit([this, Slot]()
+        {
+            CORE_PROFILE_SCOPE("Parse Model");
+            CORE_MEMORY_TAG(Assets);
+
+            int Size = 0;
+            unsigned char* Data = ReadFileData(Slot->Path.c_str(), &Size);
+            if (!Data)
+            {
+                FLog::CoreError("Failed to read model '{}'", Slot->Path);
+                Slot->State.store(EAssetState::Failed, std::memory_order_release);
+                PendingCount.fetch_sub(1, std::memory_order_relaxed);
+                return;
+            }
+
+            if (!HasExtension(Slot->Path, ".obj"))
+            {
+                Stage(FStagedModelFile{ Slot, Data, Size });
+                return;
+            }
+
+            FStagedModel Staged;
+            Staged.Slot = Slot;
+            const bool bParsed = ParseObj(Slot->Path, std::string_view(reinterpret_cast<const char*>(Data), static_cast<std::size_t>(Size)), Staged.Parsed);
+            MemFree(Data);
+            if (!bParsed)
+            {
+                FLog::CoreError("Failed to parse model '{}'", Slot->Path);
+                Staged.Parsed.Release();
+                Slot->State.store(EAssetState::Failed, std::memory_order_release);
+                PendingCount.fetch_sub(1, std::memory_order_relaxed);
+                return;
+            }
+
+            Stage(std::move(Staged));
+        }, &InFlight);
+
+        return FModelHandle(Slot);
+    }
+
+    void FAssetManager::Update()
+    {
+        CORE_PROFILE_FUNCTION();
+
+        using FClock = std::chrono::steady_clock;
+        const FClock::time_point Start = FClock::now();
+
+        std::size_t Bytes = 0;
+        bool bFirstStep = true;
+        while (bFirstStep || (Bytes < BytesPerFrame && FClock::now() - Start < TimePerFrame))
+        {
+            std::optional<FStagedAsset> Asset;
+            {
+                std::lock_guard<std::mutex> Lock(StagingMutex);
+                if (Staging.empty())
+                    break;
+
+                Asset.emplace(std::move(Staging.front()));
+                Staging.pop_front();
+            }
+
+            // Whatever is left of the byte budget; the first step always makes progress
+            const std::size_t ByteBudget = BytesPerFrame - std::min(Bytes, BytesPerFrame);
+            std::size_t StepBytes = 0;
+            const bool bDone = std::visit([&](auto& Staged) { return UploadStep(Staged, ByteBudget, StepBytes); }, *Asset);
+
+            Bytes += StepBytes;
+            bFirstStep = false;
+
+            if (bDone)
+            {
+                PendingCount.fetch_sub(1, std::memory_order_relaxed);
+            }
+            else
+            {
+                std::lock_guard<std::mutex> Lock(StagingMutex);
+                Staging.push_front(std::move(*Asset));
+            }
+        }
+
+        if (UploadWakeCallback)
+        {
+            bool bHasStaged = false;
+            {
+                std::lock_guard<std::mutex> Lock(StagingMutex);
+                bHasStaged = !Staging.empty();
+            }
+            if (bHasStaged)
+                UploadWakeCallback();
+        }
+
+        if (++FramesSinceCollect >= CollectInterval)
+        {
+            FramesSinceCollect = 0;
+            CollectUnused();
+        }
+    }
+
+    void FAssetManager::UnloadAll()
+    {
+        JobSystem.Wait(InFlight);
+
+        {
+            std::lock_guard<std::mutex> Lock(StagingMutex);
+            for (FStagedAsset& Asset : Staging)
+            {
+                Discard(Asset, true);
+            }
+            Staging.clear();
+            PendingCount.store(0, std::memory_order_relaxed);
+        }
+
+        std::lock_guard<std::mutex> Lock(AssetsMutex);
+        for (auto& [Path, Slot] : Textures)
+        {
+            if (Slot->State.exchange(EAssetState::Failed) == EAssetState::Ready)
+                ReleaseTexture(Slot->Asset);
+        }
+        for (auto& [Path, Slot] : Models)
+        {
+            if (Slot->State.exchange(EAssetState::Failed) == EAssetState::Ready)
+                ReleaseModel(Slot->Asset);
+        }
+        Textures.clear();
+        Models.clear();
+    }
+
+    void FAssetManager::SetUploadBudget(std::size_t InBytesPerFrame, double InMillisecondsPerFrame)
+    {
+        BytesPerFrame = InBytesPerFrame;
+        TimePerFrame = std::chrono::duration<double, std::milli>(InMillisecondsPerFrame);
+    }
+
+    void FAssetManager::Stage(FStagedAsset&& Asset)
+    {
+        {
+            std::lock_guard<std::mutex> Lock(StagingMutex);
+            Staging.push_back(std::move(Asset));
+        }
+
+        if (UploadWakeCallback)
+            UploadWakeCallback();
+    }
+
+    bool FAssetManager::UploadStep(FStagedTexture& Staged, std::size_t ByteBudget, std::size_t& OutBytes)
+    {
+        CORE_PROFILE_SCOPE("Upload Texture");
+
+        Image& Pixels = Staged.Pixels;
+        Texture2D& Texture = Staged.Slot->Asset;
+
+        // Compressed and mipmapped images cannot be split by rows; they go up in one piece
+        if (Pixels.format >= PIXELFORMAT_COMPRESSED_DXT1_RGB || Pixels.mipmaps > 1)
+        {
+            Texture = LoadTextureFromImage(Pixels);
+            OutBytes = static_cast<std::size_t>(GetPixelDataSize(Pixels.width, Pixels.height, Pixels.format));
+            Staged.UploadedRows = Pixels.height;
+        }
+        else
+        {
+            if (Texture.id == 0)
+            {
+                Texture = Texture2D{ rlLoadTexture(nullptr, Pixels.width, Pixels.height, Pixels.format, 1), Pixels.width, Pixels.height, 1, Pixels.format };
+            }
+
+            if (Texture.id != 0)
+            {
+                const std::size_t RowBytes = static_cast<std::size_t>(GetPixelDataSize(Pixels.width, 1, Pixels.format));
+                const int Rows = std::clamp(static_cast<int>(ByteBudget / std::max<std::size_t>(RowBytes, 1)), 1, Pixels.height - Staged.UploadedRows);
+
+                const Rectangle Band{ 0.0f, static_cast<float>(Staged.UploadedRows), static_cast<float>(Pixels.width), static_cast<float>(Rows) };
+                UpdateTextureRec(Texture, Band, static_cast<const unsigned char*>(Pixels.data) + RowBytes * Staged.UploadedRows);
+
+                Staged.UploadedRows += Rows;
+                OutBytes = RowBytes * Rows;
+            }
+        }
+
+        if (Texture.id == 0)
+        {
+            FLog::CoreError("Failed to upload texture '{}'", Staged.Slot->Path);
+            UnloadImage(Pixels);
+            Staged.Slot->State.store(EAssetState::Failed, std::memory_order_release);
+            return true;
+        }
+
+        if (Staged.UploadedRows < Pixels.height)
+            return false;
+
+        CORE_MEMORY_GPU_ALLOC(Texture, Texture.id, static_cast<std::size_t>(GetPixelDataSize(Pixels.width, Pixels.height, Pixels.format)));
+        UnloadImage(Pixels);
+        Staged.Slot->State.store(EAssetState::Ready, std::memory_order_release);
+        return true;
+    }
+
+    bool FAssetManager::UploadStep(FStagedModel& Staged, std::size_t ByteBudget, std::size_t& OutBytes)
+    {
+        CORE_PROFILE_SCOPE("Upload Model");
+
+        FParsedModel& Parsed = Staged.Parsed;
+        const std::size_t Budget = std::max(ByteBudget, MinModelUploadBytes);
+
+        // Vertex data first, in ranges of each buffer as large as the budget allows
+        while (Staged.MeshIndex < Parsed.Meshes.size())
+        {
+            if (OutBytes >= Budget)
+                return false;
+
+            Mesh& Target = Parsed.Meshes[Staged.MeshIndex];
+            if (!Target.vboId && !CreateMeshBuffers(Target))
+            {
+                FLog::CoreError("Failed to create vertex buffers for model '{}'", Staged.Slot->Path);
+                FStagedAsset Failed(std::move(Staged));
+                Discard(Failed, true);
+                return true;
+            }
+
+            const FMeshAttribute Attribute = GetMeshAttributes(Target)[Staged.Attribute];
+            const std::size_t Bytes = std::min(Attribute.Bytes - Staged.Offset, Budget - OutBytes);
+            if (Bytes > 0)
+            {
+                rlUpdateVertexBuffer(Target.vboId[Attribute.Location], static_cast<const unsigned char*>(Attribute.Data) + Staged.Offset, static_cast<int>(Bytes), static_cast<int>(Staged.Offset));
+                Staged.Offset += Bytes;
+                OutBytes += Bytes;
+            }
+
+            if (Staged.Offset == Attribute.Bytes)
+            {
+                Staged.Offset = 0;
+                if (++Staged.Attribute == GetMeshAttributes(Target).size())
+                {
+                    Staged.Attribute = 0;
+                    Staged.MeshIndex++;
+                }
+            }
+        }
+
+        // Then the materials, a diffuse map at a time
+        while (Staged.Materials.size() < Parsed.Materials.size())
+        {
+            FParsedMaterial& Source = Parsed.Materials[Staged.Materials.size()];
+            const std::size_t Bytes = Source.DiffuseMap.data ? static_cast<std::size_t>(GetPixelDataSize(Source.DiffuseMap.width, Source.DiffuseMap.height, Source.DiffuseMap.format)) : 0;
+            if (OutBytes > 0 && OutBytes + Bytes > Budget)
+                return false;
+
+            Material Created = LoadMaterialDefault();
+            Created.maps[MATERIAL_MAP_DIFFUSE].color = Source.Diffuse;
+            if (Source.DiffuseMap.data)
+            {
+                Created.maps[MATERIAL_MAP_DIFFUSE].texture = LoadTextureFromImage(Source.DiffuseMap);
+                UnloadImage(Source.DiffuseMap);
+                Source.DiffuseMap = Image{};
+                OutBytes += Bytes;
+            }
+            Staged.Materials.push_back(Created);
+        }
+
+        // Everything is on the GPU: the arrays move into a raylib model, which owns them from here
+        Model Loaded{};
+        Loaded.transform = MatrixIdentity();
+        Loaded.meshCount = static_cast<int>(Parsed.Meshes.size());
+        Loaded.meshes = CopyToRaylib(Parsed.Meshes);
+        Loaded.materialCount = static_cast<int>(Staged.Materials.size());
+        Loaded.materials = CopyToRaylib(Staged.Materials);
+        Loaded.meshMaterial = CopyToRaylib(Parsed.MeshMaterials);
+        Parsed.Meshes.clear();
+        Parsed.MeshMaterials.clear();
+        Parsed.Materials.clear();
+        Staged.Materials.clear();
+
+        TrackModel(Loaded);
+        Staged.Slot->Asset = Loaded;
+        Staged.Slot->State.store(EAssetState::Ready, std::memory_order_release);
+        return true;
+    }
+
+    bool FAssetManager::UploadStep(FStagedModelFile& Staged, [[maybe_unused]] std::size_t ByteBudget, std::size_t& OutBytes)
+    {
+        CORE_PROFILE_SCOPE("Upload Model");
+
+        s_ServedFile = FServedFile{ Staged.Slot->Path.c_str(), Staged.FileData, Staged.FileSize };
+        SetLoadFileDataCallback(ServeFileData);
+        SetLoadFileTextCallback(ServeFileText);
+
+        Model Loaded = LoadModel(Staged.Slot->Path.c_str());
+
+        SetLoadFileDataCallback(nullptr);
+        SetLoadFileTextCallback(nullptr);
+        MemFree(s_ServedFile.Data); // Still set if the loader never asked for the file
+        s_ServedFile = FServedFile{};
+        Staged.FileData = nullptr;
+
+        OutBytes = static_cast<std::size_t>(Staged.FileSize);
+
+        if (Loaded.meshCount == 0)
+        {
+            FLog::CoreError("Failed to load model '{}'", Staged.Slot->Path);
+            UnloadModel(Loaded);
+            Staged.Slot->State.store(EAssetState::Failed, std::memory_order_release);
+            return true;
+        }
+
+        TrackModel(Loaded);
+        Staged.Slot->Asset = Loaded;
+        Staged.Slot->State.store(EAssetState::Ready, std::memory_order_release);
+        return true;
+    }
+
+    void FAssetManager::Discard(FStagedAsset& Asset, bool bReleaseGpu)
+    {
+        if (FStagedTexture* Texture = std::get_if<FStagedTexture>(&Asset))
+        {
+            UnloadImage(Texture->Pixels);
+            if (bReleaseGpu && Texture->Slot->Asset.id != 0)
+                ReleaseTexture(Texture->Slot->Asset);
+            Texture->Slot->State.store(EAssetState::Failed, std::memory_order_release);
+        }
+        else if (FStagedModel* Model = std::get_if<FStagedModel>(&Asset))
+        {
+            if (bReleaseGpu)
+            {
+                // UnloadMesh frees the CPU arrays along with the buffers
+                for (Mesh& Target : Model->Parsed.Meshes)
+                {
+                    if (Target.vaoId != 0)
+                    {
+                        UnloadMesh(Target);
+                        Target = Mesh{};
+                    }
+                }
+                for (const Material& Created : Model->Materials)
+                {
+                    if (Created.maps[MATERIAL_MAP_DIFFUSE].texture.id != rlGetTextureIdDefault())
+                        UnloadTexture(Created.maps[MATERIAL_MAP_DIFFUSE].texture);
+                    MemFree(Created.maps);
+                }
+            }
+            Model->Parsed.Release();
+            Model->Slot->State.store(EAssetState::Failed, std::memory_order_release);
+        }
+        else
+        {
+            FStagedModelFile& File = std::get<FStagedModelFile>(Asset);
+            MemFree(File.FileData);
+            File.Slot->State.store(EAssetState::Failed, std::memory_order_release);
+        }
+    }
+
+    void FAssetManager::CollectUnused()
+    {
+        std::lock_guard<std::mutex> Lock(AssetsMutex);
+
+        std::erase_if(Textures, [](const auto& Entry)
+        {
+            const auto& [Path, Slot] = Entry;
+            if (Slot.use_count() > 1 || Slot->State.load(std::memory_order_acquire) == EAssetState::Loading)
+                return false;
+
+            if (Slot->State.load(std::memory_order_acquire) == EAssetState::Ready)
+                ReleaseTexture(Slot->Asset);
+            return true;
+        });
+
+        std::erase_if(Models, [](const auto& Entry)
+        {
+            const auto& [Path, Slot] = Entry;
+            if (Slot.use_count() > 1 || Slot->State.load(std::memory_order_acquire) == EAssetState::Loading)
+                return false;
+
+            if (Slot->State.load(std::memory_order_acquire) == EAssetState::Ready)
+                ReleaseModel(Slot->Asset);
+            return true;
+        });
+    }
+
+}
@@ -0,0 +1,171 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+#include "Core/Jobs/JobSystem.h"
+#include "ObjParser.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include "raylib.h"
+
+namespace Core
+{
+
+    enum class EAssetState : std::uint8_t
+    {
+        Loading,
+        Ready,
+        Failed
+    };
+
+    namespace Detail
+    {
+        template<typename T>
+        struct TAssetSlot
+        {
+            std::string Path;
+            std::atomic<EAssetState> State{ EAssetState::Loading };
+
+            // Written by the render thread before State becomes Ready
+            T Asset{};
+        };
+    }
+
+    // Shared reference to an asset loaded by FAssetManager. Cheap to copy; the asset is released
+    // on the render thread once the last handle is gone.
+    template<typename T>
+    class TAssetHandle
+    {
+    public:
+        TAssetHandle() = default;
+
+        [[nodiscard]] bool IsValid() const { return Slot != nullptr; }
+        [[nodiscard]] EAssetState GetState() const { return Slot ? Slot->State.load(std::memory_order_acquire) : EAssetState::Failed; }
+        [[nodiscard]] bool IsReady() const { return GetState() == EAssetState::Ready; }
+        [[nodiscard]] bool IsFailed() const { return GetState() == EAssetState::Failed; }
+        [[nodiscard]] const std::string& GetPath() const { return Slot->Path; }
+
+        // Only while IsReady()
+        [[nodiscard]] const T& Get() const { return Slot->Asset; }
+        const T* operator->() const { return &Slot->Asset; }
+
+    private:
+        friend class FAssetManager;
+
+        explicit TAssetHandle(Ref<Detail::TAssetSlot<T>> InSlot)
+            : Slot(std::move(InSlot))
+        {
+        }
+
+        Ref<Detail::TAssetSlot<T>> Slot;
+    };
+
+    using FTextureHandle = TAssetHandle<Texture2D>;
+    using FModelHandle = TAssetHandle<Model>;
+
+    // Loads textures and models without stalling the render thread.
+    // Workers of the job system read files, decode images and parse OBJ models into CPU meshes; the
+    // render thread drains the staged results in Update() within a per-frame budget, splitting
+    // large textures into row bands and vertex buffers into byte ranges.
+    // raylib's loaders for the other model formats create GL textures while parsing, so those are
+    // only read on a worker and decoded by LoadModel on the render thread as a single step.
+    class FAssetManager
+    {
+    public:
+        explicit FAssetManager(FJobSystem& InJobSystem);
+        ~FAssetManager();
+
+        FAssetManager(const FAssetManager&) = delete;
+        FAssetManager& operator=(const FAssetManager&) = delete;
+
+        // Any thread. Loading the same path again returns the existing handle.
+        [[nodiscard]] FTextureHandle LoadTextureAsync(const std::string& Path);
+        [[nodiscard]] FModelHandle LoadModelAsync(const std::string& Path);
+
+        // Render thread, once per frame: uploads staged assets until either budget is spent, and
+        // releases assets no handle refers to anymore. At least one step is taken every frame.
+        void Update();
+        // Render thread, before the GL context goes away
+        void UnloadAll();
+
+        void SetUploadBudget(std::size_t InBytesPerFrame, double InMillisecondsPerFrame);
+        [[nodiscard]] std::size_t GetPendingCount() const { return PendingCount.load(std::memory_order_relaxed); }
+        // Called whenever staged uploads wait for the next Update, from the staging worker or from
+        // Update itself when the budget ran out (e.g. to wake an idle render loop). Set before loading.
+        void SetUploadWakeCallback(std::function<void()> Callback) { UploadWakeCallback = std::move(Callback); }
+
+    private:
+        struct FStagedTexture
+        {
+            Ref<Detail::TAssetSlot<Texture2D>> Slot;
+            Image Pixels{};
+            int UploadedRows = 0;
+        };
+
+        // Parsed on a worker; buffers are created empty and filled range by range
+        struct FStagedModel
+        {
+            Ref<Detail::TAssetSlot<Model>> Slot;
+            FParsedModel Parsed;
+
+            // Upload progress: the buffer being filled and how far, then the materials created
+            std::size_t MeshIndex = 0;
+            std::size_t Attribute = 0;
+            std::size_t Offset = 0;
+            std::vector<Material> Materials;
+        };
+
+        // Any other format, read on a worker and loaded by raylib in one step
+        struct FStagedModelFile
+        {
+            Ref<Detail::TAssetSlot<Model>> Slot;
+            unsigned char* FileData = nullptr; // MemAlloc'd, handed to raylib
+            int FileSize = 0;
+        };
+
+        using FStagedAsset = std::variant<FStagedTexture, FStagedModel, FStagedModelFile>;
+
+        void Stage(FStagedAsset&& Asset);
+
+        // Each returns true once the asset is finished and can leave the staging queue
+        bool UploadStep(FStagedTexture& Staged, std::size_t ByteBudget, std::size_t& OutBytes);
+        bool UploadStep(FStagedModel& Staged, std::size_t ByteBudget, std::size_t& OutBytes);
+        bool UploadStep(FStagedModelFile& Staged, std::size_t ByteBudget, std::size_t& OutBytes);
+
+        // Frees what a staged asset holds and marks it failed. GPU objects are only released with
+        // bReleaseGpu, on the render thread while the context is alive.
+        static void Discard(FStagedAsset& Asset, bool bReleaseGpu);
+
+        void CollectUnused();
+
+    private:
+        FJobSystem& JobSystem;
+        // Load jobs still reading or decoding; waited on before the manager goes away
+        FJobCounter InFlight;
+
+        std::size_t BytesPerFrame = 16 * 1024 * 1024;
+        std::chrono::duration<double, std::milli> TimePerFrame{ 2.0 };
+
+        // Worker threads push, the render thread pops
+        std::mutex StagingMutex;
+        std::deque<FStagedAsset> Staging;
+        std::atomic<std::size_t> PendingCount{ 0 };
+        std::function<void()> UploadWakeCallback;
+
+        // Every live asset by path; the manager's reference is the last one when use_count() is 1
+        std::mutex AssetsMutex;
+        std::unordered_map<std::string, Ref<Detail::TAssetSlot<Texture2D>>> Textures;
+        std::unordered_map<std::string, Ref<Detail::TAssetSlot<Model>>> Models;
+        int FramesSinceCollect = 0;
+    };
+
+}
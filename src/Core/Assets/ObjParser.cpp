@@ -0,0 +1,385 @@
+#include "ObjParser.h"
+#include "Core/Logging/Log.h"
+#include "Core/Profiling/Profiler.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <type_traits>
+#include <unordered_map>
+
+namespace Core
+{
+
+    namespace
+    {
+        // Calls Func(Line) for every line of Text, without the line ending
+        template<typename F>
+        void ForEachLine(std::string_view Text, F&& Func)
+        {
+            while (!Text.empty())
+            {
+                const std::size_t End = Text.find('\n');
+                std::string_view Line = Text.substr(0, End);
+                if (!Line.empty() && Line.back() == '\r')
+                    Line.remove_suffix(1);
+
+                Func(Line);
+
+                if (End == std::string_view::npos)
+                    break;
+                Text.remove_prefix(End + 1);
+            }
+        }
+
+        void SkipSpaces(std::string_view& Text)
+        {
+            while (!Text.empty() && (Text.front() == ' ' || Text.front() == '\t'))
+                Text.remove_prefix(1);
+        }
+
+        std::string_view NextToken(std::string_view& Text)
+        {
+            SkipSpaces(Text);
+            std::size_t End = 0;
+            while (End < Text.size() && Text[End] != ' ' && Text[End] != '\t')
+                End++;
+
+            const std::string_view Token = Text.substr(0, End);
+            Text.remove_prefix(End);
+            return Token;
+        }
+
+        template<typename T>
+        bool ParseNumber(std::string_view& Text, T& Out)
+        {
+            SkipSpaces(Text);
+
+            #if !defined(__cpp_lib_to_chars)
+                // Floating-point from_chars is missing from Apple's libc++ and older Emscripten;
+                // strtof needs a terminated copy of the token
+                if constexpr (std::is_same_v<T, float>)
+                {
+                    char Token[64];
+                    std::size_t Length = 0;
+                    while (Length < Text.size() && Length < sizeof(Token) - 1 && Text[Length] != ' ' && Text[Length] != '\t')
+                    {
+                        Token[Length] = Text[Length];
+                        Length++;
+                    }
+                    Token[Length] = '\0';
+
+                    char* End = nullptr;
+                    const float Value = std::strtof(Token, &End);
+                    if (End == Token)
+                        return false;
+
+                    Out = Value;
+                    Text.remove_prefix(static_cast<std::size_t>(End - Token));
+                    return true;
+                }
+                else
+            #endif
+            {
+                const auto [End, Error] = std::from_chars(Text.data(), Text.data() + Text.size(), Out);
+                if (Error != std::errc())
+                    return false;
+
+                Text.remove_prefix(static_cast<std::size_t>(End - Text.data()));
+                return true;
+            }
+        }
+
+        // OBJ indices are 1-based, negative ones count back from the last element read so far
+        int ResolveIndex(int Index, std::size_t Count)
+        {
+            const long long Resolved = Index > 0 ? Index - 1LL : static_cast<long long>(Count) + Index;
+            return Resolved >= 0 && Resolved < static_cast<long long>(Count) ? static_cast<int>(Resolved) : -1;
+        }
+
+        std::string ReadTextFile(const std::string& Path)
+        {
+            std::ifstream File(Path, std::ios::binary);
+            return File ? std::string(std::istreambuf_iterator<char>(File), std::istreambuf_iterator<char>()) : std::string();
+        }
+
+        std::string DirectoryOf(const std::string& Path)
+        {
+            const std::size_t Slash = Path.find_last_of("/\\");
+            return Slash == std::string::npos ? std::string() : Path.substr(0, Slash + 1);
+        }
+
+        Image DecodeImage(const std::string& Path)
+        {
+            const std::string Data = ReadTextFile(Path);
+            if (Data.empty())
+                return Image{};
+
+            const std::size_t Dot = Path.find_last_of('.');
+            const std::string Extension = Dot == std::string::npos ? std::string() : Path.substr(Dot);
+            return LoadImageFromMemory(Extension.c_str(), reinterpret_cast<const unsigned char*>(Data.data()), static_cast<int>(Data.size()));
+        }
+
+        struct FMtlEntry
+        {
+            Color Diffuse = WHITE;
+            std::string DiffuseMap;
+        };
+
+        void ParseMtl(const std::string& Path, std::unordered_map<std::string, FMtlEntry>& Out)
+        {
+            const std::string Text = ReadTextFile(Path);
+            if (Text.empty())
+            {
+                FLog::CoreWarn("Material library '{}' is missing or empty", Path);
+                return;
+            }
+
+            FMtlEntry* Current = nullptr;
+            ForEachLine(Text, [&](std::string_view Line)
+            {
+                const std::string_view Keyword = NextToken(Line);
+                if (Keyword == "newmtl")
+                {
+                    SkipSpaces(Line);
+                    Current = &Out[std::string(Line)];
+                }
+                else if (Current && Keyword == "Kd")
+                {
+                    float Rgb[3] = { 1.0f, 1.0f, 1.0f };
+                    for (float& Channel : Rgb)
+                        ParseNumber(Line, Channel);
+                    Current->Diffuse = Color
+                    {
+                        static_cast<unsigned char>(std::clamp(Rgb[0], 0.0f, 1.0f) * 255.0f),
+                        static_cast<unsigned char>(std::clamp(Rgb[1], 0.0f, 1.0f) * 255.0f),
+                        static_cast<unsigned char>(std::clamp(Rgb[2], 0.0f, 1.0f) * 255.0f),
+                        255
+                    };
+                }
+                else if (Current && Keyword == "map_Kd")
+                {
+                    // Options come first; the file name is the last token
+                    std::string_view File;
+                    for (std::string_view Token = NextToken(Line); !Token.empty(); Token = NextToken(Line))
+                        File = Token;
+                    Current->DiffuseMap = std::string(File);
+                }
+            });
+        }
+
+        // Triangle corners of one material, expanded rather than indexed like raylib's meshes
+        struct FGroup
+        {
+            std::string Material;
+            std::vector<float> Positions;
+            std::vector<float> Texcoords;
+            std::vector<float> Normals;
+            bool bHasTexcoords = false;
+            bool bHasNormals = false;
+        };
+
+        struct FCorner
+        {
+            int Position = -1;
+            int Texcoord = -1;
+            int Normal = -1;
+        };
+
+        // "v", "v/vt", "v//vn" or "v/vt/vn"
+        bool ParseCorner(std::string_view Token, std::size_t PositionCount, std::size_t TexcoordCount, std::size_t NormalCount, FCorner& Out)
+        {
+            int Index = 0;
+            if (!ParseNumber(Token, Index) || (Out.Position = ResolveIndex(Index, PositionCount)) < 0)
+                return false;
+
+            Out.Texcoord = -1;
+            Out.Normal = -1;
+            if (Token.empty() || Token.front() != '/')
+                return true;
+            Token.remove_prefix(1);
+
+            if (!Token.empty() && Token.front() != '/')
+            {
+                if (!ParseNumber(Token, Index) || (Out.Texcoord = ResolveIndex(Index, TexcoordCount)) < 0)
+                    return false;
+            }
+
+            if (Token.empty() || Token.front() != '/')
+                return true;
+            Token.remove_prefix(1);
+
+            return ParseNumber(Token, Index) && (Out.Normal = ResolveIndex(Index, NormalCount)) >= 0;
+        }
+
+        template<typename T>
+        T* CopyToRaylib(const std::vector<T>& Values)
+        {
+            T* Copy = static_cast<T*>(MemAlloc(static_cast<unsigned int>(Values.size() * sizeof(T))));
+            std::memcpy(Copy, Values.data(), Values.size() * sizeof(T));
+            return Copy;
+        }
+    }
+
+    void FParsedModel::Release()
+    {
+        for (Mesh& Target : Meshes)
+        {
+            MemFree(Target.vertices);
+            MemFree(Target.texcoords);
+            MemFree(Target.normals);
+            MemFree(Target.vboId);
+        }
+        for (FParsedMaterial& Material : Materials)
+        {
+            UnloadImage(Material.DiffuseMap);
+        }
+
+        Meshes.clear();
+        MeshMaterials.clear();
+        Materials.clear();
+    }
+
+    bool ParseObj(const std::string& Path, std::string_view Text, FParsedModel& Out)
+    {
+        CORE_PROFILE_FUNCTION();
+
+        std::vector<float> Positions;
+        std::vector<float> Texcoords;
+        std::vector<float> Normals;
+
+        std::vector<FGroup> Groups;
+        std::unordered_map<std::string, std::size_t> GroupByMaterial;
+        std::size_t CurrentGroup = 0;
+        const auto SelectGroup = [&](std::string_view Material)
+        {
+            const auto [It, bInserted] = GroupByMaterial.try_emplace(std::string(Material), Groups.size());
+            if (bInserted)
+                Groups.emplace_back().Material = It->first;
+            CurrentGroup = It->second;
+        };
+        SelectGroup("");
+
+        std::unordered_map<std::string, FMtlEntry> Library;
+        const std::string Directory = DirectoryOf(Path);
+
+        std::vector<FCorner> Face;
+        std::size_t SkippedFaces = 0;
+        ForEachLine(Text, [&](std::string_view Line)
+        {
+            const std::string_view Keyword = NextToken(Line);
+            if (Keyword == "v")
+            {
+                float Xyz[3] = { 0.0f, 0.0f, 0.0f };
+                for (float& Value : Xyz)
+                    ParseNumber(Line, Value);
+                Positions.insert(Positions.end(), std::begin(Xyz), std::end(Xyz));
+            }
+            else if (Keyword == "vt")
+            {
+                float Uv[2] = { 0.0f, 0.0f };
+                for (float& Value : Uv)
+                    ParseNumber(Line, Value);
+                Texcoords.push_back(Uv[0]);
+                Texcoords.push_back(1.0f - Uv[1]);
+            }
+            else if (Keyword == "vn")
+            {
+                float Xyz[3] = { 0.0f, 0.0f, 0.0f };
+                for (float& Value : Xyz)
+                    ParseNumber(Line, Value);
+                Normals.insert(Normals.end(), std::begin(Xyz), std::end(Xyz));
+            }
+            else if (Keyword == "f")
+            {
+                Face.clear();
+                FCorner Corner;
+                for (std::string_view Token = NextToken(Line); !Token.empty(); Token = NextToken(Line))
+                {
+                    if (!ParseCorner(Token, Positions.size() / 3, Texcoords.size() / 2, Normals.size() / 3, Corner))
+                    {
+                        Face.clear();
+                        break;
+                    }
+                    Face.push_back(Corner);
+                }
+                if (Face.size() < 3)
+                {
+                    SkippedFaces++;
+                    return;
+                }
+
+                FGroup& Group = Groups[CurrentGroup];
+                for (std::size_t i = 1; i + 1 < Face.size(); i++)
+                {
+                    for (const FCorner& Vertex : { Face[0], Face[i], Face[i + 1] })
+                    {
+                        Group.Positions.insert(Group.Positions.end(), &Positions[Vertex.Position * 3], &Positions[Vertex.Position * 3] + 3);
+
+                        Group.bHasTexcoords |= Vertex.Texcoord >= 0;
+                        const float NoTexcoord[2] = { 0.0f, 0.0f };
+                        const float* Uv = Vertex.Texcoord >= 0 ? &Texcoords[Vertex.Texcoord * 2] : NoTexcoord;
+                        Group.Texcoords.insert(Group.Texcoords.end(), Uv, Uv + 2);
+
+                        Group.bHasNormals |= Vertex.Normal >= 0;
+                        const float NoNormal[3] = { 0.0f, 0.0f, 1.0f };
+                        const float* Normal = Vertex.Normal >= 0 ? &Normals[Vertex.Normal * 3] : NoNormal;
+                        Group.Normals.insert(Group.Normals.end(), Normal, Normal + 3);
+                    }
+                }
+            }
+            else if (Keyword == "usemtl")
+            {
+                SkipSpaces(Line);
+                SelectGroup(Line);
+            }
+            else if (Keyword == "mtllib")
+            {
+                for (std::string_view File = NextToken(Line); !File.empty(); File = NextToken(Line))
+                    ParseMtl(Directory + std::string(File), Library);
+            }
+        });
+
+        if (SkippedFaces > 0)
+        {
+            FLog::CoreWarn("Skipped {} malformed faces in '{}'", SkippedFaces, Path);
+        }
+
+        for (FGroup& Group : Groups)
+        {
+            if (Group.Positions.empty())
+                continue;
+
+            Mesh Target{};
+            Target.vertexCount = static_cast<int>(Group.Positions.size() / 3);
+            Target.triangleCount = Target.vertexCount / 3;
+            Target.vertices = CopyToRaylib(Group.Positions);
+            Target.texcoords = Group.bHasTexcoords ? CopyToRaylib(Group.Texcoords) : nullptr;
+            Target.normals = Group.bHasNormals ? CopyToRaylib(Group.Normals) : nullptr;
+            Out.Meshes.push_back(Target);
+
+            FParsedMaterial Material;
+            if (const auto It = Library.find(Group.Material); It != Library.end())
+            {
+                Material.Diffuse = It->second.Diffuse;
+                if (!It->second.DiffuseMap.empty())
+                {
+                    Material.DiffuseMap = DecodeImage(Directory + It->second.DiffuseMap);
+                    if (!Material.DiffuseMap.data)
+                        FLog::CoreWarn("Failed to load texture '{}' for '{}'", It->second.DiffuseMap, Path);
+                }
+            }
+            Out.MeshMaterials.push_back(static_cast<int>(Out.Materials.size()));
+            Out.Materials.push_back(Material);
+
+            // The expanded corners can be large; give them back as soon as they are copied
+            Group = FGroup{};
+        }
+
+        return !Out.Meshes.empty();
+    }
+
+}
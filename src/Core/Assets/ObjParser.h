@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "raylib.h"
+
+namespace Core
+{
+
+    struct FParsedMaterial
+    {
+        Color Diffuse = WHITE;
+        // Decoded diffuse map, empty without one
+        Image DiffuseMap{};
+    };
+
+    // The CPU side of a model: raylib meshes whose arrays are filled but not uploaded, and the
+    // materials to create on the render thread. Arrays are MemAlloc'd, so once uploaded the meshes
+    // can be handed to a raylib Model and freed by UnloadModel.
+    struct FParsedModel
+    {
+        std::vector<Mesh> Meshes;
+        // Index into Materials for each mesh
+        std::vector<int> MeshMaterials;
+        std::vector<FParsedMaterial> Materials;
+
+        // Frees the CPU arrays and images still owned here. GPU buffers are left alone.
+        void Release();
+    };
+
+    // Parses Wavefront OBJ text into one mesh per material, with faces fanned into triangles and
+    // texture V flipped the way raylib's own loader does. The .mtl libraries it names are read
+    // for diffuse colors and maps, and the maps decoded. Any thread: no GL calls.
+    [[nodiscard]] bool ParseObj(const std::string& Path, std::string_view Text, FParsedModel& Out);
+
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 // Platform detection
@@ -64,6 +65,9 @@
 
 namespace Core
 {
+    // Used to keep data written by different threads on separate cache lines
+    inline constexpr std::size_t CacheLineSize = 64;
+
     template<typename T>
     using Scope = std::unique_ptr<T>;
     template<typename T, typename ... Args>
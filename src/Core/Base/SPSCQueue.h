@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace Core
+{
+
+    // Bounded single-producer / single-consumer ring buffer.
+    // Push must only be called from one thread and Pop from one other thread.
+    // Neither side locks or allocates; a full queue rejects the push.
+    template<typename T, std::size_t Capacity>
+    class TSPSCQueue
+    {
+        static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    public:
+        [[nodiscard]] bool Push(const T& InItem)
+        {
+            const std::size_t Head = HeadIndex.load(std::memory_order_relaxed);
+            if (Head - CachedTail == Capacity)
+            {
+                CachedTail = TailIndex.load(std::memory_order_acquire);
+                if (Head - CachedTail == Capacity)
+                    return false;
+            }
+
+            Items[Head & Mask] = InItem;
+            HeadIndex.store(Head + 1, std::memory_order_release);
+            return true;
+        }
+
+        [[nodiscard]] bool Pop(T& OutItem)
+        {
+            const std::size_t Tail = TailIndex.load(std::memory_order_relaxed);
+            if (Tail == CachedHead)
+            {
+                CachedHead = HeadIndex.load(std::memory_order_acquire);
+                if (Tail == CachedHead)
+                    return false;
+            }
+
+            OutItem = Items[Tail & Mask];
+            TailIndex.store(Tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Approximate when called from a third thread; exact from either endpoint
+        [[nodiscard]] std::size_t Size() const
+        {
+            return HeadIndex.load(std::memory_order_acquire) - TailIndex.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] bool IsEmpty() const { return Size() == 0; }
+        [[nodiscard]] static constexpr std::size_t GetCapacity() { return Capacity; }
+
+    private:
+        static constexpr std::size_t Mask = Capacity - 1;
+
+        // Producer side
+        alignas(CacheLineSize) std::atomic<std::size_t> HeadIndex{ 0 };
+        std::size_t CachedTail = 0;
+
+        // Consumer side
+        alignas(CacheLineSize) std::atomic<std::size_t> TailIndex{ 0 };
+        std::size_t CachedHead = 0;
+
+        alignas(CacheLineSize) std::array<T, Capacity> Items{};
+    };
+
+}
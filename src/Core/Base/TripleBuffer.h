@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace Core
+{
+
+    // Lock-free hand-off of a value from one writer thread to one reader thread.
+    // The writer never waits for the reader and the reader always sees the latest complete value.
+    template<typename T>
+    class TTripleBuffer
+    {
+    public:
+        // --- Writer ---
+        [[nodiscard]] T& GetWriteBuffer() { return Buffers[WriteIndex]; }
+
+        void Publish()
+        {
+            const std::uint8_t Previous = Shared.exchange(WriteIndex | DirtyBit, std::memory_order_acq_rel);
+            WriteIndex = Previous & IndexMask;
+        }
+
+        void Publish(const T& InValue)
+        {
+            GetWriteBuffer() = InValue;
+            Publish();
+        }
+
+        // --- Reader ---
+        // Returns true when a newer value was published since the previous latch
+        bool Latch()
+        {
+            if ((Shared.load(std::memory_order_relaxed) & DirtyBit) == 0)
+                return false;
+
+            const std::uint8_t Previous = Shared.exchange(ReadIndex, std::memory_order_acq_rel);
+            ReadIndex = Previous & IndexMask;
+            return true;
+        }
+
+        [[nodiscard]] const T& GetReadBuffer() const { return Buffers[ReadIndex]; }
+
+    private:
+        static constexpr std::uint8_t IndexMask = 0x3;
+        static constexpr std::uint8_t DirtyBit = 0x4;
+
+        std::array<T, 3> Buffers{};
+
+        alignas(CacheLineSize) std::atomic<std::uint8_t> Shared{ 1 };
+        alignas(CacheLineSize) std::uint8_t WriteIndex = 0;
+        alignas(CacheLineSize) std::uint8_t ReadIndex = 2;
+    };
+
+}
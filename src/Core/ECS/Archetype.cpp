@@ -0,0 +1,156 @@
+#include "Archetype.h"
+#include "Core/Memory/MemoryTracker.h"
+
+#include <algorithm>
+#include <new>
+#include <utility>
+
+namespace Core
+{
+
+    namespace
+    {
+        std::size_t AlignUp(std::size_t Value, std::size_t Alignment)
+        {
+            return (Value + Alignment - 1) / Alignment * Alignment;
+        }
+    }
+
+    FArchetype::FArchetype(const FComponentMask& InMask)
+        : Mask(InMask)
+    {
+        Offsets.fill(NoColumn);
+        Mask.ForEach([this](FComponentTypeId Id) { Components.push_back(Id); });
+
+        std::size_t RowBytes = sizeof(FEntity);
+        std::size_t ColumnCount = 1;
+        for (FComponentTypeId Id : Components)
+        {
+            const FComponentTypeInfo& Info = FComponentRegistry::GetInfo(Id);
+            RowBytes += Info.Size;
+            ColumnCount += Info.Size > 0 ? 1 : 0;
+        }
+
+        // Every column may lose up to a cache line to alignment. Components too large for a
+        // chunk get chunks of one entity instead.
+        const std::size_t Usable = ChunkBytes > ColumnCount * CacheLineSize ? ChunkBytes - ColumnCount * CacheLineSize : 0;
+        ChunkCapacity = static_cast<std::uint32_t>(std::max<std::size_t>(Usable / RowBytes, 1));
+
+        std::size_t Offset = AlignUp(ChunkCapacity * sizeof(FEntity), CacheLineSize);
+        for (FComponentTypeId Id : Components)
+        {
+            const FComponentTypeInfo& Info = FComponentRegistry::GetInfo(Id);
+            if (Info.Size == 0)
+                continue;
+
+            Offset = AlignUp(Offset, std::max(Info.Alignment, CacheLineSize));
+            Offsets[Id] = static_cast<std::uint32_t>(Offset);
+            Offset += AlignUp(ChunkCapacity * Info.Size, CacheLineSize);
+        }
+        ChunkAllocationBytes = std::max(Offset, CacheLineSize);
+    }
+
+    FArchetype::~FArchetype()
+    {
+        for (FArchetypeChunk& Chunk : Chunks)
+        {
+            for (std::uint32_t Row = 0; Row < Chunk.Count; ++Row)
+            {
+                DestroyComponents({ static_cast<std::uint32_t>(&Chunk - Chunks.data()), Row });
+            }
+            FreeChunkData(Chunk.Data);
+        }
+        if (SpareChunkData)
+        {
+            FreeChunkData(SpareChunkData);
+        }
+    }
+
+    void* FArchetype::GetComponent(FEntityLocation Location, FComponentTypeId Id) const
+    {
+        void* Column = GetColumn(Chunks[Location.Chunk], Id);
+        if (!Column)
+            return nullptr;
+        return static_cast<std::byte*>(Column) + Location.Row * FComponentRegistry::GetInfo(Id).Size;
+    }
+
+    FEntityLocation FArchetype::Allocate(FEntity Entity)
+    {
+        if (Chunks.empty() || Chunks.back().Count == ChunkCapacity)
+        {
+            std::byte* Data = SpareChunkData ? std::exchange(SpareChunkData, nullptr) : AllocateChunkData();
+            Chunks.push_back({ Data, 0 });
+        }
+
+        FArchetypeChunk& Chunk = Chunks.back();
+        const FEntityLocation Location{ static_cast<std::uint32_t>(Chunks.size() - 1), Chunk.Count };
+        GetEntities(Chunk)[Chunk.Count++] = Entity;
+        ++EntityCount;
+        return Location;
+    }
+
+    FEntity FArchetype::RemoveRow(FEntityLocation Location)
+    {
+        FArchetypeChunk& LastChunk = Chunks.back();
+        const FEntityLocation Last{ static_cast<std::uint32_t>(Chunks.size() - 1), LastChunk.Count - 1 };
+
+        FEntity Moved;
+        if (Location.Chunk != Last.Chunk || Location.Row != Last.Row)
+        {
+            FArchetypeChunk& Chunk = Chunks[Location.Chunk];
+            for (FComponentTypeId Id : Components)
+            {
+                const FComponentTypeInfo& Info = FComponentRegistry::GetInfo(Id);
+                if (Info.Size == 0)
+                    continue;
+
+                std::byte* Dest = static_cast<std::byte*>(GetColumn(Chunk, Id)) + Location.Row * Info.Size;
+                std::byte* Source = static_cast<std::byte*>(GetColumn(LastChunk, Id)) + Last.Row * Info.Size;
+                Info.MoveConstruct(Dest, Source);
+                if (Info.Destroy)
+                {
+                    Info.Destroy(Source);
+                }
+            }
+
+            Moved = GetEntities(LastChunk)[Last.Row];
+            GetEntities(Chunk)[Location.Row] = Moved;
+        }
+
+        --EntityCount;
+        if (--LastChunk.Count == 0)
+        {
+            if (SpareChunkData)
+            {
+                FreeChunkData(SpareChunkData);
+            }
+            SpareChunkData = LastChunk.Data;
+            Chunks.pop_back();
+        }
+        return Moved;
+    }
+
+    void FArchetype::DestroyComponents(FEntityLocation Location)
+    {
+        for (FComponentTypeId Id : Components)
+        {
+            const FComponentTypeInfo& Info = FComponentRegistry::GetInfo(Id);
+            if (Info.Destroy)
+            {
+                Info.Destroy(GetComponent(Location, Id));
+            }
+        }
+    }
+
+    std::byte* FArchetype::AllocateChunkData()
+    {
+        CORE_MEMORY_TAG(ECS);
+        return static_cast<std::byte*>(::operator new(ChunkAllocationBytes, std::align_val_t{ CacheLineSize }));
+    }
+
+    void FArchetype::FreeChunkData(std::byte* Data)
+    {
+        ::operator delete(Data, std::align_val_t{ CacheLineSize });
+    }
+
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+#include "ComponentType.h"
+#include "Entity.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Core
+{
+
+    // A fixed-size block holding up to FArchetype::GetChunkCapacity entities. Each component has
+    // its own cache-line-aligned column (structure of arrays); the entity handles come first.
+    struct FArchetypeChunk
+    {
+        std::byte* Data = nullptr;
+        std::uint32_t Count = 0;
+    };
+
+    struct FEntityLocation
+    {
+        std::uint32_t Chunk = 0;
+        std::uint32_t Row = 0;
+    };
+
+    // Storage for every entity with exactly one set of components. Entities stay packed: all
+    // chunks but the last are full, and removal fills the hole with the last entity.
+    // Owned by FWorld; not thread-safe for structural changes.
+    class FArchetype
+    {
+    public:
+        static constexpr std::size_t ChunkBytes = 16 * 1024;
+
+        explicit FArchetype(const FComponentMask& InMask);
+        ~FArchetype();
+
+        FArchetype(const FArchetype&) = delete;
+        FArchetype& operator=(const FArchetype&) = delete;
+
+        [[nodiscard]] const FComponentMask& GetMask() const { return Mask; }
+        [[nodiscard]] const std::vector<FComponentTypeId>& GetComponents() const { return Components; }
+        [[nodiscard]] std::uint32_t GetChunkCapacity() const { return ChunkCapacity; }
+        [[nodiscard]] std::size_t GetEntityCount() const { return EntityCount; }
+
+        [[nodiscard]] std::size_t GetChunkCount() const { return Chunks.size(); }
+        [[nodiscard]] const FArchetypeChunk& GetChunk(std::size_t Index) const { return Chunks[Index]; }
+
+        [[nodiscard]] FEntity* GetEntities(const FArchetypeChunk& Chunk) const { return reinterpret_cast<FEntity*>(Chunk.Data); }
+        // Id must be one of the archetype's components; null for tags
+        [[nodiscard]] void* GetColumn(const FArchetypeChunk& Chunk, FComponentTypeId Id) const
+        {
+            return Offsets[Id] == NoColumn ? nullptr : Chunk.Data + Offsets[Id];
+        }
+        template<typename T>
+        [[nodiscard]] T* GetColumn(const FArchetypeChunk& Chunk) const
+        {
+            return static_cast<T*>(GetColumn(Chunk, FComponentRegistry::GetId<T>()));
+        }
+        [[nodiscard]] void* GetComponent(FEntityLocation Location, FComponentTypeId Id) const;
+
+        // Appends Entity with its components left uninitialized for the caller to construct
+        FEntityLocation Allocate(FEntity Entity);
+        // Fills the row at Location with the last entity, whose components are moved over, and
+        // returns that entity so its location can be updated (null if Location was the last row).
+        // The row's own components must already be destroyed or moved out.
+        FEntity RemoveRow(FEntityLocation Location);
+        // Destroys every component of the row at Location
+        void DestroyComponents(FEntityLocation Location);
+
+        // Archetypes one component away, filled in as the world walks them
+        [[nodiscard]] FArchetype* GetAddEdge(FComponentTypeId Id) const { return AddEdges[Id]; }
+        [[nodiscard]] FArchetype* GetRemoveEdge(FComponentTypeId Id) const { return RemoveEdges[Id]; }
+        void SetAddEdge(FComponentTypeId Id, FArchetype* Target) { AddEdges[Id] = Target; }
+        void SetRemoveEdge(FComponentTypeId Id, FArchetype* Target) { RemoveEdges[Id] = Target; }
+
+    private:
+        static constexpr std::uint32_t NoColumn = 0xFFFFFFFF;
+
+        [[nodiscard]] std::byte* AllocateChunkData();
+        void FreeChunkData(std::byte* Data);
+
+    private:
+        FComponentMask Mask;
+        // Ascending ids
+        std::vector<FComponentTypeId> Components;
+        // Byte offset of each component's column within a chunk
+        std::array<std::uint32_t, MaxComponentTypes> Offsets;
+        std::uint32_t ChunkCapacity = 0;
+        std::size_t ChunkAllocationBytes = 0;
+
+        std::vector<FArchetypeChunk> Chunks;
+        // Kept when the last chunk empties, so entities moving back and forth across a chunk
+        // boundary don't allocate every time
+        std::byte* SpareChunkData = nullptr;
+        std::size_t EntityCount = 0;
+
+        std::array<FArchetype*, MaxComponentTypes> AddEdges{};
+        std::array<FArchetype*, MaxComponentTypes> RemoveEdges{};
+    };
+
+}
@@ -0,0 +1,129 @@
+#include "CommandBuffer.h"
+#include "World.h"
+#include "Core/Memory/MemoryTracker.h"
+
+#include <algorithm>
+
+namespace Core
+{
+
+    FCommandBuffer::~FCommandBuffer()
+    {
+        Clear();
+        for (FPayloadBlock& Block : Blocks)
+        {
+            ::operator delete(Block.Data, std::align_val_t{ CacheLineSize });
+        }
+    }
+
+    FEntity FCommandBuffer::CreateEntity()
+    {
+        const FEntity Entity{ PendingCount++, PendingGeneration };
+        Commands.push_back({ ECommand::Create, 0, Entity });
+        return Entity;
+    }
+
+    void FCommandBuffer::DestroyEntity(FEntity Entity)
+    {
+        Commands.push_back({ ECommand::Destroy, 0, Entity });
+    }
+
+    void FCommandBuffer::Playback(FWorld& World)
+    {
+        Created.resize(PendingCount);
+
+        for (FCommand& Command : Commands)
+        {
+            switch (Command.Type)
+            {
+                case ECommand::Create:
+                    Created[Command.Entity.Index] = World.CreateEntity();
+                    break;
+
+                case ECommand::Destroy:
+                    World.DestroyEntity(Resolve(Command.Entity));
+                    break;
+
+                case ECommand::Add:
+                {
+                    bool bExisted = false;
+                    void* Storage = World.AddComponentUninitialized(Resolve(Command.Entity), Command.Component, bExisted);
+                    if (Storage && Command.Payload)
+                    {
+                        const FComponentTypeInfo& Info = FComponentRegistry::GetInfo(Command.Component);
+                        if (bExisted && Info.Destroy)
+                        {
+                            Info.Destroy(Storage);
+                        }
+                        Info.MoveConstruct(Storage, Command.Payload);
+                    }
+                    break;
+                }
+
+                case ECommand::Remove:
+                    World.RemoveComponent(Resolve(Command.Entity), Command.Component);
+                    break;
+            }
+        }
+
+        Clear();
+    }
+
+    void* FCommandBuffer::AllocatePayload(std::size_t Size, std::size_t Alignment)
+    {
+        if (CurrentBlock < Blocks.size())
+        {
+            const std::size_t Offset = (CurrentOffset + Alignment - 1) / Alignment * Alignment;
+            if (Offset + Size <= Blocks[CurrentBlock].Size)
+            {
+                CurrentOffset = Offset + Size;
+                return Blocks[CurrentBlock].Data + Offset;
+            }
+
+            // Blocks kept from earlier frames start cache-line aligned, so any that is large
+            // enough fits
+            while (++CurrentBlock < Blocks.size())
+            {
+                if (Blocks[CurrentBlock].Size >= Size)
+                {
+                    CurrentOffset = Size;
+                    return Blocks[CurrentBlock].Data;
+                }
+            }
+        }
+
+        CORE_MEMORY_TAG(ECS);
+        const std::size_t BlockSize = std::max(PayloadBlockBytes, Size);
+        Blocks.push_back({ static_cast<std::byte*>(::operator new(BlockSize, std::align_val_t{ CacheLineSize })), BlockSize });
+        CurrentBlock = Blocks.size() - 1;
+        CurrentOffset = Size;
+        return Blocks.back().Data;
+    }
+
+    FEntity FCommandBuffer::Resolve(FEntity Entity) const
+    {
+        return Entity.Generation == PendingGeneration ? Created[Entity.Index] : Entity;
+    }
+
+    void FCommandBuffer::Clear()
+    {
+        // Payloads not moved into the world still need their destructors; moved-from ones too
+        for (const FCommand& Command : Commands)
+        {
+            if (Command.Type == ECommand::Add && Command.Payload)
+            {
+                const FComponentTypeInfo& Info = FComponentRegistry::GetInfo(Command.Component);
+                if (Info.Destroy)
+                {
+                    Info.Destroy(Command.Payload);
+                }
+            }
+        }
+
+        Commands.clear();
+        CurrentBlock = 0;
+        CurrentOffset = 0;
+        PendingCount = 0;
+    }
+
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+#include "ComponentType.h"
+#include "Entity.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Core
+{
+
+    class FWorld;
+
+    // Structural changes recorded while the world is being iterated, applied in order by Playback.
+    // Entities created here can be used by later commands in the same buffer; they become real
+    // entities on playback. Commands on entities that are dead by then are dropped.
+    // One buffer per thread: recording is not synchronized.
+    class FCommandBuffer
+    {
+    public:
+        FCommandBuffer() = default;
+        ~FCommandBuffer();
+
+        FCommandBuffer(const FCommandBuffer&) = delete;
+        FCommandBuffer& operator=(const FCommandBuffer&) = delete;
+
+        FEntity CreateEntity();
+        void DestroyEntity(FEntity Entity);
+        template<typename T, typename... Args>
+        void AddComponent(FEntity Entity, Args&&... Arguments);
+        template<typename T>
+        void RemoveComponent(FEntity Entity);
+
+        // Applies the commands and clears the buffer, keeping its storage
+        void Playback(FWorld& World);
+        [[nodiscard]] bool IsEmpty() const { return Commands.empty(); }
+
+    private:
+        enum class ECommand : std::uint8_t
+        {
+            Create,
+            Destroy,
+            Add,
+            Remove
+        };
+
+        struct FCommand
+        {
+            ECommand Type;
+            FComponentTypeId Component = 0;
+            FEntity Entity;
+            void* Payload = nullptr;
+        };
+
+        // Component values live in blocks that never move, since not every component can be
+        // relocated with memcpy
+        struct FPayloadBlock
+        {
+            std::byte* Data = nullptr;
+            std::size_t Size = 0;
+        };
+
+        static constexpr std::size_t PayloadBlockBytes = 4 * 1024;
+        // Created entities carry this generation and their index into Created until playback
+        static constexpr std::uint32_t PendingGeneration = 0xFFFFFFFF;
+
+        [[nodiscard]] void* AllocatePayload(std::size_t Size, std::size_t Alignment);
+        [[nodiscard]] FEntity Resolve(FEntity Entity) const;
+        void Clear();
+
+    private:
+        std::vector<FCommand> Commands;
+        std::vector<FPayloadBlock> Blocks;
+        std::size_t CurrentBlock = 0;
+        std::size_t CurrentOffset = 0;
+
+        std::uint32_t PendingCount = 0;
+        // Playback only: the real entity for each pending one
+        std::vector<FEntity> Created;
+    };
+
+    template<typename T, typename... Args>
+    void FCommandBuffer::AddComponent(FEntity Entity, Args&&... Arguments)
+    {
+        FCommand Command{ ECommand::Add, FComponentRegistry::GetId<T>(), Entity };
+        if constexpr (!std::is_empty_v<T>)
+        {
+            static_assert(alignof(T) <= CacheLineSize, "Over-aligned components can't be recorded");
+            Command.Payload = ::new (AllocatePayload(sizeof(T), alignof(T))) T(std::forward<Args>(Arguments)...);
+        }
+        Commands.push_back(Command);
+    }
+
+    template<typename T>
+    void FCommandBuffer::RemoveComponent(FEntity Entity)
+    {
+        Commands.push_back({ ECommand::Remove, FComponentRegistry::GetId<T>(), Entity });
+    }
+
+}
@@ -0,0 +1,46 @@
+#include "ComponentType.h"
+#include "Core/Logging/Log.h"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+
+namespace Core
+{
+
+    namespace
+    {
+        std::array<FComponentTypeInfo, MaxComponentTypes> s_Infos{};
+        std::atomic<std::size_t> s_Count{ 0 };
+        std::mutex s_RegisterMutex;
+    }
+
+    const FComponentTypeInfo& FComponentRegistry::GetInfo(FComponentTypeId Id)
+    {
+        return s_Infos[Id];
+    }
+
+    std::size_t FComponentRegistry::GetCount()
+    {
+        return s_Count.load(std::memory_order_acquire);
+    }
+
+    FComponentTypeId FComponentRegistry::Register(const FComponentTypeInfo& Info)
+    {
+        std::lock_guard<std::mutex> Lock(s_RegisterMutex);
+
+        const std::size_t Id = s_Count.load(std::memory_order_relaxed);
+        if (Id >= MaxComponentTypes)
+        {
+            // Masks are a single 64-bit word; running out is a build-time design problem
+            FLog::CoreError("More than {} ECS component types registered", MaxComponentTypes);
+            std::abort();
+        }
+
+        s_Infos[Id] = Info;
+        s_Count.store(Id + 1, std::memory_order_release);
+        return static_cast<FComponentTypeId>(Id);
+    }
+
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Core
+{
+
+    using FComponentTypeId = std::uint8_t;
+    inline constexpr std::size_t MaxComponentTypes = 64;
+
+    // A set of component types, one bit per FComponentTypeId
+    class FComponentMask
+    {
+    public:
+        constexpr void Set(FComponentTypeId Id) { Bits |= std::uint64_t(1) << Id; }
+        constexpr void Clear(FComponentTypeId Id) { Bits &= ~(std::uint64_t(1) << Id); }
+
+        [[nodiscard]] constexpr bool Test(FComponentTypeId Id) const { return (Bits >> Id) & 1; }
+        [[nodiscard]] constexpr bool Contains(const FComponentMask& Other) const { return (Bits & Other.Bits) == Other.Bits; }
+        [[nodiscard]] constexpr bool Overlaps(const FComponentMask& Other) const { return (Bits & Other.Bits) != 0; }
+        [[nodiscard]] constexpr bool IsEmpty() const { return Bits == 0; }
+        [[nodiscard]] constexpr int Count() const { return std::popcount(Bits); }
+        [[nodiscard]] constexpr std::uint64_t GetBits() const { return Bits; }
+
+        [[nodiscard]] constexpr FComponentMask operator|(const FComponentMask& Other) const
+        {
+            FComponentMask Result;
+            Result.Bits = Bits | Other.Bits;
+            return Result;
+        }
+
+        friend constexpr bool operator==(const FComponentMask&, const FComponentMask&) = default;
+
+        // Calls Func(Id) for every id in the set, lowest first
+        template<typename F>
+        void ForEach(F&& Func) const
+        {
+            for (std::uint64_t Remaining = Bits; Remaining != 0; Remaining &= Remaining - 1)
+            {
+                Func(static_cast<FComponentTypeId>(std::countr_zero(Remaining)));
+            }
+        }
+
+    private:
+        std::uint64_t Bits = 0;
+    };
+
+    // How the world stores and relocates a component type without knowing it
+    struct FComponentTypeInfo
+    {
+        // Zero for empty types, which are tags: they filter queries but take no storage
+        std::size_t Size = 0;
+        std::size_t Alignment = 1;
+        // Moves Source into uninitialized Dest; Source still has to be destroyed
+        void (*MoveConstruct)(void* Dest, void* Source) = nullptr;
+        // Null for trivially destructible types
+        void (*Destroy)(void* Ptr) = nullptr;
+    };
+
+    // Hands out ids to component types on first use. Any movable type can be a component; there
+    // is room for MaxComponentTypes of them per process.
+    class FComponentRegistry
+    {
+    public:
+        template<typename T>
+        [[nodiscard]] static FComponentTypeId GetId();
+
+        [[nodiscard]] static const FComponentTypeInfo& GetInfo(FComponentTypeId Id);
+        [[nodiscard]] static std::size_t GetCount();
+
+    private:
+        template<typename T>
+        static FComponentTypeInfo MakeInfo();
+
+        static FComponentTypeId Register(const FComponentTypeInfo& Info);
+    };
+
+    template<typename... Ts>
+    [[nodiscard]] FComponentMask MakeComponentMask()
+    {
+        FComponentMask Mask;
+        (Mask.Set(FComponentRegistry::GetId<Ts>()), ...);
+        return Mask;
+    }
+
+    template<typename T>
+    FComponentTypeId FComponentRegistry::GetId()
+    {
+        if constexpr (!std::is_same_v<T, std::remove_cvref_t<T>>)
+        {
+            // const T and T must share one id
+            return GetId<std::remove_cvref_t<T>>();
+        }
+        else
+        {
+            // Ids are registered once, however many translation units ask
+            static const FComponentTypeId Id = Register(MakeInfo<T>());
+            return Id;
+        }
+    }
+
+    template<typename T>
+    FComponentTypeInfo FComponentRegistry::MakeInfo()
+    {
+        static_assert(std::is_move_constructible_v<T>, "Components must be move constructible");
+
+        FComponentTypeInfo Info;
+        if constexpr (!std::is_empty_v<T>)
+        {
+            Info.Size = sizeof(T);
+            Info.Alignment = alignof(T);
+
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                Info.MoveConstruct = [](void* Dest, void* Source) { std::memcpy(Dest, Source, sizeof(T)); };
+            }
+            else
+            {
+                Info.MoveConstruct = [](void* Dest, void* Source) { ::new (Dest) T(std::move(*static_cast<T*>(Source))); };
+            }
+
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                Info.Destroy = [](void* Ptr) { static_cast<T*>(Ptr)->~T(); };
+            }
+        }
+        return Info;
+    }
+
+}
@@ -0,0 +1,19 @@
+#include "ECSLayer.h"
+#include "Core/Memory/MemoryTracker.h"
+
+namespace Core
+{
+
+    FECSLayer::FECSLayer(FJobSystem& InJobSystem, const std::string& InName)
+        : FLayer(InName),
+          JobSystem(InJobSystem)
+    {
+    }
+
+    void FECSLayer::OnUpdate(float DeltaTime)
+    {
+        CORE_MEMORY_TAG(ECS);
+        Scheduler.Run(World, JobSystem, DeltaTime);
+    }
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Core/Layers/Layer.h"
+#include "System.h"
+#include "World.h"
+
+#include <string>
+#include <utility>
+
+namespace Core
+{
+
+    class FJobSystem;
+
+    // Drives an FWorld from the layer stack: every OnUpdate runs the scheduled systems with the
+    // frame's delta time, ahead of the layers above it and of the application's own OnUpdate.
+    class FECSLayer : public FLayer
+    {
+    public:
+        explicit FECSLayer(FJobSystem& InJobSystem, const std::string& InName = "ECS");
+
+        void OnUpdate(float DeltaTime) override;
+        // No UI of its own
+        [[nodiscard]] bool SupportsPipelinedUI() const override { return true; }
+
+        [[nodiscard]] FWorld& GetWorld() { return World; }
+        [[nodiscard]] FSystemScheduler& GetScheduler() { return Scheduler; }
+
+        template<typename T, typename... Args>
+        T& AddSystem(Args&&... Arguments)
+        {
+            return Scheduler.AddSystem<T>(std::forward<Args>(Arguments)...);
+        }
+
+    private:
+        FJobSystem& JobSystem;
+        FWorld World;
+        FSystemScheduler Scheduler;
+    };
+
+}
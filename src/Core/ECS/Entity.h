@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace Core
+{
+
+    // Handle to an entity in an FWorld. The generation changes whenever an index is reused, so
+    // handles to destroyed entities stay detectably stale. Default constructed handles are null.
+    struct FEntity
+    {
+        std::uint32_t Index = 0;
+        std::uint32_t Generation = 0;
+
+        [[nodiscard]] constexpr bool IsNull() const { return Generation == 0; }
+
+        friend constexpr bool operator==(const FEntity&, const FEntity&) = default;
+    };
+
+}
+
+template<>
+struct std::hash<Core::FEntity>
+{
+    std::size_t operator()(const Core::FEntity& Entity) const noexcept
+    {
+        return std::hash<std::uint64_t>{}((static_cast<std::uint64_t>(Entity.Generation) << 32) | Entity.Index);
+    }
+};
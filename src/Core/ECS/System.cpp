@@ -0,0 +1,76 @@
+#include "System.h"
+#include "World.h"
+#include "Core/Jobs/JobSystem.h"
+#include "Core/Profiling/Profiler.h"
+
+#include <algorithm>
+
+namespace Core
+{
+
+    bool FSystem::ConflictsWith(const FSystem& Other) const
+    {
+        if (bExclusive || Other.bExclusive)
+            return true;
+
+        return WriteMask.Overlaps(Other.ReadMask | Other.WriteMask) || Other.WriteMask.Overlaps(ReadMask);
+    }
+
+    void FSystemScheduler::Add(Scope<FSystem> System)
+    {
+        std::size_t Stage = 0;
+        for (const FScheduledSystem& Earlier : Systems)
+        {
+            if (System->ConflictsWith(*Earlier.System))
+            {
+                Stage = std::max(Stage, Earlier.Stage + 1);
+            }
+        }
+
+        if (Stages.size() <= Stage)
+        {
+            Stages.resize(Stage + 1);
+        }
+        Stages[Stage].push_back(Systems.size());
+        Systems.push_back({ std::move(System), CreateScope<FCommandBuffer>(), Stage });
+    }
+
+    void FSystemScheduler::Run(FWorld& World, FJobSystem& JobSystem, float DeltaTime)
+    {
+        CORE_PROFILE_SCOPE("ECS Systems");
+
+        for (const std::vector<std::size_t>& Stage : Stages)
+        {
+            // The calling thread runs the last system itself instead of idling in Wait
+            FJobCounter Counter;
+            for (std::size_t i = 0; i + 1 < Stage.size(); ++i)
+            {
+                FScheduledSystem& Scheduled = Systems[Stage[i]];
+                JobSystem.Submit([this, &Scheduled, &World, &JobSystem, DeltaTime]()
+                {
+                    RunSystem(Scheduled, World, JobSystem, DeltaTime);
+                }, &Counter);
+            }
+            RunSystem(Systems[Stage.back()], World, JobSystem, DeltaTime);
+            JobSystem.Wait(Counter);
+
+            for (std::size_t Index : Stage)
+            {
+                FCommandBuffer& Commands = *Systems[Index].Commands;
+                if (!Commands.IsEmpty())
+                {
+                    Commands.Playback(World);
+                }
+            }
+        }
+    }
+
+    void FSystemScheduler::RunSystem(FScheduledSystem& Scheduled, FWorld& World, FJobSystem& JobSystem, float DeltaTime)
+    {
+        CORE_PROFILE_SCOPE(Scheduled.System->GetName().c_str());
+
+        FSystemContext Context{ World, *Scheduled.Commands, JobSystem, DeltaTime };
+        Scheduled.System->OnUpdate(Context);
+    }
+
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+#include "CommandBuffer.h"
+#include "ComponentType.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Core
+{
+
+    class FJobSystem;
+    class FWorld;
+
+    struct FSystemContext
+    {
+        FWorld& World;
+        // Structural changes go here; they are applied once the system's stage has finished
+        FCommandBuffer& Commands;
+        FJobSystem& JobSystem;
+        float DeltaTime;
+    };
+
+    // A unit of per-frame work on an FWorld. The constructor declares which component types the
+    // system reads and which it writes; the scheduler runs systems whose sets don't conflict at
+    // the same time. A system that touches anything it hasn't declared must call RequireExclusive.
+    class FSystem
+    {
+    public:
+        explicit FSystem(std::string InName)
+            : Name(std::move(InName))
+        {
+        }
+        virtual ~FSystem() = default;
+
+        virtual void OnUpdate(FSystemContext& Context) = 0;
+
+        [[nodiscard]] const std::string& GetName() const { return Name; }
+        [[nodiscard]] const FComponentMask& GetReads() const { return ReadMask; }
+        [[nodiscard]] const FComponentMask& GetWrites() const { return WriteMask; }
+        [[nodiscard]] bool IsExclusive() const { return bExclusive; }
+
+        // Whether the two may not run at the same time
+        [[nodiscard]] bool ConflictsWith(const FSystem& Other) const;
+
+    protected:
+        template<typename... Ts>
+        void Reads() { ReadMask = ReadMask | MakeComponentMask<Ts...>(); }
+        template<typename... Ts>
+        void Writes() { WriteMask = WriteMask | MakeComponentMask<Ts...>(); }
+        // Runs alone, e.g. for systems that reach outside the world
+        void RequireExclusive() { bExclusive = true; }
+
+    private:
+        std::string Name;
+        FComponentMask ReadMask;
+        FComponentMask WriteMask;
+        bool bExclusive = false;
+    };
+
+    // Runs systems in stages. A system joins the first stage after every earlier-registered
+    // system it conflicts with, so conflicting systems keep their registration order while the
+    // rest of a stage runs in parallel on the job system. Each system records structural changes
+    // into its own command buffer; the buffers are played back in registration order after
+    // their stage.
+    class FSystemScheduler
+    {
+    public:
+        template<typename T, typename... Args>
+        T& AddSystem(Args&&... Arguments)
+        {
+            Scope<T> System = CreateScope<T>(std::forward<Args>(Arguments)...);
+            T& Result = *System;
+            Add(std::move(System));
+            return Result;
+        }
+        void Add(Scope<FSystem> System);
+
+        void Run(FWorld& World, FJobSystem& JobSystem, float DeltaTime);
+
+        [[nodiscard]] std::size_t GetSystemCount() const { return Systems.size(); }
+        [[nodiscard]] std::size_t GetStageCount() const { return Stages.size(); }
+        [[nodiscard]] const FSystem& GetSystem(std::size_t Index) const { return *Systems[Index].System; }
+        [[nodiscard]] std::size_t GetSystemStage(std::size_t Index) const { return Systems[Index].Stage; }
+
+    private:
+        struct FScheduledSystem
+        {
+            Scope<FSystem> System;
+            Scope<FCommandBuffer> Commands;
+            std::size_t Stage = 0;
+        };
+
+        void RunSystem(FScheduledSystem& Scheduled, FWorld& World, FJobSystem& JobSystem, float DeltaTime);
+
+    private:
+        std::vector<FScheduledSystem> Systems;
+        // Indices into Systems, in registration order within each stage
+        std::vector<std::vector<std::size_t>> Stages;
+    };
+
+}
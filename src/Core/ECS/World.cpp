@@ -0,0 +1,182 @@
+#include "World.h"
+#include "Core/Memory/MemoryTracker.h"
+
+namespace Core
+{
+
+    FWorld::FWorld()
+    {
+        EmptyArchetype = GetOrCreateArchetype(FComponentMask{});
+    }
+
+    FWorld::~FWorld() = default;
+
+    FEntity FWorld::CreateEntity()
+    {
+        return AllocateEntity(EmptyArchetype);
+    }
+
+    void FWorld::DestroyEntity(FEntity Entity)
+    {
+        if (!IsAlive(Entity))
+            return;
+
+        FEntityRecord& Record = Records[Entity.Index];
+        Record.Archetype->DestroyComponents(Record.Location);
+        RemoveRow(Record);
+
+        Record.Archetype = nullptr;
+        // Zero is the null generation
+        if (++Record.Generation == 0)
+        {
+            Record.Generation = 1;
+        }
+        FreeIndices.push_back(Entity.Index);
+    }
+
+    bool FWorld::IsAlive(FEntity Entity) const
+    {
+        return Entity.Index < Records.size()
+            && Records[Entity.Index].Generation == Entity.Generation
+            && Records[Entity.Index].Archetype != nullptr;
+    }
+
+    FArchetype* FWorld::GetOrCreateArchetype(const FComponentMask& Mask)
+    {
+        auto It = ArchetypesByMask.find(Mask.GetBits());
+        if (It != ArchetypesByMask.end())
+            return It->second;
+
+        CORE_MEMORY_TAG(ECS);
+        FArchetype* Archetype = Archetypes.emplace_back(CreateScope<FArchetype>(Mask)).get();
+        ArchetypesByMask.emplace(Mask.GetBits(), Archetype);
+        return Archetype;
+    }
+
+    FArchetype* FWorld::GetArchetypeWith(FArchetype* Source, FComponentTypeId Id)
+    {
+        if (FArchetype* Target = Source->GetAddEdge(Id))
+            return Target;
+
+        FComponentMask Mask = Source->GetMask();
+        Mask.Set(Id);
+        FArchetype* Target = GetOrCreateArchetype(Mask);
+        Source->SetAddEdge(Id, Target);
+        Target->SetRemoveEdge(Id, Source);
+        return Target;
+    }
+
+    FArchetype* FWorld::GetArchetypeWithout(FArchetype* Source, FComponentTypeId Id)
+    {
+        if (FArchetype* Target = Source->GetRemoveEdge(Id))
+            return Target;
+
+        FComponentMask Mask = Source->GetMask();
+        Mask.Clear(Id);
+        FArchetype* Target = GetOrCreateArchetype(Mask);
+        Source->SetRemoveEdge(Id, Target);
+        Target->SetAddEdge(Id, Source);
+        return Target;
+    }
+
+    FEntity FWorld::AllocateEntity(FArchetype* Archetype)
+    {
+        std::uint32_t Index;
+        if (!FreeIndices.empty())
+        {
+            Index = FreeIndices.back();
+            FreeIndices.pop_back();
+        }
+        else
+        {
+            CORE_MEMORY_TAG(ECS);
+            Index = static_cast<std::uint32_t>(Records.size());
+            Records.emplace_back();
+        }
+
+        FEntityRecord& Record = Records[Index];
+        const FEntity Entity{ Index, Record.Generation };
+        Record.Archetype = Archetype;
+        Record.Location = Archetype->Allocate(Entity);
+        return Entity;
+    }
+
+    void FWorld::MoveEntity(FEntity Entity, FEntityRecord& Record, FArchetype* Target)
+    {
+        FArchetype* Source = Record.Archetype;
+        const FEntityLocation SourceLocation = Record.Location;
+        const FEntityLocation TargetLocation = Target->Allocate(Entity);
+
+        for (FComponentTypeId Id : Source->GetComponents())
+        {
+            const FComponentTypeInfo& Info = FComponentRegistry::GetInfo(Id);
+            if (Info.Size == 0)
+                continue;
+
+            void* SourceComponent = Source->GetComponent(SourceLocation, Id);
+            if (Target->GetMask().Test(Id))
+            {
+                Info.MoveConstruct(Target->GetComponent(TargetLocation, Id), SourceComponent);
+            }
+            if (Info.Destroy)
+            {
+                Info.Destroy(SourceComponent);
+            }
+        }
+
+        RemoveRow(Record);
+        Record.Archetype = Target;
+        Record.Location = TargetLocation;
+    }
+
+    void FWorld::RemoveRow(FEntityRecord& Record)
+    {
+        const FEntity Moved = Record.Archetype->RemoveRow(Record.Location);
+        if (!Moved.IsNull())
+        {
+            Records[Moved.Index].Location = Record.Location;
+        }
+    }
+
+    void* FWorld::AddComponentUninitialized(FEntity Entity, FComponentTypeId Id, bool& bOutExisted)
+    {
+        bOutExisted = false;
+        if (!IsAlive(Entity))
+            return nullptr;
+
+        FEntityRecord& Record = Records[Entity.Index];
+        if (Record.Archetype->GetMask().Test(Id))
+        {
+            bOutExisted = true;
+        }
+        else
+        {
+            MoveEntity(Entity, Record, GetArchetypeWith(Record.Archetype, Id));
+        }
+        return Record.Archetype->GetComponent(Record.Location, Id);
+    }
+
+    void FWorld::RemoveComponent(FEntity Entity, FComponentTypeId Id)
+    {
+        if (!IsAlive(Entity))
+            return;
+
+        FEntityRecord& Record = Records[Entity.Index];
+        if (Record.Archetype->GetMask().Test(Id))
+        {
+            MoveEntity(Entity, Record, GetArchetypeWithout(Record.Archetype, Id));
+        }
+    }
+
+    void* FWorld::GetComponent(FEntity Entity, FComponentTypeId Id) const
+    {
+        if (!IsAlive(Entity))
+            return nullptr;
+
+        const FEntityRecord& Record = Records[Entity.Index];
+        if (!Record.Archetype->GetMask().Test(Id))
+            return nullptr;
+        return Record.Archetype->GetComponent(Record.Location, Id);
+    }
+
+}
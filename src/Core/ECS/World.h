@@ -0,0 +1,360 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+#include "Core/Jobs/JobSystem.h"
+#include "Core/Logging/Log.h"
+#include "Archetype.h"
+#include "ComponentType.h"
+#include "Entity.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace Core
+{
+
+    class FCommandBuffer;
+
+    // Entities and their components, grouped into archetypes by component set.
+    // Structural changes (creating and destroying entities, adding and removing components) move
+    // entities between archetypes and must not overlap any other access to the world. Systems
+    // that run in parallel record them into an FCommandBuffer instead. Component values may be
+    // read and written concurrently as long as no two threads write the same component type,
+    // which is what FSystemScheduler's read/write sets guarantee.
+    class FWorld
+    {
+    public:
+        FWorld();
+        ~FWorld();
+
+        FWorld(const FWorld&) = delete;
+        FWorld& operator=(const FWorld&) = delete;
+
+        FEntity CreateEntity();
+        template<typename... Ts>
+        FEntity CreateEntity(Ts&&... Components);
+        // Stale handles are ignored
+        void DestroyEntity(FEntity Entity);
+        [[nodiscard]] bool IsAlive(FEntity Entity) const;
+
+        // Constructs the component, or replaces it if the entity already has one
+        template<typename T, typename... Args>
+        T& AddComponent(FEntity Entity, Args&&... Arguments);
+        template<typename T>
+        void RemoveComponent(FEntity Entity);
+        template<typename T>
+        [[nodiscard]] bool HasComponent(FEntity Entity) const;
+        // Null if the entity is dead or lacks the component
+        template<typename T>
+        [[nodiscard]] T* TryGetComponent(FEntity Entity);
+        template<typename T>
+        [[nodiscard]] T& GetComponent(FEntity Entity);
+
+        // Calls Func(Ts&...) or Func(FEntity, Ts&...) for every entity that has all of Ts. Mark
+        // components only read as const. Func must not make structural changes.
+        template<typename... Ts, typename F>
+        void Each(F&& Func);
+
+        [[nodiscard]] std::size_t GetEntityCount() const { return Records.size() - FreeIndices.size(); }
+        [[nodiscard]] const std::vector<Scope<FArchetype>>& GetArchetypes() const { return Archetypes; }
+
+    private:
+        friend class FCommandBuffer;
+
+        struct FEntityRecord
+        {
+            FArchetype* Archetype = nullptr;
+            FEntityLocation Location;
+            std::uint32_t Generation = 1;
+        };
+
+        [[nodiscard]] FArchetype* GetOrCreateArchetype(const FComponentMask& Mask);
+        [[nodiscard]] FArchetype* GetArchetypeWith(FArchetype* Source, FComponentTypeId Id);
+        [[nodiscard]] FArchetype* GetArchetypeWithout(FArchetype* Source, FComponentTypeId Id);
+
+        FEntity AllocateEntity(FArchetype* Archetype);
+        // Moves Entity's row to Target, carrying over the components both archetypes share and
+        // destroying the rest. Components only Target has are left uninitialized.
+        void MoveEntity(FEntity Entity, FEntityRecord& Record, FArchetype* Target);
+        void RemoveRow(FEntityRecord& Record);
+
+        // Type-erased structural changes, also used by FCommandBuffer. Returns uninitialized
+        // storage for the component, or the existing component with bOutExisted set; null for tags.
+        void* AddComponentUninitialized(FEntity Entity, FComponentTypeId Id, bool& bOutExisted);
+        void RemoveComponent(FEntity Entity, FComponentTypeId Id);
+        [[nodiscard]] void* GetComponent(FEntity Entity, FComponentTypeId Id) const;
+
+    private:
+        std::vector<FEntityRecord> Records;
+        std::vector<std::uint32_t> FreeIndices;
+
+        std::vector<Scope<FArchetype>> Archetypes;
+        std::unordered_map<std::uint64_t, FArchetype*> ArchetypesByMask;
+        FArchetype* EmptyArchetype = nullptr;
+    };
+
+    // Typed query over the archetypes that have all of Ts (plus any With types) and none of the
+    // Without types. Matching archetypes are cached and only archetypes created since the last
+    // run are examined, so keep a query around rather than building one per frame.
+    // Tags can't be fetched; filter on them with With and Without.
+    template<typename... Ts>
+    class TQuery
+    {
+        static_assert(sizeof...(Ts) > 0, "Queries fetch at least one component");
+        static_assert((!std::is_empty_v<std::remove_cvref_t<Ts>> && ...), "Tags have no storage to fetch; use With<T>()");
+
+    public:
+        TQuery()
+            : Required(MakeComponentMask<Ts...>())
+        {
+        }
+
+        template<typename... Us>
+        TQuery& With()
+        {
+            Required = Required | MakeComponentMask<Us...>();
+            Reset();
+            return *this;
+        }
+
+        template<typename... Us>
+        TQuery& Without()
+        {
+            Excluded = Excluded | MakeComponentMask<Us...>();
+            Reset();
+            return *this;
+        }
+
+        // Calls Func(Ts&...) or Func(FEntity, Ts&...) for every matching entity
+        template<typename F>
+        void Each(FWorld& World, F&& Func);
+        // Calls Func(Count, const FEntity*, Ts*...) once per chunk, for loops the compiler can vectorize
+        template<typename F>
+        void EachChunk(FWorld& World, F&& Func);
+        // Each, with chunks spread over the job system. Func runs concurrently and must only
+        // write to the components it is given.
+        template<typename F>
+        void ParallelEach(FWorld& World, FJobSystem& JobSystem, F&& Func);
+
+        [[nodiscard]] std::size_t Count(FWorld& World);
+
+    private:
+        struct FChunkRef
+        {
+            const FArchetype* Archetype;
+            const FArchetypeChunk* Chunk;
+        };
+
+        void Update(const FWorld& World);
+        void Reset()
+        {
+            Matches.clear();
+            ScannedArchetypes = 0;
+        }
+
+        template<typename F>
+        static void RunChunk(const FArchetype& Archetype, const FArchetypeChunk& Chunk, F& Func);
+
+    private:
+        FComponentMask Required;
+        FComponentMask Excluded;
+        std::vector<const FArchetype*> Matches;
+        std::size_t ScannedArchetypes = 0;
+        const FWorld* LastWorld = nullptr;
+        // Reused by ParallelEach
+        std::vector<FChunkRef> ChunkRefs;
+    };
+
+    template<typename... Ts>
+    FEntity FWorld::CreateEntity(Ts&&... Components)
+    {
+        if constexpr (sizeof...(Ts) == 0)
+        {
+            return CreateEntity();
+        }
+        else
+        {
+            FArchetype* Archetype = GetOrCreateArchetype(MakeComponentMask<Ts...>());
+            const FEntity Entity = AllocateEntity(Archetype);
+            const FEntityLocation Location = Records[Entity.Index].Location;
+            ([&]()
+            {
+                using FType = std::remove_cvref_t<Ts>;
+                if constexpr (!std::is_empty_v<FType>)
+                {
+                    ::new (Archetype->GetComponent(Location, FComponentRegistry::GetId<FType>())) FType(std::forward<Ts>(Components));
+                }
+            }(), ...);
+            return Entity;
+        }
+    }
+
+    template<typename T, typename... Args>
+    T& FWorld::AddComponent(FEntity Entity, Args&&... Arguments)
+    {
+        bool bExisted = false;
+        void* Storage = AddComponentUninitialized(Entity, FComponentRegistry::GetId<T>(), bExisted);
+        if constexpr (std::is_empty_v<T>)
+        {
+            static T Tag;
+            return Tag;
+        }
+        else
+        {
+            CORE_ASSERT(Storage, "AddComponent on a dead entity");
+            if (bExisted)
+            {
+                T* Existing = static_cast<T*>(Storage);
+                *Existing = T(std::forward<Args>(Arguments)...);
+                return *Existing;
+            }
+            return *::new (Storage) T(std::forward<Args>(Arguments)...);
+        }
+    }
+
+    template<typename T>
+    void FWorld::RemoveComponent(FEntity Entity)
+    {
+        RemoveComponent(Entity, FComponentRegistry::GetId<T>());
+    }
+
+    template<typename T>
+    bool FWorld::HasComponent(FEntity Entity) const
+    {
+        return IsAlive(Entity) && Records[Entity.Index].Archetype->GetMask().Test(FComponentRegistry::GetId<T>());
+    }
+
+    template<typename T>
+    T* FWorld::TryGetComponent(FEntity Entity)
+    {
+        static_assert(!std::is_empty_v<T>, "Tags have no storage; use HasComponent");
+        return static_cast<T*>(GetComponent(Entity, FComponentRegistry::GetId<T>()));
+    }
+
+    template<typename T>
+    T& FWorld::GetComponent(FEntity Entity)
+    {
+        T* Component = TryGetComponent<T>(Entity);
+        CORE_ASSERT(Component, "Entity has no such component");
+        return *Component;
+    }
+
+    template<typename... Ts, typename F>
+    void FWorld::Each(F&& Func)
+    {
+        TQuery<Ts...> Query;
+        Query.Each(*this, std::forward<F>(Func));
+    }
+
+    template<typename... Ts>
+    void TQuery<Ts...>::Update(const FWorld& World)
+    {
+        if (LastWorld != &World)
+        {
+            Reset();
+            LastWorld = &World;
+        }
+
+        // Archetypes are never removed, so only the new ones need a look
+        const std::vector<Scope<FArchetype>>& Archetypes = World.GetArchetypes();
+        for (; ScannedArchetypes < Archetypes.size(); ++ScannedArchetypes)
+        {
+            const FArchetype* Archetype = Archetypes[ScannedArchetypes].get();
+            if (Archetype->GetMask().Contains(Required) && !Archetype->GetMask().Overlaps(Excluded))
+            {
+                Matches.push_back(Archetype);
+            }
+        }
+    }
+
+    template<typename... Ts>
+    template<typename F>
+    void TQuery<Ts...>::RunChunk(const FArchetype& Archetype, const FArchetypeChunk& Chunk, F& Func)
+    {
+        const auto Run = [&Chunk, &Func](const FEntity* Entities, auto*... Columns)
+        {
+            for (std::uint32_t Row = 0; Row < Chunk.Count; ++Row)
+            {
+                if constexpr (std::is_invocable_v<F&, FEntity, Ts&...>)
+                {
+                    Func(Entities[Row], Columns[Row]...);
+                }
+                else
+                {
+                    Func(Columns[Row]...);
+                }
+            }
+        };
+        Run(Archetype.GetEntities(Chunk), Archetype.template GetColumn<Ts>(Chunk)...);
+    }
+
+    template<typename... Ts>
+    template<typename F>
+    void TQuery<Ts...>::Each(FWorld& World, F&& Func)
+    {
+        Update(World);
+        for (const FArchetype* Archetype : Matches)
+        {
+            for (std::size_t ChunkIndex = 0; ChunkIndex < Archetype->GetChunkCount(); ++ChunkIndex)
+            {
+                RunChunk(*Archetype, Archetype->GetChunk(ChunkIndex), Func);
+            }
+        }
+    }
+
+    template<typename... Ts>
+    template<typename F>
+    void TQuery<Ts...>::EachChunk(FWorld& World, F&& Func)
+    {
+        Update(World);
+        for (const FArchetype* Archetype : Matches)
+        {
+            for (std::size_t ChunkIndex = 0; ChunkIndex < Archetype->GetChunkCount(); ++ChunkIndex)
+            {
+                const FArchetypeChunk& Chunk = Archetype->GetChunk(ChunkIndex);
+                Func(static_cast<std::size_t>(Chunk.Count), static_cast<const FEntity*>(Archetype->GetEntities(Chunk)),
+                     Archetype->template GetColumn<Ts>(Chunk)...);
+            }
+        }
+    }
+
+    template<typename... Ts>
+    template<typename F>
+    void TQuery<Ts...>::ParallelEach(FWorld& World, FJobSystem& JobSystem, F&& Func)
+    {
+        Update(World);
+
+        ChunkRefs.clear();
+        for (const FArchetype* Archetype : Matches)
+        {
+            for (std::size_t ChunkIndex = 0; ChunkIndex < Archetype->GetChunkCount(); ++ChunkIndex)
+            {
+                ChunkRefs.push_back({ Archetype, &Archetype->GetChunk(ChunkIndex) });
+            }
+        }
+
+        // A chunk is already a few hundred entities, enough to be worth a job of its own
+        JobSystem.ParallelFor(ChunkRefs.size(), 1, [this, &Func](std::size_t Index)
+        {
+            RunChunk(*ChunkRefs[Index].Archetype, *ChunkRefs[Index].Chunk, Func);
+        });
+    }
+
+    template<typename... Ts>
+    std::size_t TQuery<Ts...>::Count(FWorld& World)
+    {
+        Update(World);
+        std::size_t Total = 0;
+        for (const FArchetype* Archetype : Matches)
+        {
+            Total += Archetype->GetEntityCount();
+        }
+        return Total;
+    }
+
+}
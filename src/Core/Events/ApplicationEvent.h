@@ -1,11 +1,10 @@
 #pragma once
 
-#include "Event.h"
-#include <sstream>
+#include "EventBase.h"
 
 namespace Core 
 {
-    class FWindowResizeEvent : public FEvent
+    class FWindowResizeEvent
     {
     public:
         FWindowResizeEvent(unsigned int InWidth, unsigned int InHeight)
@@ -14,11 +13,10 @@ namespace Core
         [[nodiscard]] unsigned int GetWidth() const { return Width; }
         [[nodiscard]] unsigned int GetHeight() const { return Height; }
 
-        [[nodiscard]] std::string ToString() const override
+        template<typename OutputIt>
+        OutputIt FormatTo(OutputIt Out) const
         {
-            std::stringstream ss;
-            ss << "WindowResizeEvent: " << Width << ", " << Height;
-            return ss.str();
+            return std::format_to(Out, "WindowResizeEvent: {}, {}", Width, Height);
         }
 
         EVENT_CLASS_TYPE(WindowResize)
@@ -28,7 +26,7 @@ namespace Core
         unsigned int Width, Height;
     };
 
-    class FWindowCloseEvent : public FEvent
+    class FWindowCloseEvent
     {
     public:
         FWindowCloseEvent() = default;
@@ -37,7 +35,25 @@ namespace Core
         EVENT_CLASS_CATEGORY(EventCategoryApplication)
     };
 
-    class FAppTickEvent : public FEvent
+    class FWindowFocusEvent
+    {
+    public:
+        FWindowFocusEvent() = default;
+
+        EVENT_CLASS_TYPE(WindowFocus)
+        EVENT_CLASS_CATEGORY(EventCategoryApplication)
+    };
+
+    class FWindowLostFocusEvent
+    {
+    public:
+        FWindowLostFocusEvent() = default;
+
+        EVENT_CLASS_TYPE(WindowLostFocus)
+        EVENT_CLASS_CATEGORY(EventCategoryApplication)
+    };
+
+    class FAppTickEvent
     {
     public:
         FAppTickEvent() = default;
@@ -46,7 +62,7 @@ namespace Core
         EVENT_CLASS_CATEGORY(EventCategoryApplication)
     };
 
-    class FAppUpdateEvent : public FEvent
+    class FAppUpdateEvent
     {
     public:
         FAppUpdateEvent() = default;
@@ -55,7 +71,7 @@ namespace Core
         EVENT_CLASS_CATEGORY(EventCategoryApplication)
     };
 
-    class FAppRenderEvent : public FEvent
+    class FAppRenderEvent
     {
     public:
         FAppRenderEvent() = default;
@@ -1,55 +1,126 @@
 #pragma once
 
-#include "Core/Base/Core.h"
+#include "EventBase.h"
+#include "ApplicationEvent.h"
+#include "KeyEvent.h"
+#include "MouseEvent.h"
+
+#include <array>
 #include <string>
-#include <concepts>
-#include <functional> // IWYU pragma: keep
-#include <sstream> // IWYU pragma: keep
+#include <variant>
+#include <iterator>
+#include <memory_resource>
+#include <concepts> // IWYU pragma: keep
+#include <ostream>
 
-namespace Core 
+namespace Core
 {
 
-    enum class EEventType
-    {
-        None = 0,
-        WindowClose, WindowResize, WindowFocus, WindowLostFocus, WindowMoved,
-        AppTick, AppUpdate, AppRender,
-        KeyPressed, KeyReleased, KeyTyped,
-        MouseButtonPressed, MouseButtonReleased, MouseMoved, MouseScrolled
-    };
+    // Every concrete event. FWindowCloseEvent comes first so a default FEvent is valid.
+    using FEventPayload = std::variant
+    <
+        FWindowCloseEvent, FWindowResizeEvent, FWindowFocusEvent, FWindowLostFocusEvent,
+        FAppTickEvent, FAppUpdateEvent, FAppRenderEvent,
+        FKeyPressedEvent, FKeyReleasedEvent, FKeyTypedEvent,
+        FMouseButtonPressedEvent, FMouseButtonReleasedEvent, FMouseMovedEvent, FMouseScrolledEvent
+    >;
 
-    enum EEventCategory
+    namespace Detail
     {
-        None = 0,
-        EventCategoryApplication    = BIT(0),
-        EventCategoryInput          = BIT(1),
-        EventCategoryKeyboard       = BIT(2),
-        EventCategoryMouse          = BIT(3),
-        EventCategoryMouseButton    = BIT(4)
-    };
+        template<typename T, typename Variant>
+        struct TIsEventAlternative;
 
-#define EVENT_CLASS_TYPE(type) static EEventType GetStaticType() { return EEventType::type; }\
-                               virtual EEventType GetEventType() const override { return GetStaticType(); }\
-                               virtual const char* GetName() const override { return #type; }
+        template<typename T, typename... Ts>
+        struct TIsEventAlternative<T, std::variant<Ts...>> : std::bool_constant<(std::same_as<T, Ts> || ...)> {};
+
+        // Per-alternative constants indexed by FEventPayload::index(), built at compile time
+        template<typename Variant>
+        struct TEventTable;
+
+        template<typename... Ts>
+        struct TEventTable<std::variant<Ts...>>
+        {
+            static constexpr std::array<EEventType, sizeof...(Ts)> Types = { Ts::GetStaticType()... };
+            static constexpr std::array<const char*, sizeof...(Ts)> Names = { Ts::GetStaticName()... };
+            static constexpr std::array<int, sizeof...(Ts)> Categories = { Ts::GetStaticCategoryFlags()... };
+        };
+    }
 
-#define EVENT_CLASS_CATEGORY(category) virtual int GetCategoryFlags() const override { return category; }
+    template<typename T>
+    concept CEvent = Detail::TIsEventAlternative<T, FEventPayload>::value;
 
+    // Value-type event: a tagged union of the concrete event structs plus the handled flag.
+    // Trivially copyable, never allocates and needs no virtual calls to inspect.
     class FEvent
     {
     public:
-        virtual ~FEvent() = default;
+        FEvent() = default;
+
+        template<CEvent T>
+        FEvent(const T& InEvent)
+            : Payload(InEvent)
+        {
+        }
 
         bool bHandled = false;
 
-        [[nodiscard]] virtual EEventType GetEventType() const = 0;
-        [[nodiscard]] virtual const char* GetName() const = 0;
-        [[nodiscard]] virtual int GetCategoryFlags() const = 0;
-        [[nodiscard]] virtual std::string ToString() const { return GetName(); }
+        [[nodiscard]] EEventType GetEventType() const { return Table::Types[Payload.index()]; }
+        [[nodiscard]] const char* GetName() const { return Table::Names[Payload.index()]; }
+        [[nodiscard]] int GetCategoryFlags() const { return Table::Categories[Payload.index()]; }
 
         [[nodiscard]] bool IsInCategory(EEventCategory InCategory) const
         {
             return GetCategoryFlags() & InCategory;
         }
+
+        template<CEvent T>
+        [[nodiscard]] bool Is() const { return std::holds_alternative<T>(Payload); }
+
+        template<CEvent T>
+        [[nodiscard]] T* As() { return std::get_if<T>(&Payload); }
+
+        template<CEvent T>
+        [[nodiscard]] const T* As() const { return std::get_if<T>(&Payload); }
+
+        // Calls Func with the concrete event
+        template<typename F>
+        decltype(auto) Visit(F&& Func) { return std::visit(std::forward<F>(Func), Payload); }
+
+        template<typename F>
+        decltype(auto) Visit(F&& Func) const { return std::visit(std::forward<F>(Func), Payload); }
+
+        // Formats into any output iterator, e.g. a fixed buffer, without building a std::string
+        template<typename OutputIt>
+        OutputIt FormatTo(OutputIt Out) const
+        {
+            return Visit([Out](const auto& E) mutable -> OutputIt
+            {
+                if constexpr (requires { E.FormatTo(Out); })
+                    return E.FormatTo(Out);
+                else
+                    return std::format_to(Out, "{}", E.GetStaticName());
+            });
+        }
+
+        [[nodiscard]] std::string ToString() const
+        {
+            std::string Result;
+            FormatTo(std::back_inserter(Result));
+            return Result;
+        }
+
+        // Allocates from Resource instead of the heap, e.g. FFrameAllocator::GetResource()
+        [[nodiscard]] std::pmr::string ToString(std::pmr::memory_resource* Resource) const
+        {
+            std::pmr::string Result(Resource);
+            FormatTo(std::back_inserter(Result));
+            return Result;
+        }
+
+    private:
+        using Table = Detail::TEventTable<FEventPayload>;
+
+        FEventPayload Payload;
     };
 
     class FEventDispatcher
@@ -60,14 +131,13 @@ namespace Core
         {
         }
 
-        // Concept to ensure T is a valid Event type
-        template<typename T, typename F>
-        requires std::derived_from<T, FEvent>
+        // Resolves to a single index compare; no virtual call per handler
+        template<CEvent T, typename F>
         bool Dispatch(const F& Func)
         {
-            if (Event.GetEventType() == T::GetStaticType())
+            if (T* Concrete = Event.As<T>())
             {
-                Event.bHandled |= Func(static_cast<T&>(Event));
+                Event.bHandled |= Func(*Concrete);
                 return true;
             }
             return false;
@@ -81,4 +151,4 @@ namespace Core
         return OS << E.ToString();
     }
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+#include <format> // IWYU pragma: keep
+
+namespace Core 
+{
+
+    enum class EEventType
+    {
+        None = 0,
+        WindowClose, WindowResize, WindowFocus, WindowLostFocus, WindowMoved,
+        AppTick, AppUpdate, AppRender,
+        KeyPressed, KeyReleased, KeyTyped,
+        MouseButtonPressed, MouseButtonReleased, MouseMoved, MouseScrolled
+    };
+
+    enum EEventCategory
+    {
+        None = 0,
+        EventCategoryApplication    = BIT(0),
+        EventCategoryInput          = BIT(1),
+        EventCategoryKeyboard       = BIT(2),
+        EventCategoryMouse          = BIT(3),
+        EventCategoryMouseButton    = BIT(4),
+
+        EventCategoryAll            = EventCategoryApplication | EventCategoryInput | EventCategoryKeyboard |
+                                      EventCategoryMouse | EventCategoryMouseButton
+    };
+
+// Event structs are plain values: type, name and category are compile-time constants
+#define EVENT_CLASS_TYPE(type) static constexpr EEventType GetStaticType() { return EEventType::type; }\
+                               static constexpr const char* GetStaticName() { return #type; }
+
+#define EVENT_CLASS_CATEGORY(category) static constexpr int GetStaticCategoryFlags() { return category; }
+
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "Core/Base/SPSCQueue.h"
+#include "Event.h"
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+namespace Core
+{
+
+    // Events produced by the GLFW callbacks on the main thread and consumed once per frame by
+    // the thread that runs the layers. Neither side locks or allocates.
+    //
+    // Only discrete events (keys, buttons, characters) take a ring slot. Cursor moves and resizes
+    // overwrite a latest-value slot, scrolling adds to a running sum, and close requests set a
+    // flag. Before a discrete event is queued, any of that state not yet handed out is queued
+    // ahead of it, so a click is handled at the position it was made at. The drain ends with
+    // whatever is newer than the ring: the latest cursor position and size, the remaining
+    // scroll, then the close request.
+    //
+    // A full ring drops the discrete event and counts it; the producer may be the consumer's own
+    // thread, so it cannot wait for room. Positions, sizes and scrolling are never lost.
+    class FEventQueue
+    {
+        static_assert(std::is_trivially_copyable_v<FEvent>, "Queued events must stay trivially copyable");
+
+    public:
+        static constexpr std::size_t Capacity = 256;
+
+        // Producer side (main thread)
+        void Push(const FEvent& InEvent)
+        {
+            if (const FMouseMovedEvent* Moved = InEvent.As<FMouseMovedEvent>())
+            {
+                MousePosition.store(Pack(Moved->GetX(), Moved->GetY()), std::memory_order_relaxed);
+                bMouseMoved.store(true, std::memory_order_release);
+                return;
+            }
+            if (const FWindowResizeEvent* Resize = InEvent.As<FWindowResizeEvent>())
+            {
+                WindowSize.store(Pack(Resize->GetWidth(), Resize->GetHeight()), std::memory_order_relaxed);
+                bResized.store(true, std::memory_order_release);
+                return;
+            }
+            if (const FMouseScrolledEvent* Scrolled = InEvent.As<FMouseScrolledEvent>())
+            {
+                AddScroll(Scrolled->GetXOffset(), Scrolled->GetYOffset());
+                return;
+            }
+            if (InEvent.Is<FWindowCloseEvent>())
+            {
+                bCloseRequested.store(true, std::memory_order_release);
+                return;
+            }
+
+            // Whatever does not fit stays where it was for the drain to pick up
+            if (bResized.exchange(false, std::memory_order_acquire))
+            {
+                if (!Queue.Push(Unpack<FWindowResizeEvent, unsigned int>(WindowSize.load(std::memory_order_relaxed))))
+                    bResized.store(true, std::memory_order_release);
+            }
+            if (bMouseMoved.exchange(false, std::memory_order_acquire))
+            {
+                if (!Queue.Push(Unpack<FMouseMovedEvent, float>(MousePosition.load(std::memory_order_relaxed))))
+                    bMouseMoved.store(true, std::memory_order_release);
+            }
+            if (const std::uint64_t Sum = ScrollSum.exchange(0, std::memory_order_acquire))
+            {
+                const FMouseScrolledEvent Scrolled = Unpack<FMouseScrolledEvent, float>(Sum);
+                if (!Queue.Push(Scrolled))
+                    AddScroll(Scrolled.GetXOffset(), Scrolled.GetYOffset());
+            }
+
+            if (!Queue.Push(InEvent))
+                DroppedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Consumer side. Only the events already queued when the drain starts are processed,
+        // so a producer flooding the queue cannot keep the consumer here forever.
+        template<typename F>
+        void Drain(F&& Func)
+        {
+            std::size_t Remaining = Queue.Size();
+
+            FEvent Next;
+            while (Remaining-- > 0 && Queue.Pop(Next))
+            {
+                if (const FMouseMovedEvent* Moved = Next.As<FMouseMovedEvent>())
+                    LastMousePosition = Pack(Moved->GetX(), Moved->GetY());
+                else if (const FWindowResizeEvent* Resize = Next.As<FWindowResizeEvent>())
+                    LastWindowSize = Pack(Resize->GetWidth(), Resize->GetHeight());
+                Func(Next);
+            }
+
+            // A position queued ahead of a discrete event may be older than one the producer
+            // stored before this drain took the slot, so the slot is also handed out when it
+            // differs from the last position handed out, from either source
+            const bool bMoved = bMouseMoved.exchange(false, std::memory_order_acquire);
+            const std::uint64_t Position = MousePosition.load(std::memory_order_relaxed);
+            if (bMoved || Position != LastMousePosition)
+            {
+                LastMousePosition = Position;
+                FEvent Moved = Unpack<FMouseMovedEvent, float>(Position);
+                Func(Moved);
+            }
+
+            const bool bSizeChanged = bResized.exchange(false, std::memory_order_acquire);
+            const std::uint64_t Size = WindowSize.load(std::memory_order_relaxed);
+            if (bSizeChanged || Size != LastWindowSize)
+            {
+                LastWindowSize = Size;
+                FEvent Resize = Unpack<FWindowResizeEvent, unsigned int>(Size);
+                Func(Resize);
+            }
+
+            if (const std::uint64_t Sum = ScrollSum.exchange(0, std::memory_order_acquire))
+            {
+                FEvent Scrolled = Unpack<FMouseScrolledEvent, float>(Sum);
+                Func(Scrolled);
+            }
+
+            if (bCloseRequested.exchange(false, std::memory_order_acquire))
+            {
+                FEvent Close = FWindowCloseEvent();
+                Func(Close);
+            }
+        }
+
+        // Discrete events dropped on a full ring since the last call
+        [[nodiscard]] std::uint64_t TakeDroppedCount()
+        {
+            return DroppedCount.exchange(0, std::memory_order_relaxed);
+        }
+
+    private:
+        template<typename T>
+        static std::uint64_t Pack(T A, T B)
+        {
+            static_assert(sizeof(T) == sizeof(std::uint32_t));
+            return std::uint64_t(std::bit_cast<std::uint32_t>(A)) << 32 | std::bit_cast<std::uint32_t>(B);
+        }
+
+        template<typename TEvent, typename T>
+        static TEvent Unpack(std::uint64_t Bits)
+        {
+            return TEvent(std::bit_cast<T>(std::uint32_t(Bits >> 32)), std::bit_cast<T>(std::uint32_t(Bits)));
+        }
+
+        void AddScroll(float XOffset, float YOffset)
+        {
+            std::uint64_t Sum = ScrollSum.load(std::memory_order_relaxed);
+            std::uint64_t NewSum;
+            do
+            {
+                const FMouseScrolledEvent Current = Unpack<FMouseScrolledEvent, float>(Sum);
+                const float X = Current.GetXOffset() + XOffset;
+                const float Y = Current.GetYOffset() + YOffset;
+                // A zero sum means nothing to hand out, which is also true of scrolling back and forth
+                NewSum = X == 0.0f && Y == 0.0f ? 0 : Pack(X, Y);
+            }
+            while (!ScrollSum.compare_exchange_weak(Sum, NewSum, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+    private:
+        // Never a real position or size: both halves are NaN as floats and ~0 as sizes
+        static constexpr std::uint64_t NoValue = ~std::uint64_t(0);
+
+        TSPSCQueue<FEvent, Capacity> Queue;
+
+        // Producer side
+        alignas(CacheLineSize) std::atomic<std::uint64_t> MousePosition{ NoValue };
+        std::atomic<std::uint64_t> WindowSize{ NoValue };
+        std::atomic<std::uint64_t> ScrollSum{ 0 };
+        std::atomic<bool> bCloseRequested{ false };
+        std::atomic<std::uint64_t> DroppedCount{ 0 };
+        // Set with each new value, cleared by whichever side hands the value out first
+        std::atomic<bool> bMouseMoved{ false };
+        std::atomic<bool> bResized{ false };
+
+        // Consumer side
+        alignas(CacheLineSize) std::uint64_t LastMousePosition = NoValue;
+        std::uint64_t LastWindowSize = NoValue;
+    };
+
+}
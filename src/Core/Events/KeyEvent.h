@@ -1,12 +1,11 @@
 #pragma once
 
-#include "Event.h"
-#include <sstream>
+#include "EventBase.h"
 
 namespace Core
 {
 
-    class FKeyEvent : public FEvent
+    class FKeyEvent
     {
     public:
         [[nodiscard]] int GetKeyCode() const { return KeyCode; }
@@ -27,11 +26,10 @@ namespace Core
 
         [[nodiscard]] bool IsRepeat() const { return bIsRepeat; }
 
-        [[nodiscard]] std::string ToString() const override
+        template<typename OutputIt>
+        OutputIt FormatTo(OutputIt Out) const
         {
-            std::stringstream ss;
-            ss << "KeyPressedEvent: " << KeyCode << " (repeat = " << bIsRepeat << ")";
-            return ss.str();
+            return std::format_to(Out, "KeyPressedEvent: {} (repeat = {})", KeyCode, static_cast<int>(bIsRepeat));
         }
 
         EVENT_CLASS_TYPE(KeyPressed)
@@ -46,11 +44,10 @@ namespace Core
         FKeyReleasedEvent(int InKeyCode)
             : FKeyEvent(InKeyCode) {}
 
-        [[nodiscard]] std::string ToString() const override
+        template<typename OutputIt>
+        OutputIt FormatTo(OutputIt Out) const
         {
-            std::stringstream ss;
-            ss << "KeyReleasedEvent: " << KeyCode;
-            return ss.str();
+            return std::format_to(Out, "KeyReleasedEvent: {}", KeyCode);
         }
 
         EVENT_CLASS_TYPE(KeyReleased)
@@ -62,11 +59,10 @@ namespace Core
         FKeyTypedEvent(int InKeyCode)
             : FKeyEvent(InKeyCode) {}
 
-        [[nodiscard]] std::string ToString() const override
+        template<typename OutputIt>
+        OutputIt FormatTo(OutputIt Out) const
         {
-            std::stringstream ss;
-            ss << "KeyTypedEvent: " << KeyCode;
-            return ss.str();
+            return std::format_to(Out, "KeyTypedEvent: {}", KeyCode);
         }
 
         EVENT_CLASS_TYPE(KeyTyped)
@@ -1,11 +1,10 @@
 #pragma once
 
-#include "Event.h"
-#include <sstream>
+#include "EventBase.h"
 
 namespace Core 
 {
-    class FMouseMovedEvent : public FEvent
+    class FMouseMovedEvent
     {
     public:
         FMouseMovedEvent(float InX, float InY)
@@ -14,11 +13,10 @@ namespace Core
         [[nodiscard]] float GetX() const { return MouseX; }
         [[nodiscard]] float GetY() const { return MouseY; }
 
-        [[nodiscard]] std::string ToString() const override
+        template<typename OutputIt>
+        OutputIt FormatTo(OutputIt Out) const
         {
-            std::stringstream ss;
-            ss << "MouseMovedEvent: " << MouseX << ", " << MouseY;
-            return ss.str();
+            return std::format_to(Out, "MouseMovedEvent: {}, {}", MouseX, MouseY);
         }
 
         EVENT_CLASS_TYPE(MouseMoved)
@@ -28,7 +26,7 @@ namespace Core
         float MouseX, MouseY;
     };
 
-    class FMouseScrolledEvent : public FEvent
+    class FMouseScrolledEvent
     {
     public:
         FMouseScrolledEvent(float InXOffset, float InYOffset)
@@ -37,11 +35,10 @@ namespace Core
         [[nodiscard]] float GetXOffset() const { return XOffset; }
         [[nodiscard]] float GetYOffset() const { return YOffset; }
 
-        [[nodiscard]] std::string ToString() const override
+        template<typename OutputIt>
+        OutputIt FormatTo(OutputIt Out) const
         {
-            std::stringstream ss;
-            ss << "MouseScrolledEvent: " << XOffset << ", " << YOffset;
-            return ss.str();
+            return std::format_to(Out, "MouseScrolledEvent: {}, {}", XOffset, YOffset);
         }
 
         EVENT_CLASS_TYPE(MouseScrolled)
@@ -51,7 +48,7 @@ namespace Core
         float XOffset, YOffset;
     };
 
-    class FMouseButtonEvent : public FEvent
+    class FMouseButtonEvent
     {
     public:
         [[nodiscard]] int GetMouseButton() const { return Button; }
@@ -70,11 +67,10 @@ namespace Core
         FMouseButtonPressedEvent(int InButton)
             : FMouseButtonEvent(InButton) {}
 
-        [[nodiscard]] std::string ToString() const override
+        template<typename OutputIt>
+        OutputIt FormatTo(OutputIt Out) const
         {
-            std::stringstream ss;
-            ss << "MouseButtonPressedEvent: " << Button;
-            return ss.str();
+            return std::format_to(Out, "MouseButtonPressedEvent: {}", Button);
         }
 
         EVENT_CLASS_TYPE(MouseButtonPressed)
@@ -86,11 +82,10 @@ namespace Core
         FMouseButtonReleasedEvent(int InButton)
             : FMouseButtonEvent(InButton) {}
 
-        [[nodiscard]] std::string ToString() const override
+        template<typename OutputIt>
+        OutputIt FormatTo(OutputIt Out) const
         {
-            std::stringstream ss;
-            ss << "MouseButtonReleasedEvent: " << Button;
-            return ss.str();
+            return std::format_to(Out, "MouseButtonReleasedEvent: {}", Button);
         }
 
         EVENT_CLASS_TYPE(MouseButtonReleased)
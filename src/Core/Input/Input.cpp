@@ -1,42 +1,60 @@
 #include "Input.h"
-#include "Core/Application/Application.h"
 #include <GLFW/glfw3.h>
 
 namespace Core
 {
 
+    static_assert(GLFW_KEY_LAST < FInputState::MaxKeys, "FInputState::Keys is too small");
+    static_assert(GLFW_MOUSE_BUTTON_LAST < FInputState::MaxMouseButtons, "FInputState::MouseButtons is too small");
+
+    // Current and previous frame snapshots. Per thread, so the UI thread of the pipelined
+    // renderer can be handed its own copy without racing the GL thread.
+    static thread_local FInputState s_Current;
+    static thread_local FInputState s_Previous;
+
+    void FInput::BeginFrame(const FInputState& InState)
+    {
+        s_Previous = s_Current;
+        s_Current = InState;
+    }
+
+    const FInputState& FInput::GetState()
+    {
+        return s_Current;
+    }
+
     bool FInput::IsKeyPressed(int KeyCode)
     {
-        auto Window = static_cast<GLFWwindow*>(FApplication::Get().GetWindow());
-        auto State = glfwGetKey(Window, KeyCode);
-        return State == GLFW_PRESS || State == GLFW_REPEAT;
+        if (KeyCode < 0 || KeyCode >= FInputState::MaxKeys)
+            return false;
+        return s_Current.Keys[KeyCode];
     }
 
     bool FInput::IsMouseButtonPressed(int Button)
     {
-        auto Window = static_cast<GLFWwindow*>(FApplication::Get().GetWindow());
-        auto State = glfwGetMouseButton(Window, Button);
-        return State == GLFW_PRESS;
+        if (Button < 0 || Button >= FInputState::MaxMouseButtons)
+            return false;
+        return s_Current.MouseButtons[Button];
     }
 
     std::pair<float, float> FInput::GetMousePosition()
     {
-        auto Window = static_cast<GLFWwindow*>(FApplication::Get().GetWindow());
-        double XPos, YPos;
-        glfwGetCursorPos(Window, &XPos, &YPos);
-        return { (float)XPos, (float)YPos };
+        return { s_Current.MouseX, s_Current.MouseY };
     }
 
     float FInput::GetMouseX()
     {
-        auto [X, Y] = GetMousePosition();
-        return X;
+        return s_Current.MouseX;
     }
 
     float FInput::GetMouseY()
     {
-        auto [X, Y] = GetMousePosition();
-        return Y;
+        return s_Current.MouseY;
+    }
+
+    std::pair<float, float> FInput::GetMouseScroll()
+    {
+        return { s_Current.ScrollX - s_Previous.ScrollX, s_Current.ScrollY - s_Previous.ScrollY };
     }
 
 }
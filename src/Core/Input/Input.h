@@ -1,10 +1,13 @@
 #pragma once
 
+#include "InputState.h"
 #include <utility>
 
 namespace Core 
 {
 
+    // Queries are served from the snapshot latched at the top of the current frame.
+    // They never call into GLFW, so they are cheap and safe on the render thread.
     class FInput
     {
     public:
@@ -13,6 +16,17 @@ namespace Core
         [[nodiscard]] static std::pair<float, float> GetMousePosition();
         [[nodiscard]] static float GetMouseX();
         [[nodiscard]] static float GetMouseY();
+
+        // Scroll offset accumulated since the previous frame
+        [[nodiscard]] static std::pair<float, float> GetMouseScroll();
+
+    private:
+        friend class FApplication;
+
+        // Called by the application once per frame with the latest published snapshot
+        static void BeginFrame(const FInputState& InState);
+        // Snapshot latched by the calling thread this frame
+        [[nodiscard]] static const FInputState& GetState();
     };
 
 }
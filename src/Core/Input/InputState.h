@@ -0,0 +1,26 @@
+#pragma once
+
+#include <bitset>
+
+namespace Core
+{
+
+    // Snapshot of the device state captured by the main thread and published once per event batch
+    struct FInputState
+    {
+        // Large enough for GLFW_KEY_LAST / GLFW_MOUSE_BUTTON_LAST
+        static constexpr int MaxKeys = 512;
+        static constexpr int MaxMouseButtons = 8;
+
+        std::bitset<MaxKeys> Keys;
+        std::bitset<MaxMouseButtons> MouseButtons;
+
+        float MouseX = 0.0f;
+        float MouseY = 0.0f;
+
+        // Running totals since startup; per-frame deltas come from comparing two snapshots
+        float ScrollX = 0.0f;
+        float ScrollY = 0.0f;
+    };
+
+}
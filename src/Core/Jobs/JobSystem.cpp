@@ -0,0 +1,318 @@
+#include "JobSystem.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Profiling/Profiler.h"
+
+#include <format>
+#include <string>
+
+namespace Core
+{
+
+    namespace
+    {
+        // Affinity of the current thread, set once it runs ExecuteAffinityJobs
+        thread_local EJobAffinity t_ThreadAffinity = EJobAffinity::Any;
+
+        // Set on pool threads: the system they belong to and the queue they push to and pop from first
+        thread_local const void* t_WorkerSystem = nullptr;
+        thread_local std::size_t t_WorkerIndex = 0;
+    }
+
+    FJobSystem::FJobSystem(int WorkerCount)
+    {
+        #ifdef CORE_PLATFORM_WEB
+            WorkerCount = 0;
+        #else
+            if (WorkerCount < 0)
+            {
+                const int HardwareThreads = static_cast<int>(std::thread::hardware_concurrency());
+                WorkerCount = std::max(HardwareThreads - 1, 1);
+            }
+        #endif
+
+        Queues.reserve(WorkerCount);
+        for (int i = 0; i < WorkerCount; i++)
+        {
+            Queues.push_back(CreateScope<FWorkerQueue>());
+        }
+
+        Workers.reserve(WorkerCount);
+        for (int i = 0; i < WorkerCount; i++)
+        {
+            Workers.emplace_back(&FJobSystem::WorkerLoop, this, static_cast<std::size_t>(i));
+        }
+    }
+
+    FJobSystem::~FJobSystem()
+    {
+        // Workers drain what is still queued before they exit
+        bStopping.store(true, std::memory_order_release);
+        WorkAvailable.release(static_cast<std::ptrdiff_t>(Workers.size()));
+
+        for (std::thread& Worker : Workers)
+        {
+            Worker.join();
+        }
+    }
+
+    void FJobSystem::Submit(FJobFunction Func, FJobCounter* Counter, EJobAffinity Affinity)
+    {
+        if (Counter)
+        {
+            Counter->Count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        Enqueue(FJob{ std::move(Func), Counter }, Affinity);
+    }
+
+    void FJobSystem::SubmitAfter(FJobCounter& Dependency, FJobFunction Func, FJobCounter* Counter, EJobAffinity Affinity)
+    {
+        if (Counter)
+        {
+            Counter->Count.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        {
+            std::lock_guard<std::mutex> Lock(Dependency.Mutex);
+            if (Dependency.Count.load(std::memory_order_acquire) != 0)
+            {
+                Dependency.Continuations.push_back({ std::move(Func), Counter, Affinity });
+                return;
+            }
+        }
+
+        Enqueue(FJob{ std::move(Func), Counter }, Affinity);
+    }
+
+    void FJobSystem::Wait(FJobCounter& Counter)
+    {
+        const EJobAffinity Affinity = t_ThreadAffinity;
+
+        FJob Job;
+        while (!Counter.IsDone())
+        {
+            if ((Affinity != EJobAffinity::Any && TryGetAffinityJob(Affinity, Job)) || TryGetJob(Job))
+            {
+                Execute(Job);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        // The last job may still be releasing the counter; don't let the caller destroy it under it
+        std::lock_guard<std::mutex> Lock(Counter.Mutex);
+    }
+
+    void FJobSystem::ExecuteAffinityJobs(EJobAffinity Affinity)
+    {
+        t_ThreadAffinity = Affinity;
+
+        std::vector<FJob> Jobs;
+        {
+            FAffinityQueue& Queue = GetAffinityQueue(Affinity);
+            std::lock_guard<std::mutex> Lock(Queue.Mutex);
+            Jobs.swap(Queue.Jobs);
+        }
+
+        for (FJob& Job : Jobs)
+        {
+            Execute(Job);
+        }
+    }
+
+    void FJobSystem::SetAffinityWakeCallback(EJobAffinity Affinity, std::function<void()> Callback)
+    {
+        FAffinityQueue& Queue = GetAffinityQueue(Affinity);
+        std::lock_guard<std::mutex> Lock(Queue.Mutex);
+        Queue.WakeCallback = std::move(Callback);
+    }
+
+    void FJobSystem::WorkerLoop(std::size_t Index)
+    {
+        t_WorkerSystem = this;
+        t_WorkerIndex = Index;
+        CORE_MEMORY_TAG(Jobs);
+
+        #ifdef CORE_ENABLE_PROFILING
+            const std::string ThreadName = std::format("Job Worker {}", Index);
+            CORE_PROFILE_THREAD(ThreadName.c_str());
+        #endif
+
+        FJob Job;
+        while (true)
+        {
+            WorkAvailable.acquire();
+
+            if (bStopping.load(std::memory_order_acquire))
+            {
+                while (TryGetJob(Job))
+                {
+                    Execute(Job);
+                }
+                break;
+            }
+
+            // Someone helping in Wait may have taken the job this release was for
+            if (TryGetJob(Job))
+            {
+                Execute(Job);
+            }
+        }
+    }
+
+    void FJobSystem::Enqueue(FJob&& Job, EJobAffinity Affinity)
+    {
+        if (Affinity != EJobAffinity::Any)
+        {
+            FAffinityQueue& Queue = GetAffinityQueue(Affinity);
+            std::function<void()> WakeCallback;
+            {
+                std::lock_guard<std::mutex> Lock(Queue.Mutex);
+                Queue.Jobs.push_back(std::move(Job));
+                WakeCallback = Queue.WakeCallback;
+            }
+
+            if (WakeCallback)
+                WakeCallback();
+            return;
+        }
+
+        if (Workers.empty())
+        {
+            Execute(Job);
+            return;
+        }
+
+        // Workers keep their own children local; other threads spread jobs round-robin
+        const std::size_t Index = t_WorkerSystem == this
+            ? t_WorkerIndex
+            : NextQueue.fetch_add(1, std::memory_order_relaxed) % Queues.size();
+
+        {
+            std::lock_guard<std::mutex> Lock(Queues[Index]->Mutex);
+            Queues[Index]->PushBack(std::move(Job));
+        }
+        WorkAvailable.release();
+    }
+
+    bool FJobSystem::TryGetJob(FJob& OutJob)
+    {
+        if (Queues.empty())
+            return false;
+
+        const bool bIsWorker = t_WorkerSystem == this;
+        const std::size_t Start = bIsWorker ? t_WorkerIndex : NextQueue.load(std::memory_order_relaxed) % Queues.size();
+
+        // Own queue newest-first for locality
+        if (bIsWorker)
+        {
+            FWorkerQueue& Own = *Queues[Start];
+            std::lock_guard<std::mutex> Lock(Own.Mutex);
+            if (Own.PopBack(OutJob))
+                return true;
+        }
+
+        // Steal oldest-first: those tend to be the largest pieces of work left
+        for (std::size_t i = bIsWorker ? 1 : 0; i < Queues.size(); i++)
+        {
+            FWorkerQueue& Victim = *Queues[(Start + i) % Queues.size()];
+            std::lock_guard<std::mutex> Lock(Victim.Mutex);
+            if (Victim.PopFront(OutJob))
+                return true;
+        }
+
+        return false;
+    }
+
+    bool FJobSystem::TryGetAffinityJob(EJobAffinity Affinity, FJob& OutJob)
+    {
+        FAffinityQueue& Queue = GetAffinityQueue(Affinity);
+        std::lock_guard<std::mutex> Lock(Queue.Mutex);
+        if (Queue.Jobs.empty())
+            return false;
+
+        OutJob = std::move(Queue.Jobs.front());
+        Queue.Jobs.erase(Queue.Jobs.begin());
+        return true;
+    }
+
+    void FJobSystem::Execute(FJob& Job)
+    {
+        {
+            CORE_PROFILE_SCOPE("Job");
+            Job.Func();
+        }
+
+        Job.Func = nullptr;
+        FinishJob(Job.Counter);
+    }
+
+    void FJobSystem::FinishJob(FJobCounter* Counter)
+    {
+        if (!Counter)
+            return;
+
+        std::vector<FJobCounter::FContinuation> Continuations;
+        {
+            std::lock_guard<std::mutex> Lock(Counter->Mutex);
+            if (Counter->Count.fetch_sub(1, std::memory_order_acq_rel) != 1)
+                return;
+
+            Continuations.swap(Counter->Continuations);
+        }
+
+        for (FJobCounter::FContinuation& Continuation : Continuations)
+        {
+            Enqueue(FJob{ std::move(Continuation.Func), Continuation.Counter }, Continuation.Affinity);
+        }
+    }
+
+    void FJobSystem::FWorkerQueue::PushBack(FJob&& Job)
+    {
+        if (Count == Jobs.size())
+        {
+            std::vector<FJob> Grown(Jobs.size() * 2);
+            for (std::size_t Index = 0; Index < Count; Index++)
+                Grown[Index] = std::move(Jobs[(Head + Index) & (Jobs.size() - 1)]);
+            Jobs.swap(Grown);
+            Head = 0;
+        }
+
+        Jobs[(Head + Count) & (Jobs.size() - 1)] = std::move(Job);
+        Count++;
+    }
+
+    bool FJobSystem::FWorkerQueue::PopBack(FJob& OutJob)
+    {
+        if (Count == 0)
+            return false;
+
+        Count--;
+        FJob& Slot = Jobs[(Head + Count) & (Jobs.size() - 1)];
+        OutJob = std::move(Slot);
+        // A moved-from std::function is only guaranteed to be valid, not empty
+        Slot.Func = nullptr;
+        return true;
+    }
+
+    bool FJobSystem::FWorkerQueue::PopFront(FJob& OutJob)
+    {
+        if (Count == 0)
+            return false;
+
+        FJob& Slot = Jobs[Head];
+        OutJob = std::move(Slot);
+        Slot.Func = nullptr;
+        Head = (Head + 1) & (Jobs.size() - 1);
+        Count--;
+        return true;
+    }
+
+    FJobSystem::FAffinityQueue& FJobSystem::GetAffinityQueue(EJobAffinity Affinity)
+    {
+        return Affinity == EJobAffinity::MainThread ? MainThreadJobs : RenderThreadJobs;
+    }
+
+}
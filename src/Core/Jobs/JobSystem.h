@@ -0,0 +1,180 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <semaphore>
+#include <thread>
+#include <vector>
+
+namespace Core
+{
+
+    // Where a job is allowed to run
+    enum class EJobAffinity : std::uint8_t
+    {
+        Any,            // Any worker, or a thread helping in Wait
+        MainThread,     // The GLFW thread; window and platform calls
+        RenderThread    // The thread that owns the GL context
+    };
+
+    using FJobFunction = std::function<void()>;
+
+    // Counts unfinished jobs. Jobs submitted with a counter increment it and decrement it when they
+    // finish; continuations attached with SubmitAfter start once it drops to zero.
+    // Must outlive its jobs: destroy it only after FJobSystem::Wait returned.
+    class FJobCounter
+    {
+    public:
+        FJobCounter() = default;
+        FJobCounter(const FJobCounter&) = delete;
+        FJobCounter& operator=(const FJobCounter&) = delete;
+
+        [[nodiscard]] bool IsDone() const { return Count.load(std::memory_order_acquire) == 0; }
+
+    private:
+        friend class FJobSystem;
+
+        struct FContinuation
+        {
+            FJobFunction Func;
+            FJobCounter* Counter;
+            EJobAffinity Affinity;
+        };
+
+        std::atomic<std::int32_t> Count{ 0 };
+        std::mutex Mutex;
+        std::vector<FContinuation> Continuations;
+    };
+
+    // Work-stealing thread pool. Each worker pops its own queue newest-first and steals the oldest
+    // job from the others when it runs dry. A thread waiting on a counter runs jobs instead of
+    // blocking, so fork-join code can nest Submit/Wait freely.
+    // With zero workers (the web build) Any jobs run inline on the submitting thread.
+    class FJobSystem
+    {
+    public:
+        // WorkerCount < 0 sizes the pool to the hardware, leaving a core for the render thread
+        explicit FJobSystem(int WorkerCount = -1);
+        ~FJobSystem();
+
+        FJobSystem(const FJobSystem&) = delete;
+        FJobSystem& operator=(const FJobSystem&) = delete;
+
+        void Submit(FJobFunction Func, FJobCounter* Counter = nullptr, EJobAffinity Affinity = EJobAffinity::Any);
+        // Runs Func once every job counted by Dependency has finished. Counter is incremented now.
+        void SubmitAfter(FJobCounter& Dependency, FJobFunction Func, FJobCounter* Counter = nullptr, EJobAffinity Affinity = EJobAffinity::Any);
+
+        // Runs other jobs until Counter reaches zero. Jobs bound to the calling thread's affinity
+        // are run as well, so waiting on the main or render thread cannot deadlock on them.
+        void Wait(FJobCounter& Counter);
+
+        // Calls Func(Index) for every Index in [0, Count), Grain indices per job, and returns when all
+        // are done. The calling thread takes part.
+        template<typename F>
+        void ParallelFor(std::size_t Count, std::size_t Grain, F&& Func);
+
+        // Runs the jobs queued for Affinity. Called by FApplication on the matching thread once per
+        // loop iteration; also marks the calling thread as that affinity's owner.
+        void ExecuteAffinityJobs(EJobAffinity Affinity);
+        // Wakes the thread that runs Affinity jobs when one is queued (e.g. glfwPostEmptyEvent)
+        void SetAffinityWakeCallback(EJobAffinity Affinity, std::function<void()> Callback);
+
+        [[nodiscard]] std::size_t GetWorkerCount() const { return Workers.size(); }
+
+    private:
+        struct FJob
+        {
+            FJobFunction Func;
+            FJobCounter* Counter = nullptr;
+        };
+
+        // Ring of jobs, popped from either end. Unlike std::deque, which allocates a block every
+        // few pushes as it moves through memory, it only allocates when it outgrows its largest
+        // size so far.
+        struct alignas(CacheLineSize) FWorkerQueue
+        {
+            std::mutex Mutex;
+            // Size is a power of two
+            std::vector<FJob> Jobs = std::vector<FJob>(64);
+            std::size_t Head = 0;
+            std::size_t Count = 0;
+
+            void PushBack(FJob&& Job);
+            [[nodiscard]] bool PopBack(FJob& OutJob);
+            [[nodiscard]] bool PopFront(FJob& OutJob);
+        };
+
+        struct FAffinityQueue
+        {
+            std::mutex Mutex;
+            std::vector<FJob> Jobs;
+            std::function<void()> WakeCallback;
+        };
+
+        void WorkerLoop(std::size_t Index);
+
+        void Enqueue(FJob&& Job, EJobAffinity Affinity);
+        [[nodiscard]] bool TryGetJob(FJob& OutJob);
+        [[nodiscard]] bool TryGetAffinityJob(EJobAffinity Affinity, FJob& OutJob);
+        void Execute(FJob& Job);
+        void FinishJob(FJobCounter* Counter);
+
+        [[nodiscard]] FAffinityQueue& GetAffinityQueue(EJobAffinity Affinity);
+
+    private:
+        std::vector<std::thread> Workers;
+        std::vector<Scope<FWorkerQueue>> Queues;
+        FAffinityQueue MainThreadJobs;
+        FAffinityQueue RenderThreadJobs;
+
+        // Released once per queued Any job; workers sleep on it when there is nothing to steal
+        std::counting_semaphore<> WorkAvailable{ 0 };
+        std::atomic<std::size_t> NextQueue{ 0 };
+        std::atomic<bool> bStopping{ false };
+    };
+
+    template<typename F>
+    void FJobSystem::ParallelFor(std::size_t Count, std::size_t Grain, F&& Func)
+    {
+        if (Count == 0)
+            return;
+
+        Grain = std::max<std::size_t>(Grain, 1);
+        const std::size_t ChunkCount = (Count + Grain - 1) / Grain;
+
+        // Chunks are claimed from a shared index rather than queued one by one, so a job per worker
+        // is enough and a slow chunk never holds the others back
+        std::atomic<std::size_t> NextChunk{ 0 };
+        const auto RunChunks = [&]()
+        {
+            for (std::size_t Chunk = NextChunk.fetch_add(1, std::memory_order_relaxed); Chunk < ChunkCount;
+                 Chunk = NextChunk.fetch_add(1, std::memory_order_relaxed))
+            {
+                const std::size_t End = std::min(Count, (Chunk + 1) * Grain);
+                for (std::size_t Index = Chunk * Grain; Index < End; Index++)
+                    Func(Index);
+            }
+        };
+
+        const std::size_t HelperCount = std::min(Workers.size(), ChunkCount - 1);
+        if (HelperCount == 0)
+        {
+            RunChunks();
+            return;
+        }
+
+        FJobCounter Counter;
+        for (std::size_t i = 0; i < HelperCount; i++)
+            Submit([&RunChunks]() { RunChunks(); }, &Counter);
+
+        RunChunks();
+        Wait(Counter);
+    }
+
+}
@@ -6,6 +6,12 @@
 
 namespace Core {
 
+    // Callbacks run on these threads:
+    //  - OnAttach, OnDetach: the thread pushing the layer, normally the render thread in OnStart
+    //  - OnUpdate, OnEvent: the render thread, which owns GL
+    //  - OnFixedUpdate: the simulation thread (the render thread's tick on the web)
+    //  - OnUIRender: the render thread, or the UI logic thread while frames are pipelined
+    //    (FApplicationConfig::FramePipelineDepth > 0), concurrently with OnUpdate and OnEvent
     class FLayer
     {
     public:
@@ -15,12 +21,23 @@ namespace Core {
         virtual void OnAttach() {}
         virtual void OnDetach() {}
         virtual void OnUpdate(float DeltaTime) {}
+        // Runs at FApplicationConfig::FixedUpdateRate on the simulation thread
+        virtual void OnFixedUpdate(float FixedDeltaTime) {}
         virtual void OnUIRender() {}
         virtual void OnEvent(FEvent& InEvent) {}
 
+        // True if OnUIRender shares nothing with OnUpdate and OnEvent without synchronizing it, so
+        // it may run on the UI logic thread. Frames are only pipelined when every layer agrees.
+        [[nodiscard]] virtual bool SupportsPipelinedUI() const { return false; }
+
         [[nodiscard]] const std::string& GetName() const { return DebugName; }
+
+        // EEventCategory bits this layer receives; others skip it entirely
+        [[nodiscard]] int GetEventCategoryMask() const { return EventCategoryMask; }
+        void SetEventCategoryMask(int InMask) { EventCategoryMask = InMask; }
     protected:
         std::string DebugName;
+        int EventCategoryMask = EventCategoryAll;
     };
 
 }
@@ -1,26 +1,392 @@
 #include "Log.h"
+#include "LogSink.h"
+
+#include "Core/Base/SPSCQueue.h"
+#include "Core/Memory/MemoryTracker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 namespace Core {
 
-    static std::mutex s_LogMutex;
+    namespace
+    {
+        // Messages a thread can have in flight before its overflow policy kicks in
+        constexpr std::size_t RingCapacity = 1024;
+        // The flusher wakes at least this often, and early once a ring is half full or on errors
+        constexpr std::chrono::milliseconds FlushInterval{ 5 };
+
+        struct FThreadRing
+        {
+            TSPSCQueue<FLog::FRecord, RingCapacity> Queue;
+            std::atomic<std::uint64_t> Dropped{ 0 };
+            std::uint16_t ThreadIndex = 0;
+            // Set when the owning thread exits; the flusher frees the ring once it has drained it
+            std::atomic<bool> bRetired{ false };
+        };
+
+        // Set once this thread's ring is retired; anything it logs from later thread_local
+        // destructors is written synchronously
+        thread_local bool t_bRingRetired = false;
+
+        class FLogger
+        {
+        public:
+            FLogger()
+                : StartTime(std::chrono::steady_clock::now())
+            {
+                Sinks.push_back(CreateRef<FStdoutLogSink>());
+
+                #ifndef CORE_PLATFORM_WEB
+                    bRunning.store(true, std::memory_order_release);
+                    bFlusherAlive = true;
+                    FlusherThread = std::thread([this]() { FlusherLoop(); });
+                #endif
+            }
+
+            void Submit(FLog::ELogLevel Level, std::string_view Tag, FLog::FRecord& Record)
+            {
+                Record.TimeNs = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - StartTime).count());
+                Record.Level = Level;
+                const std::size_t TagLength = std::min(Tag.size(), sizeof(Record.Tag) - 1);
+                std::memcpy(Record.Tag, Tag.data(), TagLength);
+                Record.Tag[TagLength] = '\0';
+
+                if (!bRunning.load(std::memory_order_acquire))
+                {
+                    WriteSynchronous(Record);
+                    return;
+                }
+
+                FThreadRing* ThreadRing = GetThreadRing();
+                if (!ThreadRing)
+                {
+                    WriteSynchronous(Record);
+                    return;
+                }
+
+                FThreadRing& Ring = *ThreadRing;
+                Record.ThreadIndex = Ring.ThreadIndex;
+
+                while (!Ring.Queue.Push(Record))
+                {
+                    if (Level != FLog::ELogLevel::Error && Policy.load(std::memory_order_relaxed) == FLog::EOverflowPolicy::Drop)
+                    {
+                        if (Ring.Dropped.fetch_add(1, std::memory_order_relaxed) == 0)
+                        {
+                            Wake();
+                        }
+                        delete[] Record.LongText;
+                        return;
+                    }
+
+                    Wake();
+                    std::this_thread::yield();
+
+                    if (!bRunning.load(std::memory_order_acquire))
+                    {
+                        WriteSynchronous(Record);
+                        return;
+                    }
+                }
+
+                // Only the push that reaches half capacity wakes the flusher; the timeout covers a
+                // crossing this thread did not observe
+                if (Level == FLog::ELogLevel::Error || Ring.Queue.Size() == RingCapacity / 2)
+                {
+                    Wake();
+                }
+            }
+
+            void AddSink(Ref<FLogSink> Sink)
+            {
+                std::lock_guard Lock(SinksMutex);
+                Sinks.push_back(std::move(Sink));
+            }
+
+            void RemoveSink(const Ref<FLogSink>& Sink)
+            {
+                std::lock_guard Lock(SinksMutex);
+                std::erase(Sinks, Sink);
+            }
+
+            void RemoveAllSinks()
+            {
+                std::lock_guard Lock(SinksMutex);
+                Sinks.clear();
+            }
+
+            void SetOverflowPolicy(FLog::EOverflowPolicy InPolicy)
+            {
+                Policy.store(InPolicy, std::memory_order_relaxed);
+            }
+
+            void Flush()
+            {
+                std::unique_lock Lock(WakeMutex);
+                if (!bFlusherAlive)
+                    return;
+
+                const std::uint64_t Target = ++FlushRequested;
+                bWakeRequested = true;
+                WakeCondition.notify_one();
+                FlushedCondition.wait(Lock, [&]() { return FlushCompleted >= Target || !bFlusherAlive; });
+            }
+
+            void Shutdown()
+            {
+                if (!bRunning.exchange(false, std::memory_order_acq_rel))
+                    return;
+
+                Wake();
+                FlusherThread.join();
+
+                {
+                    std::lock_guard Lock(WakeMutex);
+                    bFlusherAlive = false;
+                }
+                FlushedCondition.notify_all();
+
+                // Anything pushed while the flusher was stopping
+                Drain();
+            }
+
+        private:
+            // Null once the calling thread is exiting and its ring has been handed to the flusher
+            FThreadRing* GetThreadRing()
+            {
+                // Rings outlive their threads, since the flusher may still hold messages from them.
+                // The owner only marks its ring retired on thread exit; Drain frees it.
+                struct FRingOwner
+                {
+                    FThreadRing* Ring = nullptr;
+
+                    ~FRingOwner()
+                    {
+                        if (Ring)
+                            Ring->bRetired.store(true, std::memory_order_release);
+                        t_bRingRetired = true;
+                    }
+                };
+
+                if (t_bRingRetired)
+                    return nullptr;
+
+                thread_local FRingOwner t_Owner;
+                if (!t_Owner.Ring)
+                {
+                    std::lock_guard Lock(RingsMutex);
+                    Rings.push_back(CreateScope<FThreadRing>());
+                    t_Owner.Ring = Rings.back().get();
+                    t_Owner.Ring->ThreadIndex = NextThreadIndex++;
+                }
+                return t_Owner.Ring;
+            }
+
+            void Wake()
+            {
+                {
+                    std::lock_guard Lock(WakeMutex);
+                    bWakeRequested = true;
+                }
+                WakeCondition.notify_one();
+            }
+
+            void FlusherLoop()
+            {
+                CORE_MEMORY_TAG(Logging);
+
+                bool bStopping = false;
+                while (!bStopping)
+                {
+                    std::uint64_t FlushTarget = 0;
+                    {
+                        std::unique_lock Lock(WakeMutex);
+                        WakeCondition.wait_for(Lock, FlushInterval, [&]()
+                        {
+                            return bWakeRequested || !bRunning.load(std::memory_order_acquire);
+                        });
+                        bWakeRequested = false;
+                        FlushTarget = FlushRequested;
+                        bStopping = !bRunning.load(std::memory_order_acquire);
+                    }
+
+                    Drain();
+
+                    {
+                        std::lock_guard Lock(WakeMutex);
+                        FlushCompleted = FlushTarget;
+                    }
+                    FlushedCondition.notify_all();
+                }
+            }
+
+            // Flusher thread, or the shutting-down thread once the flusher is gone
+            void Drain()
+            {
+                Batch.clear();
+                std::uint64_t Dropped = 0;
+                std::size_t RingsWithMessages = 0;
+
+                {
+                    std::lock_guard Lock(RingsMutex);
+                    for (auto It = Rings.begin(); It != Rings.end();)
+                    {
+                        FThreadRing& Ring = **It;
+                        // Read before draining: a retired ring gets no more pushes, so this pass
+                        // empties it
+                        const bool bRetired = Ring.bRetired.load(std::memory_order_acquire);
 
-    void FLog::PrintInternal(ELogLevel Level, std::string_view Tag, std::string_view Message)
+                        const std::size_t Before = Batch.size();
+                        FLog::FRecord Record;
+                        std::size_t Remaining = Ring.Queue.Size();
+                        while (Remaining-- > 0 && Ring.Queue.Pop(Record))
+                        {
+                            Batch.push_back(Record);
+                        }
+
+                        RingsWithMessages += Batch.size() != Before;
+                        Dropped += Ring.Dropped.exchange(0, std::memory_order_relaxed);
+
+                        It = bRetired ? Rings.erase(It) : It + 1;
+                    }
+                }
+
+                // Each ring is already in order; only interleaved threads need sorting
+                if (RingsWithMessages > 1)
+                {
+                    std::stable_sort(Batch.begin(), Batch.end(), [](const FLog::FRecord& A, const FLog::FRecord& B)
+                    {
+                        return A.TimeNs < B.TimeNs;
+                    });
+                }
+
+                if (Dropped > 0)
+                {
+                    FLog::FRecord Notice;
+                    const auto Result = std::format_to_n(Notice.Text, FLog::FRecord::InlineCapacity,
+                        "{} log messages dropped, the logging threads outran the flusher", Dropped);
+                    Notice.Length = static_cast<std::uint32_t>(Result.size);
+                    Notice.TimeNs = Batch.empty() ? 0 : Batch.back().TimeNs;
+                    Notice.Level = FLog::ELogLevel::Warn;
+                    std::memcpy(Notice.Tag, "CORE", 5);
+                    Batch.push_back(Notice);
+                }
+
+                if (Batch.empty())
+                    return;
+
+                std::lock_guard Lock(SinksMutex);
+                for (FLog::FRecord& Record : Batch)
+                {
+                    for (const Ref<FLogSink>& Sink : Sinks)
+                    {
+                        Sink->Write(Record);
+                    }
+                    delete[] Record.LongText;
+                }
+
+                for (const Ref<FLogSink>& Sink : Sinks)
+                {
+                    Sink->Flush();
+                }
+            }
+
+            void WriteSynchronous(FLog::FRecord& Record)
+            {
+                std::lock_guard Lock(SinksMutex);
+                for (const Ref<FLogSink>& Sink : Sinks)
+                {
+                    Sink->Write(Record);
+                    Sink->Flush();
+                }
+                delete[] Record.LongText;
+            }
+
+        private:
+            const std::chrono::steady_clock::time_point StartTime;
+            std::atomic<FLog::EOverflowPolicy> Policy{ FLog::EOverflowPolicy::Drop };
+
+            std::mutex RingsMutex;
+            std::vector<Scope<FThreadRing>> Rings;
+            std::uint16_t NextThreadIndex = 0;
+
+            std::mutex SinksMutex;
+            std::vector<Ref<FLogSink>> Sinks;
+
+            std::atomic<bool> bRunning{ false };
+            std::thread FlusherThread;
+            std::vector<FLog::FRecord> Batch;
+
+            // Wake-ups and Flush() handshakes
+            std::mutex WakeMutex;
+            std::condition_variable WakeCondition;
+            std::condition_variable FlushedCondition;
+            bool bWakeRequested = false;
+            bool bFlusherAlive = false;
+            std::uint64_t FlushRequested = 0;
+            std::uint64_t FlushCompleted = 0;
+        };
+
+        // Never destroyed: threads may still log while statics are torn down
+        FLogger& GetLogger()
+        {
+            static FLogger* Logger = new FLogger();
+            return *Logger;
+        }
+    }
+
+    void FLog::PrintInternal(ELogLevel Level, std::string_view Tag, FRecord& Record)
+    {
+        GetLogger().Submit(Level, Tag, Record);
+    }
+
+    void FLog::AddSink(Ref<FLogSink> Sink)
+    {
+        GetLogger().AddSink(std::move(Sink));
+    }
+
+    void FLog::RemoveSink(const Ref<FLogSink>& Sink)
     {
-        std::lock_guard<std::mutex> Lock(s_LogMutex);
+        GetLogger().RemoveSink(Sink);
+    }
 
-        // ANSI Color Codes
-        const char* ColorCode = "\033[0m"; // Reset
-        const char* LevelStr = "INFO";
+    void FLog::RemoveAllSinks()
+    {
+        GetLogger().RemoveAllSinks();
+    }
 
+    void FLog::SetOverflowPolicy(EOverflowPolicy Policy)
+    {
+        GetLogger().SetOverflowPolicy(Policy);
+    }
+
+    void FLog::Flush()
+    {
+        GetLogger().Flush();
+    }
+
+    void FLog::Shutdown()
+    {
+        GetLogger().Shutdown();
+    }
+
+    const char* FLog::GetLevelName(ELogLevel Level)
+    {
         switch (Level)
         {
-            case ELogLevel::Debug: ColorCode = "\033[36m"; LevelStr = "DEBUG"; break; // Cyan
-            case ELogLevel::Warn:  ColorCode = "\033[33m"; LevelStr = "WARN "; break; // Yellow
-            case ELogLevel::Error: ColorCode = "\033[31m"; LevelStr = "ERROR"; break; // Red
+            case ELogLevel::Debug: return "DEBUG";
+            case ELogLevel::Warn:  return "WARN";
+            case ELogLevel::Error: return "ERROR";
         }
-
-        std::println(stdout, "{}[{}] {}: {}{}", ColorCode, Tag, LevelStr, Message, "\033[0m");
+        return "INFO";
     }
 
 }
@@ -1,33 +1,84 @@
 #pragma once
 
+#include "Core/Base/Core.h"
+
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <format>
-#include <print> // IWYU pragma: keep  
+
+// Debug and CoreDebug compile to nothing when CORE_LOG_STRIP_DEBUG is defined
+#ifdef CORE_LOG_STRIP_DEBUG
+    #define CORE_LOG_DEBUG_ENABLED 0
+#else
+    #define CORE_LOG_DEBUG_ENABLED 1
+#endif
 
 namespace Core
 {
 
+    class FLogSink;
+
+    // Asynchronous logger. The calling thread formats the message into its own lock-free ring and
+    // returns; a background thread merges the rings in timestamp order and writes every sink.
+    // The web build has no threads and writes to the sinks directly.
     class FLog
     {
     public:
-        enum class ELogLevel
+        enum class ELogLevel : std::uint8_t
         {
             Debug = 0, Warn, Error
         };
 
+        // What a thread does when its ring is full. Errors always block.
+        enum class EOverflowPolicy : std::uint8_t
+        {
+            Drop,   // Discard the message; the flusher reports how many were lost
+            Block   // Wait for the flusher to make room
+        };
+
+        // One message as it travels from the logging thread to the sinks. Messages that do not fit
+        // Text are moved to the heap and freed by the flusher.
+        struct FRecord
+        {
+            static constexpr std::size_t InlineCapacity = 200;
+
+            std::uint64_t TimeNs = 0;       // Since the logger started
+            char* LongText = nullptr;       // Owned; set instead of Text for long messages
+            std::uint32_t Length = 0;
+            std::uint16_t ThreadIndex = 0;  // In order of each thread's first message
+            ELogLevel Level = ELogLevel::Debug;
+            char Tag[8] = {};
+            char Text[InlineCapacity];
+
+            [[nodiscard]] std::string_view GetText() const { return { LongText ? LongText : Text, Length }; }
+            [[nodiscard]] std::string_view GetTag() const { return { Tag, std::char_traits<char>::length(Tag) }; }
+        };
+
     public:
         template<typename... Args>
         static void PrintMessage(ELogLevel Level, std::string_view Tag, std::format_string<Args...> Fmt, Args&&... args)
         {
-            std::string Message = std::format(Fmt, std::forward<Args>(args)...);
-            PrintInternal(Level, Tag, Message);
+            FRecord Record;
+            const auto Result = std::format_to_n(Record.Text, FRecord::InlineCapacity, Fmt, std::forward<Args>(args)...);
+            Record.Length = static_cast<std::uint32_t>(Result.size);
+            if (static_cast<std::size_t>(Result.size) > FRecord::InlineCapacity)
+            {
+                // Rare; formatting twice keeps the common path free of allocations. Formatting only
+                // reads the arguments, so forwarding them a second time is safe.
+                Record.LongText = new char[Record.Length];
+                std::format_to(Record.LongText, Fmt, std::forward<Args>(args)...);
+            }
+            PrintInternal(Level, Tag, Record);
         }
 
         // Template API
         template<typename... Args>
-        static void Debug(std::format_string<Args...> Fmt, Args&&... args)
+        static void Debug([[maybe_unused]] std::format_string<Args...> Fmt, [[maybe_unused]] Args&&... args)
         {
-            PrintMessage(ELogLevel::Debug, "APP", Fmt, std::forward<Args>(args)...);
+            #if CORE_LOG_DEBUG_ENABLED
+                PrintMessage(ELogLevel::Debug, "APP", Fmt, std::forward<Args>(args)...);
+            #endif
         }
 
         template<typename... Args>
@@ -44,11 +95,13 @@ namespace Core
 
         // Core variants
         template<typename... Args>
-        static void CoreDebug(std::format_string<Args...> Fmt, Args&&... args)
+        static void CoreDebug([[maybe_unused]] std::format_string<Args...> Fmt, [[maybe_unused]] Args&&... args)
         {
-            PrintMessage(ELogLevel::Debug, "CORE", Fmt, std::forward<Args>(args)...);
+            #if CORE_LOG_DEBUG_ENABLED
+                PrintMessage(ELogLevel::Debug, "CORE", Fmt, std::forward<Args>(args)...);
+            #endif
         }
-        
+
         template<typename... Args>
         static void CoreWarn(std::format_string<Args...> Fmt, Args&&... args)
         {
@@ -61,8 +114,24 @@ namespace Core
             PrintMessage(ELogLevel::Error, "CORE", Fmt, std::forward<Args>(args)...);
         }
 
+        // Sinks receive every message from the flusher thread, in timestamp order. A stdout sink is
+        // installed by default.
+        static void AddSink(Ref<FLogSink> Sink);
+        static void RemoveSink(const Ref<FLogSink>& Sink);
+        // The default stdout sink included
+        static void RemoveAllSinks();
+
+        static void SetOverflowPolicy(EOverflowPolicy Policy);
+
+        // Blocks until everything logged before the call has reached the sinks
+        static void Flush();
+        // Flushes and stops the flusher thread; later messages are written synchronously
+        static void Shutdown();
+
+        [[nodiscard]] static const char* GetLevelName(ELogLevel Level);
+
     private:
-        static void PrintInternal(ELogLevel Level, std::string_view Tag, std::string_view Message);
+        static void PrintInternal(ELogLevel Level, std::string_view Tag, FRecord& Record);
     };
 
 }
@@ -0,0 +1,144 @@
+#include "LogConsoleLayer.h"
+
+#include "Core/Profiling/Profiler.h"
+
+#include <algorithm>
+
+namespace Core
+{
+
+    FLogConsoleLayer::FLogConsoleLayer()
+        : FLayer("Console"), Sink(CreateRef<FConsoleLogSink>())
+    {
+        // The panel reacts to nothing but ImGui input
+        SetEventCategoryMask(0);
+    }
+
+    void FLogConsoleLayer::OnAttach()
+    {
+        FLog::AddSink(Sink);
+    }
+
+    void FLogConsoleLayer::OnDetach()
+    {
+        FLog::RemoveSink(Sink);
+    }
+
+    void FLogConsoleLayer::OnUIRender()
+    {
+        CORE_PROFILE_FUNCTION();
+
+        if (!ImGui::Begin("Console"))
+        {
+            ImGui::End();
+            return;
+        }
+
+        bool bFilterChanged = false;
+        bFilterChanged |= ImGui::Checkbox("Debug", &bShowDebug);
+        ImGui::SameLine();
+        bFilterChanged |= ImGui::Checkbox("Warn", &bShowWarn);
+        ImGui::SameLine();
+        bFilterChanged |= ImGui::Checkbox("Error", &bShowError);
+        ImGui::SameLine();
+        ImGui::Checkbox("Auto-scroll", &bAutoScroll);
+        ImGui::SameLine();
+        if (ImGui::Button("Clear"))
+        {
+            Sink->Clear();
+        }
+        bFilterChanged |= Filter.Draw("Filter", -FLT_MIN);
+
+        if (bFilterChanged)
+        {
+            Matches.clear();
+            ScannedUpTo = 0;
+        }
+        const bool bFiltered = Filter.IsActive() || !(bShowDebug && bShowWarn && bShowError);
+
+        ImGui::Separator();
+        if (ImGui::BeginChild("Lines", ImVec2(0.0f, 0.0f), ImGuiChildFlags_None, ImGuiWindowFlags_HorizontalScrollbar))
+        {
+            Sink->Read([&](const std::vector<FConsoleLogSink::FLine>& Lines, const std::vector<char>& Text, std::uint64_t FirstLine)
+            {
+                if (bFiltered)
+                {
+                    UpdateMatches(Lines, Text, FirstLine);
+                }
+
+                const std::size_t Count = bFiltered ? Matches.size() : Lines.size();
+                ImGuiListClipper Clipper;
+                Clipper.Begin(static_cast<int>(Count));
+                while (Clipper.Step())
+                {
+                    for (int Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; Row++)
+                    {
+                        const std::size_t Index = bFiltered ? static_cast<std::size_t>(Matches[Row] - FirstLine) : static_cast<std::size_t>(Row);
+                        DrawLine(Lines[Index], Text);
+                    }
+                }
+                Clipper.End();
+            });
+
+            // Follow new lines only while already at the bottom
+            if (bAutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+            {
+                ImGui::SetScrollHereY(1.0f);
+            }
+        }
+        ImGui::EndChild();
+
+        ImGui::End();
+    }
+
+    void FLogConsoleLayer::UpdateMatches(const std::vector<FConsoleLogSink::FLine>& Lines, const std::vector<char>& Text, std::uint64_t FirstLine)
+    {
+        // Forget lines the sink has discarded since the last frame
+        Matches.erase(Matches.begin(), std::lower_bound(Matches.begin(), Matches.end(), FirstLine));
+
+        const std::uint64_t Begin = std::max(ScannedUpTo, FirstLine);
+        const std::uint64_t End = std::min<std::uint64_t>(FirstLine + Lines.size(), Begin + ScanBudget);
+        for (std::uint64_t LineNumber = Begin; LineNumber < End; LineNumber++)
+        {
+            if (PassesFilter(Lines[static_cast<std::size_t>(LineNumber - FirstLine)], Text))
+            {
+                Matches.push_back(LineNumber);
+            }
+        }
+        ScannedUpTo = End;
+    }
+
+    bool FLogConsoleLayer::PassesFilter(const FConsoleLogSink::FLine& Line, const std::vector<char>& Text) const
+    {
+        switch (Line.Level)
+        {
+            case FLog::ELogLevel::Debug: if (!bShowDebug) return false; break;
+            case FLog::ELogLevel::Warn:  if (!bShowWarn) return false; break;
+            case FLog::ELogLevel::Error: if (!bShowError) return false; break;
+        }
+
+        const char* Begin = Text.data() + Line.Offset;
+        return Filter.PassFilter(Begin, Begin + Line.Length);
+    }
+
+    void FLogConsoleLayer::DrawLine(const FConsoleLogSink::FLine& Line, const std::vector<char>& Text) const
+    {
+        ImVec4 Color = ImGui::GetStyleColorVec4(ImGuiCol_Text);
+        switch (Line.Level)
+        {
+            case FLog::ELogLevel::Debug: break;
+            case FLog::ELogLevel::Warn:  Color = ImVec4(1.0f, 0.8f, 0.3f, 1.0f); break;
+            case FLog::ELogLevel::Error: Color = ImVec4(1.0f, 0.4f, 0.4f, 1.0f); break;
+        }
+
+        ImGui::TextDisabled("[%9.3f] [%s] %-5s", static_cast<double>(Line.TimeNs) / 1.0e9,
+            Line.bCore ? "CORE" : "APP", FLog::GetLevelName(Line.Level));
+        ImGui::SameLine();
+
+        const char* Begin = Text.data() + Line.Offset;
+        ImGui::PushStyleColor(ImGuiCol_Text, Color);
+        ImGui::TextUnformatted(Begin, Begin + Line.Length);
+        ImGui::PopStyleColor();
+    }
+
+}
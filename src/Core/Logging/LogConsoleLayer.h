@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Core/Layers/Layer.h"
+#include "LogSink.h"
+
+#include "imgui.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Core
+{
+
+    // "Console" panel: every log message since startup with level and text filters. Only the
+    // visible rows are drawn, and filtering runs incrementally, so millions of lines stay cheap.
+    // Pushed as an overlay by FApplication when FApplicationConfig::bConsolePanel is set.
+    class FLogConsoleLayer : public FLayer
+    {
+    public:
+        FLogConsoleLayer();
+
+        void OnAttach() override;
+        void OnDetach() override;
+        void OnUIRender() override;
+        // The sink is read under its own lock
+        [[nodiscard]] bool SupportsPipelinedUI() const override { return true; }
+
+    private:
+        // Extends Matches with the lines written since the last frame, at most ScanBudget of them
+        void UpdateMatches(const std::vector<FConsoleLogSink::FLine>& Lines, const std::vector<char>& Text, std::uint64_t FirstLine);
+        [[nodiscard]] bool PassesFilter(const FConsoleLogSink::FLine& Line, const std::vector<char>& Text) const;
+        void DrawLine(const FConsoleLogSink::FLine& Line, const std::vector<char>& Text) const;
+
+    private:
+        static constexpr std::size_t ScanBudget = 256 * 1024;
+
+        Ref<FConsoleLogSink> Sink;
+
+        ImGuiTextFilter Filter;
+        bool bShowDebug = true;
+        bool bShowWarn = true;
+        bool bShowError = true;
+        bool bAutoScroll = true;
+
+        // Absolute numbers of the lines passing the filter, and how far the scan has come.
+        // Unused while nothing is filtered out.
+        std::vector<std::uint64_t> Matches;
+        std::uint64_t ScannedUpTo = 0;
+    };
+
+}
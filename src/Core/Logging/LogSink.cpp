@@ -0,0 +1,167 @@
+#include "LogSink.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <string_view>
+#include <system_error>
+
+namespace Core {
+
+    void FStdoutLogSink::Write(const FLog::FRecord& Record)
+    {
+        // ANSI Color Codes
+        const char* ColorCode = "\033[0m"; // Reset
+        const char* LevelStr = "INFO";
+
+        switch (Record.Level)
+        {
+            case FLog::ELogLevel::Debug: ColorCode = "\033[36m"; LevelStr = "DEBUG"; break; // Cyan
+            case FLog::ELogLevel::Warn:  ColorCode = "\033[33m"; LevelStr = "WARN "; break; // Yellow
+            case FLog::ELogLevel::Error: ColorCode = "\033[31m"; LevelStr = "ERROR"; break; // Red
+        }
+
+        Line.clear();
+        std::format_to(std::back_inserter(Line), "{}[{}] {}: {}{}\n", ColorCode, Record.GetTag(), LevelStr, Record.GetText(), "\033[0m");
+        std::fwrite(Line.data(), 1, Line.size(), stdout);
+    }
+
+    void FStdoutLogSink::Flush()
+    {
+        std::fflush(stdout);
+    }
+
+    FRotatingFileLogSink::FRotatingFileLogSink(std::string InPath, std::size_t InMaxBytes, int InMaxFiles)
+        : Path(std::move(InPath)), MaxBytes(InMaxBytes), MaxFiles(std::max(InMaxFiles, 1))
+    {
+        // Every run starts a fresh file; the previous one becomes Path.1
+        Rotate();
+    }
+
+    FRotatingFileLogSink::~FRotatingFileLogSink()
+    {
+        if (File)
+        {
+            std::fclose(File);
+        }
+    }
+
+    void FRotatingFileLogSink::Write(const FLog::FRecord& Record)
+    {
+        if (!File)
+            return;
+
+        Line.clear();
+        std::format_to(std::back_inserter(Line), "[{:10.3f}] [T{:<2}] [{}] {}: {}\n",
+            static_cast<double>(Record.TimeNs) / 1.0e9, Record.ThreadIndex, Record.GetTag(),
+            FLog::GetLevelName(Record.Level), Record.GetText());
+
+        std::fwrite(Line.data(), 1, Line.size(), File);
+        BytesWritten += Line.size();
+
+        if (BytesWritten >= MaxBytes)
+        {
+            Rotate();
+        }
+    }
+
+    void FRotatingFileLogSink::Flush()
+    {
+        if (File)
+        {
+            std::fflush(File);
+        }
+    }
+
+    void FRotatingFileLogSink::Rotate()
+    {
+        if (File)
+        {
+            std::fclose(File);
+            File = nullptr;
+        }
+
+        // Path.N-1 -> Path.N, ..., Path -> Path.1; the oldest file is overwritten
+        std::error_code Error;
+        for (int Index = MaxFiles - 1; Index >= 0; Index--)
+        {
+            const std::string From = Index == 0 ? Path : std::format("{}.{}", Path, Index);
+            const std::string To = std::format("{}.{}", Path, Index + 1);
+            if (std::filesystem::exists(From, Error))
+            {
+                std::filesystem::rename(From, To, Error);
+            }
+        }
+
+        File = std::fopen(Path.c_str(), "wb");
+        BytesWritten = 0;
+    }
+
+    FConsoleLogSink::FConsoleLogSink(std::size_t InMaxLines, std::size_t InMaxBytes)
+        : MaxLines(std::max<std::size_t>(InMaxLines, 2)),
+          MaxBytes(std::min<std::size_t>(InMaxBytes, UINT32_MAX))
+    {
+    }
+
+    void FConsoleLogSink::Write(const FLog::FRecord& Record)
+    {
+        const bool bCore = Record.GetTag() == "CORE";
+        std::string_view Remaining = Record.GetText();
+
+        std::lock_guard Lock(Mutex);
+
+        // One entry per text line keeps every row the same height for the list clipper
+        do
+        {
+            const std::size_t LineEnd = std::min(Remaining.find('\n'), Remaining.size());
+            const std::string_view Message = Remaining.substr(0, std::min(LineEnd, MaxBytes / 2));
+            Remaining.remove_prefix(std::min(LineEnd + 1, Remaining.size()));
+
+            while (!Lines.empty() && (Lines.size() >= MaxLines || Text.size() + Message.size() > MaxBytes))
+            {
+                DiscardOldest();
+            }
+
+            Lines.push_back({
+                Record.TimeNs,
+                static_cast<std::uint32_t>(Text.size()),
+                static_cast<std::uint32_t>(Message.size()),
+                Record.Level,
+                bCore
+            });
+            Text.insert(Text.end(), Message.begin(), Message.end());
+        }
+        while (!Remaining.empty());
+    }
+
+    void FConsoleLogSink::Clear()
+    {
+        std::lock_guard Lock(Mutex);
+        DiscardedLines += Lines.size();
+        Lines.clear();
+        Text.clear();
+    }
+
+    void FConsoleLogSink::DiscardOldest()
+    {
+        const std::size_t Count = Lines.size() / 2;
+        if (Count == 0)
+        {
+            DiscardedLines += Lines.size();
+            Lines.clear();
+            Text.clear();
+            return;
+        }
+
+        const std::uint32_t TextStart = Lines[Count].Offset;
+        Lines.erase(Lines.begin(), Lines.begin() + static_cast<std::ptrdiff_t>(Count));
+        Text.erase(Text.begin(), Text.begin() + TextStart);
+        for (FLine& Line : Lines)
+        {
+            Line.Offset -= TextStart;
+        }
+        DiscardedLines += Count;
+    }
+
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Log.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Core
+{
+
+    // Destination of log messages. Write and Flush are only called from the flusher thread
+    // (or under the logger's lock once it is shut down), so sinks need no locking of their own
+    // unless other threads read their state.
+    class FLogSink
+    {
+    public:
+        virtual ~FLogSink() = default;
+
+        virtual void Write(const FLog::FRecord& Record) = 0;
+        // End of a batch
+        virtual void Flush() {}
+    };
+
+    // Colored "[TAG] LEVEL: message" lines on stdout
+    class FStdoutLogSink : public FLogSink
+    {
+    public:
+        void Write(const FLog::FRecord& Record) override;
+        void Flush() override;
+
+    private:
+        std::string Line;
+    };
+
+    // Plain text file that is renamed to Path.1 (shifting older files up to Path.MaxFiles) once it
+    // grows past MaxBytes
+    class FRotatingFileLogSink : public FLogSink
+    {
+    public:
+        FRotatingFileLogSink(std::string InPath, std::size_t InMaxBytes = 5 * 1024 * 1024, int InMaxFiles = 3);
+        ~FRotatingFileLogSink() override;
+
+        void Write(const FLog::FRecord& Record) override;
+        void Flush() override;
+
+    private:
+        void Rotate();
+
+    private:
+        std::string Path;
+        std::size_t MaxBytes;
+        int MaxFiles;
+
+        std::FILE* File = nullptr;
+        std::size_t BytesWritten = 0;
+        std::string Line;
+    };
+
+    // Keeps messages in memory for the Console panel. Text lives in one contiguous buffer so
+    // millions of lines cost little more than their characters.
+    class FConsoleLogSink : public FLogSink
+    {
+    public:
+        struct FLine
+        {
+            std::uint64_t TimeNs;
+            std::uint32_t Offset;
+            std::uint32_t Length;
+            FLog::ELogLevel Level;
+            bool bCore;         // Tagged CORE rather than APP
+        };
+
+        // When either limit is reached the oldest half of the lines is discarded
+        explicit FConsoleLogSink(std::size_t InMaxLines = 4 * 1024 * 1024, std::size_t InMaxBytes = 256 * 1024 * 1024);
+
+        void Write(const FLog::FRecord& Record) override;
+
+        void Clear();
+
+        // Calls Func(Lines, Text, FirstLineNumber) with the buffer locked. FirstLineNumber counts
+        // every line ever written, so readers can tell which of their indices were discarded.
+        template<typename F>
+        void Read(F&& Func) const
+        {
+            std::lock_guard Lock(Mutex);
+            Func(Lines, Text, DiscardedLines);
+        }
+
+    private:
+        void DiscardOldest();
+
+    private:
+        std::size_t MaxLines;
+        std::size_t MaxBytes;
+
+        mutable std::mutex Mutex;
+        std::vector<FLine> Lines;
+        std::vector<char> Text;
+        std::uint64_t DiscardedLines = 0;
+    };
+
+}
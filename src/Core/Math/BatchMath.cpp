@@ -0,0 +1,290 @@
+#include "BatchMath.h"
+#include "SimdLane.h"
+#include "Core/Logging/Log.h"
+
+#include <cmath>
+#include <type_traits>
+
+namespace Core::Math
+{
+
+    namespace
+    {
+        using Detail::FScalarLane;
+        using Detail::FSimdLane;
+
+        // Calls Body(std::type_identity<Lane>, Index) over full registers, then one element at a
+        // time for the remainder, so every kernel has a single body for both
+        template<typename FBody>
+        void ForEachLane(std::size_t Count, FBody&& Body)
+        {
+            std::size_t Index = 0;
+            for (; Index + FSimdLane::Width <= Count; Index += FSimdLane::Width)
+            {
+                Body(std::type_identity<FSimdLane>{}, Index);
+            }
+            for (; Index < Count; ++Index)
+            {
+                Body(std::type_identity<FScalarLane>{}, Index);
+            }
+        }
+
+        // raylib's Matrix declares its fields row by row
+        constexpr float Matrix::* MatrixElements[16] =
+        {
+            &Matrix::m0, &Matrix::m1, &Matrix::m2, &Matrix::m3,
+            &Matrix::m4, &Matrix::m5, &Matrix::m6, &Matrix::m7,
+            &Matrix::m8, &Matrix::m9, &Matrix::m10, &Matrix::m11,
+            &Matrix::m12, &Matrix::m13, &Matrix::m14, &Matrix::m15
+        };
+
+        // raymath's EPSILON
+        constexpr float SlerpEpsilon = 0.000001f;
+    }
+
+    void FMatrixStream::Set(std::size_t Index, const Matrix& Value)
+    {
+        for (int Element = 0; Element < 16; ++Element)
+        {
+            M[Element][Index] = Value.*MatrixElements[Element];
+        }
+    }
+
+    Matrix FMatrixStream::Get(std::size_t Index) const
+    {
+        Matrix Value;
+        for (int Element = 0; Element < 16; ++Element)
+        {
+            Value.*MatrixElements[Element] = M[Element][Index];
+        }
+        return Value;
+    }
+
+    void TransformPoints(const Matrix& Transform, const FVector3Stream& In, FVector3Stream& Out)
+    {
+        const std::size_t Count = In.Size();
+        Out.Resize(Count);
+
+        // A local copy can't alias the output, so the compiler may keep it in registers
+        const Matrix M = Transform;
+
+        ForEachLane(Count, [&](auto Tag, std::size_t Index)
+        {
+            using L = typename decltype(Tag)::type;
+
+            const L X = L::Load(In.X.data() + Index);
+            const L Y = L::Load(In.Y.data() + Index);
+            const L Z = L::Load(In.Z.data() + Index);
+
+            L::Store(Out.X.data() + Index, L::Set(M.m0) * X + L::Set(M.m4) * Y + L::Set(M.m8) * Z + L::Set(M.m12));
+            L::Store(Out.Y.data() + Index, L::Set(M.m1) * X + L::Set(M.m5) * Y + L::Set(M.m9) * Z + L::Set(M.m13));
+            L::Store(Out.Z.data() + Index, L::Set(M.m2) * X + L::Set(M.m6) * Y + L::Set(M.m10) * Z + L::Set(M.m14));
+        });
+    }
+
+    void MultiplyMatrices(const FMatrixStream& Left, const FMatrixStream& Right, FMatrixStream& Out)
+    {
+        CORE_ASSERT(Left.Size() == Right.Size(), "MultiplyMatrices needs streams of the same size");
+
+        const std::size_t Count = Left.Size();
+        Out.Resize(Count);
+
+        ForEachLane(Count, [&](auto Tag, std::size_t Index)
+        {
+            using L = typename decltype(Tag)::type;
+
+            const auto Load = [Index](const FFloatStream& Stream) { return L::Load(Stream.data() + Index); };
+            const L B0 = Load(Right.M[0]), B1 = Load(Right.M[1]), B2 = Load(Right.M[2]), B3 = Load(Right.M[3]);
+            const L B4 = Load(Right.M[4]), B5 = Load(Right.M[5]), B6 = Load(Right.M[6]), B7 = Load(Right.M[7]);
+            const L B8 = Load(Right.M[8]), B9 = Load(Right.M[9]), B10 = Load(Right.M[10]), B11 = Load(Right.M[11]);
+            const L B12 = Load(Right.M[12]), B13 = Load(Right.M[13]), B14 = Load(Right.M[14]), B15 = Load(Right.M[15]);
+
+            // Spelled out like raymath, as loops over arrays of registers don't reliably stay in
+            // registers. Each group of four outputs only reads its own four elements of Left, so
+            // Out may alias Left; Right is fully loaded above.
+            for (int Row = 0; Row < 16; Row += 4)
+            {
+                const L A0 = Load(Left.M[Row]), A1 = Load(Left.M[Row + 1]), A2 = Load(Left.M[Row + 2]), A3 = Load(Left.M[Row + 3]);
+                L::Store(Out.M[Row].data() + Index, A0 * B0 + A1 * B4 + A2 * B8 + A3 * B12);
+                L::Store(Out.M[Row + 1].data() + Index, A0 * B1 + A1 * B5 + A2 * B9 + A3 * B13);
+                L::Store(Out.M[Row + 2].data() + Index, A0 * B2 + A1 * B6 + A2 * B10 + A3 * B14);
+                L::Store(Out.M[Row + 3].data() + Index, A0 * B3 + A1 * B7 + A2 * B11 + A3 * B15);
+            }
+        });
+    }
+
+    void Normalize(const FVector3Stream& In, FVector3Stream& Out)
+    {
+        const std::size_t Count = In.Size();
+        Out.Resize(Count);
+
+        ForEachLane(Count, [&](auto Tag, std::size_t Index)
+        {
+            using L = typename decltype(Tag)::type;
+
+            const L X = L::Load(In.X.data() + Index);
+            const L Y = L::Load(In.Y.data() + Index);
+            const L Z = L::Load(In.Z.data() + Index);
+
+            const L Length = L::Sqrt(X * X + Y * Y + Z * Z);
+            const L InverseLength = L::Set(1.0f) / Length;
+            // Zero-length vectors are returned unchanged
+            const typename L::FMask HasLength = L::NotEqual(Length, L::Set(0.0f));
+
+            L::Store(Out.X.data() + Index, L::Select(HasLength, X * InverseLength, X));
+            L::Store(Out.Y.data() + Index, L::Select(HasLength, Y * InverseLength, Y));
+            L::Store(Out.Z.data() + Index, L::Select(HasLength, Z * InverseLength, Z));
+        });
+    }
+
+    void Lerp(const FVector3Stream& A, const FVector3Stream& B, float Amount, FVector3Stream& Out)
+    {
+        CORE_ASSERT(A.Size() == B.Size(), "Lerp needs streams of the same size");
+
+        const std::size_t Count = A.Size();
+        Out.Resize(Count);
+
+        ForEachLane(Count, [&](auto Tag, std::size_t Index)
+        {
+            using L = typename decltype(Tag)::type;
+            const L T = L::Set(Amount);
+
+            const L AX = L::Load(A.X.data() + Index);
+            const L AY = L::Load(A.Y.data() + Index);
+            const L AZ = L::Load(A.Z.data() + Index);
+
+            L::Store(Out.X.data() + Index, AX + T * (L::Load(B.X.data() + Index) - AX));
+            L::Store(Out.Y.data() + Index, AY + T * (L::Load(B.Y.data() + Index) - AY));
+            L::Store(Out.Z.data() + Index, AZ + T * (L::Load(B.Z.data() + Index) - AZ));
+        });
+    }
+
+    void Slerp(const FQuaternionStream& A, const FQuaternionStream& B, float Amount, FQuaternionStream& Out)
+    {
+        CORE_ASSERT(A.Size() == B.Size(), "Slerp needs streams of the same size");
+
+        const std::size_t Count = A.Size();
+        Out.Resize(Count);
+
+        ForEachLane(Count, [&](auto Tag, std::size_t Index)
+        {
+            using L = typename decltype(Tag)::type;
+            const L T = L::Set(Amount);
+            const L Zero = L::Set(0.0f);
+            const L One = L::Set(1.0f);
+
+            const L AX = L::Load(A.X.data() + Index);
+            const L AY = L::Load(A.Y.data() + Index);
+            const L AZ = L::Load(A.Z.data() + Index);
+            const L AW = L::Load(A.W.data() + Index);
+            L BX = L::Load(B.X.data() + Index);
+            L BY = L::Load(B.Y.data() + Index);
+            L BZ = L::Load(B.Z.data() + Index);
+            L BW = L::Load(B.W.data() + Index);
+
+            // Take the short way around
+            L CosHalfTheta = AX * BX + AY * BY + AZ * BZ + AW * BW;
+            const typename L::FMask Flip = L::Less(CosHalfTheta, Zero);
+            BX = L::Select(Flip, L::Negate(BX), BX);
+            BY = L::Select(Flip, L::Negate(BY), BY);
+            BZ = L::Select(Flip, L::Negate(BZ), BZ);
+            BW = L::Select(Flip, L::Negate(BW), BW);
+            CosHalfTheta = L::Select(Flip, L::Negate(CosHalfTheta), CosHalfTheta);
+
+            // Nearly parallel: normalized lerp
+            const L LX = AX + T * (BX - AX);
+            const L LY = AY + T * (BY - AY);
+            const L LZ = AZ + T * (BZ - AZ);
+            const L LW = AW + T * (BW - AW);
+            L Length = L::Sqrt(LX * LX + LY * LY + LZ * LZ + LW * LW);
+            Length = L::Select(L::NotEqual(Length, Zero), Length, One);
+            const L InverseLength = One / Length;
+
+            // General case; the transcendental terms go one lane at a time
+            const L SinHalfTheta = L::Sqrt(One - CosHalfTheta * CosHalfTheta);
+            alignas(32) float Cosines[L::Width];
+            alignas(32) float Sines[L::Width];
+            alignas(32) float RatiosA[L::Width];
+            alignas(32) float RatiosB[L::Width];
+            L::Store(Cosines, CosHalfTheta);
+            L::Store(Sines, SinHalfTheta);
+            for (std::size_t Lane = 0; Lane < L::Width; ++Lane)
+            {
+                const float HalfTheta = std::acos(Cosines[Lane]);
+                RatiosA[Lane] = std::sin((1 - Amount) * HalfTheta) / Sines[Lane];
+                RatiosB[Lane] = std::sin(Amount * HalfTheta) / Sines[Lane];
+            }
+            const L RatioA = L::Load(RatiosA);
+            const L RatioB = L::Load(RatiosB);
+
+            const L Half = L::Set(0.5f);
+            const typename L::FMask Identical = L::GreaterEqual(L::Abs(CosHalfTheta), One);
+            const typename L::FMask Close = L::Greater(CosHalfTheta, L::Set(0.95f));
+            const typename L::FMask Opposite = L::Less(L::Abs(SinHalfTheta), L::Set(SlerpEpsilon));
+
+            const auto Combine = [&](L QA, L QB, L QLerp)
+            {
+                const L General = L::Select(Opposite, QA * Half + QB * Half, QA * RatioA + QB * RatioB);
+                return L::Select(Identical, QA, L::Select(Close, QLerp * InverseLength, General));
+            };
+            L::Store(Out.X.data() + Index, Combine(AX, BX, LX));
+            L::Store(Out.Y.data() + Index, Combine(AY, BY, LY));
+            L::Store(Out.Z.data() + Index, Combine(AZ, BZ, LZ));
+            L::Store(Out.W.data() + Index, Combine(AW, BW, LW));
+        });
+    }
+
+    void TransformBoxes(const Matrix& Transform, const FBoxStream& In, FBoxStream& Out)
+    {
+        const std::size_t Count = In.Size();
+        Out.Resize(Count);
+
+        // Coefficients of each output axis, and its translation
+        const float Rows[3][4] =
+        {
+            { Transform.m0, Transform.m4, Transform.m8, Transform.m12 },
+            { Transform.m1, Transform.m5, Transform.m9, Transform.m13 },
+            { Transform.m2, Transform.m6, Transform.m10, Transform.m14 }
+        };
+
+        ForEachLane(Count, [&](auto Tag, std::size_t Index)
+        {
+            using L = typename decltype(Tag)::type;
+
+            const L Min[3] = { L::Load(In.Min.X.data() + Index), L::Load(In.Min.Y.data() + Index), L::Load(In.Min.Z.data() + Index) };
+            const L Max[3] = { L::Load(In.Max.X.data() + Index), L::Load(In.Max.Y.data() + Index), L::Load(In.Max.Z.data() + Index) };
+            float* const OutMin[3] = { Out.Min.X.data() + Index, Out.Min.Y.data() + Index, Out.Min.Z.data() + Index };
+            float* const OutMax[3] = { Out.Max.X.data() + Index, Out.Max.Y.data() + Index, Out.Max.Z.data() + Index };
+
+            // Each output axis gets the smaller and larger end of every input axis' contribution
+            L NewMin[3];
+            L NewMax[3];
+            for (int Axis = 0; Axis < 3; ++Axis)
+            {
+                NewMin[Axis] = L::Set(Rows[Axis][3]);
+                NewMax[Axis] = NewMin[Axis];
+                for (int Input = 0; Input < 3; ++Input)
+                {
+                    const L Coefficient = L::Set(Rows[Axis][Input]);
+                    const L FromMin = Coefficient * Min[Input];
+                    const L FromMax = Coefficient * Max[Input];
+                    NewMin[Axis] = NewMin[Axis] + L::Min(FromMin, FromMax);
+                    NewMax[Axis] = NewMax[Axis] + L::Max(FromMin, FromMax);
+                }
+            }
+
+            // Stored only once everything is loaded, so Out may alias In
+            for (int Axis = 0; Axis < 3; ++Axis)
+            {
+                L::Store(OutMin[Axis], NewMin[Axis]);
+                L::Store(OutMax[Axis], NewMax[Axis]);
+            }
+        });
+    }
+
+    const char* GetSimdBackendName()
+    {
+        return FSimdLane::Name;
+    }
+
+}
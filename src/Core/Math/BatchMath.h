@@ -0,0 +1,38 @@
+#pragma once
+
+#include "MathStreams.h"
+
+#include "raylib.h"
+
+namespace Core::Math
+{
+
+    // Batch versions of raymath functions over structure-of-arrays streams, vectorized with the
+    // backend picked at compile time (see SimdLane.h). Each kernel resizes Out to the input size,
+    // and Out may be one of the inputs.
+    //
+    // Results match raymath bit for bit: the kernels perform the same IEEE operations in the same
+    // order, without fused multiply-adds or reciprocal estimates. The exceptions are
+    // TransformBoxes, which has no raymath counterpart, and builds that let the compiler
+    // contract raymath's own scalar code into FMAs (e.g. -mfma with -ffp-contract=fast), where
+    // raymath itself drifts by an ulp or so.
+
+    // Vector3Transform for every point
+    void TransformPoints(const Matrix& Transform, const FVector3Stream& In, FVector3Stream& Out);
+    // MatrixMultiply(Left[i], Right[i]) for every i; both streams must be the same size
+    void MultiplyMatrices(const FMatrixStream& Left, const FMatrixStream& Right, FMatrixStream& Out);
+    // Vector3Normalize for every vector
+    void Normalize(const FVector3Stream& In, FVector3Stream& Out);
+    // Vector3Lerp(A[i], B[i], Amount) for every i
+    void Lerp(const FVector3Stream& A, const FVector3Stream& B, float Amount, FVector3Stream& Out);
+    // QuaternionSlerp(A[i], B[i], Amount) for every i. The acos and sin terms are evaluated one
+    // lane at a time with the C library, like raymath does, so only the rest is vectorized.
+    void Slerp(const FQuaternionStream& A, const FQuaternionStream& B, float Amount, FQuaternionStream& Out);
+    // The axis-aligned bounds of every box after Transform (Arvo's method). Equal to the bounds
+    // of the eight Vector3Transform'ed corners up to rounding.
+    void TransformBoxes(const Matrix& Transform, const FBoxStream& In, FBoxStream& Out);
+
+    // "AVX2", "SSE4.1", "SSE2", "NEON", "WASM SIMD128" or "Scalar"
+    [[nodiscard]] const char* GetSimdBackendName();
+
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+#include "Core/Memory/AlignedAllocator.h"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "raylib.h"
+
+namespace Core::Math
+{
+
+    // Batches of raymath values in structure-of-arrays layout: one contiguous, cache-line aligned
+    // array per component, so the batch kernels load a full register of X, of Y, ... at a time.
+    using FFloatStream = std::vector<float, TAlignedAllocator<float, CacheLineSize>>;
+
+    struct FVector3Stream
+    {
+        FFloatStream X;
+        FFloatStream Y;
+        FFloatStream Z;
+
+        [[nodiscard]] std::size_t Size() const { return X.size(); }
+        void Resize(std::size_t Count)
+        {
+            X.resize(Count);
+            Y.resize(Count);
+            Z.resize(Count);
+        }
+
+        void Set(std::size_t Index, Vector3 Value)
+        {
+            X[Index] = Value.x;
+            Y[Index] = Value.y;
+            Z[Index] = Value.z;
+        }
+        [[nodiscard]] Vector3 Get(std::size_t Index) const { return { X[Index], Y[Index], Z[Index] }; }
+    };
+
+    struct FVector4Stream
+    {
+        FFloatStream X;
+        FFloatStream Y;
+        FFloatStream Z;
+        FFloatStream W;
+
+        [[nodiscard]] std::size_t Size() const { return X.size(); }
+        void Resize(std::size_t Count)
+        {
+            X.resize(Count);
+            Y.resize(Count);
+            Z.resize(Count);
+            W.resize(Count);
+        }
+
+        void Set(std::size_t Index, Vector4 Value)
+        {
+            X[Index] = Value.x;
+            Y[Index] = Value.y;
+            Z[Index] = Value.z;
+            W[Index] = Value.w;
+        }
+        [[nodiscard]] Vector4 Get(std::size_t Index) const { return { X[Index], Y[Index], Z[Index], W[Index] }; }
+    };
+
+    using FQuaternionStream = FVector4Stream;
+
+    // M[k] holds element mk of every matrix, in raylib's numbering (m0, m4, m8, m12 is the first row)
+    struct FMatrixStream
+    {
+        std::array<FFloatStream, 16> M;
+
+        [[nodiscard]] std::size_t Size() const { return M[0].size(); }
+        void Resize(std::size_t Count)
+        {
+            for (FFloatStream& Element : M)
+            {
+                Element.resize(Count);
+            }
+        }
+
+        void Set(std::size_t Index, const Matrix& Value);
+        [[nodiscard]] Matrix Get(std::size_t Index) const;
+    };
+
+    struct FBoxStream
+    {
+        FVector3Stream Min;
+        FVector3Stream Max;
+
+        [[nodiscard]] std::size_t Size() const { return Min.Size(); }
+        void Resize(std::size_t Count)
+        {
+            Min.Resize(Count);
+            Max.Resize(Count);
+        }
+
+        void Set(std::size_t Index, BoundingBox Value)
+        {
+            Min.Set(Index, Value.min);
+            Max.Set(Index, Value.max);
+        }
+        [[nodiscard]] BoundingBox Get(std::size_t Index) const { return { Min.Get(Index), Max.Get(Index) }; }
+    };
+
+}
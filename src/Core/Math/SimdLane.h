@@ -0,0 +1,236 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+// Backend selection for the batch math kernels. The widest instruction set the compiler targets
+// wins; define CORE_MATH_FORCE_SCALAR to compare against the plain C++ path.
+#if defined(CORE_MATH_FORCE_SCALAR)
+    #define CORE_MATH_SCALAR
+#elif defined(__AVX2__)
+    #define CORE_MATH_AVX2
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+    #define CORE_MATH_SSE
+    #if defined(__SSE4_1__)
+        #include <smmintrin.h>
+    #else
+        #include <emmintrin.h>
+    #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    // 32-bit NEON lacks vector division and square root
+    #define CORE_MATH_NEON
+    #include <arm_neon.h>
+#elif defined(__wasm_simd128__)
+    #define CORE_MATH_WASM
+    #include <wasm_simd128.h>
+#else
+    #define CORE_MATH_SCALAR
+#endif
+
+namespace Core::Math::Detail
+{
+
+    // A lane type wraps one register of floats. The kernels are written once against this
+    // interface and run with FSimdLane over full registers and FScalarLane over the remainder.
+    // Only exact IEEE operations are exposed (no reciprocal estimates, no fused multiply-add)
+    // so lanes compute what the scalar raymath code computes.
+
+    struct FScalarLane
+    {
+        static constexpr std::size_t Width = 1;
+        static constexpr const char* Name = "Scalar";
+
+        struct FMask
+        {
+            bool V;
+        };
+
+        float V;
+
+        static FScalarLane Set(float Value) { return { Value }; }
+        static FScalarLane Load(const float* Source) { return { *Source }; }
+        static void Store(float* Destination, FScalarLane Lane) { *Destination = Lane.V; }
+
+        friend FScalarLane operator+(FScalarLane A, FScalarLane B) { return { A.V + B.V }; }
+        friend FScalarLane operator-(FScalarLane A, FScalarLane B) { return { A.V - B.V }; }
+        friend FScalarLane operator*(FScalarLane A, FScalarLane B) { return { A.V * B.V }; }
+        friend FScalarLane operator/(FScalarLane A, FScalarLane B) { return { A.V / B.V }; }
+
+        static FScalarLane Sqrt(FScalarLane A) { return { std::sqrt(A.V) }; }
+        static FScalarLane Abs(FScalarLane A) { return { std::fabs(A.V) }; }
+        static FScalarLane Negate(FScalarLane A) { return { -A.V }; }
+        // Same choice as minps/maxps when the inputs compare equal or one is NaN
+        static FScalarLane Min(FScalarLane A, FScalarLane B) { return { A.V < B.V ? A.V : B.V }; }
+        static FScalarLane Max(FScalarLane A, FScalarLane B) { return { A.V > B.V ? A.V : B.V }; }
+
+        static FMask Less(FScalarLane A, FScalarLane B) { return { A.V < B.V }; }
+        static FMask Greater(FScalarLane A, FScalarLane B) { return { A.V > B.V }; }
+        static FMask GreaterEqual(FScalarLane A, FScalarLane B) { return { A.V >= B.V }; }
+        static FMask NotEqual(FScalarLane A, FScalarLane B) { return { A.V != B.V }; }
+        static FScalarLane Select(FMask Mask, FScalarLane IfTrue, FScalarLane IfFalse) { return Mask.V ? IfTrue : IfFalse; }
+    };
+
+#if defined(CORE_MATH_AVX2)
+
+    struct FSimdLane
+    {
+        static constexpr std::size_t Width = 8;
+        static constexpr const char* Name = "AVX2";
+
+        struct FMask
+        {
+            __m256 V;
+        };
+
+        __m256 V;
+
+        static FSimdLane Set(float Value) { return { _mm256_set1_ps(Value) }; }
+        static FSimdLane Load(const float* Source) { return { _mm256_loadu_ps(Source) }; }
+        static void Store(float* Destination, FSimdLane Lane) { _mm256_storeu_ps(Destination, Lane.V); }
+
+        friend FSimdLane operator+(FSimdLane A, FSimdLane B) { return { _mm256_add_ps(A.V, B.V) }; }
+        friend FSimdLane operator-(FSimdLane A, FSimdLane B) { return { _mm256_sub_ps(A.V, B.V) }; }
+        friend FSimdLane operator*(FSimdLane A, FSimdLane B) { return { _mm256_mul_ps(A.V, B.V) }; }
+        friend FSimdLane operator/(FSimdLane A, FSimdLane B) { return { _mm256_div_ps(A.V, B.V) }; }
+
+        static FSimdLane Sqrt(FSimdLane A) { return { _mm256_sqrt_ps(A.V) }; }
+        static FSimdLane Abs(FSimdLane A) { return { _mm256_andnot_ps(_mm256_set1_ps(-0.0f), A.V) }; }
+        static FSimdLane Negate(FSimdLane A) { return { _mm256_xor_ps(_mm256_set1_ps(-0.0f), A.V) }; }
+        static FSimdLane Min(FSimdLane A, FSimdLane B) { return { _mm256_min_ps(A.V, B.V) }; }
+        static FSimdLane Max(FSimdLane A, FSimdLane B) { return { _mm256_max_ps(A.V, B.V) }; }
+
+        static FMask Less(FSimdLane A, FSimdLane B) { return { _mm256_cmp_ps(A.V, B.V, _CMP_LT_OQ) }; }
+        static FMask Greater(FSimdLane A, FSimdLane B) { return { _mm256_cmp_ps(A.V, B.V, _CMP_GT_OQ) }; }
+        static FMask GreaterEqual(FSimdLane A, FSimdLane B) { return { _mm256_cmp_ps(A.V, B.V, _CMP_GE_OQ) }; }
+        static FMask NotEqual(FSimdLane A, FSimdLane B) { return { _mm256_cmp_ps(A.V, B.V, _CMP_NEQ_UQ) }; }
+        static FSimdLane Select(FMask Mask, FSimdLane IfTrue, FSimdLane IfFalse) { return { _mm256_blendv_ps(IfFalse.V, IfTrue.V, Mask.V) }; }
+    };
+
+#elif defined(CORE_MATH_SSE)
+
+    struct FSimdLane
+    {
+        static constexpr std::size_t Width = 4;
+        #if defined(__SSE4_1__)
+            static constexpr const char* Name = "SSE4.1";
+        #else
+            static constexpr const char* Name = "SSE2";
+        #endif
+
+        struct FMask
+        {
+            __m128 V;
+        };
+
+        __m128 V;
+
+        static FSimdLane Set(float Value) { return { _mm_set1_ps(Value) }; }
+        static FSimdLane Load(const float* Source) { return { _mm_loadu_ps(Source) }; }
+        static void Store(float* Destination, FSimdLane Lane) { _mm_storeu_ps(Destination, Lane.V); }
+
+        friend FSimdLane operator+(FSimdLane A, FSimdLane B) { return { _mm_add_ps(A.V, B.V) }; }
+        friend FSimdLane operator-(FSimdLane A, FSimdLane B) { return { _mm_sub_ps(A.V, B.V) }; }
+        friend FSimdLane operator*(FSimdLane A, FSimdLane B) { return { _mm_mul_ps(A.V, B.V) }; }
+        friend FSimdLane operator/(FSimdLane A, FSimdLane B) { return { _mm_div_ps(A.V, B.V) }; }
+
+        static FSimdLane Sqrt(FSimdLane A) { return { _mm_sqrt_ps(A.V) }; }
+        static FSimdLane Abs(FSimdLane A) { return { _mm_andnot_ps(_mm_set1_ps(-0.0f), A.V) }; }
+        static FSimdLane Negate(FSimdLane A) { return { _mm_xor_ps(_mm_set1_ps(-0.0f), A.V) }; }
+        static FSimdLane Min(FSimdLane A, FSimdLane B) { return { _mm_min_ps(A.V, B.V) }; }
+        static FSimdLane Max(FSimdLane A, FSimdLane B) { return { _mm_max_ps(A.V, B.V) }; }
+
+        static FMask Less(FSimdLane A, FSimdLane B) { return { _mm_cmplt_ps(A.V, B.V) }; }
+        static FMask Greater(FSimdLane A, FSimdLane B) { return { _mm_cmpgt_ps(A.V, B.V) }; }
+        static FMask GreaterEqual(FSimdLane A, FSimdLane B) { return { _mm_cmpge_ps(A.V, B.V) }; }
+        static FMask NotEqual(FSimdLane A, FSimdLane B) { return { _mm_cmpneq_ps(A.V, B.V) }; }
+        static FSimdLane Select(FMask Mask, FSimdLane IfTrue, FSimdLane IfFalse)
+        {
+            #if defined(__SSE4_1__)
+                return { _mm_blendv_ps(IfFalse.V, IfTrue.V, Mask.V) };
+            #else
+                return { _mm_or_ps(_mm_and_ps(Mask.V, IfTrue.V), _mm_andnot_ps(Mask.V, IfFalse.V)) };
+            #endif
+        }
+    };
+
+#elif defined(CORE_MATH_NEON)
+
+    struct FSimdLane
+    {
+        static constexpr std::size_t Width = 4;
+        static constexpr const char* Name = "NEON";
+
+        struct FMask
+        {
+            uint32x4_t V;
+        };
+
+        float32x4_t V;
+
+        static FSimdLane Set(float Value) { return { vdupq_n_f32(Value) }; }
+        static FSimdLane Load(const float* Source) { return { vld1q_f32(Source) }; }
+        static void Store(float* Destination, FSimdLane Lane) { vst1q_f32(Destination, Lane.V); }
+
+        friend FSimdLane operator+(FSimdLane A, FSimdLane B) { return { vaddq_f32(A.V, B.V) }; }
+        friend FSimdLane operator-(FSimdLane A, FSimdLane B) { return { vsubq_f32(A.V, B.V) }; }
+        friend FSimdLane operator*(FSimdLane A, FSimdLane B) { return { vmulq_f32(A.V, B.V) }; }
+        friend FSimdLane operator/(FSimdLane A, FSimdLane B) { return { vdivq_f32(A.V, B.V) }; }
+
+        static FSimdLane Sqrt(FSimdLane A) { return { vsqrtq_f32(A.V) }; }
+        static FSimdLane Abs(FSimdLane A) { return { vabsq_f32(A.V) }; }
+        static FSimdLane Negate(FSimdLane A) { return { vnegq_f32(A.V) }; }
+        static FSimdLane Min(FSimdLane A, FSimdLane B) { return { vminq_f32(A.V, B.V) }; }
+        static FSimdLane Max(FSimdLane A, FSimdLane B) { return { vmaxq_f32(A.V, B.V) }; }
+
+        static FMask Less(FSimdLane A, FSimdLane B) { return { vcltq_f32(A.V, B.V) }; }
+        static FMask Greater(FSimdLane A, FSimdLane B) { return { vcgtq_f32(A.V, B.V) }; }
+        static FMask GreaterEqual(FSimdLane A, FSimdLane B) { return { vcgeq_f32(A.V, B.V) }; }
+        static FMask NotEqual(FSimdLane A, FSimdLane B) { return { vmvnq_u32(vceqq_f32(A.V, B.V)) }; }
+        static FSimdLane Select(FMask Mask, FSimdLane IfTrue, FSimdLane IfFalse) { return { vbslq_f32(Mask.V, IfTrue.V, IfFalse.V) }; }
+    };
+
+#elif defined(CORE_MATH_WASM)
+
+    struct FSimdLane
+    {
+        static constexpr std::size_t Width = 4;
+        static constexpr const char* Name = "WASM SIMD128";
+
+        struct FMask
+        {
+            v128_t V;
+        };
+
+        v128_t V;
+
+        static FSimdLane Set(float Value) { return { wasm_f32x4_splat(Value) }; }
+        static FSimdLane Load(const float* Source) { return { wasm_v128_load(Source) }; }
+        static void Store(float* Destination, FSimdLane Lane) { wasm_v128_store(Destination, Lane.V); }
+
+        friend FSimdLane operator+(FSimdLane A, FSimdLane B) { return { wasm_f32x4_add(A.V, B.V) }; }
+        friend FSimdLane operator-(FSimdLane A, FSimdLane B) { return { wasm_f32x4_sub(A.V, B.V) }; }
+        friend FSimdLane operator*(FSimdLane A, FSimdLane B) { return { wasm_f32x4_mul(A.V, B.V) }; }
+        friend FSimdLane operator/(FSimdLane A, FSimdLane B) { return { wasm_f32x4_div(A.V, B.V) }; }
+
+        static FSimdLane Sqrt(FSimdLane A) { return { wasm_f32x4_sqrt(A.V) }; }
+        static FSimdLane Abs(FSimdLane A) { return { wasm_f32x4_abs(A.V) }; }
+        static FSimdLane Negate(FSimdLane A) { return { wasm_f32x4_neg(A.V) }; }
+        // pmin/pmax map to single instructions on x86 hosts; min/max add NaN handling
+        static FSimdLane Min(FSimdLane A, FSimdLane B) { return { wasm_f32x4_pmin(A.V, B.V) }; }
+        static FSimdLane Max(FSimdLane A, FSimdLane B) { return { wasm_f32x4_pmax(A.V, B.V) }; }
+
+        static FMask Less(FSimdLane A, FSimdLane B) { return { wasm_f32x4_lt(A.V, B.V) }; }
+        static FMask Greater(FSimdLane A, FSimdLane B) { return { wasm_f32x4_gt(A.V, B.V) }; }
+        static FMask GreaterEqual(FSimdLane A, FSimdLane B) { return { wasm_f32x4_ge(A.V, B.V) }; }
+        static FMask NotEqual(FSimdLane A, FSimdLane B) { return { wasm_f32x4_ne(A.V, B.V) }; }
+        static FSimdLane Select(FMask Mask, FSimdLane IfTrue, FSimdLane IfFalse) { return { wasm_v128_bitselect(IfTrue.V, IfFalse.V, Mask.V) }; }
+    };
+
+#else
+
+    using FSimdLane = FScalarLane;
+
+#endif
+
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace Core
+{
+
+    // Standard allocator that aligns every allocation to Alignment bytes, e.g. for containers
+    // whose data is read with SIMD loads or must not share cache lines.
+    template<typename T, std::size_t Alignment>
+    class TAlignedAllocator
+    {
+        static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two no smaller than alignof(T)");
+
+    public:
+        using value_type = T;
+
+        template<typename U>
+        struct rebind
+        {
+            using other = TAlignedAllocator<U, Alignment>;
+        };
+
+        TAlignedAllocator() noexcept = default;
+        template<typename U>
+        TAlignedAllocator(const TAlignedAllocator<U, Alignment>&) noexcept {}
+
+        [[nodiscard]] T* allocate(std::size_t Count)
+        {
+            return static_cast<T*>(::operator new(Count * sizeof(T), std::align_val_t{ Alignment }));
+        }
+
+        void deallocate(T* Pointer, std::size_t) noexcept
+        {
+            ::operator delete(Pointer, std::align_val_t{ Alignment });
+        }
+
+        template<typename U>
+        bool operator==(const TAlignedAllocator<U, Alignment>&) const noexcept { return true; }
+    };
+
+}
@@ -0,0 +1,99 @@
+#include "FrameAllocator.h"
+
+#include <algorithm>
+
+namespace Core
+{
+
+    FFrameAllocator::FFrameAllocator(std::size_t InBytesPerFrame, std::size_t InFrameCount)
+        : BytesPerFrame(InBytesPerFrame)
+    {
+        Frames.resize(std::max<std::size_t>(InFrameCount, 2));
+        for (Scope<FFrame>& Frame : Frames)
+        {
+            Frame = CreateScope<FFrame>();
+            Frame->Memory = static_cast<std::byte*>(::operator new(BytesPerFrame, std::align_val_t{ CacheLineSize }));
+        }
+    }
+
+    FFrameAllocator::~FFrameAllocator()
+    {
+        for (Scope<FFrame>& Frame : Frames)
+        {
+            ReleaseOverflow(*Frame);
+            ::operator delete(Frame->Memory, std::align_val_t{ CacheLineSize });
+        }
+    }
+
+    void* FFrameAllocator::Allocate(std::size_t Size, std::size_t Alignment)
+    {
+        // Another thread may start the next frame meanwhile; the allocation then belongs to the
+        // frame that was current when it began, which is still alive
+        FFrame& Frame = *Frames[CurrentFrame.load(std::memory_order_acquire)];
+        const std::uintptr_t Base = reinterpret_cast<std::uintptr_t>(Frame.Memory);
+
+        std::size_t Offset = Frame.Offset.load(std::memory_order_relaxed);
+        while (true)
+        {
+            const std::size_t Aligned = ((Base + Offset + Alignment - 1) & ~(static_cast<std::uintptr_t>(Alignment) - 1)) - Base;
+            const std::size_t End = Aligned + Size;
+            if (End > BytesPerFrame)
+                return AllocateOverflow(Frame, Size, Alignment);
+
+            if (Frame.Offset.compare_exchange_weak(Offset, End, std::memory_order_relaxed))
+                return Frame.Memory + Aligned;
+        }
+    }
+
+    void* FFrameAllocator::AllocateOverflow(FFrame& Frame, std::size_t Size, std::size_t Alignment)
+    {
+        void* Memory = ::operator new(std::max<std::size_t>(Size, 1), std::align_val_t{ Alignment });
+
+        std::lock_guard Lock(Frame.OverflowMutex);
+        Frame.Overflow.push_back({ Memory, Alignment });
+        Frame.OverflowBytes.fetch_add(Size, std::memory_order_relaxed);
+        return Memory;
+    }
+
+    void FFrameAllocator::ReleaseOverflow(FFrame& Frame)
+    {
+        std::lock_guard Lock(Frame.OverflowMutex);
+        for (const FOverflowBlock& Block : Frame.Overflow)
+        {
+            ::operator delete(Block.Memory, std::align_val_t{ Block.Alignment });
+        }
+        Frame.Overflow.clear();
+        Frame.OverflowBytes.store(0, std::memory_order_relaxed);
+    }
+
+    void FFrameAllocator::BeginFrame()
+    {
+        const std::size_t Current = CurrentFrame.load(std::memory_order_relaxed);
+        FFrame& Finished = *Frames[Current];
+
+        // Statistics of the frame that just ended
+        const std::size_t Bytes = GetCurrentBytes();
+        HighWaterMark.store(std::max(HighWaterMark.load(std::memory_order_relaxed), Bytes), std::memory_order_relaxed);
+        {
+            std::lock_guard Lock(Finished.OverflowMutex);
+            LastOverflowCount.store(Finished.Overflow.size(), std::memory_order_relaxed);
+        }
+        const std::size_t HistoryIndex = HistoryCount.load(std::memory_order_relaxed);
+        History[HistoryIndex % HistorySize].store(Bytes, std::memory_order_relaxed);
+        HistoryCount.store(HistoryIndex + 1, std::memory_order_release);
+
+        // The next buffer was last used FrameCount frames ago
+        const std::size_t Next = (Current + 1) % Frames.size();
+        FFrame& Recycled = *Frames[Next];
+        ReleaseOverflow(Recycled);
+        Recycled.Offset.store(0, std::memory_order_relaxed);
+        CurrentFrame.store(Next, std::memory_order_release);
+    }
+
+    std::size_t FFrameAllocator::GetCurrentBytes() const
+    {
+        const FFrame& Frame = *Frames[CurrentFrame.load(std::memory_order_acquire)];
+        return Frame.Offset.load(std::memory_order_relaxed) + Frame.OverflowBytes.load(std::memory_order_relaxed);
+    }
+
+}
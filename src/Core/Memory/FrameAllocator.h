@@ -0,0 +1,133 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Core
+{
+
+    // Bump allocator for data that only lives for a frame or two. Memory is never freed one
+    // allocation at a time: each frame gets its own buffer, and BeginFrame recycles the buffer
+    // of the oldest frame in one step.
+    // Allocate is lock-free and callable from any thread. Memory handed out during a frame stays
+    // valid for FrameCount - 1 more BeginFrame calls, so with the default of two, data built in
+    // one frame can still be read in the next.
+    // Requests that do not fit the buffer fall back to the heap and are freed with the frame.
+    class FFrameAllocator
+    {
+    public:
+        static constexpr std::size_t HistorySize = 120;
+
+        explicit FFrameAllocator(std::size_t InBytesPerFrame, std::size_t InFrameCount = 2);
+        ~FFrameAllocator();
+
+        FFrameAllocator(const FFrameAllocator&) = delete;
+        FFrameAllocator& operator=(const FFrameAllocator&) = delete;
+
+        [[nodiscard]] void* Allocate(std::size_t Size, std::size_t Alignment = alignof(std::max_align_t));
+
+        // Destructors never run, so only trivially destructible types are allowed
+        template<typename T, typename... Args>
+        [[nodiscard]] T* New(Args&&... args)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "Frame allocations are released without running destructors");
+            return ::new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+        template<typename T>
+        [[nodiscard]] std::span<T> NewArray(std::size_t Count)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "Frame allocations are released without running destructors");
+            T* Items = static_cast<T*>(Allocate(sizeof(T) * Count, alignof(T)));
+            std::uninitialized_value_construct_n(Items, Count);
+            return { Items, Count };
+        }
+
+        // For std::pmr containers, e.g. std::pmr::vector<int> Scratch(Allocator.GetResource()).
+        // Deallocation is a no-op; the container's memory goes away with its frame.
+        [[nodiscard]] std::pmr::memory_resource* GetResource() { return &Resource; }
+
+        // Render thread, at the top of every frame
+        void BeginFrame();
+
+        [[nodiscard]] std::size_t GetCapacity() const { return BytesPerFrame; }
+        [[nodiscard]] std::size_t GetFrameCount() const { return Frames.size(); }
+        // Bytes handed out so far this frame, heap fallbacks included
+        [[nodiscard]] std::size_t GetCurrentBytes() const;
+        // Largest frame so far
+        [[nodiscard]] std::size_t GetHighWaterMark() const { return HighWaterMark.load(std::memory_order_relaxed); }
+        // Allocations of the last finished frame that did not fit its buffer
+        [[nodiscard]] std::size_t GetLastOverflowCount() const { return LastOverflowCount.load(std::memory_order_relaxed); }
+
+        // Calls Func(Bytes) for the recorded frames, oldest first
+        template<typename F>
+        void ForEachFrameInHistory(F&& Func) const
+        {
+            const std::size_t Count = std::min<std::size_t>(HistoryCount.load(std::memory_order_acquire), HistorySize);
+            const std::size_t End = HistoryCount.load(std::memory_order_acquire);
+            for (std::size_t i = End - Count; i < End; i++)
+            {
+                Func(History[i % HistorySize].load(std::memory_order_relaxed));
+            }
+        }
+
+    private:
+        struct FOverflowBlock
+        {
+            void* Memory;
+            std::size_t Alignment;
+        };
+
+        struct alignas(CacheLineSize) FFrame
+        {
+            std::byte* Memory = nullptr;
+            std::atomic<std::size_t> Offset{ 0 };
+
+            std::mutex OverflowMutex;
+            std::vector<FOverflowBlock> Overflow;
+            std::atomic<std::size_t> OverflowBytes{ 0 };
+        };
+
+        class FResource : public std::pmr::memory_resource
+        {
+        public:
+            explicit FResource(FFrameAllocator& InOwner) : Owner(InOwner) {}
+
+        private:
+            void* do_allocate(std::size_t Bytes, std::size_t Alignment) override { return Owner.Allocate(Bytes, Alignment); }
+            void do_deallocate(void*, std::size_t, std::size_t) override {}
+            bool do_is_equal(const std::pmr::memory_resource& Other) const noexcept override { return this == &Other; }
+
+            FFrameAllocator& Owner;
+        };
+
+        void* AllocateOverflow(FFrame& Frame, std::size_t Size, std::size_t Alignment);
+        static void ReleaseOverflow(FFrame& Frame);
+
+    private:
+        std::size_t BytesPerFrame;
+        std::vector<Scope<FFrame>> Frames;
+        std::atomic<std::size_t> CurrentFrame{ 0 };
+        FResource Resource{ *this };
+
+        // Written by BeginFrame, read by the Memory panel
+        std::atomic<std::size_t> HighWaterMark{ 0 };
+        std::atomic<std::size_t> LastOverflowCount{ 0 };
+        std::array<std::atomic<std::size_t>, HistorySize> History{};
+        std::atomic<std::size_t> HistoryCount{ 0 };
+    };
+
+}
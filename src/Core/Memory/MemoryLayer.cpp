@@ -0,0 +1,192 @@
+#include "MemoryLayer.h"
+
+#include "Core/Profiling/Profiler.h"
+
+#include "imgui.h"
+
+#include <algorithm>
+
+namespace Core
+{
+
+    static float ToKilobytes(std::size_t Bytes)
+    {
+        return static_cast<float>(Bytes) / 1024.0f;
+    }
+
+    FMemoryLayer::FMemoryLayer(FFrameAllocator& InFrameAllocator)
+        : FLayer("Memory"), FrameAllocator(InFrameAllocator)
+    {
+        // The panel reacts to nothing but ImGui input
+        SetEventCategoryMask(0);
+    }
+
+    void FMemoryLayer::OnUIRender()
+    {
+        CORE_PROFILE_FUNCTION();
+
+        if (!ImGui::Begin("Memory"))
+        {
+            ImGui::End();
+            return;
+        }
+
+        DrawFrameAllocator();
+        #ifdef CORE_ENABLE_MEMORY_TRACKING
+            FMemoryTracker::GetStats(Stats);
+            DrawHeap();
+            DrawGpu();
+        #endif
+
+        ImGui::End();
+    }
+
+    void FMemoryLayer::DrawFrameAllocator()
+    {
+        if (!ImGui::CollapsingHeader("Frame Allocator", ImGuiTreeNodeFlags_DefaultOpen))
+            return;
+
+        FrameKilobytes.clear();
+        FrameAllocator.ForEachFrameInHistory([this](std::size_t Bytes)
+        {
+            FrameKilobytes.push_back(ToKilobytes(Bytes));
+        });
+
+        const std::size_t Capacity = FrameAllocator.GetCapacity();
+        const std::size_t HighWater = FrameAllocator.GetHighWaterMark();
+        const std::size_t LastFrame = FrameKilobytes.empty() ? 0 : static_cast<std::size_t>(FrameKilobytes.back() * 1024.0f);
+
+        ImGui::Text("Capacity: %.1f KB x %zu frames", ToKilobytes(Capacity), FrameAllocator.GetFrameCount());
+        ImGui::Text("Last frame: %.1f KB", ToKilobytes(LastFrame));
+        ImGui::Text("High-water mark: %.1f KB", ToKilobytes(HighWater));
+        ImGui::ProgressBar(Capacity > 0 ? std::min(static_cast<float>(HighWater) / static_cast<float>(Capacity), 1.0f) : 0.0f,
+            ImVec2(-FLT_MIN, 0.0f), "High-water / capacity");
+
+        const std::size_t Overflows = FrameAllocator.GetLastOverflowCount();
+        if (Overflows > 0)
+        {
+            ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.3f, 1.0f), "%zu allocations fell back to the heap last frame", Overflows);
+        }
+
+        if (!FrameKilobytes.empty())
+        {
+            const float MaxKilobytes = std::max(*std::max_element(FrameKilobytes.begin(), FrameKilobytes.end()), 1.0f);
+            ImGui::PlotLines("##FrameBytes", FrameKilobytes.data(), static_cast<int>(FrameKilobytes.size()), 0,
+                "KB per frame", 0.0f, MaxKilobytes * 1.2f, ImVec2(-FLT_MIN, 60.0f));
+        }
+    }
+
+    #ifdef CORE_ENABLE_MEMORY_TRACKING
+
+    void FMemoryLayer::DrawHeap()
+    {
+        if (!ImGui::CollapsingHeader("Heap", ImGuiTreeNodeFlags_DefaultOpen))
+            return;
+
+        std::uint32_t FrameAllocations = 0;
+        for (const FMemoryTagStats& Tag : Stats.Tags)
+        {
+            FrameAllocations += Tag.AllocationsLastFrame;
+        }
+
+        ImGui::Text("Live: %.1f KB  Peak: %.1f KB", ToKilobytes(Stats.LiveBytes), ToKilobytes(Stats.PeakBytes));
+        ImGui::Text("Allocations last frame: %u", FrameAllocations);
+
+        const std::size_t HistoryCount = std::min(Stats.FrameCount, FMemoryStats::HistorySize);
+        if (HistoryCount > 0)
+        {
+            const float MaxAllocations = std::max(*std::max_element(Stats.AllocationHistory.begin(), Stats.AllocationHistory.begin() + HistoryCount), 1.0f);
+            ImGui::PlotHistogram("##Allocations", Stats.AllocationHistory.data(), static_cast<int>(HistoryCount), 0,
+                "Allocations per frame", 0.0f, MaxAllocations * 1.2f, ImVec2(-FLT_MIN, 60.0f));
+        }
+
+        constexpr ImGuiTableFlags TableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp;
+        if (ImGui::BeginTable("Tags", 5, TableFlags))
+        {
+            ImGui::TableSetupColumn("Tag");
+            ImGui::TableSetupColumn("Live KB");
+            ImGui::TableSetupColumn("Peak KB");
+            ImGui::TableSetupColumn("Allocs / frame");
+            ImGui::TableSetupColumn("KB / frame");
+            ImGui::TableHeadersRow();
+
+            for (std::size_t Index = 0; Index < Stats.Tags.size(); Index++)
+            {
+                const FMemoryTagStats& Tag = Stats.Tags[Index];
+                if (Tag.TotalAllocations == 0)
+                    continue;
+
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(FMemoryTracker::GetTagName(static_cast<EMemoryTag>(Index)));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", ToKilobytes(Tag.LiveBytes));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", ToKilobytes(Tag.PeakBytes));
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", Tag.AllocationsLastFrame);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", ToKilobytes(Tag.BytesLastFrame));
+            }
+            ImGui::EndTable();
+        }
+
+        if (ImGui::TreeNode("Threads"))
+        {
+            if (ImGui::BeginTable("Threads", 3, TableFlags))
+            {
+                ImGui::TableSetupColumn("Thread");
+                ImGui::TableSetupColumn("Allocs / frame");
+                ImGui::TableSetupColumn("KB / frame");
+                ImGui::TableHeadersRow();
+
+                for (const FMemoryThreadStats& Thread : Stats.Threads)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%u", Thread.ThreadIndex);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%u", Thread.AllocationsLastFrame);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.1f", ToKilobytes(Thread.BytesLastFrame));
+                }
+                ImGui::EndTable();
+            }
+            ImGui::TreePop();
+        }
+    }
+
+    void FMemoryLayer::DrawGpu()
+    {
+        if (!ImGui::CollapsingHeader("GPU", ImGuiTreeNodeFlags_DefaultOpen))
+            return;
+
+        constexpr ImGuiTableFlags TableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_SizingStretchProp;
+        if (ImGui::BeginTable("Gpu", 4, TableFlags))
+        {
+            ImGui::TableSetupColumn("Kind");
+            ImGui::TableSetupColumn("Count");
+            ImGui::TableSetupColumn("Live KB");
+            ImGui::TableSetupColumn("Peak KB");
+            ImGui::TableHeadersRow();
+
+            for (std::size_t Index = 0; Index < Stats.Gpu.size(); Index++)
+            {
+                const FGpuMemoryStats& Gpu = Stats.Gpu[Index];
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(FMemoryTracker::GetGpuResourceName(static_cast<EGpuResource>(Index)));
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", Gpu.Count);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", ToKilobytes(Gpu.LiveBytes));
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", ToKilobytes(Gpu.PeakBytes));
+            }
+            ImGui::EndTable();
+        }
+    }
+
+    #endif
+
+}
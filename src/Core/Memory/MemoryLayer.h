@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Core/Layers/Layer.h"
+#include "FrameAllocator.h"
+#include "MemoryTracker.h"
+
+#include <vector>
+
+namespace Core
+{
+
+    // "Memory" panel: frame allocator usage per frame and its high-water mark, plus heap and GPU
+    // usage by tag when the memory tracker is compiled in. Pushed as an overlay by FApplication
+    // when FApplicationConfig::bMemoryPanel is set.
+    class FMemoryLayer : public FLayer
+    {
+    public:
+        explicit FMemoryLayer(FFrameAllocator& InFrameAllocator);
+
+        void OnUIRender() override;
+        // The allocator's history and the tracker's totals are safe to read from any thread
+        [[nodiscard]] bool SupportsPipelinedUI() const override { return true; }
+
+    private:
+        void DrawFrameAllocator();
+        #ifdef CORE_ENABLE_MEMORY_TRACKING
+            void DrawHeap();
+            void DrawGpu();
+        #endif
+
+    private:
+        FFrameAllocator& FrameAllocator;
+        std::vector<float> FrameKilobytes;
+        #ifdef CORE_ENABLE_MEMORY_TRACKING
+            FMemoryStats Stats;
+        #endif
+    };
+
+}
@@ -0,0 +1,440 @@
+#include "MemoryTracker.h"
+
+#ifdef CORE_ENABLE_MEMORY_TRACKING
+
+#include "RaylibAllocatorHooks.h"
+
+#include "imgui.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+
+#if defined(CORE_PLATFORM_MACOS)
+    #include <malloc/malloc.h>
+#else
+    #include <malloc.h>
+#endif
+
+namespace Core
+{
+
+    namespace
+    {
+        constexpr std::size_t TagCount = static_cast<std::size_t>(EMemoryTag::Count);
+        constexpr std::size_t GpuKindCount = static_cast<std::size_t>(EGpuResource::Count);
+
+        // Threads past this share one block of counters updated with atomic adds
+        constexpr std::uint32_t MaxThreads = 256;
+
+        std::size_t GetUsableSize(void* Ptr)
+        {
+            #if defined(CORE_PLATFORM_WINDOWS)
+                return _msize(Ptr);
+            #elif defined(CORE_PLATFORM_MACOS)
+                return malloc_size(Ptr);
+            #else
+                return malloc_usable_size(Ptr);
+            #endif
+        }
+
+        struct FTagCounters
+        {
+            std::atomic<std::uint64_t> Allocations{ 0 };
+            std::atomic<std::uint64_t> AllocatedBytes{ 0 };
+            std::atomic<std::uint64_t> FreedBytes{ 0 };
+        };
+
+        struct alignas(CacheLineSize) FThreadCounters
+        {
+            std::array<FTagCounters, TagCount> Tags;
+            bool bShared = false;
+
+            // Only the owning thread writes, so a plain load and store is enough; the shared block
+            // has several writers
+            void Add(std::atomic<std::uint64_t>& Counter, std::uint64_t Value)
+            {
+                if (bShared)
+                    Counter.fetch_add(Value, std::memory_order_relaxed);
+                else
+                    Counter.store(Counter.load(std::memory_order_relaxed) + Value, std::memory_order_relaxed);
+            }
+
+            void RecordAllocation(EMemoryTag Tag, std::size_t Bytes)
+            {
+                FTagCounters& Counters = Tags[static_cast<std::size_t>(Tag)];
+                Add(Counters.Allocations, 1);
+                Add(Counters.AllocatedBytes, Bytes);
+            }
+
+            void RecordFree(EMemoryTag Tag, std::size_t Bytes)
+            {
+                Add(Tags[static_cast<std::size_t>(Tag)].FreedBytes, Bytes);
+            }
+        };
+
+        // Counter blocks are carved from malloc so registering a thread never re-enters operator new
+        std::array<std::atomic<FThreadCounters*>, MaxThreads> s_Threads{};
+        std::atomic<std::uint32_t> s_ThreadCount{ 0 };
+        FThreadCounters s_SharedCounters;
+
+        thread_local FThreadCounters* t_Counters = nullptr;
+        thread_local EMemoryTag t_Tag = EMemoryTag::Untagged;
+
+        FThreadCounters& GetThreadCounters()
+        {
+            if (!t_Counters)
+            {
+                const std::uint32_t Index = s_ThreadCount.fetch_add(1, std::memory_order_relaxed);
+                if (Index < MaxThreads)
+                {
+                    void* Memory = std::malloc(sizeof(FThreadCounters));
+                    t_Counters = ::new (Memory) FThreadCounters();
+                    s_Threads[Index].store(t_Counters, std::memory_order_release);
+                }
+                else
+                {
+                    s_SharedCounters.bShared = true;
+                    t_Counters = &s_SharedCounters;
+                }
+            }
+            return *t_Counters;
+        }
+
+        // Stored in front of every operator new block: the tag it was charged to, its size and
+        // where malloc's block starts (they differ for over-aligned requests)
+        struct FAllocationHeader
+        {
+            void* Raw;
+            std::uint64_t SizeAndTag;
+        };
+        static_assert(sizeof(FAllocationHeader) == 16);
+
+        constexpr std::size_t HeaderSize = sizeof(FAllocationHeader);
+        constexpr int TagShift = 56;
+        constexpr std::uint64_t SizeMask = (std::uint64_t(1) << TagShift) - 1;
+
+        void* TrackedAllocate(std::size_t Size, std::size_t Alignment)
+        {
+            const std::size_t Align = std::max(Alignment, alignof(std::max_align_t));
+            const std::size_t Padding = Align > alignof(std::max_align_t) ? Align - 1 : 0;
+
+            void* Raw = std::malloc(Size + HeaderSize + Padding);
+            if (!Raw)
+                return nullptr;
+
+            const std::uintptr_t User = (reinterpret_cast<std::uintptr_t>(Raw) + HeaderSize + Align - 1) & ~(static_cast<std::uintptr_t>(Align) - 1);
+            const EMemoryTag Tag = t_Tag;
+
+            FAllocationHeader* Header = reinterpret_cast<FAllocationHeader*>(User) - 1;
+            Header->Raw = Raw;
+            Header->SizeAndTag = (static_cast<std::uint64_t>(Tag) << TagShift) | (Size & SizeMask);
+
+            GetThreadCounters().RecordAllocation(Tag, Size);
+            return reinterpret_cast<void*>(User);
+        }
+
+        void* TrackedAllocateOrThrow(std::size_t Size, std::size_t Alignment)
+        {
+            while (true)
+            {
+                if (void* Memory = TrackedAllocate(Size, Alignment))
+                    return Memory;
+
+                std::new_handler Handler = std::get_new_handler();
+                if (!Handler)
+                    throw std::bad_alloc();
+                Handler();
+            }
+        }
+
+        void TrackedFree(void* Ptr)
+        {
+            if (!Ptr)
+                return;
+
+            const FAllocationHeader* Header = static_cast<const FAllocationHeader*>(Ptr) - 1;
+            const EMemoryTag Tag = static_cast<EMemoryTag>(Header->SizeAndTag >> TagShift);
+            GetThreadCounters().RecordFree(Tag, Header->SizeAndTag & SizeMask);
+            std::free(Header->Raw);
+        }
+
+        // C allocators hand out plain malloc blocks, measured with the usable size on both ends,
+        // so a block allocated outside the hooks and freed through them cannot corrupt anything
+        void* TrackedMalloc(EMemoryTag Tag, std::size_t Size)
+        {
+            void* Memory = std::malloc(Size);
+            if (Memory)
+                GetThreadCounters().RecordAllocation(Tag, GetUsableSize(Memory));
+            return Memory;
+        }
+
+        void TrackedMallocFree(EMemoryTag Tag, void* Ptr)
+        {
+            if (!Ptr)
+                return;
+
+            GetThreadCounters().RecordFree(Tag, GetUsableSize(Ptr));
+            std::free(Ptr);
+        }
+
+        // Frame statistics; only MarkFrame writes, under s_StatsMutex
+        std::mutex s_StatsMutex;
+        FMemoryStats s_Stats;
+        std::array<std::uint64_t, TagCount> s_PreviousAllocations{};
+        std::array<std::uint64_t, TagCount> s_PreviousBytes{};
+        std::array<std::uint64_t, MaxThreads> s_PreviousThreadAllocations{};
+        std::array<std::uint64_t, MaxThreads> s_PreviousThreadBytes{};
+
+        // GPU objects by kind and GL name
+        std::mutex s_GpuMutex;
+        std::unordered_map<std::uint64_t, std::size_t> s_GpuObjects;
+        std::array<FGpuMemoryStats, GpuKindCount> s_GpuStats{};
+
+        std::uint64_t MakeGpuKey(EGpuResource Kind, unsigned int Id)
+        {
+            return (static_cast<std::uint64_t>(Kind) << 32) | Id;
+        }
+    }
+
+    EMemoryTag FMemoryTracker::SetThreadTag(EMemoryTag Tag)
+    {
+        const EMemoryTag Previous = t_Tag;
+        t_Tag = Tag;
+        return Previous;
+    }
+
+    EMemoryTag FMemoryTracker::GetThreadTag()
+    {
+        return t_Tag;
+    }
+
+    void FMemoryTracker::TrackGpuAllocation(EGpuResource Kind, unsigned int Id, std::size_t Bytes)
+    {
+        std::lock_guard Lock(s_GpuMutex);
+        FGpuMemoryStats& Stats = s_GpuStats[static_cast<std::size_t>(Kind)];
+
+        auto [It, bInserted] = s_GpuObjects.try_emplace(MakeGpuKey(Kind, Id), Bytes);
+        if (!bInserted)
+        {
+            // Same name reused without a release; replace the old size
+            Stats.LiveBytes -= It->second;
+            Stats.Count--;
+            It->second = Bytes;
+        }
+
+        Stats.LiveBytes += Bytes;
+        Stats.Count++;
+        Stats.PeakBytes = std::max(Stats.PeakBytes, Stats.LiveBytes);
+    }
+
+    void FMemoryTracker::TrackGpuRelease(EGpuResource Kind, unsigned int Id)
+    {
+        std::lock_guard Lock(s_GpuMutex);
+        const auto It = s_GpuObjects.find(MakeGpuKey(Kind, Id));
+        if (It == s_GpuObjects.end())
+            return;
+
+        FGpuMemoryStats& Stats = s_GpuStats[static_cast<std::size_t>(Kind)];
+        Stats.LiveBytes -= It->second;
+        Stats.Count--;
+        s_GpuObjects.erase(It);
+    }
+
+    void FMemoryTracker::InstallImGuiAllocator()
+    {
+        ImGui::SetAllocatorFunctions
+        (
+            [](std::size_t Size, void*) { return TrackedMalloc(EMemoryTag::ImGui, Size); },
+            [](void* Ptr, void*) { TrackedMallocFree(EMemoryTag::ImGui, Ptr); }
+        );
+    }
+
+    void FMemoryTracker::MarkFrame()
+    {
+        std::array<std::uint64_t, TagCount> Allocations{};
+        std::array<std::uint64_t, TagCount> AllocatedBytes{};
+        std::array<std::uint64_t, TagCount> FreedBytes{};
+
+        std::lock_guard Lock(s_StatsMutex);
+        s_Stats.Threads.clear();
+
+        const auto Accumulate = [&](const FThreadCounters& Counters, std::uint64_t& OutAllocations, std::uint64_t& OutBytes)
+        {
+            for (std::size_t Tag = 0; Tag < TagCount; Tag++)
+            {
+                const std::uint64_t ThreadAllocations = Counters.Tags[Tag].Allocations.load(std::memory_order_relaxed);
+                const std::uint64_t ThreadBytes = Counters.Tags[Tag].AllocatedBytes.load(std::memory_order_relaxed);
+                Allocations[Tag] += ThreadAllocations;
+                AllocatedBytes[Tag] += ThreadBytes;
+                FreedBytes[Tag] += Counters.Tags[Tag].FreedBytes.load(std::memory_order_relaxed);
+                OutAllocations += ThreadAllocations;
+                OutBytes += ThreadBytes;
+            }
+        };
+
+        const std::uint32_t ThreadCount = std::min(s_ThreadCount.load(std::memory_order_acquire), MaxThreads);
+        for (std::uint32_t Index = 0; Index < ThreadCount; Index++)
+        {
+            const FThreadCounters* Counters = s_Threads[Index].load(std::memory_order_acquire);
+            if (!Counters)
+                continue; // Registered but not published yet
+
+            std::uint64_t ThreadAllocations = 0;
+            std::uint64_t ThreadBytes = 0;
+            Accumulate(*Counters, ThreadAllocations, ThreadBytes);
+
+            FMemoryThreadStats Stats;
+            Stats.ThreadIndex = Index;
+            Stats.AllocationsLastFrame = static_cast<std::uint32_t>(ThreadAllocations - s_PreviousThreadAllocations[Index]);
+            Stats.BytesLastFrame = ThreadBytes - s_PreviousThreadBytes[Index];
+            s_Stats.Threads.push_back(Stats);
+            s_PreviousThreadAllocations[Index] = ThreadAllocations;
+            s_PreviousThreadBytes[Index] = ThreadBytes;
+        }
+
+        std::uint64_t SharedAllocations = 0;
+        std::uint64_t SharedBytes = 0;
+        Accumulate(s_SharedCounters, SharedAllocations, SharedBytes);
+
+        std::uint64_t FrameAllocations = 0;
+        s_Stats.LiveBytes = 0;
+        for (std::size_t Tag = 0; Tag < TagCount; Tag++)
+        {
+            FMemoryTagStats& Stats = s_Stats.Tags[Tag];
+            // Frees can be counted on another thread before the allocation's thread is read
+            Stats.LiveBytes = AllocatedBytes[Tag] > FreedBytes[Tag] ? AllocatedBytes[Tag] - FreedBytes[Tag] : 0;
+            Stats.PeakBytes = std::max(Stats.PeakBytes, Stats.LiveBytes);
+            Stats.TotalAllocations = Allocations[Tag];
+            Stats.AllocationsLastFrame = static_cast<std::uint32_t>(Allocations[Tag] - s_PreviousAllocations[Tag]);
+            Stats.BytesLastFrame = AllocatedBytes[Tag] - s_PreviousBytes[Tag];
+
+            s_PreviousAllocations[Tag] = Allocations[Tag];
+            s_PreviousBytes[Tag] = AllocatedBytes[Tag];
+            FrameAllocations += Stats.AllocationsLastFrame;
+            s_Stats.LiveBytes += Stats.LiveBytes;
+        }
+        s_Stats.PeakBytes = std::max(s_Stats.PeakBytes, s_Stats.LiveBytes);
+
+        s_Stats.AllocationHistory[s_Stats.FrameCount % FMemoryStats::HistorySize] = static_cast<float>(FrameAllocations);
+        s_Stats.FrameCount++;
+
+        {
+            std::lock_guard GpuLock(s_GpuMutex);
+            s_Stats.Gpu = s_GpuStats;
+        }
+    }
+
+    void FMemoryTracker::GetStats(FMemoryStats& OutStats)
+    {
+        std::lock_guard Lock(s_StatsMutex);
+        OutStats.Tags = s_Stats.Tags;
+        OutStats.Gpu = s_Stats.Gpu;
+        OutStats.Threads.assign(s_Stats.Threads.begin(), s_Stats.Threads.end());
+        OutStats.LiveBytes = s_Stats.LiveBytes;
+        OutStats.PeakBytes = s_Stats.PeakBytes;
+        OutStats.FrameCount = s_Stats.FrameCount;
+
+        // Unroll the ring so the history reads oldest first
+        const std::size_t Count = std::min(s_Stats.FrameCount, FMemoryStats::HistorySize);
+        for (std::size_t i = 0; i < Count; i++)
+        {
+            OutStats.AllocationHistory[i] = s_Stats.AllocationHistory[(s_Stats.FrameCount - Count + i) % FMemoryStats::HistorySize];
+        }
+    }
+
+    const char* FMemoryTracker::GetTagName(EMemoryTag Tag)
+    {
+        switch (Tag)
+        {
+            case EMemoryTag::Untagged:    return "Untagged";
+            case EMemoryTag::Application: return "Application";
+            case EMemoryTag::Layers:      return "Layers";
+            case EMemoryTag::UI:          return "UI";
+            case EMemoryTag::Assets:      return "Assets";
+            case EMemoryTag::ECS:         return "ECS";
+            case EMemoryTag::Jobs:        return "Jobs";
+            case EMemoryTag::Logging:     return "Logging";
+            case EMemoryTag::ImGui:       return "ImGui";
+            case EMemoryTag::Raylib:      return "raylib";
+            case EMemoryTag::Count:       break;
+        }
+        return "?";
+    }
+
+    const char* FMemoryTracker::GetGpuResourceName(EGpuResource Kind)
+    {
+        switch (Kind)
+        {
+            case EGpuResource::Texture:      return "Textures";
+            case EGpuResource::RenderTarget: return "Render targets";
+            case EGpuResource::Buffer:       return "Buffers";
+            case EGpuResource::Count:        break;
+        }
+        return "?";
+    }
+
+}
+
+// --- raylib hooks ---
+
+extern "C" void* CoreMemoryRaylibMalloc(size_t Size)
+{
+    return Core::TrackedMalloc(Core::EMemoryTag::Raylib, Size);
+}
+
+extern "C" void* CoreMemoryRaylibCalloc(size_t Count, size_t Size)
+{
+    void* Memory = std::calloc(Count, Size);
+    if (Memory)
+        Core::GetThreadCounters().RecordAllocation(Core::EMemoryTag::Raylib, Core::GetUsableSize(Memory));
+    return Memory;
+}
+
+extern "C" void* CoreMemoryRaylibRealloc(void* Ptr, size_t Size)
+{
+    const std::size_t OldSize = Ptr ? Core::GetUsableSize(Ptr) : 0;
+    void* Memory = std::realloc(Ptr, Size);
+    if (!Memory)
+        return nullptr;
+
+    Core::FThreadCounters& Counters = Core::GetThreadCounters();
+    if (Ptr)
+        Counters.RecordFree(Core::EMemoryTag::Raylib, OldSize);
+    Counters.RecordAllocation(Core::EMemoryTag::Raylib, Core::GetUsableSize(Memory));
+    return Memory;
+}
+
+extern "C" void CoreMemoryRaylibFree(void* Ptr)
+{
+    Core::TrackedMallocFree(Core::EMemoryTag::Raylib, Ptr);
+}
+
+// --- Global operator new/delete ---
+
+void* operator new(std::size_t Size) { return Core::TrackedAllocateOrThrow(Size, alignof(std::max_align_t)); }
+void* operator new[](std::size_t Size) { return Core::TrackedAllocateOrThrow(Size, alignof(std::max_align_t)); }
+void* operator new(std::size_t Size, std::align_val_t Alignment) { return Core::TrackedAllocateOrThrow(Size, static_cast<std::size_t>(Alignment)); }
+void* operator new[](std::size_t Size, std::align_val_t Alignment) { return Core::TrackedAllocateOrThrow(Size, static_cast<std::size_t>(Alignment)); }
+void* operator new(std::size_t Size, const std::nothrow_t&) noexcept { return Core::TrackedAllocate(Size, alignof(std::max_align_t)); }
+void* operator new[](std::size_t Size, const std::nothrow_t&) noexcept { return Core::TrackedAllocate(Size, alignof(std::max_align_t)); }
+void* operator new(std::size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept { return Core::TrackedAllocate(Size, static_cast<std::size_t>(Alignment)); }
+void* operator new[](std::size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept { return Core::TrackedAllocate(Size, static_cast<std::size_t>(Alignment)); }
+
+void operator delete(void* Ptr) noexcept { Core::TrackedFree(Ptr); }
+void operator delete[](void* Ptr) noexcept { Core::TrackedFree(Ptr); }
+void operator delete(void* Ptr, std::size_t) noexcept { Core::TrackedFree(Ptr); }
+void operator delete[](void* Ptr, std::size_t) noexcept { Core::TrackedFree(Ptr); }
+void operator delete(void* Ptr, std::align_val_t) noexcept { Core::TrackedFree(Ptr); }
+void operator delete[](void* Ptr, std::align_val_t) noexcept { Core::TrackedFree(Ptr); }
+void operator delete(void* Ptr, std::size_t, std::align_val_t) noexcept { Core::TrackedFree(Ptr); }
+void operator delete[](void* Ptr, std::size_t, std::align_val_t) noexcept { Core::TrackedFree(Ptr); }
+void operator delete(void* Ptr, const std::nothrow_t&) noexcept { Core::TrackedFree(Ptr); }
+void operator delete[](void* Ptr, const std::nothrow_t&) noexcept { Core::TrackedFree(Ptr); }
+void operator delete(void* Ptr, std::align_val_t, const std::nothrow_t&) noexcept { Core::TrackedFree(Ptr); }
+void operator delete[](void* Ptr, std::align_val_t, const std::nothrow_t&) noexcept { Core::TrackedFree(Ptr); }
+
+#endif
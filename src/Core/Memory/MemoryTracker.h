@@ -0,0 +1,147 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+#include "Core/Profiling/Profiler.h"
+
+// The tracker compiles out unless CORE_ENABLE_MEMORY_TRACKING is defined (see cmake/Options.cmake).
+// When it is on, global operator new/delete are replaced, raylib's RL_MALLOC family is routed
+// here (see RaylibAllocatorHooks.h) and ImGui's allocator is installed before its context exists.
+#ifdef CORE_ENABLE_MEMORY_TRACKING
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Core
+{
+
+    // Subsystem a heap allocation is charged to. ImGui and Raylib are set by their allocator hooks;
+    // everything else uses the tag of the allocating thread's innermost FMemoryTagScope.
+    enum class EMemoryTag : std::uint8_t
+    {
+        Untagged,
+        Application,
+        Layers,
+        UI,
+        Assets,
+        ECS,
+        Jobs,
+        Logging,
+        ImGui,
+        Raylib,
+
+        Count
+    };
+
+    enum class EGpuResource : std::uint8_t
+    {
+        Texture,
+        RenderTarget,
+        Buffer,
+
+        Count
+    };
+
+    struct FMemoryTagStats
+    {
+        std::uint64_t LiveBytes = 0;
+        std::uint64_t PeakBytes = 0;            // Largest LiveBytes seen at a frame boundary
+        std::uint64_t TotalAllocations = 0;
+        std::uint32_t AllocationsLastFrame = 0;
+        std::uint64_t BytesLastFrame = 0;
+    };
+
+    struct FMemoryThreadStats
+    {
+        std::uint32_t ThreadIndex = 0;          // In order of each thread's first allocation
+        std::uint32_t AllocationsLastFrame = 0;
+        std::uint64_t BytesLastFrame = 0;
+    };
+
+    struct FGpuMemoryStats
+    {
+        std::uint64_t LiveBytes = 0;
+        std::uint64_t PeakBytes = 0;
+        std::uint32_t Count = 0;
+    };
+
+    struct FMemoryStats
+    {
+        static constexpr std::size_t HistorySize = 120;
+
+        std::array<FMemoryTagStats, static_cast<std::size_t>(EMemoryTag::Count)> Tags{};
+        std::array<FGpuMemoryStats, static_cast<std::size_t>(EGpuResource::Count)> Gpu{};
+        std::vector<FMemoryThreadStats> Threads;
+
+        std::uint64_t LiveBytes = 0;
+        std::uint64_t PeakBytes = 0;
+        // Heap allocations per frame, oldest first
+        std::array<float, HistorySize> AllocationHistory{};
+        std::size_t FrameCount = 0;
+    };
+
+    // Heap and GPU memory accounting. Counters live per thread and are written without atomic
+    // read-modify-writes, so an allocation costs a header, a thread_local lookup and two plain
+    // stores on top of malloc. Totals are gathered once per frame by MarkFrame.
+    class FMemoryTracker
+    {
+    public:
+        // Returns the previous tag
+        static EMemoryTag SetThreadTag(EMemoryTag Tag);
+        [[nodiscard]] static EMemoryTag GetThreadTag();
+
+        // GPU objects are reported by the code that creates them; Id is the GL name
+        static void TrackGpuAllocation(EGpuResource Kind, unsigned int Id, std::size_t Bytes);
+        static void TrackGpuRelease(EGpuResource Kind, unsigned int Id);
+
+        // Must run before ImGui::CreateContext
+        static void InstallImGuiAllocator();
+
+        // Render thread, once per frame: closes the frame's counters and updates the peaks
+        static void MarkFrame();
+
+        // Copies the statistics as of the last MarkFrame, reusing OutStats' storage
+        static void GetStats(FMemoryStats& OutStats);
+
+        [[nodiscard]] static const char* GetTagName(EMemoryTag Tag);
+        [[nodiscard]] static const char* GetGpuResourceName(EGpuResource Kind);
+    };
+
+    class FMemoryTagScope
+    {
+    public:
+        explicit FMemoryTagScope(EMemoryTag Tag)
+            : Previous(FMemoryTracker::SetThreadTag(Tag))
+        {
+        }
+
+        ~FMemoryTagScope()
+        {
+            FMemoryTracker::SetThreadTag(Previous);
+        }
+
+        FMemoryTagScope(const FMemoryTagScope&) = delete;
+        FMemoryTagScope& operator=(const FMemoryTagScope&) = delete;
+
+    private:
+        EMemoryTag Previous;
+    };
+
+}
+
+#define CORE_MEMORY_TAG(Tag) ::Core::FMemoryTagScope CORE_PROFILE_CONCAT(MemoryTagScope_, __LINE__)(::Core::EMemoryTag::Tag)
+#define CORE_MEMORY_FRAME() ::Core::FMemoryTracker::MarkFrame()
+#define CORE_MEMORY_INSTALL_IMGUI_ALLOCATOR() ::Core::FMemoryTracker::InstallImGuiAllocator()
+#define CORE_MEMORY_GPU_ALLOC(Kind, Id, Bytes) ::Core::FMemoryTracker::TrackGpuAllocation(::Core::EGpuResource::Kind, Id, Bytes)
+#define CORE_MEMORY_GPU_FREE(Kind, Id) ::Core::FMemoryTracker::TrackGpuRelease(::Core::EGpuResource::Kind, Id)
+
+#else
+
+#define CORE_MEMORY_TAG(Tag)
+#define CORE_MEMORY_FRAME()
+#define CORE_MEMORY_INSTALL_IMGUI_ALLOCATOR()
+#define CORE_MEMORY_GPU_ALLOC(Kind, Id, Bytes)
+#define CORE_MEMORY_GPU_FREE(Kind, Id)
+
+#endif
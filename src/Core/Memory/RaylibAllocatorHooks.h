@@ -0,0 +1,25 @@
+#pragma once
+
+/* Force-included into the raylib target when CORE_ENABLE_MEMORY_TRACKING is on (see
+   cmake/Dependencies.cmake). raylib only defines its RL_MALLOC family when they are not defined
+   yet, so every allocation it and its bundled libraries make goes to the memory tracker. */
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void* CoreMemoryRaylibMalloc(size_t Size);
+void* CoreMemoryRaylibCalloc(size_t Count, size_t Size);
+void* CoreMemoryRaylibRealloc(void* Ptr, size_t Size);
+void CoreMemoryRaylibFree(void* Ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define RL_MALLOC(sz) CoreMemoryRaylibMalloc(sz)
+#define RL_CALLOC(n, sz) CoreMemoryRaylibCalloc(n, sz)
+#define RL_REALLOC(ptr, sz) CoreMemoryRaylibRealloc(ptr, sz)
+#define RL_FREE(ptr) CoreMemoryRaylibFree(ptr)
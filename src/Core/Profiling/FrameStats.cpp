@@ -0,0 +1,114 @@
+#include "FrameStats.h"
+#include "Core/Logging/Log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <iterator>
+
+namespace Core
+{
+
+    namespace
+    {
+        // Nearest rank of an ascending sample
+        double Percentile(const std::vector<double>& Sorted, double Fraction)
+        {
+            const std::size_t Rank = static_cast<std::size_t>(std::ceil(Fraction * static_cast<double>(Sorted.size())));
+            return Sorted[std::clamp<std::size_t>(Rank, 1, Sorted.size()) - 1];
+        }
+
+        void AppendJsonString(std::string& Out, std::string_view Text)
+        {
+            Out += '"';
+            for (const char Char : Text)
+            {
+                if (Char == '"' || Char == '\\')
+                {
+                    Out += '\\';
+                    Out += Char;
+                }
+                else if (static_cast<unsigned char>(Char) < 0x20)
+                {
+                    std::format_to(std::back_inserter(Out), "\\u{:04x}", static_cast<unsigned>(Char));
+                }
+                else
+                {
+                    Out += Char;
+                }
+            }
+            Out += '"';
+        }
+    }
+
+    FFrameStatsSummary FFrameStats::Summarize() const
+    {
+        FFrameStatsSummary Summary;
+        Summary.Frames = FrameSeconds.size();
+        if (FrameSeconds.empty())
+            return Summary;
+
+        std::vector<double> Sorted = FrameSeconds;
+        std::sort(Sorted.begin(), Sorted.end());
+
+        double Total = 0.0;
+        for (const double Seconds : Sorted)
+            Total += Seconds;
+        const double Mean = Total / static_cast<double>(Sorted.size());
+
+        double SquaredDeviations = 0.0;
+        for (const double Seconds : Sorted)
+            SquaredDeviations += (Seconds - Mean) * (Seconds - Mean);
+        const double Variance = Sorted.size() > 1 ? SquaredDeviations / static_cast<double>(Sorted.size() - 1) : 0.0;
+
+        Summary.TotalSeconds = Total;
+        Summary.MeanMs = Mean * 1000.0;
+        Summary.StdDevMs = std::sqrt(Variance) * 1000.0;
+        Summary.MinMs = Sorted.front() * 1000.0;
+        Summary.MaxMs = Sorted.back() * 1000.0;
+        Summary.P50Ms = Percentile(Sorted, 0.50) * 1000.0;
+        Summary.P90Ms = Percentile(Sorted, 0.90) * 1000.0;
+        Summary.P99Ms = Percentile(Sorted, 0.99) * 1000.0;
+        return Summary;
+    }
+
+    bool FFrameStats::WriteJson(const std::string& Path, const FInfo& Info) const
+    {
+        const FFrameStatsSummary Summary = Summarize();
+
+        std::string Json = "{\n";
+        for (const auto& [Key, Value] : Info)
+        {
+            Json += "  ";
+            AppendJsonString(Json, Key);
+            Json += ": ";
+            AppendJsonString(Json, Value);
+            Json += ",\n";
+        }
+        std::format_to(std::back_inserter(Json),
+            "  \"frames\": {},\n  \"total_seconds\": {:.6f},\n  \"fps\": {:.3f},\n"
+            "  \"mean_ms\": {:.4f},\n  \"stddev_ms\": {:.4f},\n  \"min_ms\": {:.4f},\n  \"max_ms\": {:.4f},\n"
+            "  \"p50_ms\": {:.4f},\n  \"p90_ms\": {:.4f},\n  \"p99_ms\": {:.4f},\n  \"frame_ms\": [",
+            Summary.Frames, Summary.TotalSeconds, Summary.TotalSeconds > 0.0 ? static_cast<double>(Summary.Frames) / Summary.TotalSeconds : 0.0,
+            Summary.MeanMs, Summary.StdDevMs, Summary.MinMs, Summary.MaxMs,
+            Summary.P50Ms, Summary.P90Ms, Summary.P99Ms);
+        for (std::size_t Index = 0; Index < FrameSeconds.size(); Index++)
+        {
+            std::format_to(std::back_inserter(Json), "{}{:.4f}", Index % 16 == 0 ? "\n    " : " ", FrameSeconds[Index] * 1000.0);
+            if (Index + 1 < FrameSeconds.size())
+                Json += ',';
+        }
+        Json += "\n  ]\n}\n";
+
+        std::ofstream File(Path, std::ios::binary);
+        File.write(Json.data(), static_cast<std::streamsize>(Json.size()));
+        if (!File)
+        {
+            FLog::CoreError("Failed to write frame stats to {}", Path);
+            return false;
+        }
+        return true;
+    }
+
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace Core
+{
+
+    struct FFrameStatsSummary
+    {
+        std::size_t Frames = 0;
+        double TotalSeconds = 0.0;
+        double MeanMs = 0.0;
+        double StdDevMs = 0.0;
+        double MinMs = 0.0;
+        double MaxMs = 0.0;
+        double P50Ms = 0.0;
+        double P90Ms = 0.0;
+        double P99Ms = 0.0;
+    };
+
+    // Frame times of a run, summarized and written as JSON for automated performance tracking.
+    // One thread records.
+    class FFrameStats
+    {
+    public:
+        using FInfo = std::vector<std::pair<std::string, std::string>>;
+
+        void Reserve(std::size_t Frames) { FrameSeconds.reserve(Frames); }
+        void Add(double Seconds) { FrameSeconds.push_back(Seconds); }
+        void Clear() { FrameSeconds.clear(); }
+
+        [[nodiscard]] std::size_t GetCount() const { return FrameSeconds.size(); }
+        [[nodiscard]] FFrameStatsSummary Summarize() const;
+
+        // The summary, Info as string fields and every frame time in milliseconds. Logs and
+        // returns false when the file cannot be written.
+        bool WriteJson(const std::string& Path, const FInfo& Info) const;
+
+    private:
+        std::vector<double> FrameSeconds;
+    };
+
+}
@@ -0,0 +1,234 @@
+#include "GpuProfiler.h"
+
+#ifdef CORE_ENABLE_PROFILING
+
+#include "Core/Base/Core.h"
+#include "Core/Logging/Log.h"
+
+#ifdef CORE_PLATFORM_WEB
+    #include <GLES3/gl3.h>
+#else
+    #include <glad/glad.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace Core
+{
+
+    namespace
+    {
+        struct FQuerySet
+        {
+            std::array<GLuint, FGpuProfiler::MaxPassesPerFrame> Queries{};
+            std::array<const char*, FGpuProfiler::MaxPassesPerFrame> Names{};
+            std::uint32_t Count = 0;
+
+            // Submitted and waiting for the GPU
+            bool bPending = false;
+        };
+
+        struct FPassHistory
+        {
+            std::array<double, FGpuProfiler::AverageWindow> Samples{};
+            std::size_t Next = 0;
+            double Sum = 0.0;
+        };
+
+        struct FGpuProfilerState
+        {
+            bool bSupported = false;
+            bool bPassOpen = false;
+            bool bWarnedNested = false;
+
+            std::array<FQuerySet, FGpuProfiler::FramesInFlight> Sets;
+            std::size_t WriteIndex = 0;
+
+            std::mutex StatsMutex;
+            std::vector<FGpuPassStats> Stats;
+            std::vector<FPassHistory> Histories; // Parallel to Stats
+        };
+
+        FGpuProfilerState& GetGpuProfilerState()
+        {
+            static FGpuProfilerState State;
+            return State;
+        }
+
+        void RecordSample(FGpuProfilerState& State, const char* Name, double Ms)
+        {
+            std::size_t Index = 0;
+            while (Index < State.Stats.size() && std::strcmp(State.Stats[Index].Name, Name) != 0)
+                Index++;
+
+            if (Index == State.Stats.size())
+            {
+                State.Stats.push_back(FGpuPassStats{ Name });
+                State.Histories.emplace_back();
+            }
+
+            FGpuPassStats& Stats = State.Stats[Index];
+            FPassHistory& History = State.Histories[Index];
+
+            History.Sum += Ms - History.Samples[History.Next];
+            History.Samples[History.Next] = Ms;
+            History.Next = (History.Next + 1) % FGpuProfiler::AverageWindow;
+
+            Stats.SampleCount = std::min<std::uint32_t>(Stats.SampleCount + 1, FGpuProfiler::AverageWindow);
+            Stats.LastMs = Ms;
+            Stats.AverageMs = History.Sum / Stats.SampleCount;
+        }
+
+        // Reads a set back if the GPU is done with it. Queries finish in submission order,
+        // so the last one being available means the whole set is.
+        bool TryCollect(FGpuProfilerState& State, FQuerySet& Set)
+        {
+            #ifdef CORE_PLATFORM_WEB
+                (void)State;
+                (void)Set;
+                return false;
+            #else
+                GLuint bAvailable = GL_FALSE;
+                glGetQueryObjectuiv(Set.Queries[Set.Count - 1], GL_QUERY_RESULT_AVAILABLE, &bAvailable);
+                if (!bAvailable)
+                    return false;
+
+                std::lock_guard<std::mutex> Lock(State.StatsMutex);
+                for (std::uint32_t i = 0; i < Set.Count; i++)
+                {
+                    GLuint64 ElapsedNs = 0;
+                    glGetQueryObjectui64v(Set.Queries[i], GL_QUERY_RESULT, &ElapsedNs);
+                    RecordSample(State, Set.Names[i], static_cast<double>(ElapsedNs) / 1.0e6);
+                }
+
+                Set.bPending = false;
+                return true;
+            #endif
+        }
+    }
+
+    void FGpuProfiler::Init()
+    {
+        FGpuProfilerState& State = GetGpuProfilerState();
+
+        // WebGL exposes timer queries only through a disjoint-timer extension that GLES3 headers lack
+        #ifdef CORE_PLATFORM_WEB
+            State.bSupported = false;
+        #else
+            State.bSupported = GLAD_GL_VERSION_3_3 && glGenQueries && glGetQueryObjectui64v;
+            if (State.bSupported)
+            {
+                for (FQuerySet& Set : State.Sets)
+                    glGenQueries(static_cast<GLsizei>(Set.Queries.size()), Set.Queries.data());
+            }
+        #endif
+
+        if (!State.bSupported)
+        {
+            FLog::CoreWarn("GPU timer queries are not supported by this context, GPU timings are disabled");
+        }
+    }
+
+    void FGpuProfiler::Shutdown()
+    {
+        FGpuProfilerState& State = GetGpuProfilerState();
+        if (!State.bSupported)
+            return;
+
+        #ifndef CORE_PLATFORM_WEB
+            for (FQuerySet& Set : State.Sets)
+            {
+                glDeleteQueries(static_cast<GLsizei>(Set.Queries.size()), Set.Queries.data());
+                Set = FQuerySet{};
+            }
+        #endif
+
+        State.bSupported = false;
+    }
+
+    bool FGpuProfiler::IsSupported()
+    {
+        return GetGpuProfilerState().bSupported;
+    }
+
+    void FGpuProfiler::BeginFrame()
+    {
+        FGpuProfilerState& State = GetGpuProfilerState();
+        if (!State.bSupported)
+            return;
+
+        FQuerySet& Previous = State.Sets[State.WriteIndex];
+        Previous.bPending = Previous.Count > 0;
+
+        State.WriteIndex = (State.WriteIndex + 1) % FramesInFlight;
+
+        // Oldest first; stop at the first set still in flight since later ones cannot be done either
+        for (std::size_t i = 0; i < FramesInFlight; i++)
+        {
+            FQuerySet& Set = State.Sets[(State.WriteIndex + i) % FramesInFlight];
+            if (Set.bPending && !TryCollect(State, Set))
+                break;
+        }
+
+        // Still in flight after FramesInFlight frames: drop the sample rather than stall on it
+        FQuerySet& Current = State.Sets[State.WriteIndex];
+        Current.bPending = false;
+        Current.Count = 0;
+    }
+
+    bool FGpuProfiler::BeginPass(const char* Name)
+    {
+        FGpuProfilerState& State = GetGpuProfilerState();
+        if (!State.bSupported)
+            return false;
+
+        if (State.bPassOpen)
+        {
+            if (!State.bWarnedNested)
+            {
+                FLog::CoreWarn("GPU pass '{}' ignored: timer queries cannot nest", Name);
+                State.bWarnedNested = true;
+            }
+            return false;
+        }
+
+        FQuerySet& Set = State.Sets[State.WriteIndex];
+        if (Set.Count == MaxPassesPerFrame)
+            return false;
+
+        #ifndef CORE_PLATFORM_WEB
+            glBeginQuery(GL_TIME_ELAPSED, Set.Queries[Set.Count]);
+        #endif
+        Set.Names[Set.Count] = Name;
+        Set.Count++;
+        State.bPassOpen = true;
+        return true;
+    }
+
+    void FGpuProfiler::EndPass()
+    {
+        FGpuProfilerState& State = GetGpuProfilerState();
+        if (!State.bPassOpen)
+            return;
+
+        #ifndef CORE_PLATFORM_WEB
+            glEndQuery(GL_TIME_ELAPSED);
+        #endif
+        State.bPassOpen = false;
+    }
+
+    std::mutex& FGpuProfiler::GetStatsMutex()
+    {
+        return GetGpuProfilerState().StatsMutex;
+    }
+
+    const std::vector<FGpuPassStats>& FGpuProfiler::GetStats()
+    {
+        return GetGpuProfilerState().Stats;
+    }
+
+}
+
+#endif
@@ -0,0 +1,94 @@
+#pragma once
+
+#ifdef CORE_ENABLE_PROFILING
+
+#include "Profiler.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace Core
+{
+
+    struct FGpuPassStats
+    {
+        const char* Name = nullptr;     // Must outlive the profiler (literals)
+        double LastMs = 0.0;
+        double AverageMs = 0.0;
+        std::uint32_t SampleCount = 0;
+    };
+
+    // GL_TIME_ELAPSED queries around named GPU passes. Every frame writes into its own query set
+    // and results are read back FramesInFlight frames later, once the GPU reports them available,
+    // so the CPU never waits on the GPU. Disables itself when the context has no timer queries.
+    // Everything except ForEachPass must be called on the thread that owns the GL context.
+    class FGpuProfiler
+    {
+    public:
+        static constexpr std::size_t FramesInFlight = 4;
+        static constexpr std::size_t MaxPassesPerFrame = 16;
+        static constexpr std::size_t AverageWindow = 60;
+
+        static void Init();
+        static void Shutdown();
+        [[nodiscard]] static bool IsSupported();
+
+        // Retires the previous frame's query set and collects every set the GPU has finished
+        static void BeginFrame();
+
+        // Timer queries cannot nest; a pass started while another is open is ignored
+        [[nodiscard]] static bool BeginPass(const char* Name);
+        static void EndPass();
+
+        // Calls Func(const FGpuPassStats&) for each pass seen so far, under the stats lock
+        template<typename F>
+        static void ForEachPass(F&& Func)
+        {
+            std::lock_guard<std::mutex> Lock(GetStatsMutex());
+            for (const FGpuPassStats& Stats : GetStats())
+                Func(Stats);
+        }
+
+    private:
+        static std::mutex& GetStatsMutex();
+        static const std::vector<FGpuPassStats>& GetStats();
+    };
+
+    class FGpuProfileScope
+    {
+    public:
+        explicit FGpuProfileScope(const char* Name)
+            : bActive(FGpuProfiler::BeginPass(Name))
+        {
+        }
+
+        ~FGpuProfileScope()
+        {
+            if (bActive)
+                FGpuProfiler::EndPass();
+        }
+
+        FGpuProfileScope(const FGpuProfileScope&) = delete;
+        FGpuProfileScope& operator=(const FGpuProfileScope&) = delete;
+
+    private:
+        bool bActive;
+    };
+
+}
+
+#define CORE_PROFILE_GPU_INIT() ::Core::FGpuProfiler::Init()
+#define CORE_PROFILE_GPU_SHUTDOWN() ::Core::FGpuProfiler::Shutdown()
+#define CORE_PROFILE_GPU_FRAME() ::Core::FGpuProfiler::BeginFrame()
+#define CORE_PROFILE_GPU_SCOPE(Name) ::Core::FGpuProfileScope CORE_PROFILE_CONCAT(GpuProfileScope_, __LINE__)(Name)
+
+#else
+
+#define CORE_PROFILE_GPU_INIT()
+#define CORE_PROFILE_GPU_SHUTDOWN()
+#define CORE_PROFILE_GPU_FRAME()
+#define CORE_PROFILE_GPU_SCOPE(Name)
+
+#endif
@@ -0,0 +1,241 @@
+#include "Profiler.h"
+
+#ifdef CORE_ENABLE_PROFILING
+
+#include "Core/Base/SPSCQueue.h"
+#include "Core/Logging/Log.h"
+
+#include <atomic>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <memory>
+
+namespace Core
+{
+
+    namespace
+    {
+        // What the hot path writes; turned into an FProfileZone when collected
+        struct FRawZone
+        {
+            const char* Name;
+            std::uint64_t StartTicks;
+            std::uint64_t EndTicks;
+            std::uint32_t Depth;
+        };
+
+        struct FThreadBuffer
+        {
+            TSPSCQueue<FRawZone, 8192> Zones;
+            std::string Name;
+            std::uint32_t Index = 0;
+
+            // Only touched by the owning thread
+            std::uint32_t Depth = 0;
+        };
+
+        struct FProfilerState
+        {
+            std::mutex RegistryMutex;
+            std::vector<std::unique_ptr<FThreadBuffer>> Threads;
+
+            std::mutex HistoryMutex;
+            std::vector<FProfileFrame> History = std::vector<FProfileFrame>(FProfiler::HistorySize);
+            std::size_t HistoryHead = 0; // Oldest frame, next one to be overwritten
+            std::uint64_t FrameStartNs = 0;
+
+            std::atomic<bool> bPaused{ false };
+
+            // Tick to nanosecond mapping, refined every frame against steady_clock
+            const std::uint64_t CalibrationTicks = FProfiler::NowTicks();
+            const std::uint64_t CalibrationNs = FProfiler::Now();
+            double NsPerTick = 1.0;
+        };
+
+        FProfilerState& GetProfilerState()
+        {
+            static FProfilerState State;
+            return State;
+        }
+
+        thread_local FThreadBuffer* t_ThreadBuffer = nullptr;
+
+        FThreadBuffer& GetThreadBuffer()
+        {
+            if (!t_ThreadBuffer)
+            {
+                FProfilerState& State = GetProfilerState();
+                std::lock_guard<std::mutex> Lock(State.RegistryMutex);
+
+                auto Buffer = std::make_unique<FThreadBuffer>();
+                Buffer->Index = static_cast<std::uint32_t>(State.Threads.size());
+                Buffer->Name = std::format("Thread {}", Buffer->Index);
+                t_ThreadBuffer = Buffer.get();
+                State.Threads.push_back(std::move(Buffer));
+            }
+            return *t_ThreadBuffer;
+        }
+
+        void AppendEscaped(std::string& Out, const char* Text)
+        {
+            for (const char* C = Text ? Text : ""; *C; ++C)
+            {
+                if (*C == '"' || *C == '\\')
+                    Out.push_back('\\');
+                Out.push_back(*C);
+            }
+        }
+    }
+
+    std::uint32_t FProfiler::BeginZone()
+    {
+        return GetThreadBuffer().Depth++;
+    }
+
+    void FProfiler::EndZone(const char* Name, std::uint64_t StartTicks, std::uint32_t Depth)
+    {
+        FThreadBuffer& Buffer = GetThreadBuffer();
+        Buffer.Depth = Depth;
+
+        // A full ring (nobody calling MarkFrame) drops the zone rather than stalling the caller
+        (void)Buffer.Zones.Push(FRawZone{ Name, StartTicks, NowTicks(), Depth });
+    }
+
+    void FProfiler::MarkFrame()
+    {
+        FProfilerState& State = GetProfilerState();
+        const std::uint64_t FrameEndNs = Now();
+
+        #ifdef CORE_PROFILE_HAS_TSC
+            const std::uint64_t ElapsedNs = FrameEndNs - State.CalibrationNs;
+            if (ElapsedNs > 1000000)
+            {
+                State.NsPerTick = static_cast<double>(ElapsedNs) / static_cast<double>(NowTicks() - State.CalibrationTicks);
+            }
+        #endif
+
+        const auto ToNs = [&State](std::uint64_t Ticks)
+        {
+            const double Delta = static_cast<double>(static_cast<std::int64_t>(Ticks - State.CalibrationTicks)) * State.NsPerTick;
+            return static_cast<std::uint64_t>(static_cast<double>(State.CalibrationNs) + Delta);
+        };
+
+        std::lock_guard<std::mutex> HistoryLock(State.HistoryMutex);
+        const bool bRecord = State.FrameStartNs != 0 && !State.bPaused.load(std::memory_order_relaxed);
+
+        FProfileFrame& Frame = State.History[State.HistoryHead];
+        if (bRecord)
+        {
+            Frame.StartNs = State.FrameStartNs;
+            Frame.EndNs = FrameEndNs;
+            Frame.Zones.clear();
+        }
+
+        {
+            std::lock_guard<std::mutex> RegistryLock(State.RegistryMutex);
+            FRawZone Zone;
+            for (const auto& Buffer : State.Threads)
+            {
+                while (Buffer->Zones.Pop(Zone))
+                {
+                    if (bRecord)
+                        Frame.Zones.push_back({ Zone.Name, ToNs(Zone.StartTicks), ToNs(Zone.EndTicks), Buffer->Index, Zone.Depth });
+                }
+            }
+        }
+
+        if (bRecord)
+        {
+            State.HistoryHead = (State.HistoryHead + 1) % State.History.size();
+        }
+        State.FrameStartNs = FrameEndNs;
+    }
+
+    void FProfiler::SetThreadName(const char* Name)
+    {
+        FThreadBuffer& Buffer = GetThreadBuffer();
+        std::lock_guard<std::mutex> Lock(GetProfilerState().RegistryMutex);
+        Buffer.Name = Name;
+    }
+
+    void FProfiler::SetPaused(bool bInPaused)
+    {
+        GetProfilerState().bPaused.store(bInPaused, std::memory_order_relaxed);
+    }
+
+    bool FProfiler::IsPaused()
+    {
+        return GetProfilerState().bPaused.load(std::memory_order_relaxed);
+    }
+
+    std::vector<std::string> FProfiler::GetThreadNames()
+    {
+        FProfilerState& State = GetProfilerState();
+        std::lock_guard<std::mutex> Lock(State.RegistryMutex);
+
+        std::vector<std::string> Names;
+        Names.reserve(State.Threads.size());
+        for (const auto& Buffer : State.Threads)
+        {
+            Names.push_back(Buffer->Name);
+        }
+        return Names;
+    }
+
+    bool FProfiler::ExportChromeTrace(const std::string& Path)
+    {
+        std::string Json = "{\"traceEvents\":[\n";
+
+        const std::vector<std::string> ThreadNames = GetThreadNames();
+        for (std::size_t i = 0; i < ThreadNames.size(); i++)
+        {
+            Json += std::format("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{},\"args\":{{\"name\":\"", i);
+            AppendEscaped(Json, ThreadNames[i].c_str());
+            Json += "\"}},\n";
+        }
+
+        ForEachFrame([&Json](const FProfileFrame& Frame, std::size_t)
+        {
+            for (const FProfileZone& Zone : Frame.Zones)
+            {
+                Json += "{\"name\":\"";
+                AppendEscaped(Json, Zone.Name);
+                std::format_to(std::back_inserter(Json), "\",\"ph\":\"X\",\"pid\":0,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}},\n",
+                    Zone.ThreadIndex, Zone.StartNs / 1000.0, (Zone.EndNs - Zone.StartNs) / 1000.0);
+            }
+        });
+
+        // Trailing comma is not valid JSON; finish with an empty metadata event instead
+        Json += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":0,\"args\":{\"name\":\"Core\"}}\n]}\n";
+
+        std::ofstream File(Path, std::ios::binary);
+        if (!File)
+        {
+            FLog::CoreError("Failed to open '{}' for the profiler trace", Path);
+            return false;
+        }
+
+        File.write(Json.data(), static_cast<std::streamsize>(Json.size()));
+        FLog::CoreDebug("Profiler trace written to '{}'", Path);
+        return static_cast<bool>(File);
+    }
+
+    std::mutex& FProfiler::GetHistoryMutex()
+    {
+        return GetProfilerState().HistoryMutex;
+    }
+
+    std::vector<FProfileFrame>& FProfiler::GetHistory()
+    {
+        return GetProfilerState().History;
+    }
+
+    std::size_t FProfiler::GetHistoryHead()
+    {
+        return GetProfilerState().HistoryHead;
+    }
+
+}
+
+#endif
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+
+#define CORE_PROFILE_CONCAT_INNER(a, b) a##b
+#define CORE_PROFILE_CONCAT(a, b) CORE_PROFILE_CONCAT_INNER(a, b)
+
+// The whole profiler compiles out unless CORE_ENABLE_PROFILING is defined (see cmake/Options.cmake)
+#ifdef CORE_ENABLE_PROFILING
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Zones are stamped with the CPU timestamp counter where available; it is several times
+// cheaper than steady_clock and keeps a zone well under 50 ns
+#if defined(_MSC_VER) && defined(_M_X64)
+    #include <intrin.h>
+    #define CORE_PROFILE_HAS_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define CORE_PROFILE_HAS_TSC
+#endif
+
+namespace Core
+{
+
+    struct FProfileZone
+    {
+        const char* Name = nullptr;     // Must outlive the profiler history (literals, layer names)
+        std::uint64_t StartNs = 0;
+        std::uint64_t EndNs = 0;
+        std::uint32_t ThreadIndex = 0;
+        std::uint32_t Depth = 0;
+    };
+
+    struct FProfileFrame
+    {
+        std::uint64_t StartNs = 0;
+        std::uint64_t EndNs = 0;
+        std::vector<FProfileZone> Zones;
+    };
+
+    // Hierarchical CPU profiler. Zones are recorded into per-thread lock-free ring buffers and
+    // gathered into a frame history once per frame by the thread that calls MarkFrame.
+    class FProfiler
+    {
+    public:
+        static constexpr std::size_t HistorySize = 240;
+
+        [[nodiscard]] static std::uint64_t Now()
+        {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+
+        // Raw zone timestamp; converted to Now() nanoseconds when frames are collected
+        [[nodiscard]] static std::uint64_t NowTicks()
+        {
+            #ifdef CORE_PROFILE_HAS_TSC
+                return __rdtsc();
+            #else
+                return Now();
+            #endif
+        }
+
+        // Hot path, called by FProfileScope
+        static std::uint32_t BeginZone();
+        static void EndZone(const char* Name, std::uint64_t StartTicks, std::uint32_t Depth);
+
+        // Closes the current frame and collects every thread's zones into the history
+        static void MarkFrame();
+        static void SetThreadName(const char* Name);
+
+        static void SetPaused(bool bInPaused);
+        [[nodiscard]] static bool IsPaused();
+
+        // Calls Func(const FProfileFrame&, Index) for each recorded frame, oldest first, under the history lock
+        template<typename F>
+        static void ForEachFrame(F&& Func)
+        {
+            std::lock_guard<std::mutex> Lock(GetHistoryMutex());
+            const std::vector<FProfileFrame>& Frames = GetHistory();
+            std::size_t Index = 0;
+            for (std::size_t i = 0; i < Frames.size(); i++)
+            {
+                const FProfileFrame& Frame = Frames[(GetHistoryHead() + i) % Frames.size()];
+                if (Frame.EndNs != 0)
+                    Func(Frame, Index++);
+            }
+        }
+
+        [[nodiscard]] static std::vector<std::string> GetThreadNames();
+
+        // Writes the retained history in Chrome trace-event format (chrome://tracing, Perfetto)
+        static bool ExportChromeTrace(const std::string& Path);
+
+    private:
+        static std::mutex& GetHistoryMutex();
+        static std::vector<FProfileFrame>& GetHistory();
+        static std::size_t GetHistoryHead();
+    };
+
+    class FProfileScope
+    {
+    public:
+        explicit FProfileScope(const char* InName)
+            : Name(InName), Depth(FProfiler::BeginZone()), StartTicks(FProfiler::NowTicks())
+        {
+        }
+
+        ~FProfileScope()
+        {
+            FProfiler::EndZone(Name, StartTicks, Depth);
+        }
+
+        FProfileScope(const FProfileScope&) = delete;
+        FProfileScope& operator=(const FProfileScope&) = delete;
+
+    private:
+        const char* Name;
+        std::uint32_t Depth;
+        std::uint64_t StartTicks;
+    };
+
+}
+
+#define CORE_PROFILE_SCOPE(Name) ::Core::FProfileScope CORE_PROFILE_CONCAT(ProfileScope_, __LINE__)(Name)
+#define CORE_PROFILE_FUNCTION() CORE_PROFILE_SCOPE(__func__)
+#define CORE_PROFILE_FRAME() ::Core::FProfiler::MarkFrame()
+#define CORE_PROFILE_THREAD(Name) ::Core::FProfiler::SetThreadName(Name)
+
+#else
+
+#define CORE_PROFILE_SCOPE(Name)
+#define CORE_PROFILE_FUNCTION()
+#define CORE_PROFILE_FRAME()
+#define CORE_PROFILE_THREAD(Name)
+
+#endif
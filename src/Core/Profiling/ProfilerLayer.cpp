@@ -0,0 +1,256 @@
+#include "ProfilerLayer.h"
+
+#ifdef CORE_ENABLE_PROFILING
+
+#include "GpuProfiler.h"
+
+#include "imgui.h"
+
+#include <algorithm>
+#include <format>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+
+namespace Core
+{
+
+    static ImU32 GetZoneColor(const char* Name)
+    {
+        const std::size_t Hash = std::hash<std::string_view>{}(Name ? Name : "");
+        const float Hue = static_cast<float>(Hash % 360) / 360.0f;
+        return ImColor::HSV(Hue, 0.55f, 0.75f);
+    }
+
+    FProfilerLayer::FProfilerLayer()
+        : FLayer("Profiler")
+    {
+        // The panel reacts to nothing but ImGui input
+        SetEventCategoryMask(0);
+    }
+
+    void FProfilerLayer::OnUIRender()
+    {
+        CORE_PROFILE_FUNCTION();
+
+        if (!ImGui::Begin("Profiler"))
+        {
+            ImGui::End();
+            return;
+        }
+
+        bool bPaused = FProfiler::IsPaused();
+        if (ImGui::Checkbox("Pause", &bPaused))
+        {
+            FProfiler::SetPaused(bPaused);
+        }
+
+        ImGui::SameLine();
+        if (ImGui::Button("Export Chrome Trace"))
+        {
+            FProfiler::ExportChromeTrace("profile_trace.json");
+        }
+
+        // Gather the history once; copy the inspected frame out of the lock
+        FrameTimes.clear();
+        std::size_t FrameCount = 0;
+        FProfiler::ForEachFrame([&](const FProfileFrame& Frame, std::size_t)
+        {
+            FrameTimes.push_back(static_cast<float>(Frame.EndNs - Frame.StartNs) / 1.0e6f);
+            FrameCount++;
+        });
+
+        if (FrameCount == 0)
+        {
+            ImGui::TextDisabled("No frames recorded yet");
+            ImGui::End();
+            return;
+        }
+
+        FrameOffset = std::clamp(FrameOffset, 0, static_cast<int>(FrameCount) - 1);
+        const std::size_t SelectedIndex = FrameCount - 1 - static_cast<std::size_t>(FrameOffset);
+        FProfiler::ForEachFrame([&](const FProfileFrame& Frame, std::size_t Index)
+        {
+            if (Index == SelectedIndex)
+            {
+                SelectedFrame.StartNs = Frame.StartNs;
+                SelectedFrame.EndNs = Frame.EndNs;
+                SelectedFrame.Zones.assign(Frame.Zones.begin(), Frame.Zones.end());
+            }
+        });
+
+        const float MaxFrameTime = *std::max_element(FrameTimes.begin(), FrameTimes.end());
+        const std::string Overlay = std::format("{:.2f} ms", FrameTimes[SelectedIndex]);
+        ImGui::PlotHistogram("##FrameTimes", FrameTimes.data(), static_cast<int>(FrameTimes.size()), 0,
+            Overlay.c_str(), 0.0f, std::max(MaxFrameTime, 16.7f), ImVec2(-1.0f, 60.0f));
+
+        ImGui::SliderInt("Frames Back", &FrameOffset, 0, static_cast<int>(FrameCount) - 1);
+        ImGui::SliderFloat("Zoom", &ZoomLevel, 1.0f, 50.0f, "%.1fx", ImGuiSliderFlags_Logarithmic);
+
+        DrawFlameGraph(SelectedFrame);
+        DrawZoneTable(SelectedFrame);
+        DrawGpuPasses();
+
+        ImGui::End();
+    }
+
+    void FProfilerLayer::DrawFlameGraph(const FProfileFrame& Frame)
+    {
+        constexpr float RowHeight = 18.0f;
+        constexpr float LabelWidth = 90.0f;
+
+        const std::vector<std::string> ThreadNames = FProfiler::GetThreadNames();
+        std::vector<std::uint32_t> ThreadDepth(ThreadNames.size(), 0);
+        for (const FProfileZone& Zone : Frame.Zones)
+        {
+            if (Zone.ThreadIndex < ThreadDepth.size())
+                ThreadDepth[Zone.ThreadIndex] = std::max(ThreadDepth[Zone.ThreadIndex], Zone.Depth + 1);
+        }
+
+        float TotalHeight = 0.0f;
+        for (std::uint32_t Depth : ThreadDepth)
+        {
+            TotalHeight += std::max<std::uint32_t>(Depth, 1) * RowHeight + 4.0f;
+        }
+
+        const float AvailWidth = ImGui::GetContentRegionAvail().x;
+        if (!ImGui::BeginChild("##FlameGraph", ImVec2(0.0f, std::min(TotalHeight, 300.0f) + 16.0f), ImGuiChildFlags_Borders, ImGuiWindowFlags_HorizontalScrollbar))
+        {
+            ImGui::EndChild();
+            return;
+        }
+
+        const float TimelineWidth = std::max(AvailWidth - LabelWidth - 16.0f, 50.0f) * ZoomLevel;
+        const double FrameNs = static_cast<double>(std::max<std::uint64_t>(Frame.EndNs - Frame.StartNs, 1));
+        const ImVec2 Origin = ImGui::GetCursorScreenPos();
+        ImDrawList* DrawList = ImGui::GetWindowDrawList();
+
+        // Lane offsets per thread
+        std::vector<float> LaneY(ThreadNames.size(), 0.0f);
+        float Y = 0.0f;
+        for (std::size_t i = 0; i < ThreadNames.size(); i++)
+        {
+            LaneY[i] = Y;
+            DrawList->AddText(ImVec2(Origin.x, Origin.y + Y), ImGui::GetColorU32(ImGuiCol_TextDisabled), ThreadNames[i].c_str());
+            Y += std::max<std::uint32_t>(ThreadDepth[i], 1) * RowHeight + 4.0f;
+        }
+
+        const FProfileZone* Hovered = nullptr;
+        const ImVec2 Mouse = ImGui::GetMousePos();
+        for (const FProfileZone& Zone : Frame.Zones)
+        {
+            if (Zone.ThreadIndex >= LaneY.size())
+                continue;
+
+            // Zones from other threads can straddle the frame boundary
+            const double Start = std::max<double>(static_cast<double>(Zone.StartNs) - static_cast<double>(Frame.StartNs), 0.0);
+            const double End = std::min<double>(static_cast<double>(Zone.EndNs) - static_cast<double>(Frame.StartNs), FrameNs);
+            if (End <= Start)
+                continue;
+
+            const ImVec2 Min(Origin.x + LabelWidth + static_cast<float>(Start / FrameNs) * TimelineWidth,
+                             Origin.y + LaneY[Zone.ThreadIndex] + Zone.Depth * RowHeight);
+            const ImVec2 Max(std::max(Origin.x + LabelWidth + static_cast<float>(End / FrameNs) * TimelineWidth, Min.x + 1.0f),
+                             Min.y + RowHeight - 1.0f);
+
+            DrawList->AddRectFilled(Min, Max, GetZoneColor(Zone.Name));
+            if (Max.x - Min.x > 30.0f)
+            {
+                const ImVec4 Clip(Min.x + 2.0f, Min.y, Max.x - 2.0f, Max.y);
+                DrawList->AddText(nullptr, 0.0f, ImVec2(Min.x + 3.0f, Min.y + 1.0f), IM_COL32_WHITE, Zone.Name, nullptr, 0.0f, &Clip);
+            }
+
+            if (Mouse.x >= Min.x && Mouse.x < Max.x && Mouse.y >= Min.y && Mouse.y < Max.y)
+                Hovered = &Zone;
+        }
+
+        ImGui::Dummy(ImVec2(LabelWidth + TimelineWidth, TotalHeight));
+
+        if (Hovered && ImGui::IsWindowHovered())
+        {
+            ImGui::SetTooltip("%s\n%.3f ms", Hovered->Name, (Hovered->EndNs - Hovered->StartNs) / 1.0e6);
+        }
+
+        ImGui::EndChild();
+    }
+
+    void FProfilerLayer::DrawZoneTable(const FProfileFrame& Frame)
+    {
+        struct FZoneStats
+        {
+            const char* Name = nullptr;
+            std::uint64_t TotalNs = 0;
+            int Count = 0;
+        };
+
+        std::unordered_map<std::string_view, FZoneStats> StatsByName;
+        for (const FProfileZone& Zone : Frame.Zones)
+        {
+            FZoneStats& Stats = StatsByName[Zone.Name ? Zone.Name : ""];
+            Stats.Name = Zone.Name;
+            Stats.TotalNs += Zone.EndNs - Zone.StartNs;
+            Stats.Count++;
+        }
+
+        std::vector<FZoneStats> Sorted;
+        Sorted.reserve(StatsByName.size());
+        for (const auto& [Name, Stats] : StatsByName)
+            Sorted.push_back(Stats);
+
+        std::sort(Sorted.begin(), Sorted.end(), [](const FZoneStats& A, const FZoneStats& B) { return A.TotalNs > B.TotalNs; });
+
+        if (ImGui::BeginTable("##Zones", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_ScrollY, ImVec2(0.0f, 200.0f)))
+        {
+            ImGui::TableSetupColumn("Zone");
+            ImGui::TableSetupColumn("Total (ms)");
+            ImGui::TableSetupColumn("Calls");
+            ImGui::TableHeadersRow();
+
+            for (const FZoneStats& Stats : Sorted)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(Stats.Name ? Stats.Name : "?");
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", Stats.TotalNs / 1.0e6);
+                ImGui::TableNextColumn();
+                ImGui::Text("%d", Stats.Count);
+            }
+            ImGui::EndTable();
+        }
+    }
+
+    void FProfilerLayer::DrawGpuPasses()
+    {
+        ImGui::SeparatorText("GPU");
+
+        if (!FGpuProfiler::IsSupported())
+        {
+            ImGui::TextDisabled("Timer queries are not available on this context");
+            return;
+        }
+
+        if (ImGui::BeginTable("##GpuPasses", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders))
+        {
+            ImGui::TableSetupColumn("Pass");
+            ImGui::TableSetupColumn("Last (ms)");
+            ImGui::TableSetupColumn(std::format("Avg of {} (ms)", FGpuProfiler::AverageWindow).c_str());
+            ImGui::TableHeadersRow();
+
+            FGpuProfiler::ForEachPass([](const FGpuPassStats& Stats)
+            {
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(Stats.Name);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", Stats.LastMs);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.3f", Stats.AverageMs);
+            });
+            ImGui::EndTable();
+        }
+    }
+
+}
+
+#endif
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Core/Layers/Layer.h"
+
+#ifdef CORE_ENABLE_PROFILING
+
+#include "Profiler.h"
+
+namespace Core
+{
+
+    // "Profiler" panel: frame-time history, per-thread flame graph of one frame, hottest zones
+    // and Chrome trace export. Pushed as an overlay by FApplication when profiling is compiled in.
+    class FProfilerLayer : public FLayer
+    {
+    public:
+        FProfilerLayer();
+
+        void OnUIRender() override;
+        // Frames are copied out of the profiler's history under its lock
+        [[nodiscard]] bool SupportsPipelinedUI() const override { return true; }
+
+    private:
+        void DrawFlameGraph(const FProfileFrame& Frame);
+        void DrawZoneTable(const FProfileFrame& Frame);
+        void DrawGpuPasses();
+
+    private:
+        // Copy of the inspected frame so drawing never holds the history lock
+        FProfileFrame SelectedFrame;
+        std::vector<float> FrameTimes;
+
+        // 0 is the latest frame, larger values go back in time
+        int FrameOffset = 0;
+        float ZoomLevel = 1.0f;
+    };
+
+}
+
+#endif
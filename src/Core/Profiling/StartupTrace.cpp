@@ -0,0 +1,107 @@
+#include "StartupTrace.h"
+#include "Core/Logging/Log.h"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Core
+{
+
+    namespace
+    {
+        // Initialized before main runs, close enough to process start for a startup timeline
+        const std::chrono::steady_clock::time_point s_ProcessStart = std::chrono::steady_clock::now();
+
+        struct FStartupEvent
+        {
+            const char* Name;
+            std::uint64_t StartNs;
+            std::uint64_t EndNs;
+            std::uint32_t ThreadIndex;
+        };
+
+        struct FStartupTraceState
+        {
+            std::mutex Mutex;
+            std::vector<FStartupEvent> Events;
+            std::vector<std::thread::id> Threads; // Index 0 is the first thread to record, normally main
+        };
+
+        FStartupTraceState& GetStartupTraceState()
+        {
+            static FStartupTraceState State;
+            return State;
+        }
+    }
+
+    std::atomic<bool> FStartupTrace::s_bEnabled{ false };
+
+    void FStartupTrace::Enable()
+    {
+        GetStartupTraceState().Events.reserve(64);
+        s_bEnabled.store(true, std::memory_order_relaxed);
+    }
+
+    std::uint64_t FStartupTrace::Now()
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - s_ProcessStart).count());
+    }
+
+    void FStartupTrace::Record(const char* Name, std::uint64_t StartNs, std::uint64_t EndNs)
+    {
+        FStartupTraceState& State = GetStartupTraceState();
+        std::lock_guard<std::mutex> Lock(State.Mutex);
+
+        const std::thread::id ThreadId = std::this_thread::get_id();
+        const auto It = std::find(State.Threads.begin(), State.Threads.end(), ThreadId);
+        const std::uint32_t ThreadIndex = static_cast<std::uint32_t>(It - State.Threads.begin());
+        if (It == State.Threads.end())
+            State.Threads.push_back(ThreadId);
+
+        State.Events.push_back({ Name, StartNs, EndNs, ThreadIndex });
+    }
+
+    void FStartupTrace::Finish()
+    {
+        // Only the first frame ends the trace
+        if (!s_bEnabled.exchange(false))
+            return;
+
+        const std::uint64_t FirstFrameNs = Now();
+
+        FStartupTraceState& State = GetStartupTraceState();
+        std::lock_guard<std::mutex> Lock(State.Mutex);
+
+        std::sort(State.Events.begin(), State.Events.end(), [](const FStartupEvent& A, const FStartupEvent& B) { return A.StartNs < B.StartNs; });
+
+        std::string Report = std::format("Startup trace ({} phases)\n  {:>9} {:>9}  {:<6} {}\n", State.Events.size(), "start ms", "dur ms", "thread", "phase");
+        std::string Json = "{\"traceEvents\":[\n";
+        for (const FStartupEvent& Event : State.Events)
+        {
+            std::format_to(std::back_inserter(Report), "  {:9.2f} {:9.2f}  {:<6} {}\n",
+                Event.StartNs / 1.0e6, (Event.EndNs - Event.StartNs) / 1.0e6, Event.ThreadIndex, Event.Name);
+            std::format_to(std::back_inserter(Json), "{{\"name\":\"{}\",\"ph\":\"X\",\"pid\":0,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}},\n",
+                Event.Name, Event.ThreadIndex, Event.StartNs / 1000.0, (Event.EndNs - Event.StartNs) / 1000.0);
+        }
+        std::format_to(std::back_inserter(Report), "Time to first frame: {:.2f} ms", FirstFrameNs / 1.0e6);
+        std::format_to(std::back_inserter(Json), "{{\"name\":\"First Frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":0,\"ts\":{:.3f}}}\n]}}\n", FirstFrameNs / 1000.0);
+
+        FLog::CoreDebug("{}", Report);
+
+        std::ofstream File("startup_trace.json", std::ios::binary);
+        File.write(Json.data(), static_cast<std::streamsize>(Json.size()));
+        if (!File)
+        {
+            FLog::CoreError("Failed to write startup_trace.json");
+        }
+    }
+
+}
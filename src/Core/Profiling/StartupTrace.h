@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Profiler.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace Core
+{
+
+    // Timeline of the startup phases up to the first presented frame, enabled at runtime with
+    // --startup-trace. Phases can be recorded from any thread; when the trace is off a phase
+    // costs one relaxed load.
+    class FStartupTrace
+    {
+    public:
+        static void Enable();
+        [[nodiscard]] static bool IsEnabled() { return s_bEnabled.load(std::memory_order_relaxed); }
+
+        // Nanoseconds since the process started
+        [[nodiscard]] static std::uint64_t Now();
+        static void Record(const char* Name, std::uint64_t StartNs, std::uint64_t EndNs);
+
+        // Called after every swap; the first call closes the trace, logs the timeline and writes
+        // it to startup_trace.json in Chrome trace format
+        static void MarkFrame()
+        {
+            if (IsEnabled())
+                Finish();
+        }
+
+    private:
+        static void Finish();
+
+        static std::atomic<bool> s_bEnabled;
+    };
+
+    class FStartupPhase
+    {
+    public:
+        explicit FStartupPhase(const char* InName)
+            : Name(InName), StartNs(FStartupTrace::IsEnabled() ? FStartupTrace::Now() : 0)
+        {
+        }
+
+        ~FStartupPhase()
+        {
+            if (FStartupTrace::IsEnabled())
+                FStartupTrace::Record(Name, StartNs, FStartupTrace::Now());
+        }
+
+        FStartupPhase(const FStartupPhase&) = delete;
+        FStartupPhase& operator=(const FStartupPhase&) = delete;
+
+    private:
+        const char* Name;
+        std::uint64_t StartNs;
+    };
+
+}
+
+#define CORE_STARTUP_PHASE(Name) ::Core::FStartupPhase CORE_PROFILE_CONCAT(StartupPhase_, __LINE__)(Name)
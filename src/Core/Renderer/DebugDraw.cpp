@@ -0,0 +1,758 @@
+#include "DebugDraw.h"
+#include "Core/Logging/Log.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Profiling/Profiler.h"
+
+#ifdef CORE_PLATFORM_WEB
+    #include <GLES3/gl3.h>
+#else
+    #include <glad/glad.h>
+#endif
+
+#include "raymath.h"
+#include "rlgl.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Core
+{
+
+    namespace
+    {
+        #ifdef CORE_PLATFORM_WEB
+            constexpr const char* LineVertexShader = R"(#version 100
+attribute vec3 vertexPosition;
+attribute vec4 vertexColor;
+
+uniform mat4 mvp;
+
+varying vec4 fragColor;
+
+void main()
+{
+    fragColor = vertexColor;
+    gl_Position = mvp * vec4(vertexPosition, 1.0);
+}
+)";
+
+            constexpr const char* LineFragmentShader = R"(#version 100
+precision mediump float;
+
+varying vec4 fragColor;
+
+void main()
+{
+    gl_FragColor = fragColor;
+}
+)";
+        #else
+            constexpr const char* LineVertexShader = R"(#version 330
+in vec3 vertexPosition;
+in vec4 vertexColor;
+
+uniform mat4 mvp;
+
+out vec4 fragColor;
+
+void main()
+{
+    fragColor = vertexColor;
+    gl_Position = mvp * vec4(vertexPosition, 1.0);
+}
+)";
+
+            constexpr const char* LineFragmentShader = R"(#version 330
+in vec4 fragColor;
+
+out vec4 finalColor;
+
+void main()
+{
+    finalColor = fragColor;
+}
+)";
+        #endif
+
+        struct FDebugVertex
+        {
+            float X, Y, Z;
+            Color Tint;
+        };
+        static_assert(sizeof(FDebugVertex) == 16);
+
+        constexpr std::size_t DepthCount = 2;
+        constexpr std::uint32_t ChunkVertices = 8192;
+        constexpr std::size_t InitialBufferVertices = 64 * 1024;
+        constexpr int SphereSegments = 24;
+
+        // Written by one thread up to Count, read by Flush from ReadOffset to Count
+        struct FChunk
+        {
+            std::array<FDebugVertex, ChunkVertices> Vertices;
+            std::atomic<std::uint32_t> Count{ 0 };
+            std::uint32_t ReadOffset = 0;  // Flush only
+            EDebugDepth Depth = EDebugDepth::Tested;
+        };
+
+        struct FThreadBuffer
+        {
+            // Null until the thread first records at that depth
+            std::array<std::atomic<FChunk*>, DepthCount> Current{};
+        };
+
+        struct FTimedLine
+        {
+            FDebugVertex Start;
+            FDebugVertex End;
+            EDebugDepth Depth;
+            float Remaining;
+        };
+
+        struct FDebugText
+        {
+            Vector3 Position;
+            std::string Text;
+            float Height;
+            Color Tint;
+            EDebugDepth Depth;
+            float Remaining;
+        };
+
+        struct FSpan
+        {
+            const FDebugVertex* Data;
+            std::uint32_t Count;
+        };
+
+        struct FDebugDrawState
+        {
+            // Chunk hand-over between recording threads and Flush
+            std::mutex ChunkMutex;
+            std::vector<std::unique_ptr<FChunk>> Chunks;
+            std::vector<FChunk*> FreeChunks;
+            std::vector<FChunk*> Published;
+            std::vector<std::unique_ptr<FThreadBuffer>> Threads;
+
+            std::mutex TimedMutex;
+            std::vector<FTimedLine> TimedLines;
+            std::vector<FDebugText> Texts;
+
+            std::atomic<std::uint32_t> Lines{ 0 };
+            std::atomic<std::uint32_t> DrawCalls{ 0 };
+
+            // Render thread only
+            bool bFlushed = false;
+            Shader LineShader{};
+            unsigned int VertexArray = 0;
+            unsigned int VertexBuffer = 0;
+            std::size_t BufferCapacity = 0;
+            std::array<std::vector<FSpan>, DepthCount> Spans;
+            std::array<std::vector<FDebugVertex>, DepthCount> Staging;
+            std::vector<FChunk*> Consumed;
+        };
+
+        FDebugDrawState& GetState()
+        {
+            static FDebugDrawState State;
+            return State;
+        }
+
+        // Outside the state so the recording fast path needs no static initialization check
+        constinit std::atomic<bool> s_bEnabled{ true };
+        thread_local FThreadBuffer* t_ThreadBuffer = nullptr;
+
+        FThreadBuffer* RegisterThread()
+        {
+            FDebugDrawState& State = GetState();
+            std::lock_guard<std::mutex> Lock(State.ChunkMutex);
+            t_ThreadBuffer = State.Threads.emplace_back(std::make_unique<FThreadBuffer>()).get();
+            return t_ThreadBuffer;
+        }
+
+        FThreadBuffer& GetThreadBuffer()
+        {
+            return t_ThreadBuffer ? *t_ThreadBuffer : *RegisterThread();
+        }
+
+        // Publishes the thread's full chunk, if any, and gives it a fresh one
+        FChunk* ReplaceChunk(std::atomic<FChunk*>& Slot, FChunk* Full, EDebugDepth Depth)
+        {
+            FDebugDrawState& State = GetState();
+            std::lock_guard<std::mutex> Lock(State.ChunkMutex);
+            if (Full)
+            {
+                State.Published.push_back(Full);
+            }
+
+            FChunk* Chunk = nullptr;
+            if (!State.FreeChunks.empty())
+            {
+                Chunk = State.FreeChunks.back();
+                State.FreeChunks.pop_back();
+            }
+            else
+            {
+                // Not make_unique: that would zero the vertices first
+                Chunk = State.Chunks.emplace_back(new FChunk).get();
+            }
+            Chunk->Depth = Depth;
+            Slot.store(Chunk, std::memory_order_release);
+            return Chunk;
+        }
+
+        FDebugVertex MakeVertex(Vector3 Position, Color Tint)
+        {
+            return { Position.x, Position.y, Position.z, Tint };
+        }
+
+        // Generate(Emit) calls Emit(Start, End) LineCount times at most. One-frame lines go into the
+        // thread's chunk and become visible to Flush together; LineCount must fit in a chunk.
+        template<typename F>
+        void RecordLines(EDebugDepth Depth, float Duration, Color Tint, std::uint32_t LineCount, F&& Generate)
+        {
+            if (Duration > 0.0f)
+            {
+                FDebugDrawState& State = GetState();
+                std::lock_guard<std::mutex> Lock(State.TimedMutex);
+                Generate([&](Vector3 Start, Vector3 End)
+                {
+                    State.TimedLines.push_back({ MakeVertex(Start, Tint), MakeVertex(End, Tint), Depth, Duration });
+                });
+                return;
+            }
+
+            std::atomic<FChunk*>& Slot = GetThreadBuffer().Current[static_cast<std::size_t>(Depth)];
+            FChunk* Chunk = Slot.load(std::memory_order_relaxed);
+            std::uint32_t Start = Chunk ? Chunk->Count.load(std::memory_order_relaxed) : ChunkVertices;
+            if (Start + LineCount * 2 > ChunkVertices)
+            {
+                Chunk = ReplaceChunk(Slot, Chunk, Depth);
+                Start = 0;
+            }
+
+            FDebugVertex* Out = Chunk->Vertices.data() + Start;
+            Generate([&Out, Tint](Vector3 LineStart, Vector3 LineEnd)
+            {
+                *Out++ = MakeVertex(LineStart, Tint);
+                *Out++ = MakeVertex(LineEnd, Tint);
+            });
+            Chunk->Count.store(static_cast<std::uint32_t>(Out - Chunk->Vertices.data()), std::memory_order_release);
+        }
+
+        // Takes every vertex recorded since the last call into State.Spans; chunks that will not
+        // be written again are collected in State.Consumed for RecycleChunks
+        void GatherChunks()
+        {
+            FDebugDrawState& State = GetState();
+            for (std::vector<FSpan>& Spans : State.Spans)
+            {
+                Spans.clear();
+            }
+
+            const auto Take = [&State](FChunk* Chunk)
+            {
+                const std::uint32_t Count = Chunk->Count.load(std::memory_order_acquire);
+                if (Count > Chunk->ReadOffset)
+                {
+                    State.Spans[static_cast<std::size_t>(Chunk->Depth)].push_back({ Chunk->Vertices.data() + Chunk->ReadOffset, Count - Chunk->ReadOffset });
+                    Chunk->ReadOffset = Count;
+                }
+            };
+
+            // Holding the lock keeps threads from publishing their current chunk meanwhile
+            std::lock_guard<std::mutex> Lock(State.ChunkMutex);
+            State.Consumed.swap(State.Published);
+            for (FChunk* Chunk : State.Consumed)
+            {
+                Take(Chunk);
+            }
+            for (const std::unique_ptr<FThreadBuffer>& Buffer : State.Threads)
+            {
+                for (std::atomic<FChunk*>& Slot : Buffer->Current)
+                {
+                    if (FChunk* Chunk = Slot.load(std::memory_order_acquire))
+                    {
+                        Take(Chunk);
+                    }
+                }
+            }
+        }
+
+        // After the gathered spans are no longer needed
+        void RecycleChunks()
+        {
+            FDebugDrawState& State = GetState();
+            std::lock_guard<std::mutex> Lock(State.ChunkMutex);
+            for (FChunk* Chunk : State.Consumed)
+            {
+                Chunk->Count.store(0, std::memory_order_relaxed);
+                Chunk->ReadOffset = 0;
+                State.FreeChunks.push_back(Chunk);
+            }
+            State.Consumed.clear();
+        }
+
+        // Stroke font on a 2 x 4 grid, one entry per character from ' ' to '_'. Each group of four
+        // digits is a segment: x0 y0 x1 y1, with y up.
+        constexpr std::array<const char*, 64> Glyphs =
+        {
+            "",                                     // ' '
+            "1412 1011",                            // !
+            "0403 2423",                            // "
+            "0121 0323 0014 1024",                  // #
+            "2404 0402 0222 2220 2000 1014",        // $
+            "0024 0313 2111",                       // %
+            "2004 0414 1402 0200 0010 1022",        // &
+            "1413",                                 // '
+            "2413 1311 1120",                       // (
+            "0413 1311 1100",                       // )
+            "0123 0321 0222",                       // *
+            "0222 1113",                            // +
+            "1100",                                 // ,
+            "0222",                                 // -
+            "1011",                                 // .
+            "0024",                                 // /
+            "0020 2024 2404 0400 0024",             // 0
+            "1014 1403 0020",                       // 1
+            "0424 2422 2202 0200 0020",             // 2
+            "0424 2420 2000 0222",                  // 3
+            "0402 0222 2420",                       // 4
+            "2404 0402 0222 2220 2000",             // 5
+            "2404 0400 0020 2022 2202",             // 6
+            "0424 2420",                            // 7
+            "0020 2024 2404 0400 0222",             // 8
+            "0222 0204 0424 2420 2000",             // 9
+            "1213 1011",                            // :
+            "1213 1100",                            // ;
+            "2402 0220",                            // <
+            "0121 0323",                            // =
+            "0422 2200",                            // >
+            "0424 2423 2313 1312 1110",             // ?
+            "2212 1213 1323 2420 2000 0004 0424",   // @
+            "0003 0314 1423 2320 0222",             // A
+            "0004 0414 1423 2312 0212 1221 2110 1000", // B
+            "2404 0400 0020",                       // C
+            "0004 0414 1423 2321 2110 1000",        // D
+            "2404 0400 0020 0212",                  // E
+            "2404 0400 0212",                       // F
+            "2404 0400 0020 2022 2212",             // G
+            "0004 2024 0222",                       // H
+            "0424 1410 0020",                       // I
+            "1424 2420 2000 0001",                  // J
+            "0004 0224 0220",                       // K
+            "0400 0020",                            // L
+            "0004 0412 1224 2420",                  // M
+            "0004 0420 2024",                       // N
+            "0020 2024 2404 0400",                  // O
+            "0004 0424 2422 2202",                  // P
+            "0020 2024 2404 0400 1120",             // Q
+            "0004 0424 2422 2202 0220",             // R
+            "2404 0402 0222 2220 2000",             // S
+            "0424 1410",                            // T
+            "0400 0020 2024",                       // U
+            "0410 1024",                            // V
+            "0400 0012 1220 2024",                  // W
+            "0024 0420",                            // X
+            "0412 2412 1210",                       // Y
+            "0424 2400 0020",                       // Z
+            "2414 1410 1020",                       // [
+            "0420",                                 // backslash
+            "0414 1410 1000",                       // ]
+            "0214 1422",                            // ^
+            "0020"                                  // _
+        };
+
+        // Appends Text's strokes as line vertices, laid out along Right and Up
+        void StrokeText(const FDebugText& Text, Vector3 Right, Vector3 Up, std::vector<FDebugVertex>& Out)
+        {
+            const float Unit = Text.Height * 0.25f;
+            const auto At = [&](float X, float Y)
+            {
+                return MakeVertex(Vector3Add(Text.Position, Vector3Add(Vector3Scale(Right, X * Unit), Vector3Scale(Up, Y * Unit))), Text.Tint);
+            };
+
+            float Column = 0.0f;
+            float Row = 0.0f;
+            for (char Character : Text.Text)
+            {
+                if (Character == '\n')
+                {
+                    Column = 0.0f;
+                    Row -= 6.0f;
+                    continue;
+                }
+                if (Character >= 'a' && Character <= 'z')
+                {
+                    Character = static_cast<char>(Character - 'a' + 'A');
+                }
+                if (Character < ' ' || Character > '_')
+                {
+                    Character = '?';
+                }
+
+                for (const char* Segment = Glyphs[static_cast<std::size_t>(Character - ' ')]; Segment[0] != '\0'; Segment += Segment[4] == ' ' ? 5 : 4)
+                {
+                    Out.push_back(At(Column + (Segment[0] - '0'), Row + (Segment[1] - '0')));
+                    Out.push_back(At(Column + (Segment[2] - '0'), Row + (Segment[3] - '0')));
+                }
+                Column += 3.0f;
+            }
+        }
+
+        // Expands timed lines and text into State.Staging, then drops what has had its last frame
+        void StageTimed(const Matrix& View)
+        {
+            FDebugDrawState& State = GetState();
+            for (std::vector<FDebugVertex>& Staging : State.Staging)
+            {
+                Staging.clear();
+            }
+
+            // The view matrix's rows are the camera axes
+            const Vector3 Right = { View.m0, View.m4, View.m8 };
+            const Vector3 Up = { View.m1, View.m5, View.m9 };
+
+            std::lock_guard<std::mutex> Lock(State.TimedMutex);
+            for (const FTimedLine& Line : State.TimedLines)
+            {
+                std::vector<FDebugVertex>& Staging = State.Staging[static_cast<std::size_t>(Line.Depth)];
+                Staging.push_back(Line.Start);
+                Staging.push_back(Line.End);
+            }
+            for (const FDebugText& Text : State.Texts)
+            {
+                StrokeText(Text, Right, Up, State.Staging[static_cast<std::size_t>(Text.Depth)]);
+            }
+
+            std::erase_if(State.TimedLines, [](const FTimedLine& Line) { return Line.Remaining <= 0.0f; });
+            std::erase_if(State.Texts, [](const FDebugText& Text) { return Text.Remaining <= 0.0f; });
+        }
+
+        bool LoadResources()
+        {
+            FDebugDrawState& State = GetState();
+            if (State.LineShader.id != 0)
+                return IsShaderValid(State.LineShader);
+
+            State.LineShader = LoadShaderFromMemory(LineVertexShader, LineFragmentShader);
+            if (!IsShaderValid(State.LineShader))
+            {
+                FLog::CoreError("Debug draw: shader failed to compile, nothing will draw");
+                return false;
+            }
+
+            State.VertexArray = rlLoadVertexArray();
+            glGenBuffers(1, &State.VertexBuffer);
+            return true;
+        }
+    }
+
+    void FDebugDraw::Line(Vector3 Start, Vector3 End, Color Tint, EDebugDepth Depth, float Duration)
+    {
+        if (!IsEnabled())
+            return;
+
+        RecordLines(Depth, Duration, Tint, 1, [&](auto&& Emit)
+        {
+            Emit(Start, End);
+        });
+    }
+
+    void FDebugDraw::Box(const BoundingBox& Box, Color Tint, EDebugDepth Depth, float Duration)
+    {
+        if (!IsEnabled())
+            return;
+
+        RecordLines(Depth, Duration, Tint, 12, [&Box](auto&& Emit)
+        {
+            const Vector3& A = Box.min;
+            const Vector3& B = Box.max;
+            const Vector3 Corners[8] =
+            {
+                { A.x, A.y, A.z }, { B.x, A.y, A.z }, { B.x, A.y, B.z }, { A.x, A.y, B.z },
+                { A.x, B.y, A.z }, { B.x, B.y, A.z }, { B.x, B.y, B.z }, { A.x, B.y, B.z }
+            };
+            for (int Index = 0; Index < 4; ++Index)
+            {
+                Emit(Corners[Index], Corners[(Index + 1) % 4]);
+                Emit(Corners[4 + Index], Corners[4 + (Index + 1) % 4]);
+                Emit(Corners[Index], Corners[4 + Index]);
+            }
+        });
+    }
+
+    void FDebugDraw::Sphere(Vector3 Center, float Radius, Color Tint, EDebugDepth Depth, float Duration)
+    {
+        if (!IsEnabled())
+            return;
+
+        // A circle in each axis plane
+        RecordLines(Depth, Duration, Tint, 3 * SphereSegments, [&](auto&& Emit)
+        {
+            const float Step = 2.0f * PI / SphereSegments;
+            for (int Index = 0; Index < SphereSegments; ++Index)
+            {
+                const float C0 = Radius * std::cos(Step * Index);
+                const float S0 = Radius * std::sin(Step * Index);
+                const float C1 = Radius * std::cos(Step * (Index + 1));
+                const float S1 = Radius * std::sin(Step * (Index + 1));
+                Emit(Vector3Add(Center, { C0, S0, 0.0f }), Vector3Add(Center, { C1, S1, 0.0f }));
+                Emit(Vector3Add(Center, { C0, 0.0f, S0 }), Vector3Add(Center, { C1, 0.0f, S1 }));
+                Emit(Vector3Add(Center, { 0.0f, C0, S0 }), Vector3Add(Center, { 0.0f, C1, S1 }));
+            }
+        });
+    }
+
+    void FDebugDraw::Frustum(const Matrix& ViewProjection, Color Tint, EDebugDepth Depth, float Duration)
+    {
+        if (!IsEnabled())
+            return;
+
+        // Clip space corners back into the world
+        const Matrix M = MatrixInvert(ViewProjection);
+        Vector3 Corners[8];
+        for (int Index = 0; Index < 8; ++Index)
+        {
+            const float X = (Index & 1) ? 1.0f : -1.0f;
+            const float Y = (Index & 2) ? 1.0f : -1.0f;
+            const float Z = (Index & 4) ? 1.0f : -1.0f;
+            const float W = M.m3 * X + M.m7 * Y + M.m11 * Z + M.m15;
+            Corners[Index] =
+            {
+                (M.m0 * X + M.m4 * Y + M.m8 * Z + M.m12) / W,
+                (M.m1 * X + M.m5 * Y + M.m9 * Z + M.m13) / W,
+                (M.m2 * X + M.m6 * Y + M.m10 * Z + M.m14) / W
+            };
+        }
+
+        RecordLines(Depth, Duration, Tint, 12, [&Corners](auto&& Emit)
+        {
+            // Corner bits are x, y, z: edges join corners one bit apart
+            for (int Index = 0; Index < 8; ++Index)
+            {
+                for (int Bit = 1; Bit < 8; Bit <<= 1)
+                {
+                    if ((Index & Bit) == 0)
+                    {
+                        Emit(Corners[Index], Corners[Index | Bit]);
+                    }
+                }
+            }
+        });
+    }
+
+    void FDebugDraw::Grid(int Slices, float Spacing, Color Tint, EDebugDepth Depth, float Duration)
+    {
+        if (!IsEnabled())
+            return;
+
+        const int HalfSlices = Slices / 2;
+        const float Extent = static_cast<float>(HalfSlices) * Spacing;
+        for (int Index = -HalfSlices; Index <= HalfSlices; ++Index)
+        {
+            const float Offset = static_cast<float>(Index) * Spacing;
+            RecordLines(Depth, Duration, Tint, 2, [&](auto&& Emit)
+            {
+                Emit({ Offset, 0.0f, -Extent }, { Offset, 0.0f, Extent });
+                Emit({ -Extent, 0.0f, Offset }, { Extent, 0.0f, Offset });
+            });
+        }
+    }
+
+    void FDebugDraw::Text(Vector3 Position, std::string_view Text, float Height, Color Tint, EDebugDepth Depth, float Duration)
+    {
+        if (!IsEnabled() || Text.empty())
+            return;
+
+        FDebugDrawState& State = GetState();
+        std::lock_guard<std::mutex> Lock(State.TimedMutex);
+        State.Texts.push_back({ Position, std::string(Text), Height, Tint, Depth, std::max(Duration, 0.0f) });
+    }
+
+    void FDebugDraw::Flush()
+    {
+        CORE_PROFILE_FUNCTION();
+
+        FDebugDrawState& State = GetState();
+        State.bFlushed = true;
+
+        GatherChunks();
+        StageTimed(rlGetMatrixModelview());
+
+        std::array<std::size_t, DepthCount> Counts{};
+        for (std::size_t Depth = 0; Depth < DepthCount; ++Depth)
+        {
+            Counts[Depth] = State.Staging[Depth].size();
+            for (const FSpan& Span : State.Spans[Depth])
+            {
+                Counts[Depth] += Span.Count;
+            }
+        }
+        const std::size_t Total = Counts[0] + Counts[1];
+
+        State.Lines.store(static_cast<std::uint32_t>(Total / 2), std::memory_order_relaxed);
+        State.DrawCalls.store(0, std::memory_order_relaxed);
+        if (Total == 0 || !IsEnabled() || !LoadResources())
+        {
+            RecycleChunks();
+            return;
+        }
+
+        // Draw whatever raylib has batched so far first, so the lines keep their place
+        rlDrawRenderBatchActive();
+
+        // Respecified every frame so the driver can hand out fresh memory instead of waiting for
+        // last frame's draw to finish reading
+        const std::size_t Bytes = Total * sizeof(FDebugVertex);
+        glBindBuffer(GL_ARRAY_BUFFER, State.VertexBuffer);
+        if (Bytes > State.BufferCapacity)
+        {
+            if (State.BufferCapacity > 0)
+            {
+                CORE_MEMORY_GPU_FREE(Buffer, State.VertexBuffer);
+            }
+            State.BufferCapacity = std::max({ Bytes, State.BufferCapacity * 2, InitialBufferVertices * sizeof(FDebugVertex) });
+            CORE_MEMORY_GPU_ALLOC(Buffer, State.VertexBuffer, State.BufferCapacity);
+        }
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(State.BufferCapacity), nullptr, GL_STREAM_DRAW);
+
+        // Depth-tested vertices first, then overlay, each straight from the chunks they were written to
+        GLintptr Offset = 0;
+        const auto Upload = [&Offset](const FDebugVertex* Data, std::size_t Count)
+        {
+            const GLsizeiptr Size = static_cast<GLsizeiptr>(Count * sizeof(FDebugVertex));
+            glBufferSubData(GL_ARRAY_BUFFER, Offset, Size, Data);
+            Offset += Size;
+        };
+        for (std::size_t Depth = 0; Depth < DepthCount; ++Depth)
+        {
+            for (const FSpan& Span : State.Spans[Depth])
+            {
+                Upload(Span.Data, Span.Count);
+            }
+            if (!State.Staging[Depth].empty())
+            {
+                Upload(State.Staging[Depth].data(), State.Staging[Depth].size());
+            }
+        }
+        RecycleChunks();
+
+        const int* Locations = State.LineShader.locs;
+        rlEnableShader(State.LineShader.id);
+        rlSetUniformMatrix(Locations[SHADER_LOC_MATRIX_MVP], MatrixMultiply(MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()), rlGetMatrixProjection()));
+
+        // Without vertex array support this sets up the default state instead
+        rlEnableVertexArray(State.VertexArray);
+        rlSetVertexAttribute(Locations[SHADER_LOC_VERTEX_POSITION], 3, RL_FLOAT, false, sizeof(FDebugVertex), 0);
+        rlEnableVertexAttribute(Locations[SHADER_LOC_VERTEX_POSITION]);
+        rlSetVertexAttribute(Locations[SHADER_LOC_VERTEX_COLOR], 4, RL_UNSIGNED_BYTE, true, sizeof(FDebugVertex), static_cast<int>(offsetof(FDebugVertex, Tint)));
+        rlEnableVertexAttribute(Locations[SHADER_LOC_VERTEX_COLOR]);
+
+        std::uint32_t DrawCalls = 0;
+        if (Counts[0] > 0)
+        {
+            glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(Counts[0]));
+            ++DrawCalls;
+        }
+        if (Counts[1] > 0)
+        {
+            const bool bDepthTest = glIsEnabled(GL_DEPTH_TEST);
+            rlDisableDepthTest();
+            glDrawArrays(GL_LINES, static_cast<GLint>(Counts[0]), static_cast<GLsizei>(Counts[1]));
+            if (bDepthTest)
+            {
+                rlEnableDepthTest();
+            }
+            ++DrawCalls;
+        }
+        State.DrawCalls.store(DrawCalls, std::memory_order_relaxed);
+
+        rlDisableVertexAttribute(Locations[SHADER_LOC_VERTEX_POSITION]);
+        rlDisableVertexAttribute(Locations[SHADER_LOC_VERTEX_COLOR]);
+        rlDisableVertexArray();
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        rlDisableShader();
+    }
+
+    void FDebugDraw::BeginFrame(float DeltaSeconds)
+    {
+        FDebugDrawState& State = GetState();
+        if (!State.bFlushed)
+        {
+            // Nobody drew last frame's lines; let them go the same way a Flush would
+            GatherChunks();
+            RecycleChunks();
+
+            std::lock_guard<std::mutex> Lock(State.TimedMutex);
+            std::erase_if(State.TimedLines, [](const FTimedLine& Line) { return Line.Remaining <= 0.0f; });
+            std::erase_if(State.Texts, [](const FDebugText& Text) { return Text.Remaining <= 0.0f; });
+        }
+        State.bFlushed = false;
+
+        std::lock_guard<std::mutex> Lock(State.TimedMutex);
+        for (FTimedLine& Line : State.TimedLines)
+        {
+            Line.Remaining -= DeltaSeconds;
+        }
+        for (FDebugText& Text : State.Texts)
+        {
+            Text.Remaining -= DeltaSeconds;
+        }
+    }
+
+    void FDebugDraw::Shutdown()
+    {
+        FDebugDrawState& State = GetState();
+        {
+            std::lock_guard<std::mutex> Lock(State.TimedMutex);
+            State.TimedLines.clear();
+            State.Texts.clear();
+        }
+
+        if (State.VertexBuffer != 0)
+        {
+            if (State.BufferCapacity > 0)
+            {
+                CORE_MEMORY_GPU_FREE(Buffer, State.VertexBuffer);
+            }
+            glDeleteBuffers(1, &State.VertexBuffer);
+            State.VertexBuffer = 0;
+            State.BufferCapacity = 0;
+        }
+        if (State.VertexArray != 0)
+        {
+            rlUnloadVertexArray(State.VertexArray);
+            State.VertexArray = 0;
+        }
+        if (IsShaderValid(State.LineShader))
+        {
+            UnloadShader(State.LineShader);
+        }
+        State.LineShader = {};
+    }
+
+    void FDebugDraw::SetEnabled(bool bInEnabled)
+    {
+        s_bEnabled.store(bInEnabled, std::memory_order_relaxed);
+    }
+
+    bool FDebugDraw::IsEnabled()
+    {
+        return s_bEnabled.load(std::memory_order_relaxed);
+    }
+
+    FDebugDrawStats FDebugDraw::GetStats()
+    {
+        const FDebugDrawState& State = GetState();
+        return { State.Lines.load(std::memory_order_relaxed), State.DrawCalls.load(std::memory_order_relaxed) };
+    }
+
+}
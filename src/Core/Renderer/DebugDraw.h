@@ -0,0 +1,62 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+
+#include <cstdint>
+#include <string_view>
+
+#include "raylib.h"
+
+namespace Core
+{
+
+    enum class EDebugDepth : std::uint8_t
+    {
+        Tested,     // Hidden behind scene geometry
+        Overlay     // Always on top
+    };
+
+    // Of the last Flush
+    struct FDebugDrawStats
+    {
+        std::uint32_t Lines = 0;
+        std::uint32_t DrawCalls = 0;
+    };
+
+    // Debug lines, boxes, spheres, frusta and text. Any thread can record; each thread writes into
+    // its own chunks of vertices, so recording takes no lock and a line costs a few stores.
+    // Flush gathers every thread's chunks into one persistent vertex buffer and draws it with one
+    // call for depth-tested lines and one for overlay lines.
+    // Primitives last one frame unless given a Duration in seconds. Timed primitives and text go
+    // through a lock; they are meant for a handful of markers, not bulk data.
+    // Lines recorded after a frame's Flush are drawn by the next one.
+    class FDebugDraw
+    {
+    public:
+        static void Line(Vector3 Start, Vector3 End, Color Tint, EDebugDepth Depth = EDebugDepth::Tested, float Duration = 0.0f);
+        static void Box(const BoundingBox& Box, Color Tint, EDebugDepth Depth = EDebugDepth::Tested, float Duration = 0.0f);
+        static void Sphere(Vector3 Center, float Radius, Color Tint, EDebugDepth Depth = EDebugDepth::Tested, float Duration = 0.0f);
+        // The volume a camera with this view-projection sees (raymath's MatrixMultiply(View, Projection))
+        static void Frustum(const Matrix& ViewProjection, Color Tint, EDebugDepth Depth = EDebugDepth::Tested, float Duration = 0.0f);
+        // Slices x Slices cells on the XZ plane around the origin, like raylib's DrawGrid
+        static void Grid(int Slices, float Spacing, Color Tint, EDebugDepth Depth = EDebugDepth::Tested, float Duration = 0.0f);
+        // Stroked in a built-in line font, facing the camera, starting at Position. Height is in
+        // world units; letters are drawn upper case.
+        static void Text(Vector3 Position, std::string_view Text, float Height, Color Tint, EDebugDepth Depth = EDebugDepth::Tested, float Duration = 0.0f);
+
+        // Render thread, between BeginMode3D and EndMode3D: draws everything recorded so far
+        static void Flush();
+        // Render thread, called by FApplication at the start of every frame. Ages timed
+        // primitives and drops the last frame's lines if nobody flushed them.
+        static void BeginFrame(float DeltaSeconds);
+        // Before the GL context goes away
+        static void Shutdown();
+
+        // Disabled, recording returns immediately and Flush draws nothing
+        static void SetEnabled(bool bInEnabled);
+        [[nodiscard]] static bool IsEnabled();
+
+        [[nodiscard]] static FDebugDrawStats GetStats();
+    };
+
+}
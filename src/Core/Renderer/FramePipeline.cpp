@@ -0,0 +1,106 @@
+#include "FramePipeline.h"
+
+#include <algorithm>
+
+namespace Core
+{
+
+    FDrawDataSnapshot::~FDrawDataSnapshot()
+    {
+        for (ImDrawList* List : Lists)
+        {
+            IM_DELETE(List);
+        }
+    }
+
+    void FDrawDataSnapshot::Capture(const ImDrawData* Source, bool bKeepTextures)
+    {
+        DrawData.Clear();
+        if (!Source || !Source->Valid)
+            return;
+
+        while (Lists.size() < static_cast<std::size_t>(Source->CmdListsCount))
+        {
+            Lists.push_back(IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData()));
+        }
+
+        // ImVector assignment reuses the existing capacity
+        for (int i = 0; i < Source->CmdListsCount; i++)
+        {
+            const ImDrawList* Src = Source->CmdLists[i];
+            ImDrawList* Dst = Lists[i];
+            Dst->CmdBuffer = Src->CmdBuffer;
+            Dst->IdxBuffer = Src->IdxBuffer;
+            Dst->VtxBuffer = Src->VtxBuffer;
+            Dst->Flags = Src->Flags;
+            DrawData.CmdLists.push_back(Dst);
+        }
+
+        DrawData.Valid = true;
+        DrawData.CmdListsCount = Source->CmdListsCount;
+        DrawData.TotalIdxCount = Source->TotalIdxCount;
+        DrawData.TotalVtxCount = Source->TotalVtxCount;
+        DrawData.DisplayPos = Source->DisplayPos;
+        DrawData.DisplaySize = Source->DisplaySize;
+        DrawData.FramebufferScale = Source->FramebufferScale;
+        DrawData.OwnerViewport = Source->OwnerViewport;
+        DrawData.Textures = bKeepTextures ? Source->Textures : nullptr;
+    }
+
+    FFramePipeline::FFramePipeline(int InDepth)
+        : Depth(std::clamp(InDepth, 1, MaxDepth)),
+          Slots(Depth + 1),
+          FreeSlots(Depth + 1)
+    {
+    }
+
+    FFramePacket* FFramePipeline::AcquireWrite(FDuration Timeout)
+    {
+        if (!FreeSlots.try_acquire_for(Timeout))
+            return nullptr;
+
+        FFramePacket& Packet = Slots[WriteIndex];
+        WriteIndex = (WriteIndex + 1) % Slots.size();
+        Packet.FrameIndex = ++NextFrameIndex;
+        return &Packet;
+    }
+
+    void FFramePipeline::SubmitWrite(FFramePacket&)
+    {
+        ReadySlots.release();
+    }
+
+    void FFramePipeline::WaitForCompletion(std::uint64_t FrameIndex)
+    {
+        std::uint64_t Completed = CompletedFrames.load(std::memory_order_acquire);
+        while (Completed < FrameIndex)
+        {
+            CompletedFrames.wait(Completed, std::memory_order_acquire);
+            Completed = CompletedFrames.load(std::memory_order_acquire);
+        }
+    }
+
+    FFramePacket* FFramePipeline::AcquireRead(FDuration Timeout)
+    {
+        if (!ReadySlots.try_acquire_for(Timeout))
+            return nullptr;
+
+        FFramePacket& Packet = Slots[ReadIndex];
+        ReadIndex = (ReadIndex + 1) % Slots.size();
+        return &Packet;
+    }
+
+    void FFramePipeline::ReleaseRead(FFramePacket& Packet)
+    {
+        CompletedFrames.store(Packet.FrameIndex, std::memory_order_release);
+        CompletedFrames.notify_all();
+        FreeSlots.release();
+    }
+
+    void FFramePipeline::Abort()
+    {
+        CompletedFrames.store(UINT64_MAX, std::memory_order_release);
+        CompletedFrames.notify_all();
+    }
+
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Core/Input/InputState.h"
+#include "imgui.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <semaphore>
+#include <vector>
+
+namespace Core
+{
+
+    // Deep copy of an ImDrawData that outlives the next ImGui::NewFrame.
+    // Draw lists are pooled per snapshot, so capturing allocates nothing once the buffers have grown.
+    class FDrawDataSnapshot
+    {
+    public:
+        FDrawDataSnapshot() = default;
+        ~FDrawDataSnapshot();
+
+        FDrawDataSnapshot(const FDrawDataSnapshot&) = delete;
+        FDrawDataSnapshot& operator=(const FDrawDataSnapshot&) = delete;
+
+        // Copies Source. Texture update requests stay with Source unless bKeepTextures is set.
+        void Capture(const ImDrawData* Source, bool bKeepTextures);
+
+        [[nodiscard]] ImDrawData* Get() { return &DrawData; }
+
+    private:
+        ImDrawData DrawData;
+        std::vector<ImDrawList*> Lists;
+    };
+
+    // Everything the GL thread needs to submit one UI frame built by the logic thread
+    struct FFramePacket
+    {
+        FDrawDataSnapshot DrawData;
+        std::uint64_t FrameIndex = 0;
+
+        // The atlas changed this frame; the logic thread waits for the upload before its next NewFrame
+        bool bHasTextureUpdates = false;
+
+        // Written by the GL thread when it hands the slot back, so the UI sees this frame's input
+        FInputState Input;
+    };
+
+    // Bounded ring of frame packets between the UI logic thread (producer) and the GL thread (consumer)
+    class FFramePipeline
+    {
+    public:
+        static constexpr int MaxDepth = 4;
+        using FDuration = std::chrono::milliseconds;
+
+        // Depth is the number of UI frames that may be queued ahead of the frame being submitted
+        explicit FFramePipeline(int InDepth);
+
+        // --- Logic thread ---
+        // Returns nullptr on timeout so the caller can check for shutdown
+        [[nodiscard]] FFramePacket* AcquireWrite(FDuration Timeout);
+        void SubmitWrite(FFramePacket& Packet);
+        // Blocks until the GL thread has submitted every frame up to FrameIndex
+        void WaitForCompletion(std::uint64_t FrameIndex);
+
+        // --- GL thread ---
+        [[nodiscard]] FFramePacket* AcquireRead(FDuration Timeout);
+        void ReleaseRead(FFramePacket& Packet);
+        // Unblocks a logic thread waiting in WaitForCompletion during shutdown
+        void Abort();
+
+        [[nodiscard]] int GetDepth() const { return Depth; }
+
+    private:
+        int Depth;
+        std::vector<FFramePacket> Slots;
+
+        std::counting_semaphore<MaxDepth + 1> FreeSlots;
+        std::counting_semaphore<MaxDepth + 1> ReadySlots{ 0 };
+
+        std::size_t WriteIndex = 0;
+        std::size_t ReadIndex = 0;
+        std::uint64_t NextFrameIndex = 0;
+
+        std::atomic<std::uint64_t> CompletedFrames{ 0 };
+    };
+
+}
@@ -0,0 +1,322 @@
+#include "InstancedRenderer.h"
+#include "Core/Logging/Log.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Profiling/Profiler.h"
+
+#ifdef CORE_PLATFORM_WEB
+    #include <GLES3/gl3.h>
+#else
+    #include <glad/glad.h>
+#endif
+
+#include "raymath.h"
+#include "rlgl.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace Core
+{
+
+    namespace
+    {
+        // Attribute and uniform names follow raylib's defaults so LoadShader fills in the locations
+        #ifdef CORE_PLATFORM_WEB
+            constexpr const char* InstanceVertexShader = R"(#version 100
+attribute vec3 vertexPosition;
+attribute vec2 vertexTexCoord;
+attribute vec3 vertexNormal;
+attribute mat4 instanceTransform;
+attribute vec4 instanceColor;
+
+uniform mat4 mvp;
+
+varying vec2 fragTexCoord;
+varying vec4 fragColor;
+varying vec3 fragNormal;
+
+void main()
+{
+    fragTexCoord = vertexTexCoord;
+    fragColor = instanceColor;
+    fragNormal = (instanceTransform * vec4(vertexNormal, 0.0)).xyz;
+    gl_Position = mvp * instanceTransform * vec4(vertexPosition, 1.0);
+}
+)";
+
+            constexpr const char* InstanceFragmentShader = R"(#version 100
+precision mediump float;
+
+varying vec2 fragTexCoord;
+varying vec4 fragColor;
+varying vec3 fragNormal;
+
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+
+void main()
+{
+    float Light = 0.35 + 0.65 * max(dot(normalize(fragNormal), normalize(vec3(0.4, 1.0, 0.6))), 0.0);
+    vec4 Albedo = texture2D(texture0, fragTexCoord) * colDiffuse * fragColor;
+    gl_FragColor = vec4(Albedo.rgb * Light, Albedo.a);
+}
+)";
+        #else
+            constexpr const char* InstanceVertexShader = R"(#version 330
+in vec3 vertexPosition;
+in vec2 vertexTexCoord;
+in vec3 vertexNormal;
+in mat4 instanceTransform;
+in vec4 instanceColor;
+
+uniform mat4 mvp;
+
+out vec2 fragTexCoord;
+out vec4 fragColor;
+out vec3 fragNormal;
+
+void main()
+{
+    fragTexCoord = vertexTexCoord;
+    fragColor = instanceColor;
+    fragNormal = (instanceTransform * vec4(vertexNormal, 0.0)).xyz;
+    gl_Position = mvp * instanceTransform * vec4(vertexPosition, 1.0);
+}
+)";
+
+            constexpr const char* InstanceFragmentShader = R"(#version 330
+in vec2 fragTexCoord;
+in vec4 fragColor;
+in vec3 fragNormal;
+
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+
+out vec4 finalColor;
+
+void main()
+{
+    float Light = 0.35 + 0.65 * max(dot(normalize(fragNormal), normalize(vec3(0.4, 1.0, 0.6))), 0.0);
+    vec4 Albedo = texture(texture0, fragTexCoord) * colDiffuse * fragColor;
+    finalColor = vec4(Albedo.rgb * Light, Albedo.a);
+}
+)";
+        #endif
+
+        constexpr std::size_t InitialInstanceCapacity = 1024;
+    }
+
+    void FInstanceBatch::Add(const Matrix& Transform, Color Tint)
+    {
+        FInstanceData& Instance = Instances.emplace_back();
+        // raylib's Matrix is laid out by rows; GL wants columns
+        const float16 Columns = MatrixToFloatV(Transform);
+        std::copy(std::begin(Columns.v), std::end(Columns.v), Instance.Transform);
+        Instance.Tint = Tint;
+    }
+
+    void FInstanceBatch::Add(Vector3 Position, float YawDegrees, Vector3 Scale, Color Tint)
+    {
+        const float Radians = YawDegrees * DEG2RAD;
+        const float Cos = std::cos(Radians);
+        const float Sin = std::sin(Radians);
+
+        // Translate * RotateY * Scale, by columns
+        FInstanceData& Instance = Instances.emplace_back();
+        float* M = Instance.Transform;
+        M[0] = Cos * Scale.x;  M[1] = 0.0f;     M[2] = -Sin * Scale.x;  M[3] = 0.0f;
+        M[4] = 0.0f;           M[5] = Scale.y;  M[6] = 0.0f;            M[7] = 0.0f;
+        M[8] = Sin * Scale.z;  M[9] = 0.0f;     M[10] = Cos * Scale.z;  M[11] = 0.0f;
+        M[12] = Position.x;    M[13] = Position.y; M[14] = Position.z;  M[15] = 1.0f;
+        Instance.Tint = Tint;
+    }
+
+    FInstancedRenderer::FInstancedRenderer()
+    {
+        InstanceShader = LoadShaderFromMemory(InstanceVertexShader, InstanceFragmentShader);
+        if (!IsShaderValid(InstanceShader))
+        {
+            FLog::CoreError("Instanced renderer: shader failed to compile, batches will not draw");
+            return;
+        }
+        InstanceColorLocation = GetShaderLocationAttrib(InstanceShader, "instanceColor");
+    }
+
+    FInstancedRenderer::~FInstancedRenderer()
+    {
+        for (const Scope<FInstanceBatch>& Batch : Batches)
+        {
+            if (Batch->InstanceBuffer != 0)
+            {
+                CORE_MEMORY_GPU_FREE(Buffer, Batch->InstanceBuffer);
+                glDeleteBuffers(1, &Batch->InstanceBuffer);
+            }
+        }
+
+        if (IsShaderValid(InstanceShader))
+        {
+            UnloadShader(InstanceShader);
+        }
+    }
+
+    FInstanceBatch& FInstancedRenderer::GetBatch(const Mesh& InMesh, const Material& InMaterial)
+    {
+        // A material is identified by its maps array, which raylib allocates per material
+        for (const Scope<FInstanceBatch>& Batch : Batches)
+        {
+            if (Batch->BatchMesh.vaoId == InMesh.vaoId && Batch->BatchMaterial.maps == InMaterial.maps)
+                return *Batch;
+        }
+
+        CORE_ASSERT(InMesh.vaoId != 0, "Instanced meshes must be uploaded with a vertex array");
+
+        Scope<FInstanceBatch>& Batch = Batches.emplace_back(CreateScope<FInstanceBatch>());
+        Batch->BatchMesh = InMesh;
+        Batch->BatchMaterial = InMaterial;
+        return *Batch;
+    }
+
+    void FInstancedRenderer::Submit(const Mesh& InMesh, const Material& InMaterial, const Matrix& Transform, Color Tint)
+    {
+        GetBatch(InMesh, InMaterial).Add(Transform, Tint);
+    }
+
+    void FInstancedRenderer::Flush()
+    {
+        CORE_PROFILE_SCOPE("Instanced Flush");
+
+        DrawCallCount = 0;
+        InstanceCount = 0;
+        if (!IsShaderValid(InstanceShader))
+        {
+            for (const Scope<FInstanceBatch>& Batch : Batches)
+            {
+                Batch->Instances.clear();
+            }
+            return;
+        }
+
+        // Draw whatever raylib has batched so far first, so the instanced draws keep their place
+        rlDrawRenderBatchActive();
+
+        const Matrix ViewProjection = MatrixMultiply(MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()), rlGetMatrixProjection());
+        if (bWireframe)
+        {
+            rlEnableWireMode();
+        }
+
+        for (const Scope<FInstanceBatch>& Batch : Batches)
+        {
+            if (Batch->Instances.empty())
+                continue;
+
+            Upload(*Batch);
+            Draw(*Batch, ViewProjection);
+
+            InstanceCount += Batch->Instances.size();
+            ++DrawCallCount;
+            Batch->Instances.clear();
+        }
+
+        if (bWireframe)
+        {
+            rlDisableWireMode();
+        }
+    }
+
+    void FInstancedRenderer::Upload(FInstanceBatch& Batch)
+    {
+        const std::size_t Bytes = Batch.Instances.size() * sizeof(FInstanceData);
+
+        if (Batch.InstanceBuffer == 0)
+        {
+            glGenBuffers(1, &Batch.InstanceBuffer);
+        }
+        glBindBuffer(GL_ARRAY_BUFFER, Batch.InstanceBuffer);
+
+        if (Bytes > Batch.BufferCapacity)
+        {
+            if (Batch.BufferCapacity > 0)
+            {
+                CORE_MEMORY_GPU_FREE(Buffer, Batch.InstanceBuffer);
+            }
+            Batch.BufferCapacity = std::max({ Bytes, Batch.BufferCapacity * 2, InitialInstanceCapacity * sizeof(FInstanceData) });
+            CORE_MEMORY_GPU_ALLOC(Buffer, Batch.InstanceBuffer, Batch.BufferCapacity);
+        }
+
+        // Respecifying the storage lets the driver hand out fresh memory instead of waiting for
+        // last frame's draw to finish reading the old contents
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(Batch.BufferCapacity), nullptr, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(Bytes), Batch.Instances.data());
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    void FInstancedRenderer::Draw(FInstanceBatch& Batch, const Matrix& ViewProjection)
+    {
+        const Mesh& BatchMesh = Batch.BatchMesh;
+        const Material& BatchMaterial = Batch.BatchMaterial;
+        const int* Locations = InstanceShader.locs;
+
+        rlEnableShader(InstanceShader.id);
+        rlSetUniformMatrix(Locations[SHADER_LOC_MATRIX_MVP], ViewProjection);
+
+        const Color Diffuse = BatchMaterial.maps ? BatchMaterial.maps[MATERIAL_MAP_DIFFUSE].color : WHITE;
+        const float DiffuseValues[4] = { Diffuse.r / 255.0f, Diffuse.g / 255.0f, Diffuse.b / 255.0f, Diffuse.a / 255.0f };
+        rlSetUniform(Locations[SHADER_LOC_COLOR_DIFFUSE], DiffuseValues, SHADER_UNIFORM_VEC4, 1);
+
+        const unsigned int Texture = (BatchMaterial.maps && BatchMaterial.maps[MATERIAL_MAP_DIFFUSE].texture.id > 0)
+            ? BatchMaterial.maps[MATERIAL_MAP_DIFFUSE].texture.id
+            : rlGetTextureIdDefault();
+        const int TextureSlot = 0;
+        rlActiveTextureSlot(TextureSlot);
+        rlEnableTexture(Texture);
+        rlSetUniform(Locations[SHADER_LOC_MAP_DIFFUSE], &TextureSlot, SHADER_UNIFORM_INT, 1);
+
+        // The instance attributes are attached to the mesh's vertex array only for this draw, so
+        // the same mesh can still be drawn normally or by another batch
+        rlEnableVertexArray(BatchMesh.vaoId);
+        rlEnableVertexBuffer(Batch.InstanceBuffer);
+
+        const int TransformLocation = Locations[SHADER_LOC_VERTEX_INSTANCE_TX];
+        for (int Column = 0; Column < 4; ++Column)
+        {
+            rlEnableVertexAttribute(TransformLocation + Column);
+            rlSetVertexAttribute(TransformLocation + Column, 4, RL_FLOAT, false, sizeof(FInstanceData), Column * 4 * static_cast<int>(sizeof(float)));
+            rlSetVertexAttributeDivisor(TransformLocation + Column, 1);
+        }
+        if (InstanceColorLocation != -1)
+        {
+            rlEnableVertexAttribute(InstanceColorLocation);
+            rlSetVertexAttribute(InstanceColorLocation, 4, RL_UNSIGNED_BYTE, true, sizeof(FInstanceData), static_cast<int>(offsetof(FInstanceData, Tint)));
+            rlSetVertexAttributeDivisor(InstanceColorLocation, 1);
+        }
+
+        const int Instances = static_cast<int>(Batch.Instances.size());
+        if (BatchMesh.indices != nullptr)
+        {
+            rlDrawVertexArrayElementsInstanced(0, BatchMesh.triangleCount * 3, nullptr, Instances);
+        }
+        else
+        {
+            rlDrawVertexArrayInstanced(0, BatchMesh.vertexCount, Instances);
+        }
+
+        for (int Column = 0; Column < 4; ++Column)
+        {
+            rlSetVertexAttributeDivisor(TransformLocation + Column, 0);
+            rlDisableVertexAttribute(TransformLocation + Column);
+        }
+        if (InstanceColorLocation != -1)
+        {
+            rlSetVertexAttributeDivisor(InstanceColorLocation, 0);
+            rlDisableVertexAttribute(InstanceColorLocation);
+        }
+
+        rlDisableVertexBuffer();
+        rlDisableVertexArray();
+        rlDisableTexture();
+        rlDisableShader();
+    }
+
+}
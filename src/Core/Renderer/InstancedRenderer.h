@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "raylib.h"
+
+namespace Core
+{
+
+    // One instance as the shader sees it: a column-major model matrix and an RGBA tint
+    struct FInstanceData
+    {
+        float Transform[16];
+        Color Tint;
+    };
+
+    // The instances of one (mesh, material) pair gathered for the current frame
+    class FInstanceBatch
+    {
+    public:
+        void Add(const Matrix& Transform, Color Tint);
+        // Translation, rotation around Y and scale, without building the intermediate matrices
+        void Add(Vector3 Position, float YawDegrees, Vector3 Scale, Color Tint);
+        void Reserve(std::size_t Count) { Instances.reserve(Count); }
+
+        [[nodiscard]] std::size_t GetCount() const { return Instances.size(); }
+
+    private:
+        friend class FInstancedRenderer;
+
+        Mesh BatchMesh{};
+        Material BatchMaterial{};
+        std::vector<FInstanceData> Instances;
+
+        // Persistent GPU copy of Instances; grows by doubling and is refilled every flush
+        unsigned int InstanceBuffer = 0;
+        std::size_t BufferCapacity = 0;
+    };
+
+    // Draws many copies of the same meshes with one instanced draw call per (mesh, material)
+    // pair instead of one call per object. Instances are gathered into batches during the frame
+    // and Flush uploads each batch into its own persistent instance buffer and draws it.
+    // Batches draw with a built-in shader that applies per-instance transform and tint plus a
+    // fixed directional light; from the material it uses the diffuse color and texture.
+    // Meshes must be uploaded (UploadMesh / LoadModel). Render thread only, with a GL context.
+    class FInstancedRenderer
+    {
+    public:
+        FInstancedRenderer();
+        ~FInstancedRenderer();
+
+        FInstancedRenderer(const FInstancedRenderer&) = delete;
+        FInstancedRenderer& operator=(const FInstancedRenderer&) = delete;
+
+        // The batch for the pair, created on first use. Batches live as long as the renderer,
+        // so hot loops should look theirs up once and Add to it directly.
+        FInstanceBatch& GetBatch(const Mesh& InMesh, const Material& InMaterial);
+        void Submit(const Mesh& InMesh, const Material& InMaterial, const Matrix& Transform, Color Tint);
+
+        // Draws every batch with the current camera and empties them. Call between
+        // BeginMode3D and EndMode3D.
+        void Flush();
+
+        // Wireframe only works where the GL has polygon modes, so not on the web
+        void SetWireframe(bool bInWireframe) { bWireframe = bInWireframe; }
+
+        // Of the last Flush
+        [[nodiscard]] std::size_t GetDrawCallCount() const { return DrawCallCount; }
+        [[nodiscard]] std::size_t GetInstanceCount() const { return InstanceCount; }
+
+    private:
+        void Upload(FInstanceBatch& Batch);
+        void Draw(FInstanceBatch& Batch, const Matrix& ViewProjection);
+
+    private:
+        Shader InstanceShader{};
+        int InstanceColorLocation = -1;
+
+        std::vector<Scope<FInstanceBatch>> Batches;
+        bool bWireframe = false;
+
+        std::size_t DrawCallCount = 0;
+        std::size_t InstanceCount = 0;
+    };
+
+}
@@ -0,0 +1,383 @@
+#include "RenderQueue.h"
+#include "Core/Profiling/Profiler.h"
+
+#include "raymath.h"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+namespace Core
+{
+
+    namespace
+    {
+        constexpr std::uint64_t FieldMask(int Bits) { return (std::uint64_t{ 1 } << Bits) - 1; }
+
+        // Fields from the least significant end; the low byte is left free
+        constexpr int PrimitiveShift = 8;
+        constexpr int TextureShift = PrimitiveShift + FRenderQueue::PrimitiveBits;
+        constexpr int MaterialShift = TextureShift + FRenderQueue::TextureBits;
+        constexpr int ShaderShift = MaterialShift + FRenderQueue::MaterialBits;
+        constexpr int DepthShift = ShaderShift + FRenderQueue::ShaderBits;
+        constexpr int PassShift = DepthShift + FRenderQueue::DepthBits;
+        static_assert(PassShift + FRenderQueue::PassBits == 64);
+
+        std::uint32_t CountStateChanges(std::uint64_t Previous, std::uint64_t Current)
+        {
+            const auto Differs = [&](int Shift, int Bits)
+            {
+                return ((Previous >> Shift) & FieldMask(Bits)) != ((Current >> Shift) & FieldMask(Bits)) ? 1u : 0u;
+            };
+            return Differs(ShaderShift, FRenderQueue::ShaderBits) + Differs(MaterialShift, FRenderQueue::MaterialBits)
+                 + Differs(TextureShift, FRenderQueue::TextureBits) + Differs(PrimitiveShift, FRenderQueue::PrimitiveBits);
+        }
+
+        // Materials have no id; their map array identifies them
+        std::uint32_t GetMaterialId(const Material& InMaterial)
+        {
+            const std::uintptr_t Address = reinterpret_cast<std::uintptr_t>(InMaterial.maps);
+            return static_cast<std::uint32_t>((Address >> 4) ^ (Address >> 20));
+        }
+
+        std::uint32_t GetDiffuseTexture(const Material& InMaterial)
+        {
+            return InMaterial.maps ? InMaterial.maps[MATERIAL_MAP_DIFFUSE].texture.id : 0;
+        }
+
+        Matrix GetModelTransform(const Model& InModel, Vector3 Position, Vector3 RotationAxis, float RotationDegrees, Vector3 Scale)
+        {
+            // As DrawModelEx builds it
+            const Matrix Transform = MatrixMultiply(MatrixMultiply(MatrixScale(Scale.x, Scale.y, Scale.z), MatrixRotate(RotationAxis, RotationDegrees * DEG2RAD)), MatrixTranslate(Position.x, Position.y, Position.z));
+            return MatrixMultiply(InModel.transform, Transform);
+        }
+    }
+
+    FRenderQueue::~FRenderQueue()
+    {
+        Release();
+    }
+
+    void FRenderQueue::SetView(const Camera3D& Camera)
+    {
+        ViewPosition = Camera.position;
+        const float Range = static_cast<float>(rlGetCullDistanceFar());
+        InverseViewRange = Range > 0.0f ? 1.0f / Range : 0.0f;
+    }
+
+    void FRenderQueue::DrawMesh(const Mesh& InMesh, const Material& InMaterial, const Matrix& Transform, ERenderPass Pass)
+    {
+        FCommand Command;
+        Command.Type = ECommandType::Mesh;
+        Command.Tint = WHITE;
+        Command.MeshDraw = { &InMesh, &InMaterial, Transform };
+        Record(Command, Pass, { Transform.m12, Transform.m13, Transform.m14 }, InMaterial.shader.id, GetMaterialId(InMaterial), GetDiffuseTexture(InMaterial), PrimitiveMesh);
+    }
+
+    void FRenderQueue::DrawModel(const Model& InModel, Vector3 Position, Vector3 RotationAxis, float RotationDegrees, Vector3 Scale, Color Tint, ERenderPass Pass)
+    {
+        RecordModel(InModel, Position, RotationAxis, RotationDegrees, Scale, Tint, Pass, ECommandType::Mesh);
+    }
+
+    void FRenderQueue::DrawModelWires(const Model& InModel, Vector3 Position, Vector3 RotationAxis, float RotationDegrees, Vector3 Scale, Color Tint, ERenderPass Pass)
+    {
+        RecordModel(InModel, Position, RotationAxis, RotationDegrees, Scale, Tint, Pass, ECommandType::MeshWires);
+    }
+
+    void FRenderQueue::RecordModel(const Model& InModel, Vector3 Position, Vector3 RotationAxis, float RotationDegrees, Vector3 Scale, Color Tint, ERenderPass Pass, ECommandType Type)
+    {
+        const Matrix Transform = GetModelTransform(InModel, Position, RotationAxis, RotationDegrees, Scale);
+        for (int Index = 0; Index < InModel.meshCount; ++Index)
+        {
+            const Material& MeshMaterial = InModel.materials[InModel.meshMaterial[Index]];
+
+            FCommand Command;
+            Command.Type = Type;
+            Command.Tint = Tint;
+            Command.MeshDraw = { &InModel.meshes[Index], &MeshMaterial, Transform };
+            Record(Command, Pass, Position, MeshMaterial.shader.id, GetMaterialId(MeshMaterial), GetDiffuseTexture(MeshMaterial), Type == ECommandType::MeshWires ? PrimitiveMeshWires : PrimitiveMesh);
+        }
+    }
+
+    void FRenderQueue::DrawLine3D(Vector3 Start, Vector3 End, Color Tint, ERenderPass Pass)
+    {
+        FCommand Command;
+        Command.Type = ECommandType::Line;
+        Command.Tint = Tint;
+        Command.Line = { Start, End };
+        Record(Command, Pass, Vector3Lerp(Start, End, 0.5f), rlGetShaderIdDefault(), 0, rlGetTextureIdDefault(), PrimitiveLines);
+    }
+
+    void FRenderQueue::DrawCube(Vector3 Position, Vector3 Size, float YawDegrees, Color Tint, ERenderPass Pass)
+    {
+        FCommand Command;
+        Command.Type = ECommandType::Cube;
+        Command.Tint = Tint;
+        Command.Cube = { Position, Size, YawDegrees };
+        Record(Command, Pass, Position, rlGetShaderIdDefault(), 0, rlGetTextureIdDefault(), PrimitiveTriangles);
+    }
+
+    void FRenderQueue::DrawCubeWires(Vector3 Position, Vector3 Size, float YawDegrees, Color Tint, ERenderPass Pass)
+    {
+        FCommand Command;
+        Command.Type = ECommandType::CubeWires;
+        Command.Tint = Tint;
+        Command.Cube = { Position, Size, YawDegrees };
+        Record(Command, Pass, Position, rlGetShaderIdDefault(), 0, rlGetTextureIdDefault(), PrimitiveLines);
+    }
+
+    void FRenderQueue::DrawBoundingBox(const BoundingBox& Box, Color Tint, ERenderPass Pass)
+    {
+        FCommand Command;
+        Command.Type = ECommandType::BoundingBox;
+        Command.Tint = Tint;
+        Command.Box = Box;
+        Record(Command, Pass, Vector3Lerp(Box.min, Box.max, 0.5f), rlGetShaderIdDefault(), 0, rlGetTextureIdDefault(), PrimitiveLines);
+    }
+
+    void FRenderQueue::DrawGrid(int Slices, float Spacing, ERenderPass Pass)
+    {
+        FCommand Command;
+        Command.Type = ECommandType::Grid;
+        Command.Grid = { Slices, Spacing };
+        Record(Command, Pass, Vector3Zero(), rlGetShaderIdDefault(), 0, rlGetTextureIdDefault(), PrimitiveLines);
+    }
+
+    void FRenderQueue::AddCallback(FCallback Callback, ERenderPass Pass)
+    {
+        FCommand Command;
+        Command.Type = ECommandType::Callback;
+        Command.CallbackIndex = static_cast<std::uint32_t>(Callbacks.size());
+        Callbacks.push_back(std::move(Callback));
+        Record(Command, Pass, ViewPosition, 0, 0, 0, PrimitiveCallback);
+    }
+
+    void FRenderQueue::Record(const FCommand& Command, ERenderPass Pass, Vector3 Position, std::uint32_t Shader, std::uint32_t MaterialId, std::uint32_t Texture, std::uint32_t Primitive)
+    {
+        Items.push_back({ MakeKey(Pass, GetDepthBucket(Pass, Position), Shader, MaterialId, Texture, Primitive), static_cast<std::uint32_t>(Commands.size()) });
+        Commands.push_back(Command);
+    }
+
+    std::uint32_t FRenderQueue::GetDepthBucket(ERenderPass Pass, Vector3 Position) const
+    {
+        if (Pass == ERenderPass::Overlay)
+            return 0;
+
+        const float Distance = std::clamp(Vector3Distance(ViewPosition, Position) * InverseViewRange, 0.0f, 1.0f);
+        const std::uint32_t Bucket = static_cast<std::uint32_t>(Distance * static_cast<float>(DepthBuckets - 1));
+        if (Pass == ERenderPass::Transparent)
+            return DepthBuckets - 1 - Bucket;
+        return Bucket & ~static_cast<std::uint32_t>(FieldMask(DepthBits - OpaqueDepthBits));
+    }
+
+    std::uint64_t FRenderQueue::MakeKey(ERenderPass Pass, std::uint32_t Depth, std::uint32_t Shader, std::uint32_t MaterialId, std::uint32_t Texture, std::uint32_t Primitive)
+    {
+        return (static_cast<std::uint64_t>(Pass) & FieldMask(PassBits)) << PassShift
+             | (Depth & FieldMask(DepthBits)) << DepthShift
+             | (Shader & FieldMask(ShaderBits)) << ShaderShift
+             | (MaterialId & FieldMask(MaterialBits)) << MaterialShift
+             | (Texture & FieldMask(TextureBits)) << TextureShift
+             | (Primitive & FieldMask(PrimitiveBits)) << PrimitiveShift;
+    }
+
+    void FRenderQueue::Sort()
+    {
+        CORE_PROFILE_FUNCTION();
+
+        const std::size_t Count = Items.size();
+        std::array<std::array<std::uint32_t, 256>, 8> Histograms{};
+        for (const FSortItem& Item : Items)
+        {
+            for (int Byte = 0; Byte < 8; ++Byte)
+            {
+                ++Histograms[Byte][(Item.Key >> (Byte * 8)) & 0xFF];
+            }
+        }
+
+        Scratch.resize(Count);
+        for (int Byte = 0; Byte < 8; ++Byte)
+        {
+            std::array<std::uint32_t, 256>& Histogram = Histograms[Byte];
+            const std::uint32_t First = Histogram[(Items[0].Key >> (Byte * 8)) & 0xFF];
+            if (First == Count)
+                continue;
+
+            // Counts to starting offsets
+            std::uint32_t Offset = 0;
+            for (std::uint32_t& Bucket : Histogram)
+            {
+                const std::uint32_t BucketCount = Bucket;
+                Bucket = Offset;
+                Offset += BucketCount;
+            }
+
+            for (const FSortItem& Item : Items)
+            {
+                Scratch[Histogram[(Item.Key >> (Byte * 8)) & 0xFF]++] = Item;
+            }
+            Items.swap(Scratch);
+        }
+    }
+
+    void FRenderQueue::Execute()
+    {
+        CORE_PROFILE_FUNCTION();
+
+        Stats = {};
+        Stats.Commands = static_cast<std::uint32_t>(Items.size());
+        if (Items.empty())
+        {
+            BeginFrame();
+            return;
+        }
+
+        if (bSortEnabled)
+        {
+            Sort();
+        }
+
+        if (!bBatchLoaded)
+        {
+            Batch = rlLoadRenderBatch(2, RL_DEFAULT_BATCH_BUFFER_ELEMENTS);
+            bBatchLoaded = true;
+        }
+
+        // Whatever was drawn before the queue goes out with the default batch
+        rlSetRenderBatchActive(&Batch);
+
+        std::uint64_t PreviousKey = Items[0].Key;
+        for (const FSortItem& Item : Items)
+        {
+            Stats.StateChanges += CountStateChanges(PreviousKey, Item.Key);
+            PreviousKey = Item.Key;
+
+            const FCommand& Command = Commands[Item.Command];
+            if (Command.Type == ECommandType::Callback)
+            {
+                FlushBatch();
+                Callbacks[Command.CallbackIndex]();
+                continue;
+            }
+
+            // rlgl flushes by itself when an entry or the vertex buffer runs out, moving on to the
+            // next buffer; commands are far smaller than a buffer, so it flushes once at most
+            const int BufferBefore = Batch.currentBuffer;
+            const std::uint32_t EntriesBefore = GetPendingDrawEntries();
+            Run(Command);
+            if (Batch.currentBuffer != BufferBefore)
+            {
+                ++Stats.BatchFlushes;
+                Stats.DrawCalls += EntriesBefore;
+            }
+        }
+
+        FlushBatch();
+        rlSetRenderBatchActive(nullptr);
+
+        BeginFrame();
+    }
+
+    void FRenderQueue::Run(const FCommand& Command)
+    {
+        switch (Command.Type)
+        {
+            case ECommandType::Mesh:
+            case ECommandType::MeshWires:
+            {
+                // Tinted like DrawModelEx, which multiplies the material's own diffuse color
+                Color& Diffuse = Command.MeshDraw.MaterialData->maps[MATERIAL_MAP_DIFFUSE].color;
+                const Color Original = Diffuse;
+                Diffuse = { static_cast<unsigned char>(Original.r * Command.Tint.r / 255), static_cast<unsigned char>(Original.g * Command.Tint.g / 255),
+                            static_cast<unsigned char>(Original.b * Command.Tint.b / 255), static_cast<unsigned char>(Original.a * Command.Tint.a / 255) };
+
+                if (Command.Type == ECommandType::MeshWires)
+                {
+                    rlEnableWireMode();
+                }
+                ::DrawMesh(*Command.MeshDraw.MeshData, *Command.MeshDraw.MaterialData, Command.MeshDraw.Transform);
+                if (Command.Type == ECommandType::MeshWires)
+                {
+                    rlDisableWireMode();
+                }
+
+                Diffuse = Original;
+                ++Stats.DrawCalls;
+                break;
+            }
+            case ECommandType::Line:
+                ::DrawLine3D(Command.Line.Start, Command.Line.End, Command.Tint);
+                break;
+            case ECommandType::Cube:
+            case ECommandType::CubeWires:
+            {
+                const Vector3 Position = Command.Cube.Position;
+                const bool bRotated = Command.Cube.YawDegrees != 0.0f;
+                if (bRotated)
+                {
+                    rlPushMatrix();
+                    rlTranslatef(Position.x, Position.y, Position.z);
+                    rlRotatef(Command.Cube.YawDegrees, 0.0f, 1.0f, 0.0f);
+                    rlTranslatef(-Position.x, -Position.y, -Position.z);
+                }
+
+                if (Command.Type == ECommandType::Cube)
+                    ::DrawCubeV(Position, Command.Cube.Size, Command.Tint);
+                else
+                    ::DrawCubeWiresV(Position, Command.Cube.Size, Command.Tint);
+
+                if (bRotated)
+                {
+                    rlPopMatrix();
+                }
+                break;
+            }
+            case ECommandType::BoundingBox:
+                ::DrawBoundingBox(Command.Box, Command.Tint);
+                break;
+            case ECommandType::Grid:
+                ::DrawGrid(Command.Grid.Slices, Command.Grid.Spacing);
+                break;
+            case ECommandType::Callback:
+                break;
+        }
+    }
+
+    void FRenderQueue::FlushBatch()
+    {
+        const std::uint32_t Entries = GetPendingDrawEntries();
+        if (Entries == 0)
+            return;
+
+        rlDrawRenderBatch(&Batch);
+        ++Stats.BatchFlushes;
+        Stats.DrawCalls += Entries;
+    }
+
+    std::uint32_t FRenderQueue::GetPendingDrawEntries() const
+    {
+        // rlgl only opens an entry once the previous one has vertices, so only the last can be empty
+        if (Batch.drawCounter <= 0)
+            return 0;
+        const bool bLastEmpty = Batch.draws[Batch.drawCounter - 1].vertexCount == 0;
+        return static_cast<std::uint32_t>(Batch.drawCounter) - (bLastEmpty ? 1u : 0u);
+    }
+
+    void FRenderQueue::BeginFrame()
+    {
+        Commands.clear();
+        Callbacks.clear();
+        Items.clear();
+    }
+
+    void FRenderQueue::Release()
+    {
+        BeginFrame();
+        if (bBatchLoaded)
+        {
+            rlUnloadRenderBatch(Batch);
+            Batch = {};
+            bBatchLoaded = false;
+        }
+    }
+
+}
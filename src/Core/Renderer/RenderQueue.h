@@ -0,0 +1,177 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "raylib.h"
+#include "rlgl.h"
+
+namespace Core
+{
+
+    // Coarse draw order; passes never mix in the sort
+    enum class ERenderPass : std::uint8_t
+    {
+        Opaque,         // State first, then roughly front to back
+        Transparent,    // Back to front
+        Overlay         // Submission order, drawn last
+    };
+
+    // Of the last Execute
+    struct FRenderQueueStats
+    {
+        std::uint32_t Commands = 0;
+        // GL draw calls: one per mesh, plus one per rlgl draw entry flushed
+        std::uint32_t DrawCalls = 0;
+        // rlDrawRenderBatch calls that had vertices to draw
+        std::uint32_t BatchFlushes = 0;
+        // Shader, material, texture or primitive switches between consecutive commands
+        std::uint32_t StateChanges = 0;
+    };
+
+    // Draw commands recorded during the frame and executed together, sorted by a 64-bit key
+    // (pass, depth bucket, shader, material, texture, primitive) so that commands sharing state
+    // run back to back. Immediate-mode primitives then land in a few long rlgl draw entries
+    // instead of alternating modes, which otherwise fills the batch's RL_DEFAULT_BATCH_DRAWCALLS
+    // entries and flushes it every few hundred objects. Commands with equal keys keep their
+    // recording order.
+    // Meshes, materials and models are referenced, not copied, and must stay alive until Execute.
+    // Render thread only; Execute needs a GL context.
+    class FRenderQueue
+    {
+    public:
+        using FCallback = std::function<void()>;
+
+        static constexpr int PassBits = 4;
+        static constexpr int DepthBits = 12;
+        static constexpr int ShaderBits = 12;
+        static constexpr int MaterialBits = 12;
+        static constexpr int TextureBits = 12;
+        static constexpr int PrimitiveBits = 4;
+        static constexpr std::uint32_t DepthBuckets = 1u << DepthBits;
+        // Opaque commands only use the top bits of their depth bucket so state runs stay long
+        static constexpr int OpaqueDepthBits = 4;
+
+        FRenderQueue() = default;
+        ~FRenderQueue();
+
+        FRenderQueue(const FRenderQueue&) = delete;
+        FRenderQueue& operator=(const FRenderQueue&) = delete;
+
+        // Where depth buckets are measured from, out to rlgl's far cull distance. Commands
+        // recorded before the first call all fall in the nearest bucket.
+        void SetView(const Camera3D& Camera);
+
+        void DrawMesh(const Mesh& InMesh, const Material& InMaterial, const Matrix& Transform, ERenderPass Pass = ERenderPass::Opaque);
+        // Every mesh of the model with its material, like DrawModelEx / DrawModelWiresEx
+        void DrawModel(const Model& InModel, Vector3 Position, Vector3 RotationAxis, float RotationDegrees, Vector3 Scale, Color Tint, ERenderPass Pass = ERenderPass::Opaque);
+        void DrawModelWires(const Model& InModel, Vector3 Position, Vector3 RotationAxis, float RotationDegrees, Vector3 Scale, Color Tint, ERenderPass Pass = ERenderPass::Opaque);
+
+        void DrawLine3D(Vector3 Start, Vector3 End, Color Tint, ERenderPass Pass = ERenderPass::Opaque);
+        // Rotated around Y through its center
+        void DrawCube(Vector3 Position, Vector3 Size, float YawDegrees, Color Tint, ERenderPass Pass = ERenderPass::Opaque);
+        void DrawCubeWires(Vector3 Position, Vector3 Size, float YawDegrees, Color Tint, ERenderPass Pass = ERenderPass::Opaque);
+        void DrawBoundingBox(const BoundingBox& Box, Color Tint, ERenderPass Pass = ERenderPass::Opaque);
+        void DrawGrid(int Slices, float Spacing, ERenderPass Pass = ERenderPass::Opaque);
+
+        // Anything else, such as an instanced renderer's flush. The pending rlgl batch is drawn
+        // first, so the callback may change GL state freely but must restore it.
+        void AddCallback(FCallback Callback, ERenderPass Pass = ERenderPass::Opaque);
+
+        // Sorts and draws everything recorded since the last Execute, then empties the queue.
+        // Call between BeginMode3D and EndMode3D.
+        void Execute();
+        // Drops commands nobody executed; FApplication calls it at the start of every frame
+        void BeginFrame();
+        // Before the GL context goes away
+        void Release();
+
+        // Off draws in recording order, to compare the counters against
+        void SetSortEnabled(bool bInSortEnabled) { bSortEnabled = bInSortEnabled; }
+        [[nodiscard]] bool IsSortEnabled() const { return bSortEnabled; }
+
+        [[nodiscard]] std::size_t GetCommandCount() const { return Commands.size(); }
+        [[nodiscard]] const FRenderQueueStats& GetStats() const { return Stats; }
+
+    private:
+        enum class ECommandType : std::uint8_t
+        {
+            Mesh,
+            MeshWires,
+            Line,
+            Cube,
+            CubeWires,
+            BoundingBox,
+            Grid,
+            Callback
+        };
+
+        struct FCommand
+        {
+            ECommandType Type = ECommandType::Mesh;
+            Color Tint{};
+            union
+            {
+                struct { const Mesh* MeshData; const Material* MaterialData; Matrix Transform; } MeshDraw;
+                struct { Vector3 Start; Vector3 End; } Line;
+                struct { Vector3 Position; Vector3 Size; float YawDegrees; } Cube;
+                BoundingBox Box;
+                struct { int Slices; float Spacing; } Grid;
+                std::uint32_t CallbackIndex;
+            };
+
+            FCommand() : MeshDraw{} {}
+        };
+
+        struct FSortItem
+        {
+            std::uint64_t Key;
+            std::uint32_t Command;
+        };
+
+        // Primitive field values; rlgl modes for batched commands
+        enum EPrimitive : std::uint32_t
+        {
+            PrimitiveCallback = 0,
+            PrimitiveMesh = 1,
+            PrimitiveMeshWires = 2,
+            PrimitiveTriangles = 3,
+            PrimitiveLines = 4
+        };
+
+        void Record(const FCommand& Command, ERenderPass Pass, Vector3 Position, std::uint32_t Shader, std::uint32_t MaterialId, std::uint32_t Texture, std::uint32_t Primitive);
+        void RecordModel(const Model& InModel, Vector3 Position, Vector3 RotationAxis, float RotationDegrees, Vector3 Scale, Color Tint, ERenderPass Pass, ECommandType Type);
+        [[nodiscard]] std::uint32_t GetDepthBucket(ERenderPass Pass, Vector3 Position) const;
+        [[nodiscard]] static std::uint64_t MakeKey(ERenderPass Pass, std::uint32_t Depth, std::uint32_t Shader, std::uint32_t MaterialId, std::uint32_t Texture, std::uint32_t Primitive);
+
+        // LSD radix sort of Items by key, one byte per pass, skipping bytes all keys share
+        void Sort();
+        void Run(const FCommand& Command);
+        // Draws what the batch holds, counting it
+        void FlushBatch();
+        // Batch draw entries holding vertices
+        [[nodiscard]] std::uint32_t GetPendingDrawEntries() const;
+
+    private:
+        std::vector<FCommand> Commands;
+        std::vector<FCallback> Callbacks;
+        std::vector<FSortItem> Items;
+        std::vector<FSortItem> Scratch;
+
+        Vector3 ViewPosition{};
+        float InverseViewRange = 0.0f;
+
+        // Double-buffered so a refill does not wait for the GPU to finish reading the last one;
+        // the buffer index also tells when rlgl flushed on its own
+        rlRenderBatch Batch{};
+        bool bBatchLoaded = false;
+
+        bool bSortEnabled = true;
+        FRenderQueueStats Stats;
+    };
+
+}
@@ -0,0 +1,348 @@
+#include "RenderTargetPool.h"
+#include "Core/Logging/Log.h"
+#include "Core/Memory/MemoryTracker.h"
+#include "Core/Profiling/Profiler.h"
+
+#ifdef CORE_PLATFORM_WEB
+    #include <GLES3/gl3.h>
+#else
+    #include <glad/glad.h>
+#endif
+
+#include "rlgl.h"
+
+#include <algorithm>
+
+namespace Core
+{
+
+    namespace
+    {
+        using FClock = std::chrono::steady_clock;
+
+        int RoundUp(int Size)
+        {
+            return (Size + FRenderTargetPool::Granularity - 1) / FRenderTargetPool::Granularity * FRenderTargetPool::Granularity;
+        }
+
+        bool IsCompatible(const FRenderTargetDesc& Allocated, const FRenderTargetDesc& Desc)
+        {
+            return Allocated.Format == Desc.Format && Allocated.Samples == Desc.Samples && Allocated.bDepth == Desc.bDepth;
+        }
+
+        bool Fits(const FRenderTargetDesc& Allocated, const FRenderTargetDesc& Desc)
+        {
+            return Allocated.Width >= Desc.Width && Allocated.Height >= Desc.Height;
+        }
+
+        // Twice what a fresh allocation would need in either direction
+        bool IsOversized(const FRenderTargetDesc& Allocated, const FRenderTargetDesc& Desc)
+        {
+            return RoundUp(Desc.Width) * 2 <= Allocated.Width || RoundUp(Desc.Height) * 2 <= Allocated.Height;
+        }
+
+        GLuint CreateRenderbuffer(int Samples, GLenum InternalFormat, int Width, int Height)
+        {
+            GLuint Renderbuffer = 0;
+            glGenRenderbuffers(1, &Renderbuffer);
+            glBindRenderbuffer(GL_RENDERBUFFER, Renderbuffer);
+            if (Samples > 1)
+                glRenderbufferStorageMultisample(GL_RENDERBUFFER, Samples, InternalFormat, Width, Height);
+            else
+                glRenderbufferStorage(GL_RENDERBUFFER, InternalFormat, Width, Height);
+            glBindRenderbuffer(GL_RENDERBUFFER, 0);
+            return Renderbuffer;
+        }
+    }
+
+    RenderTexture2D FRenderTarget::GetRenderTexture() const
+    {
+        RenderTexture2D Result{};
+        if (!Allocation)
+            return Result;
+
+        Result.id = Allocation->Framebuffer;
+        Result.texture = GetTexture();
+        Result.texture.width = Width;
+        Result.texture.height = Height;
+        return Result;
+    }
+
+    Texture2D FRenderTarget::GetTexture() const
+    {
+        if (!Allocation)
+            return Texture2D{};
+
+        const FRenderTargetDesc& Desc = Allocation->Desc;
+        return Texture2D{ Allocation->ColorTexture, Desc.Width, Desc.Height, 1, Desc.Format };
+    }
+
+    Vector2 FRenderTarget::GetUVExtent() const
+    {
+        if (!Allocation)
+            return Vector2{ 0.0f, 0.0f };
+
+        return Vector2
+        {
+            static_cast<float>(Width) / static_cast<float>(Allocation->Desc.Width),
+            static_cast<float>(Height) / static_cast<float>(Allocation->Desc.Height)
+        };
+    }
+
+    void FRenderTarget::Resolve() const
+    {
+        if (!Allocation || Allocation->Desc.Samples <= 1)
+            return;
+
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, Allocation->Framebuffer);
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, Allocation->ResolveFramebuffer);
+        glBlitFramebuffer(0, 0, Width, Height, 0, 0, Width, Height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    }
+
+    FRenderTargetPool::FRenderTargetPool(int InRetireFrames)
+        : RetireFrames(std::max(InRetireFrames, 1))
+    {
+    }
+
+    FRenderTargetPool::~FRenderTargetPool()
+    {
+        CORE_ASSERT(Allocations.empty() && Retired.empty(), "FRenderTargetPool::ReleaseAll must run before the GL context goes away");
+    }
+
+    void FRenderTargetPool::Request(FRenderTarget& Target, const FRenderTargetDesc& Desc)
+    {
+        CORE_ASSERT(Desc.Width > 0 && Desc.Height > 0, "Render targets need a size");
+
+        if (MaxSamples == 0)
+        {
+            glGetIntegerv(GL_MAX_SAMPLES, &MaxSamples);
+            MaxSamples = std::max(MaxSamples, 1);
+        }
+
+        FRenderTargetDesc Wanted = Desc;
+        Wanted.Samples = std::clamp(Desc.Samples, 1, MaxSamples);
+
+        const FClock::time_point Now = FClock::now();
+        FAllocation* Current = Target.Allocation;
+
+        // A different kind of target: leave the allocation to whoever needs that kind
+        if (Current && !IsCompatible(Current->Desc, Wanted))
+        {
+            Release(Target);
+            Current = nullptr;
+        }
+
+        if (Current && Fits(Current->Desc, Wanted))
+        {
+            if (!IsOversized(Current->Desc, Wanted))
+            {
+                Current->OversizedSince = {};
+            }
+            else if (Current->OversizedSince == FClock::time_point{})
+            {
+                Current->OversizedSince = Now;
+            }
+
+            // Shrinking waits out the delay so that dragging back and forth keeps the allocation
+            if (Current->OversizedSince == FClock::time_point{} || Now - Current->OversizedSince < ShrinkDelay)
+            {
+                Target.Width = Wanted.Width;
+                Target.Height = Wanted.Height;
+                return;
+            }
+        }
+
+        FRenderTargetDesc Size = Wanted;
+        if (Current && !Fits(Current->Desc, Wanted))
+        {
+            // Outgrown: leave headroom for the resize that is probably still going on
+            const FRenderTargetDesc& Allocated = Current->Desc;
+            Size.Width = Wanted.Width > Allocated.Width ? std::max(Wanted.Width, static_cast<int>(Allocated.Width * GrowthFactor)) : Allocated.Width;
+            Size.Height = Wanted.Height > Allocated.Height ? std::max(Wanted.Height, static_cast<int>(Allocated.Height * GrowthFactor)) : Allocated.Height;
+        }
+        Size.Width = RoundUp(Size.Width);
+        Size.Height = RoundUp(Size.Height);
+
+        FAllocation* Next = FindFree(Wanted);
+        if (!Next)
+            Next = Create(Size);
+
+        if (Current)
+            Retire(Current);
+
+        Next->bInUse = true;
+        Next->OversizedSince = {};
+        Target.Allocation = Next;
+        Target.Width = Wanted.Width;
+        Target.Height = Wanted.Height;
+    }
+
+    void FRenderTargetPool::Release(FRenderTarget& Target)
+    {
+        if (Target.Allocation)
+        {
+            Target.Allocation->bInUse = false;
+            Target.Allocation->LastUsed = FClock::now();
+        }
+        Target = FRenderTarget{};
+    }
+
+    void FRenderTargetPool::BeginFrame()
+    {
+        CORE_PROFILE_FUNCTION();
+
+        // The fence follows everything the previous frame submitted
+        if (bRetiredSinceFence)
+        {
+            Fences.push_back(FFrameFence{ FrameIndex, glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) });
+            bRetiredSinceFence = false;
+        }
+        FrameIndex++;
+
+        while (!Fences.empty())
+        {
+            GLsync Sync = static_cast<GLsync>(Fences.front().Sync);
+            const GLenum Status = glClientWaitSync(Sync, 0, 0);
+            if (Status != GL_ALREADY_SIGNALED && Status != GL_CONDITION_SATISFIED)
+                break;
+
+            CompletedFrames = Fences.front().Frame + 1;
+            glDeleteSync(Sync);
+            Fences.pop_front();
+        }
+
+        std::erase_if(Retired, [this](FRetiredAllocation& Entry)
+        {
+            if (Entry.Frame >= CompletedFrames || FrameIndex < Entry.Frame + RetireFrames)
+                return false;
+
+            Destroy(*Entry.Allocation);
+            return true;
+        });
+
+        const FClock::time_point Now = FClock::now();
+        for (std::size_t Index = Allocations.size(); Index-- > 0;)
+        {
+            FAllocation* Allocation = Allocations[Index].get();
+            if (!Allocation->bInUse && Now - Allocation->LastUsed >= ShrinkDelay)
+                Retire(Allocation);
+        }
+    }
+
+    void FRenderTargetPool::ReleaseAll()
+    {
+        for (Scope<FAllocation>& Allocation : Allocations)
+            Destroy(*Allocation);
+        for (FRetiredAllocation& Entry : Retired)
+            Destroy(*Entry.Allocation);
+        for (FFrameFence& Fence : Fences)
+            glDeleteSync(static_cast<GLsync>(Fence.Sync));
+
+        Allocations.clear();
+        Retired.clear();
+        Fences.clear();
+        bRetiredSinceFence = false;
+    }
+
+    FRenderTargetPool::FAllocation* FRenderTargetPool::FindFree(const FRenderTargetDesc& Desc)
+    {
+        FAllocation* Best = nullptr;
+        for (const Scope<FAllocation>& Allocation : Allocations)
+        {
+            const FRenderTargetDesc& Allocated = Allocation->Desc;
+            if (Allocation->bInUse || !IsCompatible(Allocated, Desc) || !Fits(Allocated, Desc) || IsOversized(Allocated, Desc))
+                continue;
+
+            if (!Best || Allocated.Width * Allocated.Height < Best->Desc.Width * Best->Desc.Height)
+                Best = Allocation.get();
+        }
+        return Best;
+    }
+
+    FRenderTargetPool::FAllocation* FRenderTargetPool::Create(const FRenderTargetDesc& Desc)
+    {
+        CORE_PROFILE_FUNCTION();
+
+        Scope<FAllocation> Allocation = CreateScope<FAllocation>();
+        Allocation->Desc = Desc;
+
+        // Sub-rectangles are sampled right up to their edge, so nothing may wrap in from the far side
+        Allocation->ColorTexture = rlLoadTexture(nullptr, Desc.Width, Desc.Height, Desc.Format, 1);
+        rlTextureParameters(Allocation->ColorTexture, RL_TEXTURE_WRAP_S, RL_TEXTURE_WRAP_CLAMP);
+        rlTextureParameters(Allocation->ColorTexture, RL_TEXTURE_WRAP_T, RL_TEXTURE_WRAP_CLAMP);
+
+        const std::size_t ColorBytes = static_cast<std::size_t>(GetPixelDataSize(Desc.Width, Desc.Height, Desc.Format));
+        const std::size_t DepthBytes = static_cast<std::size_t>(Desc.Width) * Desc.Height * 4;
+        Allocation->Bytes = ColorBytes;
+
+        glGenFramebuffers(1, &Allocation->Framebuffer);
+        glBindFramebuffer(GL_FRAMEBUFFER, Allocation->Framebuffer);
+
+        if (Desc.Samples > 1)
+        {
+            unsigned int InternalFormat = 0, Format = 0, Type = 0;
+            rlGetGlTextureFormats(Desc.Format, &InternalFormat, &Format, &Type);
+
+            Allocation->ColorRenderbuffer = CreateRenderbuffer(Desc.Samples, InternalFormat, Desc.Width, Desc.Height);
+            glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, Allocation->ColorRenderbuffer);
+            Allocation->Bytes += ColorBytes * Desc.Samples;
+        }
+        else
+        {
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, Allocation->ColorTexture, 0);
+        }
+
+        if (Desc.bDepth)
+        {
+            Allocation->DepthRenderbuffer = CreateRenderbuffer(Desc.Samples, GL_DEPTH_COMPONENT24, Desc.Width, Desc.Height);
+            glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, Allocation->DepthRenderbuffer);
+            Allocation->Bytes += DepthBytes * Desc.Samples;
+        }
+
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        {
+            FLog::CoreError("Render target {}x{} (format {}, {} samples) is incomplete", Desc.Width, Desc.Height, static_cast<int>(Desc.Format), Desc.Samples);
+        }
+
+        if (Desc.Samples > 1)
+        {
+            glGenFramebuffers(1, &Allocation->ResolveFramebuffer);
+            glBindFramebuffer(GL_FRAMEBUFFER, Allocation->ResolveFramebuffer);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, Allocation->ColorTexture, 0);
+        }
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        CORE_MEMORY_GPU_ALLOC(RenderTarget, Allocation->Framebuffer, Allocation->Bytes);
+        CreatedCount++;
+
+        Allocations.push_back(std::move(Allocation));
+        return Allocations.back().get();
+    }
+
+    void FRenderTargetPool::Retire(FAllocation* Allocation)
+    {
+        auto It = std::find_if(Allocations.begin(), Allocations.end(), [Allocation](const Scope<FAllocation>& Entry) { return Entry.get() == Allocation; });
+        CORE_ASSERT(It != Allocations.end(), "Render target allocation is not live");
+        if (It == Allocations.end())
+            return;
+
+        Retired.push_back(FRetiredAllocation{ std::move(*It), FrameIndex });
+        Allocations.erase(It);
+        bRetiredSinceFence = true;
+    }
+
+    void FRenderTargetPool::Destroy(FAllocation& Allocation)
+    {
+        CORE_MEMORY_GPU_FREE(RenderTarget, Allocation.Framebuffer);
+
+        const GLuint Framebuffers[] = { Allocation.Framebuffer, Allocation.ResolveFramebuffer };
+        glDeleteFramebuffers(Allocation.ResolveFramebuffer ? 2 : 1, Framebuffers);
+        if (Allocation.ColorRenderbuffer)
+            glDeleteRenderbuffers(1, &Allocation.ColorRenderbuffer);
+        if (Allocation.DepthRenderbuffer)
+            glDeleteRenderbuffers(1, &Allocation.DepthRenderbuffer);
+        rlUnloadTexture(Allocation.ColorTexture);
+    }
+
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include "Core/Base/Core.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "raylib.h"
+
+namespace Core
+{
+
+    struct FRenderTargetDesc
+    {
+        int Width = 0;
+        int Height = 0;
+        PixelFormat Format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+        // Above 1, drawing goes to multisampled buffers that FRenderTarget::Resolve copies into the texture
+        int Samples = 1;
+        bool bDepth = true;
+    };
+
+    namespace Detail
+    {
+        struct FRenderTargetAllocation
+        {
+            // Width and Height are the allocated size, which may exceed what targets ask for
+            FRenderTargetDesc Desc;
+
+            unsigned int Framebuffer = 0;           // Drawn into; multisampled when Desc.Samples > 1
+            unsigned int ColorTexture = 0;          // Always single-sampled
+            unsigned int ColorRenderbuffer = 0;     // Multisampled only
+            unsigned int ResolveFramebuffer = 0;    // Multisampled only, wraps ColorTexture
+            unsigned int DepthRenderbuffer = 0;
+            std::size_t Bytes = 0;
+
+            bool bInUse = false;
+            std::chrono::steady_clock::time_point LastUsed;
+            // Start of the current stretch of requests well below the allocated size; zero when not oversized
+            std::chrono::steady_clock::time_point OversizedSince;
+        };
+    }
+
+    // A Width x Height rectangle at the origin of a pooled allocation that may be larger.
+    // Default constructed targets are invalid until FRenderTargetPool::Request.
+    class FRenderTarget
+    {
+    public:
+        [[nodiscard]] bool IsValid() const { return Allocation != nullptr; }
+        [[nodiscard]] int GetWidth() const { return Width; }
+        [[nodiscard]] int GetHeight() const { return Height; }
+
+        // For BeginTextureMode. Sized to the rectangle, so raylib's viewport, projection and 3D
+        // aspect ratio cover the rectangle rather than the whole allocation.
+        [[nodiscard]] RenderTexture2D GetRenderTexture() const;
+        // The color texture at the allocation's full size; only GetUVExtent of it holds the image
+        [[nodiscard]] Texture2D GetTexture() const;
+        [[nodiscard]] Vector2 GetUVExtent() const;
+
+        // Multisampled targets: copies the rectangle into GetTexture. Call after EndTextureMode.
+        void Resolve() const;
+
+    private:
+        friend class FRenderTargetPool;
+
+        Detail::FRenderTargetAllocation* Allocation = nullptr;
+        int Width = 0;
+        int Height = 0;
+    };
+
+    // Render targets by size, format and sample count, for views that change size often such as
+    // viewport panels. A target keeps its allocation while the requested size fits, so resizing
+    // costs no GL allocation until the size outgrows it; allocations then grow by GrowthFactor.
+    // An allocation much larger than its target is only shrunk after ShrinkDelay, and free ones
+    // are dropped after the same delay. Replaced allocations are deleted once a fence shows the GPU
+    // is done with them and RetireFrames have passed for UI frames built ahead.
+    // Render thread only.
+    class FRenderTargetPool
+    {
+    public:
+        static constexpr float GrowthFactor = 1.5f;
+        static constexpr int Granularity = 64;
+        static constexpr std::chrono::seconds ShrinkDelay{ 2 };
+
+        explicit FRenderTargetPool(int InRetireFrames = 1);
+        ~FRenderTargetPool();
+
+        FRenderTargetPool(const FRenderTargetPool&) = delete;
+        FRenderTargetPool& operator=(const FRenderTargetPool&) = delete;
+
+        // Points Target at a Desc.Width x Desc.Height rectangle, keeping its allocation when
+        // possible. Call every frame with the size the target should have.
+        void Request(FRenderTarget& Target, const FRenderTargetDesc& Desc);
+        // Hands the allocation back to the pool; Target becomes invalid
+        void Release(FRenderTarget& Target);
+
+        // Once per frame: fences the previous frame if it retired anything, deletes allocations
+        // the GPU has finished with, and drops free allocations unused for ShrinkDelay
+        void BeginFrame();
+        // Before the GL context goes away; targets still held become invalid
+        void ReleaseAll();
+
+        [[nodiscard]] std::size_t GetAllocationCount() const { return Allocations.size() + Retired.size(); }
+        // GL allocations made so far; stays flat while targets resize within their allocations
+        [[nodiscard]] std::uint64_t GetCreatedCount() const { return CreatedCount; }
+
+    private:
+        using FAllocation = Detail::FRenderTargetAllocation;
+
+        struct FRetiredAllocation
+        {
+            Scope<FAllocation> Allocation;
+            std::uint64_t Frame = 0;
+        };
+
+        struct FFrameFence
+        {
+            std::uint64_t Frame = 0;
+            void* Sync = nullptr; // GLsync
+        };
+
+        FAllocation* FindFree(const FRenderTargetDesc& Desc);
+        FAllocation* Create(const FRenderTargetDesc& Desc);
+        // Moves a live allocation to the retired list
+        void Retire(FAllocation* Allocation);
+        static void Destroy(FAllocation& Allocation);
+
+    private:
+        int RetireFrames;
+        int MaxSamples = 0;
+
+        std::vector<Scope<FAllocation>> Allocations;
+        std::vector<FRetiredAllocation> Retired;
+        std::deque<FFrameFence> Fences;
+
+        std::uint64_t FrameIndex = 0;
+        // Frames before this index have finished on the GPU
+        std::uint64_t CompletedFrames = 0;
+        bool bRetiredSinceFence = false;
+        std::uint64_t CreatedCount = 0;
+    };
+
+}
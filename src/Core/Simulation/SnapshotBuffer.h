@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Core/Base/TripleBuffer.h"
+
+#include <algorithm>
+#include <chrono>
+
+namespace Core
+{
+
+    // Hands simulation state from the fixed-update thread to the render thread.
+    // Each publish carries the previous and current tick so the reader always gets a coherent
+    // pair to interpolate between, plus how far the render clock has advanced into the step.
+    template<typename T>
+    class TSnapshotBuffer
+    {
+    public:
+        using FClock = std::chrono::steady_clock;
+
+        struct FView
+        {
+            const T& Previous;
+            const T& Current;
+            float Alpha;
+        };
+
+        // Simulation thread: call once per fixed step with the freshly updated state
+        void Publish(const T& InState, float InFixedDeltaTime)
+        {
+            FSnapshotPair& Pair = Buffer.GetWriteBuffer();
+            Pair.Previous = LastPublished;
+            Pair.Current = InState;
+            Pair.PublishTime = FClock::now();
+            Pair.FixedDeltaTime = InFixedDeltaTime;
+            Buffer.Publish();
+
+            LastPublished = InState;
+        }
+
+        // Render thread: latch the newest pair; Alpha is 0 at Previous and 1 at Current
+        [[nodiscard]] FView Read()
+        {
+            Buffer.Latch();
+            const FSnapshotPair& Pair = Buffer.GetReadBuffer();
+
+            float Alpha = 1.0f;
+            if (Pair.FixedDeltaTime > 0.0f)
+            {
+                const float Elapsed = std::chrono::duration<float>(FClock::now() - Pair.PublishTime).count();
+                Alpha = std::clamp(Elapsed / Pair.FixedDeltaTime, 0.0f, 1.0f);
+            }
+
+            return { Pair.Previous, Pair.Current, Alpha };
+        }
+
+    private:
+        struct FSnapshotPair
+        {
+            T Previous{};
+            T Current{};
+            FClock::time_point PublishTime{};
+            float FixedDeltaTime = 0.0f;
+        };
+
+        TTripleBuffer<FSnapshotPair> Buffer;
+
+        // Only touched by the simulation thread
+        T LastPublished{};
+    };
+
+}
@@ -0,0 +1,106 @@
+#include "Frustum.h"
+
+#include "raymath.h"
+#include "rlgl.h"
+
+#include <cmath>
+
+namespace Core
+{
+
+    namespace
+    {
+        FPlane MakePlane(float A, float B, float C, float D)
+        {
+            const float Length = std::sqrt(A * A + B * B + C * C);
+            const float InverseLength = Length > 0.0f ? 1.0f / Length : 0.0f;
+            return { { A * InverseLength, B * InverseLength, C * InverseLength }, D * InverseLength };
+        }
+    }
+
+    FFrustum FFrustum::FromMatrix(const Matrix& ViewProjection)
+    {
+        // Gribb & Hartmann: each plane is the last row of the clip matrix plus or minus one of
+        // the others. raymath's MatrixMultiply(View, Projection) is Projection * View applied to
+        // column vectors, so row r is (m[r], m[4 + r], m[8 + r], m[12 + r]).
+        const Matrix& M = ViewProjection;
+        const float Row0[4] = { M.m0, M.m4, M.m8, M.m12 };
+        const float Row1[4] = { M.m1, M.m5, M.m9, M.m13 };
+        const float Row2[4] = { M.m2, M.m6, M.m10, M.m14 };
+        const float Row3[4] = { M.m3, M.m7, M.m11, M.m15 };
+
+        FFrustum Frustum;
+        Frustum.Planes[0] = MakePlane(Row3[0] + Row0[0], Row3[1] + Row0[1], Row3[2] + Row0[2], Row3[3] + Row0[3]); // Left
+        Frustum.Planes[1] = MakePlane(Row3[0] - Row0[0], Row3[1] - Row0[1], Row3[2] - Row0[2], Row3[3] - Row0[3]); // Right
+        Frustum.Planes[2] = MakePlane(Row3[0] + Row1[0], Row3[1] + Row1[1], Row3[2] + Row1[2], Row3[3] + Row1[3]); // Bottom
+        Frustum.Planes[3] = MakePlane(Row3[0] - Row1[0], Row3[1] - Row1[1], Row3[2] - Row1[2], Row3[3] - Row1[3]); // Top
+        Frustum.Planes[4] = MakePlane(Row3[0] + Row2[0], Row3[1] + Row2[1], Row3[2] + Row2[2], Row3[3] + Row2[3]); // Near
+        Frustum.Planes[5] = MakePlane(Row3[0] - Row2[0], Row3[1] - Row2[1], Row3[2] - Row2[2], Row3[3] - Row2[3]); // Far
+        return Frustum;
+    }
+
+    FFrustum FFrustum::FromCamera(const Camera3D& Camera, float Aspect)
+    {
+        const double Near = rlGetCullDistanceNear();
+        const double Far = rlGetCullDistanceFar();
+
+        // Same projection BeginMode3D builds
+        Matrix Projection;
+        if (Camera.projection == CAMERA_ORTHOGRAPHIC)
+        {
+            const double Top = Camera.fovy / 2.0;
+            const double Right = Top * Aspect;
+            Projection = MatrixOrtho(-Right, Right, -Top, Top, Near, Far);
+        }
+        else
+        {
+            const double Top = Near * std::tan(Camera.fovy * 0.5 * DEG2RAD);
+            const double Right = Top * Aspect;
+            Projection = MatrixFrustum(-Right, Right, -Top, Top, Near, Far);
+        }
+
+        const Matrix View = MatrixLookAt(Camera.position, Camera.target, Camera.up);
+        return FromMatrix(MatrixMultiply(View, Projection));
+    }
+
+    EContainment FFrustum::Classify(const BoundingBox& Box) const
+    {
+        std::uint32_t Straddled = 0;
+        if (!ClassifyMasked(Box, AllPlanes, Straddled))
+            return EContainment::Outside;
+        return Straddled == 0 ? EContainment::Inside : EContainment::Intersects;
+    }
+
+    bool FFrustum::ClassifyMasked(const BoundingBox& Box, std::uint32_t PlaneMask, std::uint32_t& OutMask) const
+    {
+        OutMask = 0;
+        for (std::uint32_t Index = 0; Index < 6; ++Index)
+        {
+            const std::uint32_t Bit = 1u << Index;
+            if ((PlaneMask & Bit) == 0)
+                continue;
+
+            // The corners furthest along and against the normal
+            const FPlane& Plane = Planes[Index];
+            const bool bPositiveX = Plane.Normal.x >= 0.0f;
+            const bool bPositiveY = Plane.Normal.y >= 0.0f;
+            const bool bPositiveZ = Plane.Normal.z >= 0.0f;
+
+            const float Furthest = Plane.Normal.x * (bPositiveX ? Box.max.x : Box.min.x)
+                                 + Plane.Normal.y * (bPositiveY ? Box.max.y : Box.min.y)
+                                 + Plane.Normal.z * (bPositiveZ ? Box.max.z : Box.min.z) + Plane.Distance;
+            if (Furthest < 0.0f)
+                return false;
+
+            const float Nearest = Plane.Normal.x * (bPositiveX ? Box.min.x : Box.max.x)
+                                + Plane.Normal.y * (bPositiveY ? Box.min.y : Box.max.y)
+                                + Plane.Normal.z * (bPositiveZ ? Box.min.z : Box.max.z) + Plane.Distance;
+            if (Nearest < 0.0f)
+            {
+                OutMask |= Bit;
+            }
+        }
+        return true;
+    }
+
+}
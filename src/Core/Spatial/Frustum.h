@@ -0,0 +1,51 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "raylib.h"
+
+namespace Core
+{
+
+    // Points with Dot(Normal, P) + Distance >= 0 are on the inside
+    struct FPlane
+    {
+        Vector3 Normal;
+        float Distance;
+    };
+
+    enum class EContainment : std::uint8_t
+    {
+        Outside,
+        Intersects,
+        Inside
+    };
+
+    // The six planes bounding what a camera sees
+    class FFrustum
+    {
+    public:
+        static constexpr std::uint32_t AllPlanes = 0x3F;
+
+        // ViewProjection as raymath builds it: MatrixMultiply(View, Projection)
+        [[nodiscard]] static FFrustum FromMatrix(const Matrix& ViewProjection);
+        // The frustum BeginMode3D sets up for Camera on a target with the given aspect ratio,
+        // using rlgl's cull distances as near and far planes
+        [[nodiscard]] static FFrustum FromCamera(const Camera3D& Camera, float Aspect);
+
+        [[nodiscard]] EContainment Classify(const BoundingBox& Box) const;
+        [[nodiscard]] bool Intersects(const BoundingBox& Box) const { return Classify(Box) != EContainment::Outside; }
+
+        // Classify against the planes set in PlaneMask only. Returns false if Box is outside one
+        // of them; otherwise OutMask holds the planes Box straddles, and is zero when Box is
+        // inside them all. Lets hierarchy walks skip planes a parent is already inside of.
+        [[nodiscard]] bool ClassifyMasked(const BoundingBox& Box, std::uint32_t PlaneMask, std::uint32_t& OutMask) const;
+
+        [[nodiscard]] const std::array<FPlane, 6>& GetPlanes() const { return Planes; }
+
+    private:
+        std::array<FPlane, 6> Planes{};
+    };
+
+}
@@ -0,0 +1,609 @@
+#include "SpatialIndex.h"
+#include "Core/Logging/Log.h"
+#include "Core/Profiling/Profiler.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Core
+{
+
+    namespace
+    {
+        // How far ahead of a moving proxy its fat box reaches, in multiples of the last move
+        constexpr float DisplacementMultiplier = 4.0f;
+
+        // Half the surface area; only ever compared
+        float Area(const BoundingBox& Box)
+        {
+            const float X = Box.max.x - Box.min.x;
+            const float Y = Box.max.y - Box.min.y;
+            const float Z = Box.max.z - Box.min.z;
+            return X * Y + Y * Z + Z * X;
+        }
+
+        BoundingBox Union(const BoundingBox& A, const BoundingBox& B)
+        {
+            return {
+                { std::min(A.min.x, B.min.x), std::min(A.min.y, B.min.y), std::min(A.min.z, B.min.z) },
+                { std::max(A.max.x, B.max.x), std::max(A.max.y, B.max.y), std::max(A.max.z, B.max.z) }
+            };
+        }
+
+        bool Contains(const BoundingBox& Outer, const BoundingBox& Inner)
+        {
+            return Outer.min.x <= Inner.min.x && Outer.min.y <= Inner.min.y && Outer.min.z <= Inner.min.z
+                && Inner.max.x <= Outer.max.x && Inner.max.y <= Outer.max.y && Inner.max.z <= Outer.max.z;
+        }
+
+        BoundingBox Expand(const BoundingBox& Box, float Amount)
+        {
+            return {
+                { Box.min.x - Amount, Box.min.y - Amount, Box.min.z - Amount },
+                { Box.max.x + Amount, Box.max.y + Amount, Box.max.z + Amount }
+            };
+        }
+
+        void Stretch(float& Min, float& Max, float Delta)
+        {
+            if (Delta < 0.0f)
+            {
+                Min += Delta;
+            }
+            else
+            {
+                Max += Delta;
+            }
+        }
+
+        float GetAxis(const Vector3& Value, int Axis)
+        {
+            return Axis == 0 ? Value.x : (Axis == 1 ? Value.y : Value.z);
+        }
+    }
+
+    FSpatialIndex::FSpatialIndex(float InFatMargin)
+        : FatMargin(InFatMargin)
+    {
+    }
+
+    FProxyId FSpatialIndex::CreateProxy(const BoundingBox& Bounds, std::uint64_t UserData, ESpatialMobility Mobility)
+    {
+        FTree& Tree = GetTree(Mobility);
+        const std::int32_t Leaf = Tree.AllocateNode();
+
+        FProxyId Proxy = FreeProxy;
+        if (Proxy == NullProxy)
+        {
+            Proxy = static_cast<FProxyId>(Proxies.size());
+            Proxies.emplace_back();
+        }
+        else
+        {
+            FreeProxy = Proxies[Proxy].Node;
+        }
+        Proxies[Proxy] = { Leaf, Mobility, Mobility == ESpatialMobility::Static, true };
+
+        FNode& Node = Tree.Nodes[Leaf];
+        Node.Bounds = Expand(Bounds, FatMargin);
+        Node.UserData = UserData;
+        Node.Proxy = Proxy;
+        Node.Height = 0;
+
+        if (Mobility == ESpatialMobility::Static)
+        {
+            Node.Parent = static_cast<std::int32_t>(PendingStatic.size());
+            PendingStatic.push_back(Leaf);
+        }
+        else
+        {
+            Tree.InsertLeaf(Leaf);
+        }
+
+        ++ProxyCount;
+        return Proxy;
+    }
+
+    void FSpatialIndex::DestroyProxy(FProxyId Proxy)
+    {
+        CORE_ASSERT(Proxy >= 0 && Proxy < static_cast<FProxyId>(Proxies.size()) && Proxies[Proxy].bInUse, "Invalid spatial proxy");
+
+        FProxy& Entry = Proxies[Proxy];
+        FTree& Tree = GetTree(Entry.Mobility);
+        if (Entry.bPending)
+        {
+            const std::int32_t Slot = Tree.Nodes[Entry.Node].Parent;
+            const std::int32_t Last = PendingStatic.back();
+            PendingStatic[Slot] = Last;
+            Tree.Nodes[Last].Parent = Slot;
+            PendingStatic.pop_back();
+        }
+        else
+        {
+            Tree.RemoveLeaf(Entry.Node);
+        }
+        Tree.FreeNode(Entry.Node);
+
+        Entry = FProxy{};
+        Entry.Node = FreeProxy;
+        FreeProxy = Proxy;
+        --ProxyCount;
+    }
+
+    bool FSpatialIndex::MoveProxy(FProxyId Proxy, const BoundingBox& Bounds, Vector3 Displacement)
+    {
+        CORE_ASSERT(Proxy >= 0 && Proxy < static_cast<FProxyId>(Proxies.size()) && Proxies[Proxy].bInUse, "Invalid spatial proxy");
+
+        BoundingBox Fat = Expand(Bounds, FatMargin);
+        Stretch(Fat.min.x, Fat.max.x, Displacement.x * DisplacementMultiplier);
+        Stretch(Fat.min.y, Fat.max.y, Displacement.y * DisplacementMultiplier);
+        Stretch(Fat.min.z, Fat.max.z, Displacement.z * DisplacementMultiplier);
+
+        const FProxy& Entry = Proxies[Proxy];
+        FTree& Tree = GetTree(Entry.Mobility);
+
+        // Stay put while the old fat box still covers the proxy, unless it has become much
+        // larger than needed (after a fast move stretched it, say)
+        const BoundingBox& Current = Tree.Nodes[Entry.Node].Bounds;
+        if (Contains(Current, Bounds) && Contains(Expand(Fat, 4.0f * FatMargin), Current))
+            return false;
+
+        if (Entry.bPending)
+        {
+            Tree.Nodes[Entry.Node].Bounds = Fat;
+            return true;
+        }
+
+        // Most moves are local, so rather than descend from the root again, start from the
+        // closest former ancestor that still contains the new box
+        std::int32_t Start = Tree.RemoveLeaf(Entry.Node);
+        while (Start != NullProxy && !Contains(Tree.Nodes[Start].Bounds, Fat))
+        {
+            Start = Tree.Nodes[Start].Parent;
+        }
+
+        Tree.Nodes[Entry.Node].Bounds = Fat;
+        Tree.InsertLeaf(Entry.Node, Start);
+        return true;
+    }
+
+    void FSpatialIndex::Rebuild()
+    {
+        CORE_PROFILE_FUNCTION();
+
+        // Every leaf, whether linked into the old tree or pending
+        std::vector<FNode> Leaves;
+        for (FTree* Tree : { &StaticTree, &MovableTree })
+        {
+            Leaves.clear();
+            Leaves.reserve(Tree->Nodes.size());
+            for (const FNode& Node : Tree->Nodes)
+            {
+                if (Node.Height == 0)
+                {
+                    Leaves.push_back(Node);
+                }
+            }
+
+            Tree->Build(Leaves);
+            for (std::size_t Index = 0; Index < Tree->Nodes.size(); ++Index)
+            {
+                const FNode& Node = Tree->Nodes[Index];
+                if (Node.IsLeaf())
+                {
+                    Proxies[Node.Proxy].Node = static_cast<std::int32_t>(Index);
+                    Proxies[Node.Proxy].bPending = false;
+                }
+            }
+        }
+        PendingStatic.clear();
+    }
+
+    void FSpatialIndex::Clear()
+    {
+        StaticTree.Clear();
+        MovableTree.Clear();
+        PendingStatic.clear();
+        Proxies.clear();
+        FreeProxy = NullProxy;
+        ProxyCount = 0;
+    }
+
+    std::int32_t FSpatialIndex::GetHeight() const
+    {
+        const std::int32_t StaticHeight = StaticTree.Root == NullProxy ? 0 : StaticTree.Nodes[StaticTree.Root].Height;
+        const std::int32_t MovableHeight = MovableTree.Root == NullProxy ? 0 : MovableTree.Nodes[MovableTree.Root].Height;
+        return std::max(StaticHeight, MovableHeight);
+    }
+
+    void FSpatialIndex::QueryFrustum(const FFrustum& Frustum, std::vector<std::uint64_t>& OutUserData, FSpatialQueryStats* OutStats) const
+    {
+        CORE_PROFILE_FUNCTION();
+
+        ForEachInFrustum(Frustum, [&OutUserData](std::span<const std::uint64_t> Run)
+        {
+            OutUserData.insert(OutUserData.end(), Run.data(), Run.data() + Run.size());
+        }, OutStats);
+    }
+
+    const FSpatialIndex::FNode& FSpatialIndex::GetLeaf(FProxyId Proxy) const
+    {
+        const FProxy& Entry = Proxies[Proxy];
+        return (Entry.Mobility == ESpatialMobility::Static ? StaticTree : MovableTree).Nodes[Entry.Node];
+    }
+
+    float FSpatialIndex::IntersectRay(const BoundingBox& Box, Vector3 Origin, Vector3 InverseDirection, float MaxDistance)
+    {
+        // Slab test. fmin and fmax drop the NaNs a ray lying in a slab's plane produces.
+        float Enter = 0.0f;
+        float Exit = MaxDistance;
+
+        const auto Slab = [&](float Min, float Max, float Start, float Inverse)
+        {
+            const float T1 = (Min - Start) * Inverse;
+            const float T2 = (Max - Start) * Inverse;
+            Enter = std::fmax(Enter, std::fmin(T1, T2));
+            Exit = std::fmin(Exit, std::fmax(T1, T2));
+        };
+        Slab(Box.min.x, Box.max.x, Origin.x, InverseDirection.x);
+        Slab(Box.min.y, Box.max.y, Origin.y, InverseDirection.y);
+        Slab(Box.min.z, Box.max.z, Origin.z, InverseDirection.z);
+
+        return Enter <= Exit ? Enter : -1.0f;
+    }
+
+    std::int32_t FSpatialIndex::FTree::AllocateNode()
+    {
+        if (FreeList == NullProxy)
+        {
+            Nodes.emplace_back();
+            return static_cast<std::int32_t>(Nodes.size() - 1);
+        }
+
+        const std::int32_t Index = FreeList;
+        FreeList = Nodes[Index].Parent;
+        Nodes[Index] = FNode{};
+        return Index;
+    }
+
+    void FSpatialIndex::FTree::FreeNode(std::int32_t Index)
+    {
+        Nodes[Index].Parent = FreeList;
+        Nodes[Index].Height = -1;
+        FreeList = Index;
+    }
+
+    void FSpatialIndex::FTree::InsertLeaf(std::int32_t Leaf, std::int32_t Start)
+    {
+        bOrdered = false;
+
+        if (Root == NullProxy)
+        {
+            Root = Leaf;
+            Nodes[Leaf].Parent = NullProxy;
+            return;
+        }
+
+        const BoundingBox LeafBounds = Nodes[Leaf].Bounds;
+        const std::int32_t Sibling = FindBestSibling(LeafBounds, Start == NullProxy ? Root : Start);
+
+        // May grow Nodes, so no references are held across it
+        const std::int32_t NewParent = AllocateNode();
+        const std::int32_t OldParent = Nodes[Sibling].Parent;
+
+        FNode& Parent = Nodes[NewParent];
+        Parent.Parent = OldParent;
+        Parent.Bounds = Union(LeafBounds, Nodes[Sibling].Bounds);
+        Parent.Height = Nodes[Sibling].Height + 1;
+        Parent.Child1 = Sibling;
+        Parent.Child2 = Leaf;
+
+        if (OldParent == NullProxy)
+        {
+            Root = NewParent;
+        }
+        else if (Nodes[OldParent].Child1 == Sibling)
+        {
+            Nodes[OldParent].Child1 = NewParent;
+        }
+        else
+        {
+            Nodes[OldParent].Child2 = NewParent;
+        }
+        Nodes[Sibling].Parent = NewParent;
+        Nodes[Leaf].Parent = NewParent;
+
+        // Refit the ancestors, rotating each once its children are up to date. Above Start the
+        // bounds already held the leaf, so only heights can change and nothing is rotated.
+        bool bAboveStart = false;
+        for (std::int32_t Index = NewParent; Index != NullProxy; Index = Nodes[Index].Parent)
+        {
+            FNode& Node = Nodes[Index];
+            const FNode& Child1 = Nodes[Node.Child1];
+            const FNode& Child2 = Nodes[Node.Child2];
+            const std::int32_t Height = 1 + std::max(Child1.Height, Child2.Height);
+            if (bAboveStart)
+            {
+                if (Height == Node.Height)
+                    break;
+
+                Node.Height = Height;
+                continue;
+            }
+
+            Node.Bounds = Union(Child1.Bounds, Child2.Bounds);
+            Node.Height = Height;
+            Rotate(Index);
+            bAboveStart = Index == Start;
+        }
+    }
+
+    std::int32_t FSpatialIndex::FTree::RemoveLeaf(std::int32_t Leaf)
+    {
+        bOrdered = false;
+
+        if (Leaf == Root)
+        {
+            Root = NullProxy;
+            return NullProxy;
+        }
+
+        const std::int32_t Parent = Nodes[Leaf].Parent;
+        const std::int32_t GrandParent = Nodes[Parent].Parent;
+        const std::int32_t Sibling = Nodes[Parent].Child1 == Leaf ? Nodes[Parent].Child2 : Nodes[Parent].Child1;
+
+        FreeNode(Parent);
+        Nodes[Sibling].Parent = GrandParent;
+        if (GrandParent == NullProxy)
+        {
+            Root = Sibling;
+            return Sibling;
+        }
+
+        if (Nodes[GrandParent].Child1 == Parent)
+        {
+            Nodes[GrandParent].Child1 = Sibling;
+        }
+        else
+        {
+            Nodes[GrandParent].Child2 = Sibling;
+        }
+
+        // The ancestors only lost a leaf, so refitting shrinks them back to what they hold, up
+        // to the first one left unchanged
+        for (std::int32_t Index = GrandParent; Index != NullProxy; Index = Nodes[Index].Parent)
+        {
+            FNode& Node = Nodes[Index];
+            const FNode& Child1 = Nodes[Node.Child1];
+            const FNode& Child2 = Nodes[Node.Child2];
+            const BoundingBox Bounds = Union(Child1.Bounds, Child2.Bounds);
+            const std::int32_t Height = 1 + std::max(Child1.Height, Child2.Height);
+            if (Height == Node.Height && Contains(Bounds, Node.Bounds))
+                break;
+
+            Node.Bounds = Bounds;
+            Node.Height = Height;
+        }
+        return GrandParent;
+    }
+
+    std::int32_t FSpatialIndex::FTree::FindBestSibling(const BoundingBox& Bounds, std::int32_t Start) const
+    {
+        // Greedy descent on the surface area heuristic: stop at the node where pairing with the
+        // new leaf is cheaper than the lowest possible cost of pushing it into either child
+        std::int32_t Index = Start;
+        while (!Nodes[Index].IsLeaf())
+        {
+            const FNode& Node = Nodes[Index];
+            const float CombinedArea = Area(Union(Node.Bounds, Bounds));
+
+            // A new parent holding this node and the leaf
+            const float Cost = 2.0f * CombinedArea;
+            // Every level below also grows this node
+            const float InheritedCost = 2.0f * (CombinedArea - Area(Node.Bounds));
+
+            const auto DescendCost = [&](std::int32_t Child)
+            {
+                const FNode& ChildNode = Nodes[Child];
+                const float ChildArea = Area(Union(Bounds, ChildNode.Bounds));
+                return InheritedCost + (ChildNode.IsLeaf() ? ChildArea : ChildArea - Area(ChildNode.Bounds));
+            };
+            const float Cost1 = DescendCost(Node.Child1);
+            const float Cost2 = DescendCost(Node.Child2);
+
+            if (Cost < Cost1 && Cost < Cost2)
+                break;
+
+            Index = Cost1 < Cost2 ? Node.Child1 : Node.Child2;
+        }
+        return Index;
+    }
+
+    void FSpatialIndex::FTree::Rotate(std::int32_t IndexA)
+    {
+        // Swaps a child of A with a grandchild on the other side when that shrinks the internal
+        // node in between. A's own bounds hold the same leaves either way.
+        //
+        //         A
+        //       /   \      children
+        //      B     C
+        //     / \   / \    grandchildren
+        //    D   E F   G
+        FNode& A = Nodes[IndexA];
+        if (A.Height < 2)
+            return;
+
+        const std::int32_t IndexB = A.Child1;
+        const std::int32_t IndexC = A.Child2;
+        FNode& B = Nodes[IndexB];
+        FNode& C = Nodes[IndexC];
+
+        enum class ESwap
+        {
+            None,
+            BF,
+            BG,
+            CD,
+            CE
+        };
+        ESwap Best = ESwap::None;
+        float BestDelta = 0.0f;
+        BoundingBox BestBounds{};
+
+        const auto Consider = [&](ESwap Swap, const BoundingBox& NewBounds, float OldArea)
+        {
+            const float Delta = Area(NewBounds) - OldArea;
+            if (Delta < BestDelta)
+            {
+                Best = Swap;
+                BestDelta = Delta;
+                BestBounds = NewBounds;
+            }
+        };
+
+        if (C.Height > 0)
+        {
+            // Moving F up leaves C holding B and G, and vice versa
+            const float AreaC = Area(C.Bounds);
+            Consider(ESwap::BF, Union(B.Bounds, Nodes[C.Child2].Bounds), AreaC);
+            Consider(ESwap::BG, Union(B.Bounds, Nodes[C.Child1].Bounds), AreaC);
+        }
+        if (B.Height > 0)
+        {
+            const float AreaB = Area(B.Bounds);
+            Consider(ESwap::CD, Union(C.Bounds, Nodes[B.Child2].Bounds), AreaB);
+            Consider(ESwap::CE, Union(C.Bounds, Nodes[B.Child1].Bounds), AreaB);
+        }
+
+        switch (Best)
+        {
+        case ESwap::None:
+            return;
+
+        case ESwap::BF:
+        case ESwap::BG:
+        {
+            const std::int32_t IndexUp = Best == ESwap::BF ? C.Child1 : C.Child2;
+            const std::int32_t IndexStay = Best == ESwap::BF ? C.Child2 : C.Child1;
+            A.Child1 = IndexUp;
+            C.Child1 = IndexB;
+            C.Child2 = IndexStay;
+            B.Parent = IndexC;
+            Nodes[IndexUp].Parent = IndexA;
+
+            C.Bounds = BestBounds;
+            C.Height = 1 + std::max(B.Height, Nodes[IndexStay].Height);
+            A.Height = 1 + std::max(C.Height, Nodes[IndexUp].Height);
+            break;
+        }
+
+        case ESwap::CD:
+        case ESwap::CE:
+        {
+            const std::int32_t IndexUp = Best == ESwap::CD ? B.Child1 : B.Child2;
+            const std::int32_t IndexStay = Best == ESwap::CD ? B.Child2 : B.Child1;
+            A.Child2 = IndexUp;
+            B.Child1 = IndexStay;
+            B.Child2 = IndexC;
+            C.Parent = IndexB;
+            Nodes[IndexUp].Parent = IndexA;
+
+            B.Bounds = BestBounds;
+            B.Height = 1 + std::max(C.Height, Nodes[IndexStay].Height);
+            A.Height = 1 + std::max(B.Height, Nodes[IndexUp].Height);
+            break;
+        }
+        }
+    }
+
+    void FSpatialIndex::FTree::Build(const std::vector<FNode>& Leaves)
+    {
+        Clear();
+        if (Leaves.empty())
+            return;
+
+        struct FItem
+        {
+            Vector3 Centroid;
+            std::int32_t Leaf;
+        };
+
+        // Top-down median split on the longest axis of the centroids. Nodes are emitted in
+        // depth-first order, so the leaves under any node are Items[First, Last).
+        struct FBuilder
+        {
+            FTree& Tree;
+            const std::vector<FNode>& Leaves;
+            std::vector<FItem> Items;
+
+            std::int32_t Build(std::uint32_t First, std::uint32_t Last, std::int32_t Parent)
+            {
+                const std::int32_t Index = static_cast<std::int32_t>(Tree.Nodes.size());
+                Tree.Nodes.emplace_back();
+                Tree.LeafRanges.push_back({ First, Last - First });
+
+                if (Last - First == 1)
+                {
+                    FNode& Node = Tree.Nodes[Index];
+                    Node = Leaves[Items[First].Leaf];
+                    Node.Parent = Parent;
+                    Tree.LeafOrder[First] = Node.UserData;
+                    return Index;
+                }
+
+                Vector3 Min = Items[First].Centroid;
+                Vector3 Max = Min;
+                for (std::uint32_t Item = First + 1; Item < Last; ++Item)
+                {
+                    const Vector3& Centroid = Items[Item].Centroid;
+                    Min = { std::min(Min.x, Centroid.x), std::min(Min.y, Centroid.y), std::min(Min.z, Centroid.z) };
+                    Max = { std::max(Max.x, Centroid.x), std::max(Max.y, Centroid.y), std::max(Max.z, Centroid.z) };
+                }
+                const Vector3 Extent = { Max.x - Min.x, Max.y - Min.y, Max.z - Min.z };
+                const int Axis = Extent.x >= Extent.y && Extent.x >= Extent.z ? 0 : (Extent.y >= Extent.z ? 1 : 2);
+
+                const std::uint32_t Middle = First + (Last - First) / 2;
+                std::nth_element(Items.begin() + First, Items.begin() + Middle, Items.begin() + Last,
+                    [Axis](const FItem& A, const FItem& B) { return GetAxis(A.Centroid, Axis) < GetAxis(B.Centroid, Axis); });
+
+                const std::int32_t Child1 = Build(First, Middle, Index);
+                const std::int32_t Child2 = Build(Middle, Last, Index);
+
+                FNode& Node = Tree.Nodes[Index];
+                Node.Parent = Parent;
+                Node.Child1 = Child1;
+                Node.Child2 = Child2;
+                Node.Bounds = Union(Tree.Nodes[Child1].Bounds, Tree.Nodes[Child2].Bounds);
+                Node.Height = 1 + std::max(Tree.Nodes[Child1].Height, Tree.Nodes[Child2].Height);
+                return Index;
+            }
+        };
+
+        FBuilder Builder{ *this, Leaves, {} };
+        Builder.Items.reserve(Leaves.size());
+        for (std::size_t Leaf = 0; Leaf < Leaves.size(); ++Leaf)
+        {
+            const BoundingBox& Bounds = Leaves[Leaf].Bounds;
+            const Vector3 Centroid = { (Bounds.min.x + Bounds.max.x) * 0.5f, (Bounds.min.y + Bounds.max.y) * 0.5f, (Bounds.min.z + Bounds.max.z) * 0.5f };
+            Builder.Items.push_back({ Centroid, static_cast<std::int32_t>(Leaf) });
+        }
+
+        const std::size_t NodeCount = 2 * Leaves.size() - 1;
+        Nodes.reserve(NodeCount);
+        LeafRanges.reserve(NodeCount);
+        LeafOrder.resize(Leaves.size());
+        Root = Builder.Build(0, static_cast<std::uint32_t>(Leaves.size()), NullProxy);
+        bOrdered = true;
+    }
+
+    void FSpatialIndex::FTree::Clear()
+    {
+        Nodes.clear();
+        Root = NullProxy;
+        FreeList = NullProxy;
+        LeafOrder.clear();
+        LeafRanges.clear();
+        bOrdered = false;
+    }
+
+}
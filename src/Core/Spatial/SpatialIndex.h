@@ -0,0 +1,418 @@
+#pragma once
+
+#include "Frustum.h"
+
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+#include "raylib.h"
+
+namespace Core
+{
+
+    using FProxyId = std::int32_t;
+    inline constexpr FProxyId NullProxy = -1;
+
+    enum class ESpatialMobility : std::uint8_t
+    {
+        // Rarely or never moves. Kept in a tree Rebuild() lays out for the fastest queries.
+        Static,
+        // Moves often. Kept in a smaller tree that is updated incrementally.
+        Movable
+    };
+
+    struct FSpatialQueryStats
+    {
+        // Bounds tested against the frustum
+        std::uint32_t Visited = 0;
+        // Tested bounds found outside, each removing a whole subtree
+        std::uint32_t Culled = 0;
+        // Proxies returned, including those under subtrees accepted without testing
+        std::uint32_t Drawn = 0;
+    };
+
+    struct FRayHit
+    {
+        FProxyId Proxy = NullProxy;
+        std::uint64_t UserData = 0;
+        float Distance = 0.0f;
+
+        [[nodiscard]] bool IsHit() const { return Proxy != NullProxy; }
+    };
+
+    // Dynamic AABB trees in the style of physics broadphases. Every proxy is a leaf holding a
+    // fattened copy of its bounds, so small movements don't touch the tree; moving out of them
+    // reinserts the leaf, picking its sibling by surface area and rotating the ancestors on the
+    // way back up to keep the tree shallow.
+    //
+    // Static and movable proxies live in separate trees, so the per-frame churn of the movable
+    // ones stays in a tree sized to them. New static proxies are batched: Rebuild() builds the
+    // trees top-down in depth-first order, where every subtree's proxies are contiguous and a
+    // subtree fully inside a frustum is handed out whole. Until then they are tested one by
+    // one, and changes after a rebuild are applied incrementally, losing that fast path.
+    //
+    // Not thread-safe: mutate it from one thread, and don't query while it is being mutated.
+    class FSpatialIndex
+    {
+    public:
+        // FatMargin pads every proxy's bounds on each side
+        explicit FSpatialIndex(float InFatMargin = 0.1f);
+
+        FProxyId CreateProxy(const BoundingBox& Bounds, std::uint64_t UserData, ESpatialMobility Mobility = ESpatialMobility::Movable);
+        void DestroyProxy(FProxyId Proxy);
+        // Bounds is the proxy's new tight box, and Displacement how far it moved since the last
+        // call; the fat box is stretched along it to anticipate the next move. Returns true if
+        // the fat box changed.
+        bool MoveProxy(FProxyId Proxy, const BoundingBox& Bounds, Vector3 Displacement = { 0.0f, 0.0f, 0.0f });
+
+        // Builds both trees from scratch. Call it once static content is loaded; it takes a few
+        // hundred milliseconds per million proxies.
+        void Rebuild();
+        void Clear();
+
+        [[nodiscard]] const BoundingBox& GetFatBounds(FProxyId Proxy) const { return GetLeaf(Proxy).Bounds; }
+        [[nodiscard]] std::uint64_t GetUserData(FProxyId Proxy) const { return GetLeaf(Proxy).UserData; }
+        [[nodiscard]] std::size_t GetProxyCount() const { return ProxyCount; }
+        // Static proxies created since the last Rebuild()
+        [[nodiscard]] std::size_t GetPendingCount() const { return PendingStatic.size(); }
+        [[nodiscard]] std::int32_t GetHeight() const;
+
+        // Calls Visit(std::span<const std::uint64_t>) with the user data of every proxy whose fat
+        // bounds touch Frustum, in runs pointing into the index that stay valid until it next
+        // changes. Subtrees fully inside are taken whole, as a single run when the tree is
+        // freshly rebuilt, and planes a parent is inside of aren't tested again. The traversal
+        // stacks come from Scratch, e.g. FFrameAllocator::GetResource() for a query every frame.
+        template<typename TVisit>
+        void ForEachInFrustum(const FFrustum& Frustum, TVisit&& Visit, FSpatialQueryStats* OutStats = nullptr, std::pmr::memory_resource* Scratch = std::pmr::get_default_resource()) const;
+        // Appends what ForEachInFrustum visits to OutUserData
+        void QueryFrustum(const FFrustum& Frustum, std::vector<std::uint64_t>& OutUserData, FSpatialQueryStats* OutStats = nullptr) const;
+
+        // Calls Func(Proxy, UserData) for every proxy whose fat bounds overlap Box
+        template<typename TFunc>
+        void QueryBox(const BoundingBox& Box, TFunc&& Func) const;
+
+        // Finds the closest proxy along Ray within MaxDistance. HitTest(Proxy, UserData) refines
+        // a candidate whose fat bounds the ray enters, returning the distance of the exact hit or
+        // a negative value for a miss. Candidates are visited nearest first, and subtrees
+        // further away than the best hit so far are skipped.
+        template<typename THitTest>
+        [[nodiscard]] FRayHit Raycast(const Ray& InRay, float MaxDistance, THitTest&& HitTest) const;
+
+    private:
+        struct FNode
+        {
+            BoundingBox Bounds;
+            // Next free node while unused; index in PendingStatic while pending
+            std::int32_t Parent = NullProxy;
+            std::int32_t Child1 = NullProxy;
+            std::int32_t Child2 = NullProxy;
+            // Leaves are 0, unused nodes -1
+            std::int32_t Height = -1;
+            std::uint64_t UserData = 0;
+            FProxyId Proxy = NullProxy;
+
+            [[nodiscard]] bool IsLeaf() const { return Child1 == NullProxy; }
+        };
+
+        struct FTree
+        {
+            std::vector<FNode> Nodes;
+            std::int32_t Root = NullProxy;
+            std::int32_t FreeList = NullProxy;
+
+            // Set by a rebuild and cleared by any incremental change: the user data of the
+            // leaves in depth-first order, and the slice of it under every node
+            struct FLeafRange
+            {
+                std::uint32_t First;
+                std::uint32_t Count;
+            };
+            std::vector<std::uint64_t> LeafOrder;
+            std::vector<FLeafRange> LeafRanges;
+            bool bOrdered = false;
+
+            std::int32_t AllocateNode();
+            void FreeNode(std::int32_t Index);
+            // Searches for the new sibling under Start, which must contain the leaf, or the root
+            void InsertLeaf(std::int32_t Leaf, std::int32_t Start = NullProxy);
+            // Returns the lowest node whose bounds changed, or NullProxy if the tree emptied
+            std::int32_t RemoveLeaf(std::int32_t Leaf);
+            [[nodiscard]] std::int32_t FindBestSibling(const BoundingBox& Bounds, std::int32_t Start) const;
+            void Rotate(std::int32_t Index);
+            // Replaces the tree with one built top-down over Leaves, in depth-first order
+            void Build(const std::vector<FNode>& Leaves);
+            void Clear();
+
+            template<typename TVisit>
+            void ForEachInFrustum(const FFrustum& Frustum, TVisit& Visit, FSpatialQueryStats& Stats, std::pmr::memory_resource* Scratch) const;
+
+            template<typename TFunc>
+            void QueryBox(const BoundingBox& Box, TFunc& Func) const;
+            template<typename THitTest>
+            void Raycast(Vector3 Origin, Vector3 InverseDirection, float& Best, FRayHit& Hit, THitTest& HitTest) const;
+        };
+
+        struct FProxy
+        {
+            // Next free proxy while unused
+            std::int32_t Node = NullProxy;
+            ESpatialMobility Mobility = ESpatialMobility::Movable;
+            bool bPending = false;
+            bool bInUse = false;
+        };
+
+        [[nodiscard]] FTree& GetTree(ESpatialMobility Mobility) { return Mobility == ESpatialMobility::Static ? StaticTree : MovableTree; }
+        [[nodiscard]] const FNode& GetLeaf(FProxyId Proxy) const;
+
+        // Entry distance of the ray into Box, or a negative value if it misses within MaxDistance
+        static float IntersectRay(const BoundingBox& Box, Vector3 Origin, Vector3 InverseDirection, float MaxDistance);
+
+        FTree StaticTree;
+        FTree MovableTree;
+        // Static leaves allocated in StaticTree but not linked into it until the next Rebuild()
+        std::vector<std::int32_t> PendingStatic;
+
+        std::vector<FProxy> Proxies;
+        std::int32_t FreeProxy = NullProxy;
+        std::size_t ProxyCount = 0;
+        float FatMargin;
+    };
+
+    template<typename TVisit>
+    void FSpatialIndex::FTree::ForEachInFrustum(const FFrustum& Frustum, TVisit& Visit, FSpatialQueryStats& Stats, std::pmr::memory_resource* Scratch) const
+    {
+        if (Root == NullProxy)
+            return;
+
+        struct FEntry
+        {
+            std::int32_t Index;
+            std::uint32_t PlaneMask;
+        };
+        std::pmr::vector<FEntry> Stack(Scratch);
+        Stack.reserve(64);
+        Stack.push_back({ Root, FFrustum::AllPlanes });
+
+        std::pmr::vector<std::int32_t> SubtreeStack(Scratch);
+        while (!Stack.empty())
+        {
+            const FEntry Entry = Stack.back();
+            Stack.pop_back();
+            ++Stats.Visited;
+
+            const FNode& Node = Nodes[Entry.Index];
+            std::uint32_t Straddled = 0;
+            if (!Frustum.ClassifyMasked(Node.Bounds, Entry.PlaneMask, Straddled))
+            {
+                ++Stats.Culled;
+                continue;
+            }
+
+            if (Node.IsLeaf())
+            {
+                Visit(std::span<const std::uint64_t>(&Node.UserData, 1));
+                ++Stats.Drawn;
+            }
+            else if (Straddled != 0)
+            {
+                Stack.push_back({ Node.Child1, Straddled });
+                Stack.push_back({ Node.Child2, Straddled });
+            }
+            else if (bOrdered)
+            {
+                // Fully inside, and its leaves are one contiguous run
+                const FLeafRange Range = LeafRanges[Entry.Index];
+                Visit(std::span<const std::uint64_t>(LeafOrder.data() + Range.First, Range.Count));
+                Stats.Drawn += Range.Count;
+            }
+            else
+            {
+                // Fully inside: take every leaf without testing
+                SubtreeStack.push_back(Entry.Index);
+                while (!SubtreeStack.empty())
+                {
+                    const FNode& Inner = Nodes[SubtreeStack.back()];
+                    SubtreeStack.pop_back();
+                    if (Inner.IsLeaf())
+                    {
+                        Visit(std::span<const std::uint64_t>(&Inner.UserData, 1));
+                        ++Stats.Drawn;
+                    }
+                    else
+                    {
+                        SubtreeStack.push_back(Inner.Child1);
+                        SubtreeStack.push_back(Inner.Child2);
+                    }
+                }
+            }
+        }
+    }
+
+    template<typename TFunc>
+    void FSpatialIndex::FTree::QueryBox(const BoundingBox& Box, TFunc& Func) const
+    {
+        if (Root == NullProxy)
+            return;
+
+        std::vector<std::int32_t> Stack;
+        Stack.reserve(64);
+        Stack.push_back(Root);
+        while (!Stack.empty())
+        {
+            const FNode& Node = Nodes[Stack.back()];
+            Stack.pop_back();
+            if (!CheckCollisionBoxes(Node.Bounds, Box))
+                continue;
+
+            if (Node.IsLeaf())
+            {
+                Func(Node.Proxy, Node.UserData);
+            }
+            else
+            {
+                Stack.push_back(Node.Child1);
+                Stack.push_back(Node.Child2);
+            }
+        }
+    }
+
+    template<typename THitTest>
+    void FSpatialIndex::FTree::Raycast(Vector3 Origin, Vector3 InverseDirection, float& Best, FRayHit& Hit, THitTest& HitTest) const
+    {
+        if (Root == NullProxy)
+            return;
+
+        const float RootDistance = IntersectRay(Nodes[Root].Bounds, Origin, InverseDirection, Best);
+        if (RootDistance < 0.0f)
+            return;
+
+        struct FEntry
+        {
+            std::int32_t Index;
+            float Distance;
+        };
+        std::vector<FEntry> Stack;
+        Stack.reserve(64);
+        Stack.push_back({ Root, RootDistance });
+        while (!Stack.empty())
+        {
+            const FEntry Entry = Stack.back();
+            Stack.pop_back();
+            if (Entry.Distance > Best)
+                continue;
+
+            const FNode& Node = Nodes[Entry.Index];
+            if (Node.IsLeaf())
+            {
+                const float Distance = HitTest(Node.Proxy, Node.UserData);
+                if (Distance >= 0.0f && Distance <= Best)
+                {
+                    Best = Distance;
+                    Hit = { Node.Proxy, Node.UserData, Distance };
+                }
+                continue;
+            }
+
+            const float Distance1 = IntersectRay(Nodes[Node.Child1].Bounds, Origin, InverseDirection, Best);
+            const float Distance2 = IntersectRay(Nodes[Node.Child2].Bounds, Origin, InverseDirection, Best);
+
+            // Push the nearer child last so it is visited first
+            if (Distance1 >= 0.0f && Distance2 >= 0.0f)
+            {
+                if (Distance1 < Distance2)
+                {
+                    Stack.push_back({ Node.Child2, Distance2 });
+                    Stack.push_back({ Node.Child1, Distance1 });
+                }
+                else
+                {
+                    Stack.push_back({ Node.Child1, Distance1 });
+                    Stack.push_back({ Node.Child2, Distance2 });
+                }
+            }
+            else if (Distance1 >= 0.0f)
+            {
+                Stack.push_back({ Node.Child1, Distance1 });
+            }
+            else if (Distance2 >= 0.0f)
+            {
+                Stack.push_back({ Node.Child2, Distance2 });
+            }
+        }
+    }
+
+    template<typename TVisit>
+    void FSpatialIndex::ForEachInFrustum(const FFrustum& Frustum, TVisit&& Visit, FSpatialQueryStats* OutStats, std::pmr::memory_resource* Scratch) const
+    {
+        FSpatialQueryStats Stats;
+        StaticTree.ForEachInFrustum(Frustum, Visit, Stats, Scratch);
+        MovableTree.ForEachInFrustum(Frustum, Visit, Stats, Scratch);
+
+        for (const std::int32_t Index : PendingStatic)
+        {
+            const FNode& Node = StaticTree.Nodes[Index];
+            ++Stats.Visited;
+            if (Frustum.Intersects(Node.Bounds))
+            {
+                Visit(std::span<const std::uint64_t>(&Node.UserData, 1));
+                ++Stats.Drawn;
+            }
+            else
+            {
+                ++Stats.Culled;
+            }
+        }
+
+        if (OutStats)
+        {
+            *OutStats = Stats;
+        }
+    }
+
+    template<typename TFunc>
+    void FSpatialIndex::QueryBox(const BoundingBox& Box, TFunc&& Func) const
+    {
+        StaticTree.QueryBox(Box, Func);
+        MovableTree.QueryBox(Box, Func);
+
+        for (const std::int32_t Index : PendingStatic)
+        {
+            const FNode& Node = StaticTree.Nodes[Index];
+            if (CheckCollisionBoxes(Node.Bounds, Box))
+            {
+                Func(Node.Proxy, Node.UserData);
+            }
+        }
+    }
+
+    template<typename THitTest>
+    FRayHit FSpatialIndex::Raycast(const Ray& InRay, float MaxDistance, THitTest&& HitTest) const
+    {
+        // Infinities for axis-parallel rays make the slab test work out on its own
+        const Vector3 Origin = InRay.position;
+        const Vector3 InverseDirection = { 1.0f / InRay.direction.x, 1.0f / InRay.direction.y, 1.0f / InRay.direction.z };
+
+        FRayHit Hit;
+        float Best = MaxDistance;
+        StaticTree.Raycast(Origin, InverseDirection, Best, Hit, HitTest);
+        MovableTree.Raycast(Origin, InverseDirection, Best, Hit, HitTest);
+
+        for (const std::int32_t Index : PendingStatic)
+        {
+            const FNode& Node = StaticTree.Nodes[Index];
+            if (IntersectRay(Node.Bounds, Origin, InverseDirection, Best) < 0.0f)
+                continue;
+
+            const float Distance = HitTest(Node.Proxy, Node.UserData);
+            if (Distance >= 0.0f && Distance <= Best)
+            {
+                Best = Distance;
+                Hit = { Node.Proxy, Node.UserData, Distance };
+            }
+        }
+        return Hit;
+    }
+
+}
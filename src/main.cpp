@@ -1,8 +1,182 @@
 #include "Core/Application/Application.h"
 #include <raylib-cpp.hpp>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
 #include <optional>
 #include "Core/Application/EntryPoint.h"
 #include "Core/Base/Core.h" // IWYU pragma: keep
+#include "Core/ECS/ECSLayer.h"
+#include "Core/Profiling/GpuProfiler.h" // IWYU pragma: keep
+#include "Core/Renderer/DebugDraw.h"
+#include "Core/Renderer/InstancedRenderer.h"
+#include "Core/Simulation/SnapshotBuffer.h"
+#include "Core/Spatial/SpatialIndex.h"
+#include <atomic>
+#include <span>
+#include <string_view>
+#include <vector>
+
+// Scene Components
+struct FTransform
+{
+    raylib::Vector3 Position = raylib::Vector3(0.0f, 0.0f, 0.0f);
+    // Around the Y axis
+    float RotationDegrees = 0.0f;
+    raylib::Vector3 Scale = raylib::Vector3(1.0f, 1.0f, 1.0f);
+};
+
+struct FSpin
+{
+    float DegreesPerSecond = 45.0f;
+};
+
+struct FCubeMesh
+{
+    raylib::Vector3 Size = raylib::Vector3(1.5f, 1.5f, 1.5f);
+    raylib::Color Color = raylib::Color(230, 41, 55, 255);
+};
+
+// Moves the entity up and down around BaseHeight
+struct FBob
+{
+    float BaseHeight = 0.0f;
+    float Phase = 0.0f;
+};
+
+// A ball dropped onto the grid, stepped by the fixed update and drawn between its last two steps
+struct FBallState
+{
+    raylib::Vector3 Position = raylib::Vector3(-2.5f, 3.0f, 0.0f);
+    raylib::Vector3 Velocity = raylib::Vector3(1.8f, 0.0f, 0.0f);
+    bool bResting = false;
+};
+
+// The entity's entry in the sandbox's spatial index
+struct FSpatialProxy
+{
+    Core::FProxyId Id = Core::NullProxy;
+    raylib::Vector3 LastPosition = raylib::Vector3(0.0f, 0.0f, 0.0f);
+};
+
+// Spinning only turns cubes around Y, so bounds that fit every yaw stay valid while they spin
+BoundingBox GetCubeBounds(const FTransform& Transform, const FCubeMesh& Mesh)
+{
+    const raylib::Vector3 Half = Mesh.Size * Transform.Scale * 0.5f;
+    const float Radius = std::sqrt(Half.x * Half.x + Half.z * Half.z);
+    const raylib::Vector3& Position = Transform.Position;
+    return
+    {
+        { Position.x - Radius, Position.y - Half.y, Position.z - Radius },
+        { Position.x + Radius, Position.y + Half.y, Position.z + Radius }
+    };
+}
+
+// Distance along InRay to the cube, or a negative value if it misses
+float IntersectCube(const Ray& InRay, const FTransform& Transform, const FCubeMesh& Mesh)
+{
+    // In the cube's own frame it is an axis-aligned box around the origin
+    const Matrix ToLocal = MatrixRotateY(-Transform.RotationDegrees * DEG2RAD);
+    const Ray LocalRay =
+    {
+        Vector3Transform(Vector3Subtract(InRay.position, Transform.Position), ToLocal),
+        Vector3Transform(InRay.direction, ToLocal)
+    };
+    const raylib::Vector3 Half = Mesh.Size * Transform.Scale * 0.5f;
+    const RayCollision Hit = GetRayCollisionBox(LocalRay, { Vector3Negate(Half), Half });
+    return Hit.hit ? Hit.distance : -1.0f;
+}
+
+class FSpinSystem : public Core::FSystem
+{
+public:
+    FSpinSystem()
+        : Core::FSystem("Spin")
+    {
+        Reads<FSpin>();
+        Writes<FTransform>();
+    }
+
+    void OnUpdate(Core::FSystemContext& Context) override
+    {
+        Query.ParallelEach(Context.World, Context.JobSystem, [DeltaTime = Context.DeltaTime](FTransform& Transform, const FSpin& Spin)
+        {
+            Transform.RotationDegrees = std::fmod(Transform.RotationDegrees + Spin.DegreesPerSecond * DeltaTime, 360.0f);
+        });
+    }
+
+private:
+    Core::TQuery<FTransform, const FSpin> Query;
+};
+
+class FBobSystem : public Core::FSystem
+{
+public:
+    FBobSystem()
+        : Core::FSystem("Bob")
+    {
+        Reads<FBob>();
+        Writes<FTransform>();
+    }
+
+    void OnUpdate(Core::FSystemContext& Context) override
+    {
+        Time += Context.DeltaTime;
+        Query.ParallelEach(Context.World, Context.JobSystem, [Time = Time](FTransform& Transform, const FBob& Bob)
+        {
+            Transform.Position.y = Bob.BaseHeight + 0.1f * std::sin(2.0f * Time + Bob.Phase);
+        });
+    }
+
+private:
+    Core::TQuery<FTransform, const FBob> Query;
+    float Time = 0.0f;
+};
+
+// Scene settings edited by the UI and applied by OnUpdate
+struct FSceneSettings
+{
+    int ViewportWidth = 1280;
+    int ViewportHeight = 720;
+    bool bDrawWireframe = false;
+    bool bInstanced = true;
+    bool bFrustumCulling = true;
+    bool bSortQueue = true;
+    bool bShowBounds = false;
+    bool bInterpolateBall = true;
+    // Something spins or bobs, so OnDemand frames have to keep coming
+    bool bAnimating = true;
+    int FieldCubeCount = 0;
+    float CameraDistance = 6.9f;
+    raylib::Color BgColor = raylib::Color(25, 25, 25, 255);
+};
+
+// What the UI shows of the scene, captured at the end of OnUpdate
+struct FSceneReadout
+{
+    std::size_t EntityCount = 0;
+    FTransform CubeTransform;
+    bool bHasPicked = false;
+    Core::FEntity Picked;
+    raylib::Vector3 PickedPosition = raylib::Vector3(0.0f, 0.0f, 0.0f);
+
+    std::size_t DrawCalls = 0;
+    std::size_t Instances = 0;
+    Core::FRenderQueueStats QueueStats;
+    Core::FDebugDrawStats DebugStats;
+    std::size_t ProxyCount = 0;
+    int TreeHeight = 0;
+    Core::FSpatialQueryStats CullStats;
+
+    // The scene texture, zero until the first frame has been drawn
+    unsigned int SceneTexture = 0;
+    int SceneWidth = 0;
+    int SceneHeight = 0;
+    Vector2 SceneUVExtent = { 0.0f, 0.0f };
+};
 
 // The user application logic
 class FSandboxApp : public Core::FApplication
@@ -14,32 +188,61 @@ public:
               Core::FApplicationConfig
               {
                   .Name = "Raylib + ImGui Hybrid Engine",
-                  .Width = 1600, .Height = 900
+                  .Width = 1600, .Height = 900,
+                  // Deliberately slow so the interpolation between steps is visible
+                  .FixedUpdateRate = 20.0f,
+                  // Continuous by default; --power=on-demand idles while nothing moves
+                  .bConsolePanel = true,
+                  .bMemoryPanel = true
               }
           ) {}
 
     // Scene Resources
-    std::optional<raylib::RenderTexture2D> SceneTexture;
+    Core::FRenderTarget SceneTarget;
     std::optional<raylib::Model> CubeModel;
+    Core::Scope<Core::FInstancedRenderer> InstancedRenderer;
 
     // Scene State
     raylib::Camera3D Camera;
-    int ViewportWidth = 0;
-    int ViewportHeight = 0;
-
-    // Sync UI to Render
-    int DesiredViewportWidth = 1280;
-    int DesiredViewportHeight = 720;
+    Core::FECSLayer* Scene = nullptr;
+    Core::FEntity Cube;
+    std::vector<Core::FEntity> FieldCubes;
+
+    // Culling and picking
+    Core::FSpatialIndex SpatialIndex;
+    Core::TQuery<const FTransform, const FCubeMesh, FSpatialProxy> MovingProxies;
+    Core::FSpatialQueryStats CullStats;
+    Core::TQuery<const FTransform, const FCubeMesh> CubeBounds;
+    Core::FEntity Picked;
+
+    // Fixed-step ball. Ball is owned by the simulation thread; rendering reads the snapshots
+    static constexpr float BallRadius = 0.25f;
+    FBallState Ball;
+    Core::TSnapshotBuffer<FBallState> BallSnapshots;
+    std::atomic<bool> bDropBall{ false };
+
+    // Sync UI and Render. With pipelined frames OnUIRender runs on the UI logic thread beside
+    // OnUpdate, so the two only meet here, under HandoffMutex: the UI publishes its settings, a
+    // pick and its scene edits, and OnUpdate applies them and publishes what the UI shows.
+    std::mutex HandoffMutex;
+    FSceneSettings SharedSettings;
+    // Viewport pixel clicked, picked against the scene on the next update
+    std::optional<raylib::Vector2> SharedPickRequest;
+    // Structural and value changes to the world, played back before the systems next run
+    Core::FCommandBuffer SceneCommands;
+    FSceneReadout SharedReadout;
+
+    // Render thread copy of the settings
+    FSceneSettings FrameSettings;
+    raylib::Color GridColor = raylib::Color(60, 60, 60, 255);
 
-    float CubeRotation = 0.0f;
-    float RotationSpeed = 1.0f;
-    bool bDrawWireframe = false;
+    // UI thread state
+    FSceneSettings Settings;
+    FSceneReadout Readout;
+    // Kept while auto-rotate is off so the speed survives the toggle
+    float SpinSpeed = 45.0f;
     bool bAutoRotate = true;
-
-    // Visual Settings
-    raylib::Color BgColor = raylib::Color(25, 25, 25, 255);
-    raylib::Color CubeColor = raylib::Color(230, 41, 55, 255);
-    raylib::Color GridColor = raylib::Color(60, 60, 60, 255);
+    raylib::Color CubeColor = FCubeMesh{}.Color;
 
     void OnStart() override
     {
@@ -50,101 +253,362 @@ public:
         Camera.fovy = 45.0f;
         Camera.projection = CAMERA_PERSPECTIVE;
 
-        // Initialize Render Texture
-        ViewportWidth = DesiredViewportWidth;
-        ViewportHeight = DesiredViewportHeight;
-        SceneTexture.emplace(ViewportWidth, ViewportHeight);
-
         // Load a Unit Cube Model
         Mesh CubeMesh = GenMeshCube(1.5f, 1.5f, 1.5f);
         CubeModel.emplace(CubeMesh);
+        InstancedRenderer = Core::CreateScope<Core::FInstancedRenderer>();
+
+        // Scene Entities
+        Scene = new Core::FECSLayer(GetJobSystem(), "Scene");
+        PushLayer(Scene);
+        Scene->AddSystem<FSpinSystem>();
+        Scene->AddSystem<FBobSystem>();
+        MovingProxies.With<FBob>();
+
+        Cube = Scene->GetWorld().CreateEntity
+        (
+            FTransform{ .Position = raylib::Vector3(0.0f, 0.5f, 0.0f) },
+            FSpin{ .DegreesPerSecond = SpinSpeed },
+            FCubeMesh{},
+            FSpatialProxy{}
+        );
+        AddProxy(Cube, Core::ESpatialMobility::Static);
+        SpatialIndex.Rebuild();
+
+        // Scene presets for headless benchmark runs: --cubes=N fills the cube field, --bounds draws the proxies
+        for (int i = 1; i < GetArgCount(); i++)
+        {
+            const std::string_view Arg = GetArgs()[i];
+            if (Arg.starts_with("--cubes="))
+                Settings.FieldCubeCount = std::clamp(std::atoi(GetArgs()[i] + 8), 0, 1000000);
+            else if (Arg == "--bounds")
+                Settings.bShowBounds = true;
+        }
+        UpdateAnimating();
+        SharedSettings = Settings;
+        FrameSettings = Settings;
     }
 
-    void OnUpdate(float DeltaTime) override
+    [[nodiscard]] bool SupportsPipelinedUI() const override { return true; }
+
+    // UI thread. The main cube spins while auto-rotate is on, and every field cube spins.
+    void UpdateAnimating()
     {
-        // --- Resource Management (Pre-Render) ---
-        if
-        (
-            DesiredViewportWidth > 0 && DesiredViewportHeight > 0 &&
-           (
-               DesiredViewportWidth != ViewportWidth ||
-               DesiredViewportHeight != ViewportHeight
-           )
-        )
+        Settings.bAnimating = (bAutoRotate && SpinSpeed != 0.0f) || Settings.FieldCubeCount > 0;
+    }
+
+    void AddProxy(Core::FEntity Entity, Core::ESpatialMobility Mobility)
+    {
+        Core::FWorld& World = Scene->GetWorld();
+        const FTransform& Transform = World.GetComponent<FTransform>(Entity);
+        FSpatialProxy& Proxy = World.GetComponent<FSpatialProxy>(Entity);
+        Proxy.Id = SpatialIndex.CreateProxy(GetCubeBounds(Transform, World.GetComponent<FCubeMesh>(Entity)), std::bit_cast<std::uint64_t>(Entity), Mobility);
+        Proxy.LastPosition = Transform.Position;
+    }
+
+    // Grows or shrinks a grid of small spinning cubes around the main one to the field size setting.
+    // Every twentieth cube also bobs, and is the only kind that moves through the spatial index.
+    void UpdateCubeField()
+    {
+        Core::FWorld& World = Scene->GetWorld();
+        const std::size_t Target = static_cast<std::size_t>(FrameSettings.FieldCubeCount);
+        if (FieldCubes.size() == Target)
+            return;
+
+        while (FieldCubes.size() > Target)
         {
-            ViewportWidth = DesiredViewportWidth;
-            ViewportHeight = DesiredViewportHeight;
-            SceneTexture.emplace(ViewportWidth, ViewportHeight);
+            SpatialIndex.DestroyProxy(World.GetComponent<FSpatialProxy>(FieldCubes.back()).Id);
+            World.DestroyEntity(FieldCubes.back());
+            FieldCubes.pop_back();
         }
 
-        // --- Update Logic ---
-        if (bAutoRotate)
+        if (FieldCubes.size() < Target)
         {
-            CubeRotation += (45.0f * DeltaTime * RotationSpeed);
-            if (CubeRotation > 360.0f) CubeRotation -= 360.0f;
+            constexpr float Spacing = 0.3f;
+            const int Side = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(Target))));
+            const float Offset = (Side - 1) * Spacing * 0.5f;
+
+            FieldCubes.reserve(Target);
+            for (std::size_t i = FieldCubes.size(); i < Target; ++i)
+            {
+                const int X = static_cast<int>(i) % Side;
+                const int Z = static_cast<int>(i) / Side;
+                const raylib::Color Color = ColorFromHSV(360.0f * X / Side, 0.6f, 0.4f + 0.6f * Z / Side);
+
+                const Core::FEntity Entity = World.CreateEntity
+                (
+                    FTransform{ .Position = raylib::Vector3(X * Spacing - Offset, -0.1f, Z * Spacing - Offset) },
+                    FSpin{ .DegreesPerSecond = 20.0f + static_cast<float>(i % 7) * 15.0f },
+                    FCubeMesh{ .Size = raylib::Vector3(0.15f, 0.15f, 0.15f), .Color = Color },
+                    FSpatialProxy{}
+                );
+
+                if (i % 20 == 0)
+                {
+                    World.AddComponent<FBob>(Entity, -0.1f, static_cast<float>(X + Z) * 0.5f);
+                    AddProxy(Entity, Core::ESpatialMobility::Movable);
+                }
+                else
+                {
+                    AddProxy(Entity, Core::ESpatialMobility::Static);
+                }
+                FieldCubes.push_back(Entity);
+            }
         }
 
-        // --- Render Scene to Texture ---
-        if (SceneTexture.has_value() && SceneTexture->IsValid())
+        // Lay the trees out again for the new contents
+        SpatialIndex.Rebuild();
+    }
+
+    // Simulation thread
+    void OnFixedUpdate(float FixedDeltaTime) override
+    {
+        if (bDropBall.exchange(false, std::memory_order_relaxed))
+            Ball = FBallState{};
+
+        if (!Ball.bResting)
         {
-            SceneTexture->BeginMode();
-            BgColor.ClearBackground();
+            constexpr float Gravity = -9.81f;
+            constexpr float Restitution = 0.7f;
+            constexpr float Walls = 3.0f;
 
-            Camera.BeginMode();
+            Ball.Velocity.y += Gravity * FixedDeltaTime;
+            Ball.Position += Ball.Velocity * FixedDeltaTime;
 
-                // Draw Grid
-                DrawGrid(10, 1.0f);
+            if (std::abs(Ball.Position.x) > Walls)
+            {
+                Ball.Position.x = std::copysign(Walls, Ball.Position.x);
+                Ball.Velocity.x = -Ball.Velocity.x;
+            }
 
-                // Draw Axes
-                DrawLine3D({0,0,0}, {1,0,0}, RED);
-                DrawLine3D({0,0,0}, {0,1,0}, GREEN);
-                DrawLine3D({0,0,0}, {0,0,1}, BLUE);
+            if (Ball.Position.y < BallRadius)
+            {
+                Ball.Position.y = BallRadius;
+                Ball.Velocity.y = -Ball.Velocity.y * Restitution;
+                Ball.Velocity.x *= Restitution;
+
+                // Too slow to leave the ground again within a step
+                if (Ball.Velocity.y < -Gravity * FixedDeltaTime)
+                {
+                    Ball.Velocity = raylib::Vector3(0.0f, 0.0f, 0.0f);
+                    Ball.bResting = true;
+                }
+            }
 
-                // Draw Rotating Cube
-                raylib::Vector3 CubePos(0.0f, 0.5f, 0.0f);
-                raylib::Vector3 CubeSize(1.5f, 1.5f, 1.5f);
+            RequestRedraw();
+        }
 
-                #ifdef CORE_PLATFORM_WEB
-                    // WebAssembly: Use raw Raylib C functions
-                    rlPushMatrix();
-                    rlTranslatef(CubePos.x, CubePos.y, CubePos.z);
-                    rlRotatef(CubeRotation, 0, 1, 0);
-                    rlTranslatef(-CubePos.x, -CubePos.y, -CubePos.z);
+        BallSnapshots.Publish(Ball, FixedDeltaTime);
+    }
 
-                    if (bDrawWireframe)
-                    {
-                        DrawCubeWiresV(CubePos, CubeSize, CubeColor);
-                    }
-                    else
-                    {
-                        DrawCubeV(CubePos, CubeSize, CubeColor);
-                        DrawCubeWiresV(CubePos, CubeSize, BLACK);
-                    }
+    void OnUpdate(float DeltaTime) override
+    {
+        Core::FWorld& World = Scene->GetWorld();
+
+        // --- Take the UI's changes ---
+        std::optional<raylib::Vector2> PickRequest;
+        {
+            std::lock_guard<std::mutex> Lock(HandoffMutex);
+            FrameSettings = SharedSettings;
+            PickRequest = std::exchange(SharedPickRequest, std::nullopt);
+            SceneCommands.Playback(World);
+        }
+        GetRenderQueue().SetSortEnabled(FrameSettings.bSortQueue);
 
-                    rlPopMatrix();
-                #else
-                    // Desktop: Use raylib-cpp wrapper
-                    const raylib::Vector3 RotationAxis(0.0f, 1.0f, 0.0f);
-                    const raylib::Vector3 Scale(1.0f, 1.0f, 1.0f);
+        // --- Resource Management (Pre-Render) ---
+        // Resizing within the pooled allocation only changes the rectangle drawn into
+        if (FrameSettings.ViewportWidth > 0 && FrameSettings.ViewportHeight > 0)
+        {
+            GetRenderTargetPool().Request(SceneTarget, { .Width = FrameSettings.ViewportWidth, .Height = FrameSettings.ViewportHeight });
+        }
 
-                    if (bDrawWireframe)
-                    {
-                        CubeModel->DrawWires(CubePos, RotationAxis, CubeRotation, Scale, CubeColor);
-                    }
-                    else
+        // --- Update Logic ---
+        UpdateCubeField();
+        Camera.position = Vector3Scale(Vector3Normalize(Camera.position), FrameSettings.CameraDistance);
+
+        MovingProxies.Each(World, [this](const FTransform& Transform, const FCubeMesh& Mesh, FSpatialProxy& Proxy)
+        {
+            SpatialIndex.MoveProxy(Proxy.Id, GetCubeBounds(Transform, Mesh), Transform.Position - Proxy.LastPosition);
+            Proxy.LastPosition = Transform.Position;
+        });
+
+        if (PickRequest && SceneTarget.IsValid())
+        {
+            const Ray PickRay = GetScreenToWorldRayEx(*PickRequest, Camera, SceneTarget.GetWidth(), SceneTarget.GetHeight());
+            const Core::FRayHit Hit = SpatialIndex.Raycast(PickRay, static_cast<float>(rlGetCullDistanceFar()), [&](Core::FProxyId, std::uint64_t UserData)
+            {
+                const Core::FEntity Entity = std::bit_cast<Core::FEntity>(UserData);
+                return IntersectCube(PickRay, World.GetComponent<FTransform>(Entity), World.GetComponent<FCubeMesh>(Entity));
+            });
+            Picked = Hit.IsHit() ? std::bit_cast<Core::FEntity>(Hit.UserData) : Core::FEntity{};
+        }
+
+        // The window only idles while nothing spins
+        if (FrameSettings.bAnimating)
+            RequestRedraw();
+
+        // --- Render Scene to Texture ---
+        if (SceneTarget.IsValid())
+        {
+            Core::FRenderQueue& Queue = GetRenderQueue();
+            Queue.SetView(Camera);
+
+            // Draw Grid
+            Core::FDebugDraw::Grid(10, 1.0f, GridColor);
+
+            // Draw Axes
+            Core::FDebugDraw::Line({0,0,0}, {1,0,0}, RED);
+            Core::FDebugDraw::Line({0,0,0}, {0,1,0}, GREEN);
+            Core::FDebugDraw::Line({0,0,0}, {0,0,1}, BLUE);
+
+            // The ball, drawn between its last two fixed steps. Frames keep coming until it has
+            // come to rest and been drawn there
+            const Core::TSnapshotBuffer<FBallState>::FView BallView = BallSnapshots.Read();
+            const raylib::Vector3 BallPosition = FrameSettings.bInterpolateBall ? BallView.Previous.Position.Lerp(BallView.Current.Position, BallView.Alpha) : BallView.Current.Position;
+            Core::FDebugDraw::Sphere(BallPosition, BallRadius, ORANGE);
+            if (!BallView.Current.bResting || BallView.Alpha < 1.0f)
+                RequestRedraw();
+
+            // Bounds of every cube, recorded from the job workers
+            if (FrameSettings.bShowBounds)
+            {
+                CubeBounds.ParallelEach(World, GetJobSystem(), [](const FTransform& Transform, const FCubeMesh& Mesh)
+                {
+                    Core::FDebugDraw::Box(GetCubeBounds(Transform, Mesh), LIME);
+                });
+            }
+
+            // Draw Cubes, only those in view when culling
+            const Core::FFrustum Frustum = Core::FFrustum::FromCamera(Camera, static_cast<float>(SceneTarget.GetWidth()) / static_cast<float>(SceneTarget.GetHeight()));
+            const auto ForEachVisibleCube = [&](auto&& Draw)
+            {
+                if (!FrameSettings.bFrustumCulling)
+                {
+                    World.Each<const FTransform, const FCubeMesh>(Draw);
+                    CullStats = {};
+                    return;
+                }
+
+                // The traversal stacks are thrown away with the frame
+                SpatialIndex.ForEachInFrustum(Frustum, [&](std::span<const std::uint64_t> Run)
+                {
+                    for (const std::uint64_t UserData : Run)
                     {
-                        CubeModel->Draw(CubePos, RotationAxis, CubeRotation, Scale, CubeColor);
-                        CubeModel->DrawWires(CubePos, RotationAxis, CubeRotation, Scale, BLACK);
+                        const Core::FEntity Entity = std::bit_cast<Core::FEntity>(UserData);
+                        Draw(World.GetComponent<FTransform>(Entity), World.GetComponent<FCubeMesh>(Entity));
                     }
-                #endif
+                }, &CullStats, GetFrameAllocator().GetResource());
+            };
+
+            if (FrameSettings.bInstanced)
+            {
+                // The model is a 1.5 unit cube
+                Core::FInstanceBatch& Batch = InstancedRenderer->GetBatch(CubeModel->meshes[0], CubeModel->materials[0]);
+                ForEachVisibleCube([&Batch](const FTransform& Transform, const FCubeMesh& Mesh)
+                {
+                    Batch.Add(Transform.Position, Transform.RotationDegrees, Mesh.Size / 1.5f * Transform.Scale, Mesh.Color);
+                });
+
+                Queue.AddCallback([this]()
+                {
+                    InstancedRenderer->SetWireframe(FrameSettings.bDrawWireframe);
+                    InstancedRenderer->Flush();
+                });
+            }
+            else
+            {
+                // One draw per object (two with outlines)
+                ForEachVisibleCube([this, &Queue](const FTransform& Transform, const FCubeMesh& Mesh)
+                {
+                    #ifdef CORE_PLATFORM_WEB
+                        // WebAssembly: immediate-mode cubes, batched by rlgl
+                        const raylib::Vector3 Size = Mesh.Size * Transform.Scale;
+
+                        if (FrameSettings.bDrawWireframe)
+                        {
+                            Queue.DrawCubeWires(Transform.Position, Size, Transform.RotationDegrees, Mesh.Color);
+                        }
+                        else
+                        {
+                            Queue.DrawCube(Transform.Position, Size, Transform.RotationDegrees, Mesh.Color);
+                            Queue.DrawCubeWires(Transform.Position, Size, Transform.RotationDegrees, BLACK);
+                        }
+                    #else
+                        // Desktop: the cube model. The model is a 1.5 unit cube
+                        const raylib::Vector3 RotationAxis(0.0f, 1.0f, 0.0f);
+                        const raylib::Vector3 Scale = Mesh.Size / 1.5f * Transform.Scale;
+
+                        if (FrameSettings.bDrawWireframe)
+                        {
+                            Queue.DrawModelWires(*CubeModel, Transform.Position, RotationAxis, Transform.RotationDegrees, Scale, Mesh.Color);
+                        }
+                        else
+                        {
+                            Queue.DrawModel(*CubeModel, Transform.Position, RotationAxis, Transform.RotationDegrees, Scale, Mesh.Color);
+                            Queue.DrawModelWires(*CubeModel, Transform.Position, RotationAxis, Transform.RotationDegrees, Scale, BLACK);
+                        }
+                    #endif
+                });
+            }
 
+            // Outline and label the picked cube
+            if (World.IsAlive(Picked))
+            {
+                const BoundingBox Bounds = GetCubeBounds(World.GetComponent<FTransform>(Picked), World.GetComponent<FCubeMesh>(Picked));
+                char Label[32];
+                std::snprintf(Label, sizeof(Label), "Entity %u", Picked.Index);
+                Core::FDebugDraw::Box(Bounds, YELLOW, Core::EDebugDepth::Overlay);
+                Core::FDebugDraw::Text({ Bounds.min.x, Bounds.max.y + 0.1f, Bounds.min.z }, Label, 0.15f, YELLOW, Core::EDebugDepth::Overlay);
+            }
+
+            // raylib batches draws until EndTextureMode, so the pass has to cover the whole block
+            CORE_PROFILE_GPU_SCOPE("Scene");
+            BeginTextureMode(SceneTarget.GetRenderTexture());
+            FrameSettings.BgColor.ClearBackground();
+
+            Camera.BeginMode();
+                Queue.Execute();
+                Core::FDebugDraw::Flush();
             Camera.EndMode();
-            SceneTexture->EndMode();
+            EndTextureMode();
         }
+
+        // --- Publish for the UI ---
+        FSceneReadout Snapshot;
+        Snapshot.EntityCount = World.GetEntityCount();
+        Snapshot.CubeTransform = World.GetComponent<FTransform>(Cube);
+        if (World.IsAlive(Picked))
+        {
+            Snapshot.bHasPicked = true;
+            Snapshot.Picked = Picked;
+            Snapshot.PickedPosition = World.GetComponent<FTransform>(Picked).Position;
+        }
+        Snapshot.DrawCalls = InstancedRenderer->GetDrawCallCount();
+        Snapshot.Instances = InstancedRenderer->GetInstanceCount();
+        Snapshot.QueueStats = GetRenderQueue().GetStats();
+        Snapshot.DebugStats = Core::FDebugDraw::GetStats();
+        Snapshot.ProxyCount = SpatialIndex.GetProxyCount();
+        Snapshot.TreeHeight = SpatialIndex.GetHeight();
+        Snapshot.CullStats = CullStats;
+        if (SceneTarget.IsValid())
+        {
+            Snapshot.SceneTexture = SceneTarget.GetTexture().id;
+            Snapshot.SceneWidth = SceneTarget.GetWidth();
+            Snapshot.SceneHeight = SceneTarget.GetHeight();
+            Snapshot.SceneUVExtent = SceneTarget.GetUVExtent();
+        }
+
+        std::lock_guard<std::mutex> Lock(HandoffMutex);
+        SharedReadout = Snapshot;
     }
 
     void OnUIRender() override
     {
+        {
+            std::lock_guard<std::mutex> Lock(HandoffMutex);
+            Readout = SharedReadout;
+        }
+
         // --- DockSpace ---
         ImGuiID DockSpaceId = ImGui::GetID("MyDockSpace");
         ImGui::DockSpaceOverViewport
@@ -154,6 +618,13 @@ public:
             ImGuiDockNodeFlags_PassthruCentralNode
         );
 
+        // Edits to the world are recorded for the next update to play back
+        const auto EditScene = [this](auto&& Record)
+        {
+            std::lock_guard<std::mutex> Lock(HandoffMutex);
+            Record(SceneCommands);
+        };
+
         // --- Settings Panel ---
         ImGui::Begin("Settings");
 
@@ -163,16 +634,61 @@ public:
         ImGui::Separator();
 
         ImGui::TextDisabled("Scene Control");
-        ImGui::Checkbox("Auto Rotate", &bAutoRotate);
+        ImGui::Text("Entities: %zu", Readout.EntityCount);
+        if (ImGui::Checkbox("Auto Rotate", &bAutoRotate))
+        {
+            // Spinning is just the presence of the component
+            EditScene([this](Core::FCommandBuffer& Commands)
+            {
+                if (bAutoRotate)
+                    Commands.AddComponent<FSpin>(Cube, SpinSpeed);
+                else
+                    Commands.RemoveComponent<FSpin>(Cube);
+            });
+        }
         if (bAutoRotate)
         {
-             ImGui::SliderFloat("Speed", &RotationSpeed, 0.0f, 5.0f);
+             if (ImGui::SliderFloat("Speed", &SpinSpeed, 0.0f, 225.0f, "%.0f deg/s"))
+                 EditScene([this](Core::FCommandBuffer& Commands) { Commands.AddComponent<FSpin>(Cube, SpinSpeed); });
         }
         else
         {
-             ImGui::SliderFloat("Rotation", &CubeRotation, 0.0f, 360.0f);
+             FTransform Transform = Readout.CubeTransform;
+             if (ImGui::SliderFloat("Rotation", &Transform.RotationDegrees, 0.0f, 360.0f))
+                 EditScene([&](Core::FCommandBuffer& Commands) { Commands.AddComponent<FTransform>(Cube, Transform); });
+        }
+        ImGui::Checkbox("Wireframe Mode", &Settings.bDrawWireframe);
+        if (ImGui::Button("Drop Ball"))
+            bDropBall.store(true, std::memory_order_relaxed);
+        ImGui::SameLine();
+        ImGui::Checkbox("Interpolate", &Settings.bInterpolateBall);
+        ImGui::SliderFloat("Camera Distance", &Settings.CameraDistance, 2.0f, 120.0f);
+
+        ImGui::Separator();
+        ImGui::TextDisabled("Cube Field");
+        ImGui::SliderInt("Cubes", &Settings.FieldCubeCount, 0, 1000000, "%d", ImGuiSliderFlags_Logarithmic);
+        ImGui::Checkbox("Instanced", &Settings.bInstanced);
+        if (Settings.bInstanced)
+        {
+            ImGui::Text("Draw Calls: %zu (%zu instances)", Readout.DrawCalls, Readout.Instances);
+        }
+        ImGui::Checkbox("Frustum Culling", &Settings.bFrustumCulling);
+        ImGui::Checkbox("Sort Render Queue", &Settings.bSortQueue);
+        const Core::FRenderQueueStats& QueueStats = Readout.QueueStats;
+        ImGui::Text("Queue: %u commands, %u draw calls", QueueStats.Commands, QueueStats.DrawCalls);
+        ImGui::Text("Batch Flushes: %u, State Changes: %u", QueueStats.BatchFlushes, QueueStats.StateChanges);
+        ImGui::Checkbox("Show Bounds", &Settings.bShowBounds);
+        ImGui::Text("Debug Draw: %u lines, %u draw calls", Readout.DebugStats.Lines, Readout.DebugStats.DrawCalls);
+        ImGui::Text("BVH: %zu proxies, height %d", Readout.ProxyCount, Readout.TreeHeight);
+        if (Readout.bHasPicked)
+        {
+            const raylib::Vector3& Position = Readout.PickedPosition;
+            ImGui::Text("Picked: entity %u at (%.2f, %.2f, %.2f)", Readout.Picked.Index, Position.x, Position.y, Position.z);
+        }
+        else
+        {
+            ImGui::TextDisabled("Click a cube in the viewport to pick it");
         }
-        ImGui::Checkbox("Wireframe Mode", &bDrawWireframe);
 
         ImGui::Separator();
         ImGui::TextDisabled("Colors");
@@ -186,11 +702,14 @@ public:
                 C.g = static_cast<unsigned char>(Col[1] * 255);
                 C.b = static_cast<unsigned char>(Col[2] * 255);
                 C.a = static_cast<unsigned char>(Col[3] * 255);
+                return true;
             }
+            return false;
         };
 
-        EditColor("Cube Color", CubeColor);
-        EditColor("Background", BgColor);
+        if (EditColor("Cube Color", CubeColor))
+            EditScene([this](Core::FCommandBuffer& Commands) { Commands.AddComponent<FCubeMesh>(Cube, FCubeMesh{ .Color = CubeColor }); });
+        EditColor("Background", Settings.BgColor);
 
         ImGui::End();
 
@@ -200,35 +719,67 @@ public:
 
         // Read available size
         ImVec2 ViewportPanelSize = ImGui::GetContentRegionAvail();
-        DesiredViewportWidth = static_cast<int>(ViewportPanelSize.x);
-        DesiredViewportHeight = static_cast<int>(ViewportPanelSize.y);
+        Settings.ViewportWidth = static_cast<int>(ViewportPanelSize.x);
+        Settings.ViewportHeight = static_cast<int>(ViewportPanelSize.y);
 
         // Draw the texture
-        if (SceneTexture.has_value() && SceneTexture->IsValid())
+        std::optional<raylib::Vector2> PickRequest;
+        if (Readout.SceneTexture != 0)
         {
-            // We flip the UVs (0,1) to (1,0) because Raylib renders upside down relative to ImGui/OpenGL coordinates
-            ImTextureID TexID = (ImTextureID)(intptr_t)SceneTexture->GetTexture().id;
+            // The scene covers the bottom-left UVExtent of a possibly larger texture. The V range is
+            // flipped because Raylib renders upside down relative to ImGui/OpenGL coordinates
+            ImTextureID TexID = (ImTextureID)(intptr_t)Readout.SceneTexture;
+            const Vector2 UVExtent = Readout.SceneUVExtent;
             ImGui::Image
             (
                 TexID,
                 ImVec2
                 (
-                    static_cast<float>(ViewportWidth),
-                    static_cast<float>(ViewportHeight)
+                    static_cast<float>(Readout.SceneWidth),
+                    static_cast<float>(Readout.SceneHeight)
                 ),
-                ImVec2(0, 1),
-                ImVec2(1, 0)
+                ImVec2(0, UVExtent.y),
+                ImVec2(UVExtent.x, 0)
             );
+
+            const ImVec2 ImageMin = ImGui::GetItemRectMin();
+            if (ImGui::IsItemClicked(ImGuiMouseButton_Left))
+            {
+                const ImVec2 Mouse = ImGui::GetMousePos();
+                PickRequest = raylib::Vector2(Mouse.x - ImageMin.x, Mouse.y - ImageMin.y);
+            }
+
+            // Culling stats over the top-left corner of the scene
+            if (Settings.bFrustumCulling)
+            {
+                const Core::FSpatialQueryStats& CullStats = Readout.CullStats;
+                char Stats[128];
+                std::snprintf(Stats, sizeof(Stats), "Visited %u  Culled %u  Drawn %u", CullStats.Visited, CullStats.Culled, CullStats.Drawn);
+
+                const ImVec2 TextPos(ImageMin.x + 8.0f, ImageMin.y + 8.0f);
+                const ImVec2 TextSize = ImGui::CalcTextSize(Stats);
+                ImDrawList* DrawList = ImGui::GetWindowDrawList();
+                DrawList->AddRectFilled(ImVec2(TextPos.x - 4.0f, TextPos.y - 2.0f), ImVec2(TextPos.x + TextSize.x + 4.0f, TextPos.y + TextSize.y + 2.0f), IM_COL32(0, 0, 0, 160), 3.0f);
+                DrawList->AddText(TextPos, IM_COL32(255, 255, 255, 255), Stats);
+            }
         }
 
         ImGui::End();
         ImGui::PopStyleVar();
+
+        // --- Publish for the next update ---
+        UpdateAnimating();
+        std::lock_guard<std::mutex> Lock(HandoffMutex);
+        SharedSettings = Settings;
+        if (PickRequest)
+            SharedPickRequest = PickRequest;
     }
 
     void OnShutdown() override
     {
         // OpenGL context is still active on this thread!
-        SceneTexture.reset();
+        GetRenderTargetPool().Release(SceneTarget);
+        InstancedRenderer.reset();
         CubeModel.reset();
     }
 };